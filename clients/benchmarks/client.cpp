@@ -42,10 +42,17 @@
 #include "testing_gebsrmv.hpp"
 #include "testing_gemvi.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_spmv_batched.hpp"
+#include "testing_spmv_bsr.hpp"
 #include "testing_spmv_coo.hpp"
 #include "testing_spmv_coo_aos.hpp"
+#include "testing_spmv_csc.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spmv_ell.hpp"
+#include "testing_spmv_fused.hpp"
+#include "testing_spmv_mixed.hpp"
+#include "testing_spmv_csr16.hpp"
+#include "testing_spmv_sell.hpp"
 
 // Level3
 #include "testing_bsrmm.hpp"
@@ -54,7 +61,10 @@
 #include "testing_gebsrmm.hpp"
 #include "testing_gemmi.hpp"
 #include "testing_sddmm.hpp"
+#include "testing_spmm_bsr.hpp"
 #include "testing_spmm_coo.hpp"
+#include "testing_spmm_csc.hpp"
+#include "testing_spmm_sell.hpp"
 #include "testing_spmm_csr.hpp"
 
 // Extra
@@ -83,6 +93,8 @@
 #include "testing_csr2csr_compress.hpp"
 #include "testing_csr2dense.hpp"
 #include "testing_csr2ell.hpp"
+#include "testing_csr2csr16.hpp"
+#include "testing_csr2sell.hpp"
 #include "testing_csr2gebsr.hpp"
 #include "testing_csr2hyb.hpp"
 #include "testing_csrsort.hpp"
@@ -103,6 +115,7 @@
 #include "testing_prune_csr2csr_by_percentage.hpp"
 #include "testing_prune_dense2csr.hpp"
 #include "testing_prune_dense2csr_by_percentage.hpp"
+#include "testing_sparse_to_dense_bsr.hpp"
 #include "testing_sparse_to_dense_coo.hpp"
 #include "testing_sparse_to_dense_csc.hpp"
 #include "testing_sparse_to_dense_csr.hpp"
@@ -110,1498 +123,2142 @@
 // Reordering
 #include "testing_csrcolor.hpp"
 
+// Autotuning
+#include "testing_spmm_autotune.hpp"
+#include "testing_spmv_autotune.hpp"
+
+// A/B comparison
+#include "testing_spmm_ab.hpp"
+#include "testing_spmv_ab.hpp"
+
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <rocsparse.h>
 #include <unordered_set>
 
 #include "program_options.hpp"
-
-int main(int argc, char* argv[])
+#include "rocsparse_ab.hpp"
+#include "rocsparse_autotune.hpp"
+#include "rocsparse_footprint.hpp"
+#include "rocsparse_roofline.hpp"
+#include "rocsparse_sweep.hpp"
+
+static int rocsparse_bench_run(const std::string& function,
+                               char               precision,
+                               char               indextype,
+                               const Arguments&   arg)
 {
-    Arguments arg;
-    arg.unit_check          = 0;
-    arg.timing              = 1;
-    arg.alphai              = 0.0;
-    arg.betai               = 0.0;
-    arg.threshold           = 0.0;
-    arg.percentage          = 0.0;
-    arg.sddmm_alg           = rocsparse_sddmm_alg_default;
-    arg.spmv_alg            = rocsparse_spmv_alg_default;
-    arg.spmm_alg            = rocsparse_spmm_alg_default;
-    arg.spgemm_alg          = rocsparse_spgemm_alg_default;
-    arg.sparse_to_dense_alg = rocsparse_sparse_to_dense_alg_default;
-    arg.dense_to_sparse_alg = rocsparse_dense_to_sparse_alg_default;
-
-    std::string   function;
-    std::string   filename;
-    std::string   rocalution;
-    char          indextype = 's';
-    char          precision = 's';
-    char          transA;
-    char          transB;
-    int           baseA;
-    int           baseB;
-    int           baseC;
-    int           baseD;
-    int           action;
-    int           part;
-    char          diag;
-    char          uplo;
-    char          apol;
-    rocsparse_int dir;
-    rocsparse_int order;
-    rocsparse_int format;
-
-    rocsparse_int device_id;
-
-    // clang-format off
-
-    options_description desc("rocsparse client command line options");
-    desc.add_options() ("help,h", "produces this help message")
-        // clang-format off
-        ("sizem,m",
-        value<rocsparse_int>(&arg.M)->default_value(128),
-        "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
-        "& SPARSE-3: the number of rows.")
-
-        ("sizen,n",
-        value<rocsparse_int>(&arg.N)->default_value(128),
-        "Specific matrix/vector size testing: SPARSE-1: the length of the "
-        "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
-
-        ("sizek,k",
-        value<rocsparse_int>(&arg.K)->default_value(128),
-        "Specific matrix/vector size testing: SPARSE-3: the number of columns")
-
-        ("sizennz,z",
-        value<rocsparse_int>(&arg.nnz)->default_value(32),
-        "Specific vector size testing, LEVEL-1: the number of non-zero elements "
-        "of the sparse vector.")
-
-        ("blockdim",
-        value<rocsparse_int>(&arg.block_dim)->default_value(2),
-        "BSR block dimension (default: 2)")
-
-        ("row-blockdimA",
-        value<rocsparse_int>(&arg.row_block_dimA)->default_value(2),
-        "General BSR row block dimension (default: 2)")
-
-        ("col-blockdimA",
-        value<rocsparse_int>(&arg.col_block_dimA)->default_value(2),
-        "General BSR col block dimension (default: 2)")
-
-        ("row-blockdimB",
-        value<rocsparse_int>(&arg.row_block_dimB)->default_value(2),
-        "General BSR row block dimension (default: 2)")
-
-        ("col-blockdimB",
-        value<rocsparse_int>(&arg.col_block_dimB)->default_value(2),
-        "General BSR col block dimension (default: 2)")
-
-        ("mtx",
-        value<std::string>(&filename)->default_value(""), "read from matrix "
-        "market (.mtx) format. This will override parameters -m, -n, and -z.")
-
-        ("rocalution",
-        value<std::string>(&rocalution)->default_value(""),
-        "read from rocalution matrix binary file. This will override parameter --mtx")
-
-        ("dimx",
-        value<rocsparse_int>(&arg.dimx)->default_value(0.0), "assemble "
-        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
-        "will override parameters -m, -n, -z and --mtx.")
-
-        ("dimy",
-        value<rocsparse_int>(&arg.dimy)->default_value(0.0), "assemble "
-        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
-        "will override parameters -m, -n, -z and --mtx.")
-
-        ("dimz",
-        value<rocsparse_int>(&arg.dimz)->default_value(0.0), "assemble "
-        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
-        "will override parameters -m, -n, -z and --mtx.")
-
-        ("alpha",
-        value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
-
-        ("beta",
-        value<double>(&arg.beta)->default_value(0.0), "specifies the scalar beta")
-
-        ("threshold",
-        value<double>(&arg.threshold)->default_value(1.0), "specifies the scalar threshold")
-
-        ("percentage",
-        value<double>(&arg.percentage)->default_value(0.0), "specifies the scalar percentage")
-
-        ("transposeA",
-        value<char>(&transA)->default_value('N'),
-        "N = no transpose, T = transpose, C = conjugate transpose")
-
-        ("transposeB",
-        value<char>(&transB)->default_value('N'),
-        "N = no transpose, T = transpose, C = conjugate transpose, (default = N)")
-
-        ("indexbaseA",
-        value<int>(&baseA)->default_value(0),
-        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
-
-        ("indexbaseB",
-        value<int>(&baseB)->default_value(0),
-        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
-
-        ("indexbaseC",
-        value<int>(&baseC)->default_value(0),
-        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
-
-        ("indexbaseD",
-        value<int>(&baseD)->default_value(0),
-        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
-
-        ("action",
-        value<int>(&action)->default_value(0),
-        "0 = rocsparse_action_numeric, 1 = rocsparse_action_symbolic, (default: 0)")
-
-        ("hybpart",
-        value<int>(&part)->default_value(0),
-        "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
-        "2 = rocsparse_hyb_partition_max, (default: 0)")
-
-        ("diag",
-        value<char>(&diag)->default_value('N'),
-        "N = non-unit diagonal, U = unit diagonal, (default = N)")
-
-        ("uplo",
-        value<char>(&uplo)->default_value('L'),
-        "L = lower fill, U = upper fill, (default = L)")
-
-        ("apolicy",
-        value<char>(&apol)->default_value('R'),
-        "R = reuse meta data, F = force re-build, (default = R)")
-
-        ("function,f",
-        value<std::string>(&function)->default_value("axpyi"),
-        "SPARSE function to test. Options:\n"
-        "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-        "  Level2: bsrmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, ellmv, hybmv, gebsrmv, gemvi\n"
-        "  Level3: bsrmm, gebsrmm, csrmm, coomm, csrsm, gemmi, sddmm\n"
-        "  Extra: csrgeam, csrgemm\n"
-        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch\n"
-        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
-        "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
-        "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
-        "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
-        "  Sorting: cscsort, csrsort, coosort\n"
-        "  Misc: identity, nnz")
-
-        ("indextype",
-        value<char>(&indextype)->default_value('s'),
-        "Specify index types to be int32_t (s), int64_t (d) or mixed (m). Options: s,d,m")
-
-        ("precision,r",
-        value<char>(&precision)->default_value('s'), "Options: s,d,c,z")
-
-        ("verify,v",
-        value<rocsparse_int>(&arg.unit_check)->default_value(0),
-        "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
-
-        ("iters,i",
-        value<int>(&arg.iters)->default_value(10),
-        "Iterations to run inside timing loop")
-
-        ("device,d",
-        value<rocsparse_int>(&device_id)->default_value(0),
-        "Set default device to be used for subsequent program runs")
-
-        ("direction",
-        value<rocsparse_int>(&dir)->default_value(rocsparse_direction_row),
-        "Indicates whether a dense matrix should be parsed by rows or by columns, assuming column-major storage: row = 0, column = 1 (default: 0)")
-
-        ("order",
-        value<rocsparse_int>(&order)->default_value(rocsparse_order_column),
-        "Indicates whether a dense matrix is laid out in column-major storage: 1, or row-major storage 0 (default: 1)")
-
-        ("format",
-        value<rocsparse_int>(&format)->default_value(rocsparse_format_coo),
-        "Indicates wther a sparse matrix is laid out in coo format: 0, coo_aos format: 1, csr format: 2, csc format: 3 or ell format: 4 (default:0)")
-
-        ("denseld",
-        value<rocsparse_int>(&arg.denseld)->default_value(128),
-        "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage.");
-
-    // clang-format on
-
-    variables_map vm;
-    store(parse_command_line(argc, argv, desc), vm);
-    notify(vm);
-
-    if(vm.count("help"))
+    // Level1
+    if(function == "axpyi")
+    {
+        if(precision == 's')
+            testing_axpyi<float>(arg);
+        else if(precision == 'd')
+            testing_axpyi<double>(arg);
+        else if(precision == 'c')
+            testing_axpyi<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_axpyi<rocsparse_double_complex>(arg);
+    }
+    else if(function == "doti")
+    {
+        if(precision == 's')
+            testing_doti<float>(arg);
+        else if(precision == 'd')
+            testing_doti<double>(arg);
+        else if(precision == 'c')
+            testing_doti<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_doti<rocsparse_double_complex>(arg);
+    }
+    else if(function == "dotci")
+    {
+        if(precision == 's')
+            testing_doti<float>(arg);
+        else if(precision == 'd')
+            testing_doti<double>(arg);
+        else if(precision == 'c')
+            testing_dotci<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_dotci<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gthr")
+    {
+        if(precision == 's')
+            testing_gthr<float>(arg);
+        else if(precision == 'd')
+            testing_gthr<double>(arg);
+        else if(precision == 'c')
+            testing_gthr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gthr<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gthrz")
+    {
+        if(precision == 's')
+            testing_gthrz<float>(arg);
+        else if(precision == 'd')
+            testing_gthrz<double>(arg);
+        else if(precision == 'c')
+            testing_gthrz<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gthrz<rocsparse_double_complex>(arg);
+    }
+    else if(function == "roti")
+    {
+        if(precision == 's')
+            testing_roti<float>(arg);
+        else if(precision == 'd')
+            testing_roti<double>(arg);
+    }
+    else if(function == "sctr")
+    {
+        if(precision == 's')
+            testing_sctr<float>(arg);
+        else if(precision == 'd')
+            testing_sctr<double>(arg);
+        else if(precision == 'c')
+            testing_sctr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_sctr<rocsparse_double_complex>(arg);
+    }
+    else if(function == "bsrmv")
+    {
+        if(precision == 's')
+            testing_bsrmv<float>(arg);
+        else if(precision == 'd')
+            testing_bsrmv<double>(arg);
+        else if(precision == 'c')
+            testing_bsrmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrmv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "bsrsv")
+    {
+        if(precision == 's')
+            testing_bsrsv<float>(arg);
+        else if(precision == 'd')
+            testing_bsrsv<double>(arg);
+        else if(precision == 'c')
+            testing_bsrsv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrsv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "coomv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_coo<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_coo<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_coo<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_coo<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "coomv_aos")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_coo_aos<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo_aos<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_coo_aos<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo_aos<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_coo_aos<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo_aos<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_coo_aos<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_coo_aos<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "csrmv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_csr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_csr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "cscmv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "csrmv_managed")
+    {
+        if(precision == 's')
+            testing_csrmv_managed<float>(arg);
+        else if(precision == 'd')
+            testing_csrmv_managed<double>(arg);
+        else if(precision == 'c')
+            testing_csrmv_managed<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmv_managed<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrsv")
+    {
+        if(precision == 's')
+            testing_csrsv<float>(arg);
+        else if(precision == 'd')
+            testing_csrsv<double>(arg);
+        else if(precision == 'c')
+            testing_csrsv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "ellmv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_ell<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_ell<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_ell<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_ell<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_ell<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_ell<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_ell<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_ell<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "sellmv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_sell<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_sell<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_sell<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_sell<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_sell<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_sell<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_sell<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_sell<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "spmv_bsr")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_bsr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_bsr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_bsr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_bsr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_bsr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_bsr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_bsr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_bsr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_bsr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_bsr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_bsr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_bsr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "csr16mv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_csr16<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr16<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_csr16<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr16<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_csr16<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr16<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_csr16<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csr16<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "spmv_mixed")
+    {
+        // The precision selects the compute type, matrix values are stored in the next
+        // lower precision
+        if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_mixed<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_mixed<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_mixed<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_mixed<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_mixed<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_mixed<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "spmv_batched")
+    {
+        // The batch count is given by sizek
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_batched<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_batched<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_batched<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_batched<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_batched<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_batched<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_batched<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_batched<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_batched<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_batched<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_batched<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_batched<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "spmv_fused")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_fused<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_fused<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_fused<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_fused<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_fused<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_fused<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_fused<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_fused<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_fused<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_fused<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_fused<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_fused<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "gemvi")
+    {
+        if(precision == 's')
+            testing_gemvi<float>(arg);
+        else if(precision == 'd')
+            testing_gemvi<double>(arg);
+        else if(precision == 'c')
+            testing_gemvi<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gemvi<rocsparse_double_complex>(arg);
+    }
+    else if(function == "hybmv")
+    {
+        if(precision == 's')
+            testing_hybmv<float>(arg);
+        else if(precision == 'd')
+            testing_hybmv<double>(arg);
+        else if(precision == 'c')
+            testing_hybmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_hybmv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gebsrmv")
+    {
+        if(precision == 's')
+            testing_gebsrmv<float>(arg);
+        else if(precision == 'd')
+            testing_gebsrmv<double>(arg);
+        else if(precision == 'c')
+            testing_gebsrmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gebsrmv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "bsrmm")
+    {
+        if(precision == 's')
+            testing_bsrmm<float>(arg);
+        else if(precision == 'd')
+            testing_bsrmm<double>(arg);
+        else if(precision == 'c')
+            testing_bsrmm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrmm<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gebsrmm")
+    {
+        if(precision == 's')
+            testing_gebsrmm<float>(arg);
+        else if(precision == 'd')
+            testing_gebsrmm<double>(arg);
+        else if(precision == 'c')
+            testing_gebsrmm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gebsrmm<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmm")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_csr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_csr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmm_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "cscmm")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_csc<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csc<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csc<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_csc<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csc<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csc<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmm_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "coomm")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_coo<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_coo<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_coo<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_coo<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmm_coo<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_coo<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_coo<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_coo<int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "sellmm")
     {
-        std::cout << desc << std::endl;
-        return 0;
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_sell<int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_sell<int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_sell<int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_sell<int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmm_sell<int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_sell<int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_sell<int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_sell<int64_t, rocsparse_double_complex>(arg);
+        }
     }
-
-    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    else if(function == "spmm_bsr")
     {
-        std::cerr << "Invalid value for --direction" << std::endl;
-        return -1;
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_bsr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmm_bsr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_bsr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_bsr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmm_bsr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_bsr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmm_bsr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_bsr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_bsr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_bsr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_bsr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_bsr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
     }
-
-    if(order != rocsparse_order_row && order != rocsparse_order_column)
+    else if(function == "csrsm")
     {
-        std::cerr << "Invalid value for --order" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csrsm<float>(arg);
+        else if(precision == 'd')
+            testing_csrsm<double>(arg);
+        else if(precision == 'c')
+            testing_csrsm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsm<rocsparse_double_complex>(arg);
     }
-
-    if(format != rocsparse_format_csr && format != rocsparse_format_coo
-       && format != rocsparse_format_coo_aos && format != rocsparse_format_ell
-       && format != rocsparse_format_csc)
+    else if(function == "gemmi")
     {
-        std::cerr << "Invalid value for --format" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_gemmi<float>(arg);
+        else if(precision == 'd')
+            testing_gemmi<double>(arg);
+        else if(precision == 'c')
+            testing_gemmi<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gemmi<rocsparse_double_complex>(arg);
     }
-
-    if(indextype != 's' && indextype != 'd' && indextype != 'm')
+    else if(function == "csrgeam")
     {
-        std::cerr << "Invalid value for --indextype" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csrgeam<float>(arg);
+        else if(precision == 'd')
+            testing_csrgeam<double>(arg);
+        else if(precision == 'c')
+            testing_csrgeam<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrgeam<rocsparse_double_complex>(arg);
     }
-
-    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
+    else if(function == "csrgemm")
     {
-        std::cerr << "Invalid value for --precision" << std::endl;
-        return -1;
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spgemm_csr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_csr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_csr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spgemm_csr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_csr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_csr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spgemm_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spgemm_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
     }
-
-    if(transA == 'N')
+    else if(function == "sddmm")
     {
-        arg.transA = rocsparse_operation_none;
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_sddmm<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_sddmm<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_sddmm<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_sddmm<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_sddmm<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_sddmm<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_sddmm<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_sddmm<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_sddmm<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_sddmm<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_sddmm<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_sddmm<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
     }
-    else if(transA == 'T')
+    else if(function == "bsric0")
     {
-        arg.transA = rocsparse_operation_transpose;
-        ;
+        if(precision == 's')
+            testing_bsric0<float>(arg);
+        else if(precision == 'd')
+            testing_bsric0<double>(arg);
+        else if(precision == 'c')
+            testing_bsric0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsric0<rocsparse_double_complex>(arg);
     }
-    else if(transA == 'C')
+    else if(function == "bsrilu0")
     {
-        arg.transA = rocsparse_operation_conjugate_transpose;
+        if(precision == 's')
+            testing_bsrilu0<float>(arg);
+        else if(precision == 'd')
+            testing_bsrilu0<double>(arg);
+        else if(precision == 'c')
+            testing_bsrilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrilu0<rocsparse_double_complex>(arg);
     }
-
-    if(transB == 'N')
+    else if(function == "csric0")
     {
-        arg.transB = rocsparse_operation_none;
+        if(precision == 's')
+            testing_csric0<float>(arg);
+        else if(precision == 'd')
+            testing_csric0<double>(arg);
+        else if(precision == 'c')
+            testing_csric0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csric0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrilu0")
+    {
+        if(precision == 's')
+            testing_csrilu0<float>(arg);
+        else if(precision == 'd')
+            testing_csrilu0<double>(arg);
+        else if(precision == 'c')
+            testing_csrilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrilu0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv")
+    {
+        if(precision == 's')
+            testing_gtsv<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv_no_pivot")
+    {
+        if(precision == 's')
+            testing_gtsv_no_pivot<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_no_pivot<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_no_pivot<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_no_pivot<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv_no_pivot_strided_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_no_pivot_strided_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_no_pivot_strided_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_no_pivot_strided_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
     }
-    else if(transB == 'T')
+    else if(function == "nnz")
     {
-        arg.transB = rocsparse_operation_transpose;
+        if(precision == 's')
+            testing_nnz<float>(arg);
+        else if(precision == 'd')
+            testing_nnz<double>(arg);
+        else if(precision == 'c')
+            testing_nnz<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_nnz<rocsparse_double_complex>(arg);
     }
-    else if(transB == 'C')
+    else if(function == "dense2csr")
     {
-        arg.transB = rocsparse_operation_conjugate_transpose;
+        if(precision == 's')
+            testing_dense2csr<float>(arg);
+        else if(precision == 'd')
+            testing_dense2csr<double>(arg);
+        else if(precision == 'c')
+            testing_dense2csr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_dense2csr<rocsparse_double_complex>(arg);
     }
-
-    arg.baseA = (baseA == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
-    arg.baseB = (baseB == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
-    arg.baseC = (baseC == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
-    arg.baseD = (baseD == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
-
-    arg.action = (action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
-    arg.part   = (part == 0)   ? rocsparse_hyb_partition_auto
-                 : (part == 1) ? rocsparse_hyb_partition_user
-                               : rocsparse_hyb_partition_max;
-    arg.diag   = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
-    arg.uplo   = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
-    arg.apol   = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
-    arg.spol   = rocsparse_solve_policy_auto;
-    arg.direction
-        = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
-    arg.order  = (order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
-    arg.format = (rocsparse_format)format;
-
-    // rocALUTION parameter overrides filename parameter
-    if(rocalution != "")
+    else if(function == "dense2coo")
     {
-        strcpy(arg.filename, rocalution.c_str());
-        arg.matrix = rocsparse_matrix_file_rocalution;
+        if(precision == 's')
+            testing_dense2coo<float>(arg);
+        else if(precision == 'd')
+            testing_dense2coo<double>(arg);
+        else if(precision == 'c')
+            testing_dense2coo<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_dense2coo<rocsparse_double_complex>(arg);
     }
-    else if(arg.dimx != 0 && arg.dimy != 0 && arg.dimz != 0)
+    else if(function == "prune_dense2csr")
     {
-        arg.matrix = rocsparse_matrix_laplace_3d;
+        if(precision == 's')
+            testing_prune_dense2csr<float>(arg);
+        else if(precision == 'd')
+            testing_prune_dense2csr<double>(arg);
     }
-    else if(arg.dimx != 0 && arg.dimy != 0)
+    else if(function == "prune_dense2csr_by_percentage")
     {
-        arg.matrix = rocsparse_matrix_laplace_2d;
+        if(precision == 's')
+            testing_prune_dense2csr_by_percentage<float>(arg);
+        else if(precision == 'd')
+            testing_prune_dense2csr_by_percentage<double>(arg);
     }
-    else if(filename != "")
+    else if(function == "dense2csc")
     {
-        strcpy(arg.filename, filename.c_str());
-        arg.matrix = rocsparse_matrix_file_mtx;
+        if(precision == 's')
+            testing_dense2csc<float>(arg);
+        else if(precision == 'd')
+            testing_dense2csc<double>(arg);
+        else if(precision == 'c')
+            testing_dense2csc<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_dense2csc<rocsparse_double_complex>(arg);
     }
-    else
+    else if(function == "csr2dense")
     {
-        arg.matrix = rocsparse_matrix_random;
+        if(precision == 's')
+            testing_csr2dense<float>(arg);
+        else if(precision == 'd')
+            testing_csr2dense<double>(arg);
+        else if(precision == 'c')
+            testing_csr2dense<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2dense<rocsparse_double_complex>(arg);
     }
-
-    arg.matrix_init_kind = rocsparse_matrix_init_kind_default;
-
-    // Device query
-    int devs;
-    if(hipGetDeviceCount(&devs) != hipSuccess)
+    else if(function == "csc2dense")
     {
-        std::cerr << "Error: cannot get device count" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csc2dense<float>(arg);
+        else if(precision == 'd')
+            testing_csc2dense<double>(arg);
+        else if(precision == 'c')
+            testing_csc2dense<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csc2dense<rocsparse_double_complex>(arg);
     }
-
-    std::cout << "Query device success: there are " << devs << " devices" << std::endl;
-
-    for(int i = 0; i < devs; ++i)
+    else if(function == "coo2dense")
     {
-        hipDeviceProp_t prop;
-
-        if(hipGetDeviceProperties(&prop, i) != hipSuccess)
-        {
-            std::cerr << "Error: cannot get device properties" << std::endl;
-            return -1;
-        }
-
-        std::cout << "Device ID " << i << ": " << prop.name << std::endl;
-        std::cout << "-------------------------------------------------------------------------"
-                  << std::endl;
-        std::cout << "with " << (prop.totalGlobalMem >> 20) << "MB memory, clock rate "
-                  << prop.clockRate / 1000 << "MHz @ computing capability " << prop.major << "."
-                  << prop.minor << std::endl;
-        std::cout << "maxGridDimX " << prop.maxGridSize[0] << ", sharedMemPerBlock "
-                  << (prop.sharedMemPerBlock >> 10) << "KB, maxThreadsPerBlock "
-                  << prop.maxThreadsPerBlock << std::endl;
-        std::cout << "wavefrontSize " << prop.warpSize << std::endl;
-        std::cout << "-------------------------------------------------------------------------"
-                  << std::endl;
+        if(precision == 's')
+            testing_coo2dense<float>(arg);
+        else if(precision == 'd')
+            testing_coo2dense<double>(arg);
+        else if(precision == 'c')
+            testing_coo2dense<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_coo2dense<rocsparse_double_complex>(arg);
     }
-
-    // Set device
-    if(hipSetDevice(device_id) != hipSuccess || device_id >= devs)
+    else if(function == "csr2coo")
     {
-        std::cerr << "Error: cannot set device ID " << device_id << std::endl;
-        return -1;
+        testing_csr2coo<float>(arg);
     }
-
-    hipDeviceProp_t prop;
-    hipGetDeviceProperties(&prop, device_id);
-
-    std::cout << "Using device ID " << device_id << " (" << prop.name << ") for rocSPARSE"
-              << std::endl;
-    std::cout << "-------------------------------------------------------------------------"
-              << std::endl;
-
-    // Print version
-    rocsparse_handle handle;
-    rocsparse_create_handle(&handle);
-
-    int  ver;
-    char rev[64];
-
-    rocsparse_get_version(handle, &ver);
-    rocsparse_get_git_rev(handle, rev);
-
-    std::cout << "rocSPARSE version: " << ver / 100000 << "." << ver / 100 % 1000 << "."
-              << ver % 100 << "-" << rev << std::endl;
-
-    rocsparse_destroy_handle(handle);
-
-    /* ============================================================================================
-    */
-    if(arg.M < 0 || arg.N < 0)
+    else if(function == "csr2csc")
     {
-        std::cerr << "Invalid dimension" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csr2csc<float>(arg);
+        else if(precision == 'd')
+            testing_csr2csc<double>(arg);
+        else if(precision == 'c')
+            testing_csr2csc<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2csc<rocsparse_double_complex>(arg);
     }
-
-    if(arg.block_dim < 1)
+    else if(function == "gebsr2gebsc")
     {
-        std::cerr << "Invalid value for --blockdim" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_gebsr2gebsc<float>(arg);
+        else if(precision == 'd')
+            testing_gebsr2gebsc<double>(arg);
+        else if(precision == 'c')
+            testing_gebsr2gebsc<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gebsr2gebsc<rocsparse_double_complex>(arg);
     }
-
-    if(arg.row_block_dimA < 1)
+    else if(function == "csr2ell")
     {
-        std::cerr << "Invalid value for --row-blockdimA" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csr2ell<float>(arg);
+        else if(precision == 'd')
+            testing_csr2ell<double>(arg);
+        else if(precision == 'c')
+            testing_csr2ell<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2ell<rocsparse_double_complex>(arg);
     }
-
-    if(arg.col_block_dimA < 1)
+    else if(function == "csr2sell")
     {
-        std::cerr << "Invalid value for --col-blockdimA" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csr2sell<float>(arg);
+        else if(precision == 'd')
+            testing_csr2sell<double>(arg);
+        else if(precision == 'c')
+            testing_csr2sell<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2sell<rocsparse_double_complex>(arg);
     }
-
-    if(arg.row_block_dimB < 1)
+    else if(function == "csr2csr16")
     {
-        std::cerr << "Invalid value for --row-blockdimB" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csr2csr16<float>(arg);
+        else if(precision == 'd')
+            testing_csr2csr16<double>(arg);
+        else if(precision == 'c')
+            testing_csr2csr16<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2csr16<rocsparse_double_complex>(arg);
     }
-
-    if(arg.col_block_dimB < 1)
+    else if(function == "csr2hyb")
     {
-        std::cerr << "Invalid value for --col-blockdimB" << std::endl;
-        return -1;
+        if(precision == 's')
+            testing_csr2hyb<float>(arg);
+        else if(precision == 'd')
+            testing_csr2hyb<double>(arg);
+        else if(precision == 'c')
+            testing_csr2hyb<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2hyb<rocsparse_double_complex>(arg);
     }
-
-    // Level1
-    if(function == "axpyi")
+    else if(function == "csr2bsr")
     {
         if(precision == 's')
-            testing_axpyi<float>(arg);
+            testing_csr2bsr<float>(arg);
         else if(precision == 'd')
-            testing_axpyi<double>(arg);
+            testing_csr2bsr<double>(arg);
         else if(precision == 'c')
-            testing_axpyi<rocsparse_float_complex>(arg);
+            testing_csr2bsr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_axpyi<rocsparse_double_complex>(arg);
+            testing_csr2bsr<rocsparse_double_complex>(arg);
     }
-    else if(function == "doti")
+    else if(function == "csr2gebsr")
     {
         if(precision == 's')
-            testing_doti<float>(arg);
+            testing_csr2gebsr<float>(arg);
         else if(precision == 'd')
-            testing_doti<double>(arg);
+            testing_csr2gebsr<double>(arg);
         else if(precision == 'c')
-            testing_doti<rocsparse_float_complex>(arg);
+            testing_csr2gebsr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_doti<rocsparse_double_complex>(arg);
+            testing_csr2gebsr<rocsparse_double_complex>(arg);
     }
-    else if(function == "dotci")
+    else if(function == "coo2csr")
+    {
+        testing_coo2csr<float>(arg);
+    }
+    else if(function == "ell2csr")
     {
         if(precision == 's')
-            testing_doti<float>(arg);
+            testing_ell2csr<float>(arg);
         else if(precision == 'd')
-            testing_doti<double>(arg);
+            testing_ell2csr<double>(arg);
         else if(precision == 'c')
-            testing_dotci<rocsparse_float_complex>(arg);
+            testing_ell2csr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_dotci<rocsparse_double_complex>(arg);
+            testing_ell2csr<rocsparse_double_complex>(arg);
     }
-    else if(function == "gthr")
+    else if(function == "hyb2csr")
     {
         if(precision == 's')
-            testing_gthr<float>(arg);
+            testing_hyb2csr<float>(arg);
         else if(precision == 'd')
-            testing_gthr<double>(arg);
+            testing_hyb2csr<double>(arg);
         else if(precision == 'c')
-            testing_gthr<rocsparse_float_complex>(arg);
+            testing_hyb2csr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_gthr<rocsparse_double_complex>(arg);
+            testing_hyb2csr<rocsparse_double_complex>(arg);
     }
-    else if(function == "gthrz")
+    else if(function == "bsr2csr")
     {
         if(precision == 's')
-            testing_gthrz<float>(arg);
+            testing_bsr2csr<float>(arg);
         else if(precision == 'd')
-            testing_gthrz<double>(arg);
+            testing_bsr2csr<double>(arg);
         else if(precision == 'c')
-            testing_gthrz<rocsparse_float_complex>(arg);
+            testing_bsr2csr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_gthrz<rocsparse_double_complex>(arg);
+            testing_bsr2csr<rocsparse_double_complex>(arg);
     }
-    else if(function == "roti")
+    else if(function == "gebsr2csr")
     {
         if(precision == 's')
-            testing_roti<float>(arg);
+            testing_gebsr2csr<float>(arg);
         else if(precision == 'd')
-            testing_roti<double>(arg);
+            testing_gebsr2csr<double>(arg);
+        else if(precision == 'c')
+            testing_gebsr2csr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gebsr2csr<rocsparse_double_complex>(arg);
     }
-    else if(function == "sctr")
+    else if(function == "gebsr2gebsr")
     {
         if(precision == 's')
-            testing_sctr<float>(arg);
+            testing_gebsr2gebsr<float>(arg);
         else if(precision == 'd')
-            testing_sctr<double>(arg);
+            testing_gebsr2gebsr<double>(arg);
         else if(precision == 'c')
-            testing_sctr<rocsparse_float_complex>(arg);
+            testing_gebsr2gebsr<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_sctr<rocsparse_double_complex>(arg);
+            testing_gebsr2gebsr<rocsparse_double_complex>(arg);
     }
-    else if(function == "bsrmv")
+    else if(function == "csr2csr_compress")
     {
         if(precision == 's')
-            testing_bsrmv<float>(arg);
+            testing_csr2csr_compress<float>(arg);
         else if(precision == 'd')
-            testing_bsrmv<double>(arg);
+            testing_csr2csr_compress<double>(arg);
         else if(precision == 'c')
-            testing_bsrmv<rocsparse_float_complex>(arg);
+            testing_csr2csr_compress<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_bsrmv<rocsparse_double_complex>(arg);
+            testing_csr2csr_compress<rocsparse_double_complex>(arg);
     }
-    else if(function == "bsrsv")
+    else if(function == "prune_csr2csr")
     {
         if(precision == 's')
-            testing_bsrsv<float>(arg);
+            testing_prune_csr2csr<float>(arg);
         else if(precision == 'd')
-            testing_bsrsv<double>(arg);
-        else if(precision == 'c')
-            testing_bsrsv<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_bsrsv<rocsparse_double_complex>(arg);
+            testing_prune_csr2csr<double>(arg);
     }
-    else if(function == "coomv")
+    else if(function == "prune_csr2csr_by_percentage")
     {
         if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_spmv_coo<int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_spmv_coo<int64_t, float>(arg);
-        }
+            testing_prune_csr2csr_by_percentage<float>(arg);
         else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_spmv_coo<int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_spmv_coo<int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_spmv_coo<int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_spmv_coo<int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_spmv_coo<int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_spmv_coo<int64_t, rocsparse_double_complex>(arg);
-        }
+            testing_prune_csr2csr_by_percentage<double>(arg);
     }
-    else if(function == "coomv_aos")
+    else if(function == "dense_to_sparse_coo")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spmv_coo_aos<int32_t, float>(arg);
+                testing_dense_to_sparse_coo<int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spmv_coo_aos<int64_t, float>(arg);
+                testing_dense_to_sparse_coo<int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spmv_coo_aos<int32_t, double>(arg);
+                testing_dense_to_sparse_coo<int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spmv_coo_aos<int64_t, double>(arg);
+                testing_dense_to_sparse_coo<int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spmv_coo_aos<int32_t, rocsparse_float_complex>(arg);
+                testing_dense_to_sparse_coo<int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spmv_coo_aos<int64_t, rocsparse_float_complex>(arg);
+                testing_dense_to_sparse_coo<int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_spmv_coo_aos<int32_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_coo<int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_spmv_coo_aos<int64_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_coo<int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "csrmv")
+    else if(function == "dense_to_sparse_csr")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spmv_csr<int32_t, int32_t, float>(arg);
+                testing_dense_to_sparse_csr<int32_t, int32_t, float>(arg);
             else if(indextype == 'm')
-                testing_spmv_csr<int64_t, int32_t, float>(arg);
+                testing_dense_to_sparse_csr<int64_t, int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spmv_csr<int64_t, int64_t, float>(arg);
+                testing_dense_to_sparse_csr<int64_t, int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spmv_csr<int32_t, int32_t, double>(arg);
+                testing_dense_to_sparse_csr<int32_t, int32_t, double>(arg);
             else if(indextype == 'm')
-                testing_spmv_csr<int64_t, int32_t, double>(arg);
+                testing_dense_to_sparse_csr<int64_t, int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spmv_csr<int64_t, int64_t, double>(arg);
+                testing_dense_to_sparse_csr<int64_t, int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spmv_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+                testing_dense_to_sparse_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'm')
-                testing_spmv_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+                testing_dense_to_sparse_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spmv_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+                testing_dense_to_sparse_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_spmv_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'm')
-                testing_spmv_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_spmv_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "csrmv_managed")
-    {
-        if(precision == 's')
-            testing_csrmv_managed<float>(arg);
-        else if(precision == 'd')
-            testing_csrmv_managed<double>(arg);
-        else if(precision == 'c')
-            testing_csrmv_managed<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrmv_managed<rocsparse_double_complex>(arg);
-    }
-    else if(function == "csrsv")
-    {
-        if(precision == 's')
-            testing_csrsv<float>(arg);
-        else if(precision == 'd')
-            testing_csrsv<double>(arg);
-        else if(precision == 'c')
-            testing_csrsv<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrsv<rocsparse_double_complex>(arg);
-    }
-    else if(function == "ellmv")
+    else if(function == "dense_to_sparse_csc")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spmv_ell<int32_t, float>(arg);
+                testing_dense_to_sparse_csc<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_dense_to_sparse_csc<int64_t, int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spmv_ell<int64_t, float>(arg);
+                testing_dense_to_sparse_csc<int64_t, int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spmv_ell<int32_t, double>(arg);
+                testing_dense_to_sparse_csc<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_dense_to_sparse_csc<int64_t, int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spmv_ell<int64_t, double>(arg);
+                testing_dense_to_sparse_csc<int64_t, int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spmv_ell<int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_spmv_ell<int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_spmv_ell<int32_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_dense_to_sparse_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spmv_ell<int64_t, rocsparse_double_complex>(arg);
+                testing_dense_to_sparse_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
         }
-    }
-    else if(function == "gemvi")
-    {
-        if(precision == 's')
-            testing_gemvi<float>(arg);
-        else if(precision == 'd')
-            testing_gemvi<double>(arg);
-        else if(precision == 'c')
-            testing_gemvi<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gemvi<rocsparse_double_complex>(arg);
-    }
-    else if(function == "hybmv")
-    {
-        if(precision == 's')
-            testing_hybmv<float>(arg);
-        else if(precision == 'd')
-            testing_hybmv<double>(arg);
-        else if(precision == 'c')
-            testing_hybmv<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_hybmv<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gebsrmv")
-    {
-        if(precision == 's')
-            testing_gebsrmv<float>(arg);
-        else if(precision == 'd')
-            testing_gebsrmv<double>(arg);
-        else if(precision == 'c')
-            testing_gebsrmv<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gebsrmv<rocsparse_double_complex>(arg);
-    }
-    else if(function == "bsrmm")
-    {
-        if(precision == 's')
-            testing_bsrmm<float>(arg);
-        else if(precision == 'd')
-            testing_bsrmm<double>(arg);
-        else if(precision == 'c')
-            testing_bsrmm<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_bsrmm<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gebsrmm")
-    {
-        if(precision == 's')
-            testing_gebsrmm<float>(arg);
-        else if(precision == 'd')
-            testing_gebsrmm<double>(arg);
-        else if(precision == 'c')
-            testing_gebsrmm<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_gebsrmm<rocsparse_double_complex>(arg);
+        {
+            if(indextype == 's')
+                testing_dense_to_sparse_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_dense_to_sparse_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_dense_to_sparse_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
     }
-    else if(function == "csrmm")
+    else if(function == "sparse_to_dense_coo")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spmm_csr<int32_t, int32_t, float>(arg);
-            else if(indextype == 'm')
-                testing_spmm_csr<int64_t, int32_t, float>(arg);
+                testing_sparse_to_dense_coo<int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spmm_csr<int64_t, int64_t, float>(arg);
+                testing_sparse_to_dense_coo<int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spmm_csr<int32_t, int32_t, double>(arg);
-            else if(indextype == 'm')
-                testing_spmm_csr<int64_t, int32_t, double>(arg);
+                testing_sparse_to_dense_coo<int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spmm_csr<int64_t, int64_t, double>(arg);
+                testing_sparse_to_dense_coo<int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spmm_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'm')
-                testing_spmm_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_coo<int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spmm_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_coo<int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_spmm_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'm')
-                testing_spmm_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_coo<int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_spmm_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_coo<int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "coomm")
+    else if(function == "sparse_to_dense_csr")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spmm_coo<int32_t, float>(arg);
+                testing_sparse_to_dense_csr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_csr<int64_t, int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spmm_coo<int64_t, float>(arg);
+                testing_sparse_to_dense_csr<int64_t, int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spmm_coo<int32_t, double>(arg);
+                testing_sparse_to_dense_csr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_csr<int64_t, int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spmm_coo<int64_t, double>(arg);
+                testing_sparse_to_dense_csr<int64_t, int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spmm_coo<int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spmm_coo<int64_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_spmm_coo<int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_spmm_coo<int64_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "csrsm")
-    {
-        if(precision == 's')
-            testing_csrsm<float>(arg);
-        else if(precision == 'd')
-            testing_csrsm<double>(arg);
-        else if(precision == 'c')
-            testing_csrsm<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrsm<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gemmi")
-    {
-        if(precision == 's')
-            testing_gemmi<float>(arg);
-        else if(precision == 'd')
-            testing_gemmi<double>(arg);
-        else if(precision == 'c')
-            testing_gemmi<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gemmi<rocsparse_double_complex>(arg);
-    }
-    else if(function == "csrgeam")
-    {
-        if(precision == 's')
-            testing_csrgeam<float>(arg);
-        else if(precision == 'd')
-            testing_csrgeam<double>(arg);
-        else if(precision == 'c')
-            testing_csrgeam<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrgeam<rocsparse_double_complex>(arg);
-    }
-    else if(function == "csrgemm")
+    else if(function == "sparse_to_dense_csc")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_spgemm_csr<int32_t, int32_t, float>(arg);
+                testing_sparse_to_dense_csc<int32_t, int32_t, float>(arg);
             else if(indextype == 'm')
-                testing_spgemm_csr<int64_t, int32_t, float>(arg);
+                testing_sparse_to_dense_csc<int64_t, int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_spgemm_csr<int64_t, int64_t, float>(arg);
+                testing_sparse_to_dense_csc<int64_t, int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_spgemm_csr<int32_t, int32_t, double>(arg);
+                testing_sparse_to_dense_csc<int32_t, int32_t, double>(arg);
             else if(indextype == 'm')
-                testing_spgemm_csr<int64_t, int32_t, double>(arg);
+                testing_sparse_to_dense_csc<int64_t, int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_spgemm_csr<int64_t, int64_t, double>(arg);
+                testing_sparse_to_dense_csc<int64_t, int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_spgemm_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'm')
-                testing_spgemm_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_spgemm_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_spgemm_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'm')
-                testing_spgemm_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_spgemm_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "sddmm")
+    else if(function == "sparse_to_dense_bsr")
     {
         if(precision == 's')
         {
             if(indextype == 's')
-                testing_sddmm<int32_t, int32_t, float>(arg);
+                testing_sparse_to_dense_bsr<int32_t, int32_t, float>(arg);
             else if(indextype == 'm')
-                testing_sddmm<int64_t, int32_t, float>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int32_t, float>(arg);
             else if(indextype == 'd')
-                testing_sddmm<int64_t, int64_t, float>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int64_t, float>(arg);
         }
         else if(precision == 'd')
         {
             if(indextype == 's')
-                testing_sddmm<int32_t, int32_t, double>(arg);
+                testing_sparse_to_dense_bsr<int32_t, int32_t, double>(arg);
             else if(indextype == 'm')
-                testing_sddmm<int64_t, int32_t, double>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int32_t, double>(arg);
             else if(indextype == 'd')
-                testing_sddmm<int64_t, int64_t, double>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int64_t, double>(arg);
         }
         else if(precision == 'c')
         {
             if(indextype == 's')
-                testing_sddmm<int32_t, int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_bsr<int32_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'm')
-                testing_sddmm<int64_t, int32_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int32_t, rocsparse_float_complex>(arg);
             else if(indextype == 'd')
-                testing_sddmm<int64_t, int64_t, rocsparse_float_complex>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int64_t, rocsparse_float_complex>(arg);
         }
         else if(precision == 'z')
         {
             if(indextype == 's')
-                testing_sddmm<int32_t, int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_bsr<int32_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'm')
-                testing_sddmm<int64_t, int32_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int32_t, rocsparse_double_complex>(arg);
             else if(indextype == 'd')
-                testing_sddmm<int64_t, int64_t, rocsparse_double_complex>(arg);
+                testing_sparse_to_dense_bsr<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
-    else if(function == "bsric0")
-    {
-        if(precision == 's')
-            testing_bsric0<float>(arg);
-        else if(precision == 'd')
-            testing_bsric0<double>(arg);
-        else if(precision == 'c')
-            testing_bsric0<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_bsric0<rocsparse_double_complex>(arg);
-    }
-    else if(function == "bsrilu0")
-    {
-        if(precision == 's')
-            testing_bsrilu0<float>(arg);
-        else if(precision == 'd')
-            testing_bsrilu0<double>(arg);
-        else if(precision == 'c')
-            testing_bsrilu0<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_bsrilu0<rocsparse_double_complex>(arg);
-    }
-    else if(function == "csric0")
-    {
-        if(precision == 's')
-            testing_csric0<float>(arg);
-        else if(precision == 'd')
-            testing_csric0<double>(arg);
-        else if(precision == 'c')
-            testing_csric0<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csric0<rocsparse_double_complex>(arg);
-    }
-    else if(function == "csrilu0")
-    {
-        if(precision == 's')
-            testing_csrilu0<float>(arg);
-        else if(precision == 'd')
-            testing_csrilu0<double>(arg);
-        else if(precision == 'c')
-            testing_csrilu0<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrilu0<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gtsv")
-    {
-        if(precision == 's')
-            testing_gtsv<float>(arg);
-        else if(precision == 'd')
-            testing_gtsv<double>(arg);
-        else if(precision == 'c')
-            testing_gtsv<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gtsv<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gtsv_no_pivot")
-    {
-        if(precision == 's')
-            testing_gtsv_no_pivot<float>(arg);
-        else if(precision == 'd')
-            testing_gtsv_no_pivot<double>(arg);
-        else if(precision == 'c')
-            testing_gtsv_no_pivot<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gtsv_no_pivot<rocsparse_double_complex>(arg);
-    }
-    else if(function == "gtsv_no_pivot_strided_batch")
-    {
-        if(precision == 's')
-            testing_gtsv_no_pivot_strided_batch<float>(arg);
-        else if(precision == 'd')
-            testing_gtsv_no_pivot_strided_batch<double>(arg);
-        else if(precision == 'c')
-            testing_gtsv_no_pivot_strided_batch<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gtsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
-    }
-    else if(function == "nnz")
+    else if(function == "csrcolor")
     {
         if(precision == 's')
-            testing_nnz<float>(arg);
+            testing_csrcolor<float>(arg);
         else if(precision == 'd')
-            testing_nnz<double>(arg);
+            testing_csrcolor<double>(arg);
         else if(precision == 'c')
-            testing_nnz<rocsparse_float_complex>(arg);
+            testing_csrcolor<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_nnz<rocsparse_double_complex>(arg);
+            testing_csrcolor<rocsparse_double_complex>(arg);
     }
-    else if(function == "dense2csr")
+    else if(function == "csrsort")
     {
-        if(precision == 's')
-            testing_dense2csr<float>(arg);
-        else if(precision == 'd')
-            testing_dense2csr<double>(arg);
-        else if(precision == 'c')
-            testing_dense2csr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_dense2csr<rocsparse_double_complex>(arg);
+        testing_csrsort<float>(arg);
     }
-    else if(function == "dense2coo")
+    else if(function == "cscsort")
     {
-        if(precision == 's')
-            testing_dense2coo<float>(arg);
-        else if(precision == 'd')
-            testing_dense2coo<double>(arg);
-        else if(precision == 'c')
-            testing_dense2coo<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_dense2coo<rocsparse_double_complex>(arg);
+        testing_cscsort<float>(arg);
     }
-    else if(function == "prune_dense2csr")
+    else if(function == "coosort")
     {
-        if(precision == 's')
-            testing_prune_dense2csr<float>(arg);
-        else if(precision == 'd')
-            testing_prune_dense2csr<double>(arg);
+        testing_coosort<float>(arg);
     }
-    else if(function == "prune_dense2csr_by_percentage")
+    else if(function == "identity")
     {
-        if(precision == 's')
-            testing_prune_dense2csr_by_percentage<float>(arg);
-        else if(precision == 'd')
-            testing_prune_dense2csr_by_percentage<double>(arg);
+        testing_identity<float>(arg);
     }
-    else if(function == "dense2csc")
+    else if(function == "autotune_spmv")
     {
         if(precision == 's')
-            testing_dense2csc<float>(arg);
+            testing_spmv_autotune<float>(arg);
         else if(precision == 'd')
-            testing_dense2csc<double>(arg);
+            testing_spmv_autotune<double>(arg);
         else if(precision == 'c')
-            testing_dense2csc<rocsparse_float_complex>(arg);
+            testing_spmv_autotune<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_dense2csc<rocsparse_double_complex>(arg);
+            testing_spmv_autotune<rocsparse_double_complex>(arg);
     }
-    else if(function == "csr2dense")
+    else if(function == "autotune_spmm")
     {
         if(precision == 's')
-            testing_csr2dense<float>(arg);
+            testing_spmm_autotune<float>(arg);
         else if(precision == 'd')
-            testing_csr2dense<double>(arg);
+            testing_spmm_autotune<double>(arg);
         else if(precision == 'c')
-            testing_csr2dense<rocsparse_float_complex>(arg);
+            testing_spmm_autotune<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_csr2dense<rocsparse_double_complex>(arg);
+            testing_spmm_autotune<rocsparse_double_complex>(arg);
     }
-    else if(function == "csc2dense")
+    else if(function == "ab_spmv")
     {
         if(precision == 's')
-            testing_csc2dense<float>(arg);
+            testing_spmv_ab<float>(arg);
         else if(precision == 'd')
-            testing_csc2dense<double>(arg);
+            testing_spmv_ab<double>(arg);
         else if(precision == 'c')
-            testing_csc2dense<rocsparse_float_complex>(arg);
+            testing_spmv_ab<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_csc2dense<rocsparse_double_complex>(arg);
+            testing_spmv_ab<rocsparse_double_complex>(arg);
     }
-    else if(function == "coo2dense")
+    else if(function == "ab_spmm")
     {
         if(precision == 's')
-            testing_coo2dense<float>(arg);
+            testing_spmm_ab<float>(arg);
         else if(precision == 'd')
-            testing_coo2dense<double>(arg);
+            testing_spmm_ab<double>(arg);
         else if(precision == 'c')
-            testing_coo2dense<rocsparse_float_complex>(arg);
+            testing_spmm_ab<rocsparse_float_complex>(arg);
         else if(precision == 'z')
-            testing_coo2dense<rocsparse_double_complex>(arg);
+            testing_spmm_ab<rocsparse_double_complex>(arg);
     }
-    else if(function == "csr2coo")
+    else
     {
-        testing_csr2coo<float>(arg);
+        std::cerr << "Invalid value for --function" << std::endl;
+        return -1;
     }
-    else if(function == "csr2csc")
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments arg;
+    arg.unit_check          = 0;
+    arg.timing              = 1;
+    arg.alphai              = 0.0;
+    arg.betai               = 0.0;
+    arg.threshold           = 0.0;
+    arg.percentage          = 0.0;
+    arg.sddmm_alg           = rocsparse_sddmm_alg_default;
+    arg.spmv_alg            = rocsparse_spmv_alg_default;
+    arg.spmm_alg            = rocsparse_spmm_alg_default;
+    arg.spgemm_alg          = rocsparse_spgemm_alg_default;
+    arg.sparse_to_dense_alg = rocsparse_sparse_to_dense_alg_default;
+    arg.dense_to_sparse_alg = rocsparse_dense_to_sparse_alg_default;
+
+    std::string   function;
+    std::string   filename;
+    std::string   rocalution;
+    std::string   machine_profile;
+    char          indextype = 's';
+    char          precision = 's';
+    char          transA;
+    char          transB;
+    int           baseA;
+    int           baseB;
+    int           baseC;
+    int           baseD;
+    int           action;
+    int           part;
+    char          diag;
+    char          uplo;
+    char          apol;
+    rocsparse_int dir;
+    rocsparse_int order;
+    rocsparse_int format;
+
+    rocsparse_int device_id;
+
+    std::string sweep_N;
+    std::string sweep_block_dim;
+    std::string sweep_row_block_dimA;
+    std::string sweep_col_block_dimA;
+    std::string sweep_denseld;
+    std::string sweep_iters;
+    std::string sweep_metric;
+    std::string sweep_output;
+
+    // clang-format off
+
+    options_description desc("rocsparse client command line options");
+    desc.add_options() ("help,h", "produces this help message")
+        // clang-format off
+        ("sizem,m",
+        value<rocsparse_int>(&arg.M)->default_value(128),
+        "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
+        "& SPARSE-3: the number of rows.")
+
+        ("sizen,n",
+        value<std::string>(&sweep_N)->default_value("128"),
+        "Specific matrix/vector size testing: SPARSE-1: the length of the "
+        "dense vector. SPARSE-2 & SPARSE-3: the number of columns. Accepts a sweep "
+        "specification, see --sweep-output")
+
+        ("sizek,k",
+        value<rocsparse_int>(&arg.K)->default_value(128),
+        "Specific matrix/vector size testing: SPARSE-3: the number of columns")
+
+        ("sizennz,z",
+        value<rocsparse_int>(&arg.nnz)->default_value(32),
+        "Specific vector size testing, LEVEL-1: the number of non-zero elements "
+        "of the sparse vector.")
+
+        ("blockdim",
+        value<std::string>(&sweep_block_dim)->default_value("2"),
+        "BSR block dimension or SELL-C-sigma slice size, accepts a sweep specification (default: 2)")
+
+        ("row-blockdimA",
+        value<std::string>(&sweep_row_block_dimA)->default_value("2"),
+        "General BSR row block dimension or SELL-C-sigma sorting window, accepts a sweep specification (default: 2)")
+
+        ("col-blockdimA",
+        value<std::string>(&sweep_col_block_dimA)->default_value("2"),
+        "General BSR col block dimension, accepts a sweep specification (default: 2)")
+
+        ("row-blockdimB",
+        value<rocsparse_int>(&arg.row_block_dimB)->default_value(2),
+        "General BSR row block dimension (default: 2)")
+
+        ("col-blockdimB",
+        value<rocsparse_int>(&arg.col_block_dimB)->default_value(2),
+        "General BSR col block dimension (default: 2)")
+
+        ("mtx",
+        value<std::string>(&filename)->default_value(""), "read from matrix "
+        "market (.mtx) format. This will override parameters -m, -n, and -z.")
+
+        ("rocalution",
+        value<std::string>(&rocalution)->default_value(""),
+        "read from rocalution matrix binary file. This will override parameter --mtx")
+
+        ("dimx",
+        value<rocsparse_int>(&arg.dimx)->default_value(0.0), "assemble "
+        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
+        "will override parameters -m, -n, -z and --mtx.")
+
+        ("dimy",
+        value<rocsparse_int>(&arg.dimy)->default_value(0.0), "assemble "
+        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
+        "will override parameters -m, -n, -z and --mtx.")
+
+        ("dimz",
+        value<rocsparse_int>(&arg.dimz)->default_value(0.0), "assemble "
+        "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
+        "will override parameters -m, -n, -z and --mtx.")
+
+        ("alpha",
+        value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
+
+        ("beta",
+        value<double>(&arg.beta)->default_value(0.0), "specifies the scalar beta")
+
+        ("threshold",
+        value<double>(&arg.threshold)->default_value(1.0), "specifies the scalar threshold")
+
+        ("percentage",
+        value<double>(&arg.percentage)->default_value(0.0), "specifies the scalar percentage")
+
+        ("transposeA",
+        value<char>(&transA)->default_value('N'),
+        "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("transposeB",
+        value<char>(&transB)->default_value('N'),
+        "N = no transpose, T = transpose, C = conjugate transpose, (default = N)")
+
+        ("indexbaseA",
+        value<int>(&baseA)->default_value(0),
+        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
+
+        ("indexbaseB",
+        value<int>(&baseB)->default_value(0),
+        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
+
+        ("indexbaseC",
+        value<int>(&baseC)->default_value(0),
+        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
+
+        ("indexbaseD",
+        value<int>(&baseD)->default_value(0),
+        "0 = zero-based indexing, 1 = one-based indexing, (default: 0)")
+
+        ("action",
+        value<int>(&action)->default_value(0),
+        "0 = rocsparse_action_numeric, 1 = rocsparse_action_symbolic, (default: 0)")
+
+        ("hybpart",
+        value<int>(&part)->default_value(0),
+        "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
+        "2 = rocsparse_hyb_partition_max, (default: 0)")
+
+        ("diag",
+        value<char>(&diag)->default_value('N'),
+        "N = non-unit diagonal, U = unit diagonal, (default = N)")
+
+        ("uplo",
+        value<char>(&uplo)->default_value('L'),
+        "L = lower fill, U = upper fill, (default = L)")
+
+        ("apolicy",
+        value<char>(&apol)->default_value('R'),
+        "R = reuse meta data, F = force re-build, (default = R)")
+
+        ("function,f",
+        value<std::string>(&function)->default_value("axpyi"),
+        "SPARSE function to test. Options:\n"
+        "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
+        "  Level2: bsrmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, cscmv, csrsv, ellmv, sellmv, csr16mv, spmv_bsr, spmv_mixed, spmv_batched, spmv_fused, hybmv, gebsrmv, gemvi\n"
+        "  Level3: bsrmm, gebsrmm, csrmm, cscmm, coomm, sellmm, spmm_bsr, csrsm, gemmi, sddmm\n"
+        "  Extra: csrgeam, csrgemm\n"
+        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch\n"
+        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2sell, csr2csr16, csr2hyb, csr2bsr, csr2gebsr\n"
+        "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
+        "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
+        "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, sparse_to_dense_bsr, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
+        "  Sorting: cscsort, csrsort, coosort\n"
+        "  Misc: identity, nnz\n"
+        "  Autotuning: autotune_spmv, autotune_spmm\n"
+        "  A/B comparison: ab_spmv, ab_spmm")
+
+        ("indextype",
+        value<char>(&indextype)->default_value('s'),
+        "Specify index types to be int32_t (s), int64_t (d) or mixed (m). Options: s,d,m")
+
+        ("precision,r",
+        value<char>(&precision)->default_value('s'), "Options: s,d,c,z")
+
+        ("verify,v",
+        value<rocsparse_int>(&arg.unit_check)->default_value(0),
+        "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+
+        ("iters,i",
+        value<std::string>(&sweep_iters)->default_value("10"),
+        "Iterations to run inside timing loop, accepts a sweep specification")
+
+        ("device,d",
+        value<rocsparse_int>(&device_id)->default_value(0),
+        "Set default device to be used for subsequent program runs")
+
+        ("direction",
+        value<rocsparse_int>(&dir)->default_value(rocsparse_direction_row),
+        "Indicates whether a dense matrix should be parsed by rows or by columns, assuming column-major storage: row = 0, column = 1 (default: 0)")
+
+        ("order",
+        value<rocsparse_int>(&order)->default_value(rocsparse_order_column),
+        "Indicates whether a dense matrix is laid out in column-major storage: 1, or row-major storage 0 (default: 1)")
+
+        ("format",
+        value<rocsparse_int>(&format)->default_value(rocsparse_format_coo),
+        "Indicates wther a sparse matrix is laid out in coo format: 0, coo_aos format: 1, csr format: 2, csc format: 3 or ell format: 4 (default:0)")
+
+        ("denseld",
+        value<std::string>(&sweep_denseld)->default_value("128"),
+        "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage. "
+        "Accepts a sweep specification")
+
+        ("machine-profile",
+        value<std::string>(&machine_profile)->default_value(""),
+        "Machine profile file with peak bandwidth (GB/s) and peak GFlop/s. If given, each "
+        "result additionally reports arithmetic intensity, percentage of peak and the bounding "
+        "roof. Format: one 'key = value' per line with keys name, bandwidth, gflops_f32, gflops_f64")
+
+        ("reuses",
+        value<int>(&rocsparse_autotune_options::active().reuses)->default_value(100),
+        "Autotuning: number of times the operation is reused with the same matrix. Conversion "
+        "and analysis costs are amortized over this number of calls (default: 100)")
+
+        ("autotune-json",
+        value<std::string>(&rocsparse_autotune_options::active().json)->default_value(""),
+        "Autotuning: write the JSON report to this file instead of stdout")
+
+        ("footprint-only",
+        bool_switch(&rocsparse_footprint_only())->default_value(false),
+        "Conversion: compute the memory footprint of the output format on the host, "
+        "without running any kernels")
+
+        ("ab-configs",
+        value<std::string>(&rocsparse_ab_options::active().configs)->default_value(""),
+        "A/B comparison: comma separated list of configurations, the first one is the baseline. "
+        "ab_spmv: csr_adaptive, csr_stream, csr_merge, coo, ell "
+        "(default: csr_adaptive,csr_stream). "
+        "ab_spmm: csr, coo_atomic, coo_segmented (default: coo_atomic,coo_segmented). "
+        "One call of each configuration is timed per iteration, in randomized order")
+
+        ("ab-seed",
+        value<unsigned int>(&rocsparse_ab_options::active().seed)->default_value(0),
+        "A/B comparison: seed of the randomized order (default: 0)")
+
+        ("sweep-metric",
+        value<std::string>(&sweep_metric)->default_value("GFlop/s"),
+        "Sweep: column of the timing output that is tabulated when exactly two parameters "
+        "are swept (default: GFlop/s)")
+
+        ("sweep-output",
+        value<std::string>(&sweep_output)->default_value(""),
+        "Sweep: write the results to this file instead of stdout. Parameters --sizen, "
+        "--blockdim, --row-blockdimA, --col-blockdimA, --denseld and --iters accept a comma "
+        "separated list of values a, ranges a:b, strided ranges a:b:s and geometric ranges "
+        "a:b*f, e.g. --blockdim 1:32*2. All combinations are benchmarked in a single run and "
+        "collected in a table with one row per combination");
+
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
     {
-        if(precision == 's')
-            testing_csr2csc<float>(arg);
-        else if(precision == 'd')
-            testing_csr2csc<double>(arg);
-        else if(precision == 'c')
-            testing_csr2csc<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2csc<rocsparse_double_complex>(arg);
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        std::cerr << "Invalid value for --direction" << std::endl;
+        return -1;
+    }
+
+    if(order != rocsparse_order_row && order != rocsparse_order_column)
+    {
+        std::cerr << "Invalid value for --order" << std::endl;
+        return -1;
+    }
+
+    if(format != rocsparse_format_csr && format != rocsparse_format_coo
+       && format != rocsparse_format_coo_aos && format != rocsparse_format_ell
+       && format != rocsparse_format_csc)
+    {
+        std::cerr << "Invalid value for --format" << std::endl;
+        return -1;
     }
-    else if(function == "gebsr2gebsc")
+
+    if(indextype != 's' && indextype != 'd' && indextype != 'm')
     {
-        if(precision == 's')
-            testing_gebsr2gebsc<float>(arg);
-        else if(precision == 'd')
-            testing_gebsr2gebsc<double>(arg);
-        else if(precision == 'c')
-            testing_gebsr2gebsc<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gebsr2gebsc<rocsparse_double_complex>(arg);
+        std::cerr << "Invalid value for --indextype" << std::endl;
+        return -1;
     }
-    else if(function == "csr2ell")
+
+    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
     {
-        if(precision == 's')
-            testing_csr2ell<float>(arg);
-        else if(precision == 'd')
-            testing_csr2ell<double>(arg);
-        else if(precision == 'c')
-            testing_csr2ell<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2ell<rocsparse_double_complex>(arg);
+        std::cerr << "Invalid value for --precision" << std::endl;
+        return -1;
     }
-    else if(function == "csr2hyb")
+
+    if(rocsparse_autotune_options::active().reuses < 0)
     {
-        if(precision == 's')
-            testing_csr2hyb<float>(arg);
-        else if(precision == 'd')
-            testing_csr2hyb<double>(arg);
-        else if(precision == 'c')
-            testing_csr2hyb<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2hyb<rocsparse_double_complex>(arg);
+        std::cerr << "Invalid value for --reuses" << std::endl;
+        return -1;
     }
-    else if(function == "csr2bsr")
+
+    if(machine_profile != "")
     {
-        if(precision == 's')
-            testing_csr2bsr<float>(arg);
-        else if(precision == 'd')
-            testing_csr2bsr<double>(arg);
-        else if(precision == 'c')
-            testing_csr2bsr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2bsr<rocsparse_double_complex>(arg);
+        rocsparse_machine_profile& profile = rocsparse_machine_profile::active();
+        if(!profile.load(machine_profile))
+        {
+            std::cerr << "Invalid value for --machine-profile" << std::endl;
+            return -1;
+        }
+
+        profile.precision = precision;
     }
-    else if(function == "csr2gebsr")
+
+    if(transA == 'N')
     {
-        if(precision == 's')
-            testing_csr2gebsr<float>(arg);
-        else if(precision == 'd')
-            testing_csr2gebsr<double>(arg);
-        else if(precision == 'c')
-            testing_csr2gebsr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2gebsr<rocsparse_double_complex>(arg);
+        arg.transA = rocsparse_operation_none;
     }
-    else if(function == "coo2csr")
+    else if(transA == 'T')
     {
-        testing_coo2csr<float>(arg);
+        arg.transA = rocsparse_operation_transpose;
+        ;
     }
-    else if(function == "ell2csr")
+    else if(transA == 'C')
     {
-        if(precision == 's')
-            testing_ell2csr<float>(arg);
-        else if(precision == 'd')
-            testing_ell2csr<double>(arg);
-        else if(precision == 'c')
-            testing_ell2csr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_ell2csr<rocsparse_double_complex>(arg);
+        arg.transA = rocsparse_operation_conjugate_transpose;
     }
-    else if(function == "hyb2csr")
+
+    if(transB == 'N')
     {
-        if(precision == 's')
-            testing_hyb2csr<float>(arg);
-        else if(precision == 'd')
-            testing_hyb2csr<double>(arg);
-        else if(precision == 'c')
-            testing_hyb2csr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_hyb2csr<rocsparse_double_complex>(arg);
+        arg.transB = rocsparse_operation_none;
     }
-    else if(function == "bsr2csr")
+    else if(transB == 'T')
     {
-        if(precision == 's')
-            testing_bsr2csr<float>(arg);
-        else if(precision == 'd')
-            testing_bsr2csr<double>(arg);
-        else if(precision == 'c')
-            testing_bsr2csr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_bsr2csr<rocsparse_double_complex>(arg);
+        arg.transB = rocsparse_operation_transpose;
     }
-    else if(function == "gebsr2csr")
+    else if(transB == 'C')
     {
-        if(precision == 's')
-            testing_gebsr2csr<float>(arg);
-        else if(precision == 'd')
-            testing_gebsr2csr<double>(arg);
-        else if(precision == 'c')
-            testing_gebsr2csr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gebsr2csr<rocsparse_double_complex>(arg);
+        arg.transB = rocsparse_operation_conjugate_transpose;
     }
-    else if(function == "gebsr2gebsr")
+
+    arg.baseA = (baseA == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
+    arg.baseB = (baseB == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
+    arg.baseC = (baseC == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
+    arg.baseD = (baseD == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
+
+    arg.action = (action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
+    arg.part   = (part == 0)   ? rocsparse_hyb_partition_auto
+                 : (part == 1) ? rocsparse_hyb_partition_user
+                               : rocsparse_hyb_partition_max;
+    arg.diag   = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
+    arg.uplo   = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
+    arg.apol   = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
+    arg.spol   = rocsparse_solve_policy_auto;
+    arg.direction
+        = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
+    arg.order  = (order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
+    arg.format = (rocsparse_format)format;
+
+    // rocALUTION parameter overrides filename parameter
+    if(rocalution != "")
     {
-        if(precision == 's')
-            testing_gebsr2gebsr<float>(arg);
-        else if(precision == 'd')
-            testing_gebsr2gebsr<double>(arg);
-        else if(precision == 'c')
-            testing_gebsr2gebsr<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_gebsr2gebsr<rocsparse_double_complex>(arg);
+        strcpy(arg.filename, rocalution.c_str());
+        arg.matrix = rocsparse_matrix_file_rocalution;
     }
-    else if(function == "csr2csr_compress")
+    else if(arg.dimx != 0 && arg.dimy != 0 && arg.dimz != 0)
     {
-        if(precision == 's')
-            testing_csr2csr_compress<float>(arg);
-        else if(precision == 'd')
-            testing_csr2csr_compress<double>(arg);
-        else if(precision == 'c')
-            testing_csr2csr_compress<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csr2csr_compress<rocsparse_double_complex>(arg);
+        arg.matrix = rocsparse_matrix_laplace_3d;
     }
-    else if(function == "prune_csr2csr")
+    else if(arg.dimx != 0 && arg.dimy != 0)
     {
-        if(precision == 's')
-            testing_prune_csr2csr<float>(arg);
-        else if(precision == 'd')
-            testing_prune_csr2csr<double>(arg);
+        arg.matrix = rocsparse_matrix_laplace_2d;
     }
-    else if(function == "prune_csr2csr_by_percentage")
+    else if(filename != "")
     {
-        if(precision == 's')
-            testing_prune_csr2csr_by_percentage<float>(arg);
-        else if(precision == 'd')
-            testing_prune_csr2csr_by_percentage<double>(arg);
+        strcpy(arg.filename, filename.c_str());
+        arg.matrix = rocsparse_matrix_file_mtx;
     }
-    else if(function == "dense_to_sparse_coo")
+    else
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_coo<int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_coo<int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_coo<int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_coo<int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_coo<int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_coo<int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_coo<int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_coo<int64_t, rocsparse_double_complex>(arg);
-        }
+        arg.matrix = rocsparse_matrix_random;
     }
-    else if(function == "dense_to_sparse_csr")
+
+    arg.matrix_init_kind = rocsparse_matrix_init_kind_default;
+
+    // Device query
+    int devs;
+    if(hipGetDeviceCount(&devs) != hipSuccess)
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csr<int32_t, int32_t, float>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csr<int64_t, int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csr<int64_t, int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csr<int32_t, int32_t, double>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csr<int64_t, int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csr<int64_t, int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
-        }
+        std::cerr << "Error: cannot get device count" << std::endl;
+        return -1;
     }
-    else if(function == "dense_to_sparse_csc")
+
+    std::cout << "Query device success: there are " << devs << " devices" << std::endl;
+
+    for(int i = 0; i < devs; ++i)
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csc<int32_t, int32_t, float>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csc<int64_t, int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csc<int64_t, int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csc<int32_t, int32_t, double>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csc<int64_t, int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csc<int64_t, int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_dense_to_sparse_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
+        hipDeviceProp_t prop;
+
+        if(hipGetDeviceProperties(&prop, i) != hipSuccess)
         {
-            if(indextype == 's')
-                testing_dense_to_sparse_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'm')
-                testing_dense_to_sparse_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_dense_to_sparse_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
+            std::cerr << "Error: cannot get device properties" << std::endl;
+            return -1;
         }
+
+        std::cout << "Device ID " << i << ": " << prop.name << std::endl;
+        std::cout << "-------------------------------------------------------------------------"
+                  << std::endl;
+        std::cout << "with " << (prop.totalGlobalMem >> 20) << "MB memory, clock rate "
+                  << prop.clockRate / 1000 << "MHz @ computing capability " << prop.major << "."
+                  << prop.minor << std::endl;
+        std::cout << "maxGridDimX " << prop.maxGridSize[0] << ", sharedMemPerBlock "
+                  << (prop.sharedMemPerBlock >> 10) << "KB, maxThreadsPerBlock "
+                  << prop.maxThreadsPerBlock << std::endl;
+        std::cout << "wavefrontSize " << prop.warpSize << std::endl;
+        std::cout << "-------------------------------------------------------------------------"
+                  << std::endl;
     }
-    else if(function == "sparse_to_dense_coo")
+
+    // Set device
+    if(hipSetDevice(device_id) != hipSuccess || device_id >= devs)
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_coo<int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_coo<int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_coo<int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_coo<int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_coo<int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_coo<int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_coo<int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_coo<int64_t, rocsparse_double_complex>(arg);
-        }
+        std::cerr << "Error: cannot set device ID " << device_id << std::endl;
+        return -1;
     }
-    else if(function == "sparse_to_dense_csr")
+
+    hipDeviceProp_t prop;
+    hipGetDeviceProperties(&prop, device_id);
+
+    std::cout << "Using device ID " << device_id << " (" << prop.name << ") for rocSPARSE"
+              << std::endl;
+    std::cout << "-------------------------------------------------------------------------"
+              << std::endl;
+
+    if(rocsparse_machine_profile::active().valid())
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csr<int32_t, int32_t, float>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csr<int64_t, int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csr<int64_t, int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csr<int32_t, int32_t, double>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csr<int64_t, int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csr<int64_t, int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csr<int32_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csr<int64_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csr<int64_t, int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csr<int32_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csr<int64_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
-        }
+        const rocsparse_machine_profile& profile = rocsparse_machine_profile::active();
+
+        std::cout << "Machine profile " << profile.name << ": " << profile.bandwidth
+                  << " GB/s, " << profile.peak_gflops() << " GFlop/s" << std::endl;
+        std::cout << "-------------------------------------------------------------------------"
+                  << std::endl;
     }
-    else if(function == "sparse_to_dense_csc")
+
+    // Print version
+    rocsparse_handle handle;
+    rocsparse_create_handle(&handle);
+
+    int  ver;
+    char rev[64];
+
+    rocsparse_get_version(handle, &ver);
+    rocsparse_get_git_rev(handle, rev);
+
+    std::cout << "rocSPARSE version: " << ver / 100000 << "." << ver / 100 % 1000 << "."
+              << ver % 100 << "-" << rev << std::endl;
+
+    rocsparse_destroy_handle(handle);
+
+    /* ============================================================================================
+    */
+    std::vector<int64_t> N;
+    std::vector<int64_t> block_dim;
+    std::vector<int64_t> row_block_dimA;
+    std::vector<int64_t> col_block_dimA;
+    std::vector<int64_t> denseld;
+    std::vector<int64_t> iters;
+
+    if(!rocsparse_sweep_parse(sweep_N, N)
+       || arg.M < 0 || *std::min_element(N.begin(), N.end()) < 0)
     {
-        if(precision == 's')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csc<int32_t, int32_t, float>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csc<int64_t, int32_t, float>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csc<int64_t, int64_t, float>(arg);
-        }
-        else if(precision == 'd')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csc<int32_t, int32_t, double>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csc<int64_t, int32_t, double>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csc<int64_t, int64_t, double>(arg);
-        }
-        else if(precision == 'c')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
-        }
-        else if(precision == 'z')
-        {
-            if(indextype == 's')
-                testing_sparse_to_dense_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'm')
-                testing_sparse_to_dense_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
-            else if(indextype == 'd')
-                testing_sparse_to_dense_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
-        }
+        std::cerr << "Invalid dimension" << std::endl;
+        return -1;
     }
-    else if(function == "csrcolor")
+
+    if(!rocsparse_sweep_parse(sweep_block_dim, block_dim)
+       || *std::min_element(block_dim.begin(), block_dim.end()) < 1)
     {
-        if(precision == 's')
-            testing_csrcolor<float>(arg);
-        else if(precision == 'd')
-            testing_csrcolor<double>(arg);
-        else if(precision == 'c')
-            testing_csrcolor<rocsparse_float_complex>(arg);
-        else if(precision == 'z')
-            testing_csrcolor<rocsparse_double_complex>(arg);
+        std::cerr << "Invalid value for --blockdim" << std::endl;
+        return -1;
     }
-    else if(function == "csrsort")
+
+    if(!rocsparse_sweep_parse(sweep_row_block_dimA, row_block_dimA)
+       || *std::min_element(row_block_dimA.begin(), row_block_dimA.end()) < 1)
     {
-        testing_csrsort<float>(arg);
+        std::cerr << "Invalid value for --row-blockdimA" << std::endl;
+        return -1;
     }
-    else if(function == "cscsort")
+
+    if(!rocsparse_sweep_parse(sweep_col_block_dimA, col_block_dimA)
+       || *std::min_element(col_block_dimA.begin(), col_block_dimA.end()) < 1)
     {
-        testing_cscsort<float>(arg);
+        std::cerr << "Invalid value for --col-blockdimA" << std::endl;
+        return -1;
     }
-    else if(function == "coosort")
+
+    if(!rocsparse_sweep_parse(sweep_denseld, denseld))
     {
-        testing_coosort<float>(arg);
+        std::cerr << "Invalid value for --denseld" << std::endl;
+        return -1;
     }
-    else if(function == "identity")
+
+    if(!rocsparse_sweep_parse(sweep_iters, iters))
     {
-        testing_identity<float>(arg);
+        std::cerr << "Invalid value for --iters" << std::endl;
+        return -1;
     }
-    else
+
+    if(arg.row_block_dimB < 1)
     {
-        std::cerr << "Invalid value for --function" << std::endl;
+        std::cerr << "Invalid value for --row-blockdimB" << std::endl;
+        return -1;
+    }
+
+    if(arg.col_block_dimB < 1)
+    {
+        std::cerr << "Invalid value for --col-blockdimB" << std::endl;
         return -1;
     }
+
+    // Parameter sweep, the last parameter varies fastest
+    rocsparse_sweep sweep;
+    sweep.add("sizen", N);
+    sweep.add("blockdim", block_dim);
+    sweep.add("row-blockdimA", row_block_dimA);
+    sweep.add("col-blockdimA", col_block_dimA);
+    sweep.add("denseld", denseld);
+    sweep.add("iters", iters);
+
+    for(size_t i = 0; i < sweep.size(); ++i)
+    {
+        std::vector<int64_t> point = sweep.point(i);
+
+        arg.N              = point[0];
+        arg.block_dim      = point[1];
+        arg.row_block_dimA = point[2];
+        arg.col_block_dimA = point[3];
+        arg.denseld        = point[4];
+        arg.iters          = point[5];
+
+        rocsparse_timing_record().clear();
+
+        int status = rocsparse_bench_run(function, precision, indextype, arg);
+        if(status != 0)
+        {
+            return status;
+        }
+
+        if(sweep.active())
+        {
+            sweep.record(i);
+        }
+    }
+
+    if(sweep.active())
+    {
+        if(sweep_output != "")
+        {
+            std::ofstream ofs(sweep_output);
+            if(!ofs)
+            {
+                std::cerr << "Error: cannot open " << sweep_output << std::endl;
+                return -1;
+            }
+
+            sweep.write(ofs, sweep_metric);
+        }
+        else
+        {
+            std::cout << "-------------------------------------------------------------------------"
+                      << std::endl;
+            sweep.write(std::cout, sweep_metric);
+        }
+    }
+
     return 0;
 }
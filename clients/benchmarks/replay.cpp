@@ -0,0 +1,553 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse.hpp"
+#include "rocsparse_datatype2string.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "program_options.hpp"
+
+/* ==================================================================================== */
+/*! \brief  call of a capture log, written by ROCSPARSE_LAYER=8 */
+struct replay_call
+{
+    std::string           function;
+    char                  precision;
+    rocsparse_operation   trans;
+    rocsparse_matrix_type type;
+    rocsparse_fill_mode   fill_mode;
+    int64_t               m;
+    int64_t               n;
+    int64_t               nnz;
+    double                alpha_re;
+    double                alpha_im;
+    double                beta_re;
+    double                beta_im;
+    bool                  adaptive;
+    std::string           file;
+};
+
+/* ==================================================================================== */
+/*! \brief  captured CSR operand */
+struct replay_csr
+{
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    rocsparse_index_base base;
+    char                 precision;
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col_ind;
+    std::vector<char>    val;
+};
+
+/* ==================================================================================== */
+/*! \brief  timing of a replayed call */
+struct replay_result
+{
+    double usec;
+    double error;
+    double gflop_count;
+    double gbyte_count;
+};
+
+/* ==================================================================================== */
+/*! \brief  options of the replay */
+struct replay_options
+{
+    int         iters;
+    std::string backend;
+    bool        verify;
+};
+
+static bool replay_parse(const std::string& line, replay_call& call)
+{
+    std::istringstream is(line);
+
+    int         trans;
+    int         type;
+    int         fill_mode;
+    std::string algo;
+
+    is >> call.function >> call.precision >> trans >> type >> fill_mode >> call.m >> call.n
+        >> call.nnz >> call.alpha_re >> call.alpha_im >> call.beta_re >> call.beta_im >> algo
+        >> call.file;
+
+    if(is.fail() || call.function != "csrmv")
+    {
+        return false;
+    }
+
+    call.trans     = (rocsparse_operation)trans;
+    call.type      = (rocsparse_matrix_type)type;
+    call.fill_mode = (rocsparse_fill_mode)fill_mode;
+    call.adaptive  = (algo == "adaptive");
+
+    return true;
+}
+
+static bool replay_load(const std::string& path, replay_csr& A)
+{
+    std::ifstream ifs(path, std::ios::binary);
+
+    int64_t header[5];
+    if(!ifs.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        return false;
+    }
+
+    A.m         = header[0];
+    A.n         = header[1];
+    A.nnz       = header[2];
+    A.base      = (rocsparse_index_base)header[3];
+    A.precision = (char)header[4];
+
+    size_t val_size = (A.precision == 's')   ? sizeof(float)
+                      : (A.precision == 'd') ? sizeof(double)
+                      : (A.precision == 'c') ? sizeof(rocsparse_float_complex)
+                                             : sizeof(rocsparse_double_complex);
+
+    A.row_ptr.resize(A.m + 1);
+    A.col_ind.resize(A.nnz);
+    A.val.resize(val_size * A.nnz);
+
+    ifs.read(reinterpret_cast<char*>(A.row_ptr.data()), sizeof(int64_t) * (A.m + 1));
+    ifs.read(reinterpret_cast<char*>(A.col_ind.data()), sizeof(int64_t) * A.nnz);
+    ifs.read(A.val.data(), A.val.size());
+
+    return ifs.good();
+}
+
+template <typename T>
+static T replay_scalar(double re, double im)
+{
+    return static_cast<T>(re);
+}
+
+template <>
+rocsparse_float_complex replay_scalar<rocsparse_float_complex>(double re, double im)
+{
+    return rocsparse_float_complex(static_cast<float>(re), static_cast<float>(im));
+}
+
+template <>
+rocsparse_double_complex replay_scalar<rocsparse_double_complex>(double re, double im)
+{
+    return rocsparse_double_complex(re, im);
+}
+
+/* ==================================================================================== */
+/*! \brief  host reference of a csrmv call */
+template <typename T>
+static void replay_host_csrmv(const replay_call&                call,
+                              const replay_csr&                 A,
+                              T                                 alpha,
+                              const host_vector<rocsparse_int>& csr_row_ptr,
+                              const host_vector<rocsparse_int>& csr_col_ind,
+                              const host_vector<T>&             csr_val,
+                              const host_vector<T>&             x,
+                              T                                 beta,
+                              host_vector<T>&                   y)
+{
+    if(call.type == rocsparse_matrix_type_general)
+    {
+        host_csrmv(static_cast<rocsparse_int>(A.m),
+                   static_cast<rocsparse_int>(A.nnz),
+                   alpha,
+                   csr_row_ptr.data(),
+                   csr_col_ind.data(),
+                   csr_val.data(),
+                   x.data(),
+                   beta,
+                   y.data(),
+                   A.base,
+                   call.adaptive ? 1 : 0);
+    }
+    else
+    {
+        host_csrmv_symmetric(call.trans,
+                             static_cast<rocsparse_int>(A.m),
+                             static_cast<rocsparse_int>(A.nnz),
+                             alpha,
+                             csr_row_ptr.data(),
+                             csr_col_ind.data(),
+                             csr_val.data(),
+                             x.data(),
+                             beta,
+                             y.data(),
+                             call.type,
+                             call.fill_mode,
+                             A.base);
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  replay a csrmv call, returns false if the call cannot be replayed */
+template <typename T>
+static bool replay_csrmv(const replay_call&    call,
+                         const replay_csr&     A,
+                         const replay_options& options,
+                         replay_result&        result)
+{
+    // The captured operand is converted to rocsparse_int
+    if(A.m > std::numeric_limits<rocsparse_int>::max()
+       || A.n > std::numeric_limits<rocsparse_int>::max()
+       || A.nnz > std::numeric_limits<rocsparse_int>::max())
+    {
+        return false;
+    }
+
+    rocsparse_int M   = A.m;
+    rocsparse_int N   = A.n;
+    rocsparse_int nnz = A.nnz;
+
+    // Host reference is only available for non-transposed general matrices, and for
+    // symmetric and hermitian matrices
+    bool host = (options.backend == "host");
+    if(call.trans != rocsparse_operation_none && call.type == rocsparse_matrix_type_general
+       && (host || options.verify))
+    {
+        return false;
+    }
+
+    host_vector<rocsparse_int> hcsr_row_ptr(A.row_ptr.begin(), A.row_ptr.end());
+    host_vector<rocsparse_int> hcsr_col_ind(A.col_ind.begin(), A.col_ind.end());
+    host_vector<T>             hcsr_val(nnz);
+
+    memcpy(hcsr_val.data(), A.val.data(), sizeof(T) * nnz);
+
+    T halpha = replay_scalar<T>(call.alpha_re, call.alpha_im);
+    T hbeta  = replay_scalar<T>(call.beta_re, call.beta_im);
+
+    result.gflop_count = spmv_gflop_count(M, nnz, hbeta != static_cast<T>(0));
+    result.gbyte_count = csrmv_gbyte_count<T>(M, N, nnz, hbeta != static_cast<T>(0));
+    result.error       = 0.0;
+
+    // Dense vectors are not captured
+    rocsparse_int xsize = (call.trans == rocsparse_operation_none) ? N : M;
+    rocsparse_int ysize = (call.trans == rocsparse_operation_none) ? M : N;
+
+    host_vector<T> hx(xsize);
+    host_vector<T> hy(ysize);
+
+    for(rocsparse_int i = 0; i < xsize; ++i)
+    {
+        hx[i] = random_generator<T>();
+    }
+
+    for(rocsparse_int i = 0; i < ysize; ++i)
+    {
+        hy[i] = random_generator<T>();
+    }
+
+    // Host reference
+    host_vector<T> hy_ref(hy);
+    if(host || options.verify)
+    {
+        replay_host_csrmv(call, A, halpha, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, hbeta, hy_ref);
+    }
+
+    if(host)
+    {
+        host_vector<T> hy_1(hy);
+
+        double start = get_time_us();
+
+        for(int iter = 0; iter < options.iters; ++iter)
+        {
+            replay_host_csrmv(
+                call, A, halpha, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, hbeta, hy_1);
+        }
+
+        result.usec = (get_time_us() - start) / options.iters;
+
+        return true;
+    }
+
+    rocsparse_local_handle    handle;
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_info  info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, A.base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, call.type));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, call.fill_mode));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    device_vector<rocsparse_int> dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<rocsparse_int> dcsr_col_ind(hcsr_col_ind);
+    device_vector<T>             dcsr_val(hcsr_val);
+    device_vector<T>             dx(hx);
+    device_vector<T>             dy(hy);
+
+    rocsparse_mat_info csrmv_info = nullptr;
+    if(call.adaptive)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(
+            handle, call.trans, M, N, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info));
+        csrmv_info = info;
+    }
+
+    // Warm up, the result is used for verification
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                             call.trans,
+                                             M,
+                                             N,
+                                             nnz,
+                                             &halpha,
+                                             descr,
+                                             dcsr_val,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             csrmv_info,
+                                             dx,
+                                             &hbeta,
+                                             dy));
+
+    if(options.verify)
+    {
+        host_vector<T> hy_1(ysize);
+        hy_1.transfer_from(dy);
+
+        // Relative error in the maximum norm
+        double err = 0.0;
+        double nrm = 0.0;
+        for(rocsparse_int i = 0; i < ysize; ++i)
+        {
+            err = std::max(err, (double)std::abs(hy_1[i] - hy_ref[i]));
+            nrm = std::max(nrm, (double)std::abs(hy_ref[i]));
+        }
+
+        result.error = (nrm > 0.0) ? err / nrm : err;
+    }
+
+    double start = get_time_us_sync(rocsparse_get_stream(handle));
+
+    for(int iter = 0; iter < options.iters; ++iter)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                 call.trans,
+                                                 M,
+                                                 N,
+                                                 nnz,
+                                                 &halpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 csrmv_info,
+                                                 dx,
+                                                 &hbeta,
+                                                 dy));
+    }
+
+    result.usec = (get_time_us_sync(rocsparse_get_stream(handle)) - start) / options.iters;
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string    capture;
+    replay_options options;
+    rocsparse_int  device_id;
+
+    // clang-format off
+
+    options_description desc("rocsparse replay command line options");
+    desc.add_options() ("help,h", "produces this help message")
+        // clang-format off
+        ("capture",
+        value<std::string>(&capture)->default_value("."),
+        "Directory of the capture, as given by ROCSPARSE_LOG_CAPTURE_PATH")
+
+        ("iters,i",
+        value<int>(&options.iters)->default_value(10),
+        "Iterations run per captured call")
+
+        ("backend",
+        value<std::string>(&options.backend)->default_value("device"),
+        "Backend the calls are replayed with: device, host (reference implementation)")
+
+        ("verify",
+        bool_switch(&options.verify)->default_value(false),
+        "Compare the device results against the host reference implementation")
+
+        ("device,d",
+        value<rocsparse_int>(&device_id)->default_value(0),
+        "Set default device to be used for subsequent program runs");
+
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(options.backend != "device" && options.backend != "host")
+    {
+        std::cerr << "Invalid value for --backend" << std::endl;
+        return -1;
+    }
+
+    if(options.iters <= 0)
+    {
+        std::cerr << "Invalid value for --iters" << std::endl;
+        return -1;
+    }
+
+    if(options.backend == "device" && hipSetDevice(device_id) != hipSuccess)
+    {
+        std::cerr << "Error: cannot set device ID " << device_id << std::endl;
+        return -1;
+    }
+
+    std::ifstream log(capture + "/capture.log");
+    if(!log.good())
+    {
+        std::cerr << "Error: cannot open " << capture << "/capture.log" << std::endl;
+        return -1;
+    }
+
+    rocsparse_seedrand();
+
+    // Operands are loaded once
+    std::map<std::string, std::unique_ptr<replay_csr>> operands;
+
+    std::cout << std::setw(6) << "call" << std::setw(10) << "function" << std::setw(6) << "prec"
+              << std::setw(6) << "trans" << std::setw(12) << "M" << std::setw(12) << "N"
+              << std::setw(12) << "nnz" << std::setw(10) << "algo" << std::setw(12) << "msec"
+              << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s";
+    if(options.verify)
+    {
+        std::cout << std::setw(14) << "error";
+    }
+    std::cout << std::endl;
+
+    std::string line;
+    int         index     = 0;
+    int         skipped   = 0;
+    double      total_sec = 0.0;
+
+    while(std::getline(log, line))
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        replay_call call;
+        if(!replay_parse(line, call))
+        {
+            std::cerr << "Skipping unsupported call: " << line << std::endl;
+            ++skipped;
+            continue;
+        }
+
+        auto it = operands.find(call.file);
+        if(it == operands.end())
+        {
+            std::unique_ptr<replay_csr> A(new replay_csr);
+            if(!replay_load(capture + "/" + call.file, *A))
+            {
+                std::cerr << "Error: cannot read " << call.file << std::endl;
+                return -1;
+            }
+
+            it = operands.emplace(call.file, std::move(A)).first;
+        }
+
+        replay_result result;
+        bool          done = false;
+
+        switch(call.precision)
+        {
+        case 's':
+            done = replay_csrmv<float>(call, *it->second, options, result);
+            break;
+        case 'd':
+            done = replay_csrmv<double>(call, *it->second, options, result);
+            break;
+        case 'c':
+            done = replay_csrmv<rocsparse_float_complex>(call, *it->second, options, result);
+            break;
+        case 'z':
+            done = replay_csrmv<rocsparse_double_complex>(call, *it->second, options, result);
+            break;
+        }
+
+        if(!done)
+        {
+            std::cerr << "Skipping call " << index << ": " << line << std::endl;
+            ++skipped;
+            ++index;
+            continue;
+        }
+
+        std::cout << std::setw(6) << index << std::setw(10) << call.function << std::setw(6)
+                  << call.precision << std::setw(6) << rocsparse_operation2string(call.trans)
+                  << std::setw(12) << call.m << std::setw(12) << call.n << std::setw(12)
+                  << call.nnz << std::setw(10) << (call.adaptive ? "adaptive" : "stream")
+                  << std::setw(12) << result.usec / 1e3 << std::setw(12)
+                  << result.gflop_count / result.usec * 1e6 << std::setw(12)
+                  << result.gbyte_count / result.usec * 1e6;
+        if(options.verify)
+        {
+            std::cout << std::setw(14) << result.error;
+        }
+        std::cout << std::endl;
+
+        total_sec += result.usec * 1e-6;
+        ++index;
+    }
+
+    std::cout << "Replayed " << index - skipped << " calls on " << options.backend << " in "
+              << total_sec * 1e3 << " msec per iteration";
+    if(skipped > 0)
+    {
+        std::cout << ", " << skipped << " calls skipped";
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_ab.hpp"
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_autotune.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+rocsparse_ab_options& rocsparse_ab_options::active()
+{
+    static rocsparse_ab_options options;
+    return options;
+}
+
+std::vector<std::string> rocsparse_ab_config_names(const std::string& defaults)
+{
+    const std::string& configs = rocsparse_ab_options::active().configs;
+
+    std::vector<std::string> names;
+    std::istringstream       iss(configs.empty() ? defaults : configs);
+    std::string              name;
+    while(std::getline(iss, name, ','))
+    {
+        if(!name.empty())
+        {
+            names.push_back(name);
+        }
+    }
+
+    return names;
+}
+
+std::vector<std::vector<double>> rocsparse_ab_run(hipStream_t                             stream,
+                                                  int                                     rounds,
+                                                  const std::vector<rocsparse_ab_config>& configs)
+{
+    rounds = std::max(rounds, 2);
+
+    // Warm up
+    for(const rocsparse_ab_config& config : configs)
+    {
+        for(int iter = 0; iter < 2; ++iter)
+        {
+            config.run();
+        }
+    }
+
+    std::mt19937        rng(rocsparse_ab_options::active().seed);
+    std::vector<size_t> order(configs.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::vector<std::vector<double>> samples(configs.size(), std::vector<double>(rounds));
+    for(int round = 0; round < rounds; ++round)
+    {
+        std::shuffle(order.begin(), order.end(), rng);
+
+        for(size_t i : order)
+        {
+            double time_used = get_time_us_sync(stream);
+            configs[i].run();
+            samples[i][round] = get_time_us_sync(stream) - time_used;
+        }
+    }
+
+    return samples;
+}
+
+// Two-sided 95% quantile of the Student t distribution
+static double rocsparse_ab_t95(size_t df)
+{
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306,
+                                   2.262,  2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120,
+                                   2.110,  2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064,
+                                   2.060,  2.056, 2.052, 2.048, 2.045, 2.042};
+
+    if(df == 0)
+    {
+        return 0.0;
+    }
+
+    if(df <= 30)
+    {
+        return table[df - 1];
+    }
+
+    return (df <= 40) ? 2.021 : (df <= 60) ? 2.000 : (df <= 120) ? 1.980 : 1.960;
+}
+
+static void rocsparse_ab_mean_stddev(const std::vector<double>& x, double& mean, double& stddev)
+{
+    mean = std::accumulate(x.begin(), x.end(), 0.0) / x.size();
+
+    double sum = 0.0;
+    for(double v : x)
+    {
+        sum += (v - mean) * (v - mean);
+    }
+
+    stddev = (x.size() > 1) ? std::sqrt(sum / (x.size() - 1)) : 0.0;
+}
+
+void rocsparse_ab_report(const char*                             function,
+                         const char*                             precision,
+                         const std::vector<rocsparse_ab_config>& configs,
+                         const std::vector<std::vector<double>>& samples)
+{
+    if(configs.empty())
+    {
+        std::cerr << "Error: no configuration for " << function << std::endl;
+        return;
+    }
+
+    size_t rounds = samples[0].size();
+
+    size_t width = 12;
+    for(const rocsparse_ab_config& config : configs)
+    {
+        width = std::max(width, config.name.size() + 2);
+    }
+
+    std::cout << "A/B comparison of " << function << " (" << precision << "), " << rounds
+              << " interleaved rounds, seed " << rocsparse_ab_options::active().seed
+              << std::endl;
+
+    std::cout << std::left << std::setw(width) << "config" << std::right << std::setw(14)
+              << "median(ms)" << std::setw(14) << "min(ms)" << std::setw(14) << "mean(ms)"
+              << std::setw(14) << "stddev(ms)" << std::setw(12) << "GFlop/s" << std::setw(12)
+              << "GB/s" << std::endl;
+
+    for(size_t i = 0; i < configs.size(); ++i)
+    {
+        double median = rocsparse_autotune_median(samples[i]);
+        double min    = *std::min_element(samples[i].begin(), samples[i].end());
+        double mean, stddev;
+        rocsparse_ab_mean_stddev(samples[i], mean, stddev);
+
+        std::cout << std::left << std::setw(width) << configs[i].name << std::right
+                  << std::fixed << std::setprecision(4) << std::setw(14) << median / 1e3
+                  << std::setw(14) << min / 1e3 << std::setw(14) << mean / 1e3 << std::setw(14)
+                  << stddev / 1e3 << std::setprecision(2) << std::setw(12)
+                  << get_gpu_gflops(median, configs[i].gflop_count) << std::setw(12)
+                  << get_gpu_gbyte(median, configs[i].gbyte_count) << std::endl;
+    }
+
+    if(configs.size() < 2)
+    {
+        std::cout.unsetf(std::ios::floatfield);
+        return;
+    }
+
+    // Differences of each round against the first configuration, run in the same round
+    std::cout << std::endl;
+    std::cout << "Paired differences against " << configs[0].name << std::endl;
+    std::cout << std::left << std::setw(width) << "config" << std::right << std::setw(14)
+              << "diff(ms)" << std::setw(14) << "95% CI low" << std::setw(14) << "95% CI high"
+              << std::setw(10) << "speedup" << std::setw(10) << "wins" << std::setw(14)
+              << "verdict" << std::endl;
+
+    for(size_t i = 1; i < configs.size(); ++i)
+    {
+        std::vector<double> diff(rounds);
+        std::vector<double> speedup(rounds);
+
+        size_t wins = 0;
+        for(size_t r = 0; r < rounds; ++r)
+        {
+            diff[r]    = samples[i][r] - samples[0][r];
+            speedup[r] = (samples[i][r] > 0.0) ? samples[0][r] / samples[i][r] : 1.0;
+            wins += (diff[r] < 0.0);
+        }
+
+        double mean, stddev;
+        rocsparse_ab_mean_stddev(diff, mean, stddev);
+
+        double half = rocsparse_ab_t95(rounds - 1) * stddev / std::sqrt(rounds);
+        double low  = mean - half;
+        double high = mean + half;
+
+        // Significant if the confidence interval of the mean difference excludes zero
+        const char* verdict = (high < 0.0) ? "faster" : (low > 0.0) ? "slower" : "no difference";
+
+        std::cout << std::left << std::setw(width) << configs[i].name << std::right
+                  << std::fixed << std::setprecision(4) << std::setw(14) << mean / 1e3
+                  << std::setw(14) << low / 1e3 << std::setw(14) << high / 1e3
+                  << std::setprecision(3) << std::setw(9) << rocsparse_autotune_median(speedup)
+                  << "x" << std::setprecision(1) << std::setw(9) << 100.0 * wins / rounds << "%"
+                  << std::setw(14) << verdict << std::endl;
+    }
+
+    std::cout.unsetf(std::ios::floatfield);
+}
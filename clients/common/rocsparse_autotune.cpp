@@ -0,0 +1,225 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_autotune.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+rocsparse_autotune_options& rocsparse_autotune_options::active()
+{
+    static rocsparse_autotune_options options;
+    return options;
+}
+
+double rocsparse_autotune_candidate::total_msec(int reuses) const
+{
+    return this->convert_msec + this->analysis_msec + reuses * this->median_msec;
+}
+
+double rocsparse_autotune_median(std::vector<double> samples)
+{
+    if(samples.empty())
+    {
+        return 0.0;
+    }
+
+    size_t half = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + half, samples.end());
+
+    if(samples.size() % 2)
+    {
+        return samples[half];
+    }
+
+    // Even number of samples, average the two middle elements
+    double upper = samples[half];
+    return 0.5 * (upper + *std::max_element(samples.begin(), samples.begin() + half));
+}
+
+static std::string rocsparse_autotune_label(const rocsparse_autotune_candidate& c)
+{
+    std::string label = c.format + " " + c.alg;
+    if(!c.params.empty())
+    {
+        label += " (" + c.params + ")";
+    }
+
+    return label;
+}
+
+static void rocsparse_autotune_json_string(std::ostream& os, const std::string& s)
+{
+    os << '"';
+    for(char c : s)
+    {
+        if(c == '"' || c == '\\')
+        {
+            os << '\\';
+        }
+        os << c;
+    }
+    os << '"';
+}
+
+static void rocsparse_autotune_json(std::ostream&                                    os,
+                                    const char*                                      function,
+                                    const char*                                      precision,
+                                    int64_t                                          M,
+                                    int64_t                                          N,
+                                    int64_t                                          nnz,
+                                    int                                              reuses,
+                                    size_t                                           best,
+                                    size_t                                           fastest,
+                                    const std::vector<rocsparse_autotune_candidate>& candidates)
+{
+    os << std::setprecision(6);
+    os << "{\n";
+    os << "  \"function\": \"" << function << "\",\n";
+    os << "  \"precision\": \"" << precision << "\",\n";
+    os << "  \"M\": " << M << ",\n";
+    os << "  \"N\": " << N << ",\n";
+    os << "  \"nnz\": " << nnz << ",\n";
+    os << "  \"reuses\": " << reuses << ",\n";
+    os << "  \"recommended\": " << best << ",\n";
+    os << "  \"fastest_per_call\": " << fastest << ",\n";
+    os << "  \"candidates\": [\n";
+
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        const rocsparse_autotune_candidate& c = candidates[i];
+
+        os << "    {\"format\": ";
+        rocsparse_autotune_json_string(os, c.format);
+        os << ", \"alg\": ";
+        rocsparse_autotune_json_string(os, c.alg);
+        os << ", \"params\": ";
+        rocsparse_autotune_json_string(os, c.params);
+        os << ", \"convert_msec\": " << c.convert_msec
+           << ", \"analysis_msec\": " << c.analysis_msec << ", \"median_msec\": " << c.median_msec
+           << ", \"min_msec\": " << c.min_msec << ", \"gflops\": " << c.gflops
+           << ", \"gbyte\": " << c.gbyte << ", \"total_msec\": " << c.total_msec(reuses) << "}"
+           << (i + 1 < candidates.size() ? "," : "") << "\n";
+    }
+
+    os << "  ]\n";
+    os << "}" << std::endl;
+}
+
+size_t rocsparse_autotune_report(const char*                                      function,
+                                 const char*                                      precision,
+                                 int64_t                                          M,
+                                 int64_t                                          N,
+                                 int64_t                                          nnz,
+                                 const std::vector<rocsparse_autotune_candidate>& candidates)
+{
+    const rocsparse_autotune_options& options = rocsparse_autotune_options::active();
+
+    int reuses = options.reuses;
+
+    if(candidates.empty())
+    {
+        std::cerr << "Error: no applicable format for " << function << std::endl;
+        return 0;
+    }
+
+    // Recommended candidate minimizes the amortized total time, the fastest candidate
+    // minimizes the time per call only
+    size_t best    = 0;
+    size_t fastest = 0;
+    for(size_t i = 1; i < candidates.size(); ++i)
+    {
+        if(candidates[i].total_msec(reuses) < candidates[best].total_msec(reuses))
+        {
+            best = i;
+        }
+
+        if(candidates[i].median_msec < candidates[fastest].median_msec)
+        {
+            fastest = i;
+        }
+    }
+
+    size_t width = 12;
+    for(const rocsparse_autotune_candidate& c : candidates)
+    {
+        width = std::max(width, rocsparse_autotune_label(c).size() + 2);
+    }
+
+    std::cout << std::left << std::setw(width) << "candidate" << std::right << std::setw(14)
+              << "convert(ms)" << std::setw(14) << "analysis(ms)" << std::setw(14)
+              << "median(ms)" << std::setw(14) << "min(ms)" << std::setw(12) << "GFlop/s"
+              << std::setw(12) << "GB/s" << std::setw(14) << "total(ms)" << std::setw(10)
+              << "vs best" << std::endl;
+
+    double best_total = candidates[best].total_msec(reuses);
+    for(size_t i = 0; i < candidates.size(); ++i)
+    {
+        const rocsparse_autotune_candidate& c     = candidates[i];
+        double                              total = c.total_msec(reuses);
+
+        std::cout << std::left << std::setw(width) << rocsparse_autotune_label(c) << std::right
+                  << std::fixed << std::setprecision(4) << std::setw(14) << c.convert_msec
+                  << std::setw(14) << c.analysis_msec << std::setw(14) << c.median_msec
+                  << std::setw(14) << c.min_msec << std::setprecision(2) << std::setw(12)
+                  << c.gflops << std::setw(12) << c.gbyte << std::setprecision(4)
+                  << std::setw(14) << total << std::setprecision(2) << std::setw(9)
+                  << (best_total > 0.0 ? total / best_total : 1.0) << "x" << std::endl;
+    }
+
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::endl;
+    std::cout << "Recommended for " << reuses << " reuses: "
+              << rocsparse_autotune_label(candidates[best]) << std::endl;
+    if(fastest != best)
+    {
+        std::cout << "Fastest per call: " << rocsparse_autotune_label(candidates[fastest])
+                  << std::endl;
+    }
+    std::cout << std::endl;
+
+    if(options.json.empty())
+    {
+        rocsparse_autotune_json(
+            std::cout, function, precision, M, N, nnz, reuses, best, fastest, candidates);
+    }
+    else
+    {
+        std::ofstream ofs(options.json);
+        if(!ofs.is_open())
+        {
+            std::cerr << "Error: cannot open " << options.json << std::endl;
+        }
+        else
+        {
+            rocsparse_autotune_json(
+                ofs, function, precision, M, N, nnz, reuses, best, fastest, candidates);
+            std::cout << "Autotune report written to " << options.json << std::endl;
+        }
+    }
+
+    return best;
+}
@@ -117,6 +117,13 @@ void unit_check_general(int64_t                         M,
     UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_DOUBLE_COMPLEX_EQ);
 }
 
+template <>
+void unit_check_general(
+    int64_t M, int64_t N, int64_t lda, const uint16_t* hCPU, const uint16_t* hGPU)
+{
+    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
+}
+
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, const int32_t* hCPU, const int32_t* hGPU)
 {
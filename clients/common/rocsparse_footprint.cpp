@@ -0,0 +1,218 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_footprint.hpp"
+
+#include <algorithm>
+#include <vector>
+
+double rocsparse_footprint::megabytes() const
+{
+    return this->bytes / 1e6;
+}
+
+double rocsparse_footprint::padding() const
+{
+    return (this->nnz > 0) ? static_cast<double>(this->stored) / this->nnz : 1.0;
+}
+
+bool& rocsparse_footprint_only()
+{
+    static bool footprint_only = false;
+    return footprint_only;
+}
+
+rocsparse_footprint
+    rocsparse_footprint_csx(int64_t dim, int64_t nnz, size_t index_size, size_t value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = nnz;
+    fp.bytes  = (dim + 1) * index_size + nnz * (index_size + value_size);
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_coo(int64_t nnz, size_t index_size, size_t value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = nnz;
+    fp.bytes  = nnz * (2 * index_size + value_size);
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_ell(
+    int64_t m, int64_t ell_width, int64_t nnz, size_t index_size, size_t value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = m * ell_width;
+    fp.bytes  = fp.stored * (index_size + value_size);
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_sell(int64_t m,
+                                             int64_t nslices,
+                                             int64_t sell_nnz,
+                                             int64_t nnz,
+                                             size_t  index_size,
+                                             size_t  value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = sell_nnz;
+    fp.bytes  = (nslices + 1 + m) * index_size + fp.stored * (index_size + value_size);
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_csr16(
+    int64_t m, int64_t nnz, int64_t esc_nnz, size_t index_size, size_t value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = nnz;
+    fp.bytes  = (2 * m + 1 + 2 * esc_nnz) * index_size + (nnz - esc_nnz) * sizeof(uint16_t)
+               + nnz * value_size;
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_hyb(int64_t m,
+                                            int64_t ell_width,
+                                            int64_t coo_nnz,
+                                            int64_t nnz,
+                                            size_t  index_size,
+                                            size_t  value_size)
+{
+    rocsparse_footprint ell = rocsparse_footprint_ell(m, ell_width, 0, index_size, value_size);
+    rocsparse_footprint coo = rocsparse_footprint_coo(coo_nnz, index_size, value_size);
+
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = ell.stored + coo.stored;
+    fp.bytes  = ell.bytes + coo.bytes;
+
+    return fp;
+}
+
+rocsparse_footprint rocsparse_footprint_gebsr(int64_t mb,
+                                              int64_t nnzb,
+                                              int64_t row_block_dim,
+                                              int64_t col_block_dim,
+                                              int64_t nnz,
+                                              size_t  index_size,
+                                              size_t  value_size)
+{
+    rocsparse_footprint fp;
+
+    fp.nnz    = nnz;
+    fp.stored = nnzb * row_block_dim * col_block_dim;
+    fp.bytes  = (mb + 1 + nnzb) * index_size + fp.stored * value_size;
+
+    return fp;
+}
+
+rocsparse_int rocsparse_footprint_ell_width(rocsparse_int m, const rocsparse_int* csr_row_ptr)
+{
+    rocsparse_int ell_width = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        ell_width = std::max(ell_width, csr_row_ptr[i + 1] - csr_row_ptr[i]);
+    }
+
+    return ell_width;
+}
+
+rocsparse_int rocsparse_footprint_hyb_width(rocsparse_int           m,
+                                            rocsparse_int           nnz,
+                                            const rocsparse_int*    csr_row_ptr,
+                                            rocsparse_hyb_partition partition,
+                                            rocsparse_int           user_ell_width)
+{
+    switch(partition)
+    {
+    case rocsparse_hyb_partition_user:
+        return user_ell_width;
+    case rocsparse_hyb_partition_auto:
+        return (m > 0) ? (nnz - 1) / m + 1 : 0;
+    case rocsparse_hyb_partition_max:
+        return rocsparse_footprint_ell_width(m, csr_row_ptr);
+    }
+
+    return 0;
+}
+
+rocsparse_int rocsparse_footprint_hyb_coo_nnz(rocsparse_int        m,
+                                              const rocsparse_int* csr_row_ptr,
+                                              rocsparse_int        ell_width)
+{
+    rocsparse_int coo_nnz = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        coo_nnz += std::max(csr_row_ptr[i + 1] - csr_row_ptr[i] - ell_width, 0);
+    }
+
+    return coo_nnz;
+}
+
+rocsparse_int rocsparse_footprint_gebsr_nnzb(rocsparse_int        m,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_index_base base,
+                                             rocsparse_int        row_block_dim,
+                                             rocsparse_int        col_block_dim)
+{
+    rocsparse_int mb   = (m + row_block_dim - 1) / row_block_dim;
+    rocsparse_int nnzb = 0;
+
+    std::vector<rocsparse_int> block_cols;
+    for(rocsparse_int ib = 0; ib < mb; ++ib)
+    {
+        block_cols.clear();
+
+        rocsparse_int row_begin = ib * row_block_dim;
+        rocsparse_int row_end   = std::min(row_begin + row_block_dim, m);
+
+        for(rocsparse_int j = csr_row_ptr[row_begin] - base; j < csr_row_ptr[row_end] - base; ++j)
+        {
+            block_cols.push_back((csr_col_ind[j] - base) / col_block_dim);
+        }
+
+        // Count distinct block columns of this block row
+        std::sort(block_cols.begin(), block_cols.end());
+        nnzb += std::unique(block_cols.begin(), block_cols.end()) - block_cols.begin();
+    }
+
+    return nnzb;
+}
@@ -129,17 +129,17 @@ void host_sctr(I nnz, const T* x_val, const I* x_ind, T* y, rocsparse_index_base
  *    level 2 SPARSE
  * ===========================================================================
  */
-template <typename T>
+template <typename I, typename J, typename T>
 void host_bsrmv(rocsparse_direction  dir,
                 rocsparse_operation  trans,
-                rocsparse_int        mb,
-                rocsparse_int        nb,
-                rocsparse_int        nnzb,
+                J                    mb,
+                J                    nb,
+                I                    nnzb,
                 T                    alpha,
-                const rocsparse_int* bsr_row_ptr,
-                const rocsparse_int* bsr_col_ind,
+                const I*             bsr_row_ptr,
+                const J*             bsr_col_ind,
                 const T*             bsr_val,
-                rocsparse_int        bsr_dim,
+                J                    bsr_dim,
                 const T*             x,
                 T                    beta,
                 T*                   y,
@@ -150,7 +150,7 @@ void host_bsrmv(rocsparse_direction  dir,
     {
         if(beta != static_cast<T>(1))
         {
-            for(rocsparse_int i = 0; i < mb * bsr_dim; ++i)
+            for(I i = 0; i < mb * bsr_dim; ++i)
             {
                 y[i] *= beta;
             }
@@ -159,11 +159,11 @@ void host_bsrmv(rocsparse_direction  dir,
         return;
     }
 
-    rocsparse_int WFSIZE;
+    J WFSIZE;
 
     if(bsr_dim == 2)
     {
-        rocsparse_int blocks_per_row = nnzb / mb;
+        I blocks_per_row = nnzb / mb;
 
         if(blocks_per_row < 8)
         {
@@ -202,23 +202,23 @@ void host_bsrmv(rocsparse_direction  dir,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int row = 0; row < mb; ++row)
+    for(J row = 0; row < mb; ++row)
     {
-        rocsparse_int row_begin = bsr_row_ptr[row] - base;
-        rocsparse_int row_end   = bsr_row_ptr[row + 1] - base;
+        I row_begin = bsr_row_ptr[row] - base;
+        I row_end   = bsr_row_ptr[row + 1] - base;
 
         if(bsr_dim == 2)
         {
             std::vector<T> sum0(WFSIZE, static_cast<T>(0));
             std::vector<T> sum1(WFSIZE, static_cast<T>(0));
 
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
+            for(I j = row_begin; j < row_end; j += WFSIZE)
             {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
+                for(J k = 0; k < WFSIZE; ++k)
                 {
                     if(j + k < row_end)
                     {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
+                        J col = bsr_col_ind[j + k] - base;
 
                         if(dir == rocsparse_direction_column)
                         {
@@ -276,15 +276,15 @@ void host_bsrmv(rocsparse_direction  dir,
         }
         else
         {
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            for(J bi = 0; bi < bsr_dim; ++bi)
             {
                 std::vector<T> sum(WFSIZE, static_cast<T>(0));
 
-                for(rocsparse_int j = row_begin; j < row_end; ++j)
+                for(I j = row_begin; j < row_end; ++j)
                 {
-                    rocsparse_int col = bsr_col_ind[j] - base;
+                    J col = bsr_col_ind[j] - base;
 
-                    for(rocsparse_int bj = 0; bj < bsr_dim; bj += WFSIZE)
+                    for(J bj = 0; bj < bsr_dim; bj += WFSIZE)
                     {
                         for(unsigned int k = 0; k < WFSIZE; ++k)
                         {
@@ -330,18 +330,18 @@ void host_bsrmv(rocsparse_direction  dir,
     }
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 void host_gebsrmv(rocsparse_direction  dir,
                   rocsparse_operation  trans,
-                  rocsparse_int        mb,
-                  rocsparse_int        nb,
-                  rocsparse_int        nnzb,
+                  J                    mb,
+                  J                    nb,
+                  I                    nnzb,
                   T                    alpha,
-                  const rocsparse_int* bsr_row_ptr,
-                  const rocsparse_int* bsr_col_ind,
+                  const I*             bsr_row_ptr,
+                  const J*             bsr_col_ind,
                   const T*             bsr_val,
-                  rocsparse_int        row_block_dim,
-                  rocsparse_int        col_block_dim,
+                  J                    row_block_dim,
+                  J                    col_block_dim,
                   const T*             x,
                   T                    beta,
                   T*                   y,
@@ -352,7 +352,7 @@ void host_gebsrmv(rocsparse_direction  dir,
     {
         if(beta != static_cast<T>(1))
         {
-            for(rocsparse_int i = 0; i < mb * row_block_dim; ++i)
+            for(I i = 0; i < mb * row_block_dim; ++i)
             {
                 y[i] *= beta;
             }
@@ -381,11 +381,11 @@ void host_gebsrmv(rocsparse_direction  dir,
         return;
     }
 
-    rocsparse_int WFSIZE;
+    J WFSIZE;
 
     if(row_block_dim == 2 || row_block_dim == 3 || row_block_dim == 4)
     {
-        rocsparse_int blocks_per_row = nnzb / mb;
+        I blocks_per_row = nnzb / mb;
 
         if(blocks_per_row < 8)
         {
@@ -424,25 +424,25 @@ void host_gebsrmv(rocsparse_direction  dir,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int row = 0; row < mb; ++row)
+    for(J row = 0; row < mb; ++row)
     {
-        rocsparse_int row_begin = bsr_row_ptr[row] - base;
-        rocsparse_int row_end   = bsr_row_ptr[row + 1] - base;
+        I row_begin = bsr_row_ptr[row] - base;
+        I row_end   = bsr_row_ptr[row + 1] - base;
 
         if(row_block_dim == 2)
         {
             std::vector<T> sum0(WFSIZE, static_cast<T>(0));
             std::vector<T> sum1(WFSIZE, static_cast<T>(0));
 
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
+            for(I j = row_begin; j < row_end; j += WFSIZE)
             {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
+                for(J k = 0; k < WFSIZE; ++k)
                 {
                     if(j + k < row_end)
                     {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
+                        J col = bsr_col_ind[j + k] - base;
 
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
+                        for(J l = 0; l < col_block_dim; l++)
                         {
                             if(dir == rocsparse_direction_column)
                             {
@@ -499,15 +499,15 @@ void host_gebsrmv(rocsparse_direction  dir,
             std::vector<T> sum1(WFSIZE, static_cast<T>(0));
             std::vector<T> sum2(WFSIZE, static_cast<T>(0));
 
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
+            for(I j = row_begin; j < row_end; j += WFSIZE)
             {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
+                for(J k = 0; k < WFSIZE; ++k)
                 {
                     if(j + k < row_end)
                     {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
+                        J col = bsr_col_ind[j + k] - base;
 
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
+                        for(J l = 0; l < col_block_dim; l++)
                         {
                             if(dir == rocsparse_direction_column)
                             {
@@ -577,15 +577,15 @@ void host_gebsrmv(rocsparse_direction  dir,
             std::vector<T> sum2(WFSIZE, static_cast<T>(0));
             std::vector<T> sum3(WFSIZE, static_cast<T>(0));
 
-            for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
+            for(I j = row_begin; j < row_end; j += WFSIZE)
             {
-                for(rocsparse_int k = 0; k < WFSIZE; ++k)
+                for(J k = 0; k < WFSIZE; ++k)
                 {
                     if(j + k < row_end)
                     {
-                        rocsparse_int col = bsr_col_ind[j + k] - base;
+                        J col = bsr_col_ind[j + k] - base;
 
-                        for(rocsparse_int l = 0; l < col_block_dim; l++)
+                        for(J l = 0; l < col_block_dim; l++)
                         {
                             if(dir == rocsparse_direction_column)
                             {
@@ -662,15 +662,15 @@ void host_gebsrmv(rocsparse_direction  dir,
         }
         else
         {
-            for(rocsparse_int bi = 0; bi < row_block_dim; ++bi)
+            for(J bi = 0; bi < row_block_dim; ++bi)
             {
                 std::vector<T> sum(WFSIZE, static_cast<T>(0));
 
-                for(rocsparse_int j = row_begin; j < row_end; ++j)
+                for(I j = row_begin; j < row_end; ++j)
                 {
-                    rocsparse_int col = bsr_col_ind[j] - base;
+                    J col = bsr_col_ind[j] - base;
 
-                    for(rocsparse_int bj = 0; bj < col_block_dim; bj += WFSIZE)
+                    for(J bj = 0; bj < col_block_dim; bj += WFSIZE)
                     {
                         for(unsigned int k = 0; k < WFSIZE; ++k)
                         {
@@ -1069,6 +1069,122 @@ void host_coomv_aos(I                    M,
     }
 }
 
+// Conjugation of the stored triangle and its mirror image, such that op(A) is
+// applied for symmetric and hermitian storage
+static void host_symmetric_conj(rocsparse_operation   trans,
+                                rocsparse_matrix_type matrix_type,
+                                bool&                 conj_stored,
+                                bool&                 conj_mirror)
+{
+    if(matrix_type == rocsparse_matrix_type_hermitian)
+    {
+        conj_stored = (trans == rocsparse_operation_transpose);
+        conj_mirror = !conj_stored;
+    }
+    else
+    {
+        conj_stored = (trans == rocsparse_operation_conjugate_transpose);
+        conj_mirror = conj_stored;
+    }
+}
+
+template <typename I, typename T>
+void host_coomv_symmetric(rocsparse_operation   trans,
+                          I                     M,
+                          I                     nnz,
+                          T                     alpha,
+                          const I*              coo_row_ind,
+                          const I*              coo_col_ind,
+                          const T*              coo_val,
+                          const T*              x,
+                          T                     beta,
+                          T*                    y,
+                          rocsparse_matrix_type matrix_type,
+                          rocsparse_fill_mode   fill_mode,
+                          rocsparse_index_base  base)
+{
+    bool conj_stored;
+    bool conj_mirror;
+    host_symmetric_conj(trans, matrix_type, conj_stored, conj_mirror);
+
+    for(I i = 0; i < M; ++i)
+    {
+        y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+    }
+
+    for(I i = 0; i < nnz; ++i)
+    {
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
+
+        // Skip entries that are not part of the stored triangle
+        if((fill_mode == rocsparse_fill_mode_lower) ? (col > row) : (col < row))
+        {
+            continue;
+        }
+
+        T val = coo_val[i];
+
+        y[row] += alpha * (conj_stored ? rocsparse_conj(val) : val) * x[col];
+
+        if(col != row)
+        {
+            y[col] += alpha * (conj_mirror ? rocsparse_conj(val) : val) * x[row];
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrmv_symmetric(rocsparse_operation   trans,
+                          J                     M,
+                          I                     nnz,
+                          T                     alpha,
+                          const I*              csr_row_ptr,
+                          const J*              csr_col_ind,
+                          const T*              csr_val,
+                          const T*              x,
+                          T                     beta,
+                          T*                    y,
+                          rocsparse_matrix_type matrix_type,
+                          rocsparse_fill_mode   fill_mode,
+                          rocsparse_index_base  base)
+{
+    bool conj_stored;
+    bool conj_mirror;
+    host_symmetric_conj(trans, matrix_type, conj_stored, conj_mirror);
+
+    for(J i = 0; i < M; ++i)
+    {
+        y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+    }
+
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+
+            // Skip entries that are not part of the stored triangle
+            if((fill_mode == rocsparse_fill_mode_lower) ? (col > i) : (col < i))
+            {
+                continue;
+            }
+
+            T val = csr_val[j];
+
+            y[i] += alpha * (conj_stored ? rocsparse_conj(val) : val) * x[col];
+
+            if(col != i)
+            {
+                y[col] += alpha * (conj_mirror ? rocsparse_conj(val) : val) * x[i];
+            }
+        }
+    }
+}
+
 template <typename I, typename J, typename T>
 void host_csrmv(J                    M,
                 I                    nnz,
@@ -1201,6 +1317,295 @@ void host_csrmv(J                    M,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csrmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
+                I                    nnz,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                const T*             x,
+                T                    beta,
+                T*                   y,
+                rocsparse_index_base base,
+                int                  algo)
+{
+    if(trans == rocsparse_operation_none)
+    {
+        host_csrmv(M, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, base, algo);
+        return;
+    }
+
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    for(J i = 0; i < N; ++i)
+    {
+        y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+    }
+
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            T val = conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+            y[csr_col_ind[j] - base] += alpha * val * x[i];
+        }
+    }
+}
+
+template <typename I, typename J, typename A, typename T>
+void host_csrmv_mixed(rocsparse_operation  trans,
+                      J                    M,
+                      J                    N,
+                      I                    nnz,
+                      T                    alpha,
+                      const I*             csr_row_ptr,
+                      const J*             csr_col_ind,
+                      const A*             csr_val,
+                      const T*             x,
+                      T                    beta,
+                      T*                   y,
+                      rocsparse_index_base base)
+{
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    if(trans == rocsparse_operation_none)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
+
+            // Values are converted to the compute precision before they are accumulated
+            T sum = static_cast<T>(0);
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                sum = std::fma(
+                    alpha * host_convert_value<T>(csr_val[j]), x[csr_col_ind[j] - base], sum);
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                y[i] = sum;
+            }
+            else
+            {
+                y[i] = std::fma(beta, y[i], sum);
+            }
+        }
+
+        return;
+    }
+
+    for(J i = 0; i < N; ++i)
+    {
+        y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+    }
+
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            T val = host_convert_value<T>(csr_val[j]);
+            val   = conj ? rocsparse_conj(val) : val;
+
+            y[csr_col_ind[j] - base] += alpha * val * x[i];
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrmv_strided_batched(J                    M,
+                                I                    nnz,
+                                int                  batch_count,
+                                T                    alpha,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const T*             csr_val,
+                                int64_t              val_batch_stride,
+                                const T*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                T*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base)
+{
+    // Batches and rows are independent of each other
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2) schedule(dynamic, 1024)
+#endif
+    for(int b = 0; b < batch_count; ++b)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            const T* val_b = csr_val + b * val_batch_stride;
+            const T* x_b   = x + b * x_batch_stride;
+            T*       y_b   = y + b * y_batch_stride;
+
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
+
+            T sum = static_cast<T>(0);
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                sum = std::fma(alpha * val_b[j], x_b[csr_col_ind[j] - base], sum);
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                y_b[i] = sum;
+            }
+            else
+            {
+                y_b[i] = std::fma(beta, y_b[i], sum);
+            }
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrmv_fused(J                    M,
+                      I                    nnz,
+                      T                    alpha,
+                      const I*             csr_row_ptr,
+                      const J*             csr_col_ind,
+                      const T*             csr_val,
+                      const T*             x,
+                      T                    beta,
+                      const T*             y_in,
+                      T*                   y_out,
+                      T*                   dot,
+                      T*                   nrm2,
+                      rocsparse_index_base base)
+{
+    // Rows are independent of each other
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        T sum = static_cast<T>(0);
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            sum = std::fma(alpha * csr_val[j], x[csr_col_ind[j] - base], sum);
+        }
+
+        if(beta == static_cast<T>(0))
+        {
+            y_out[i] = sum;
+        }
+        else
+        {
+            y_out[i] = std::fma(beta, y_in[i], sum);
+        }
+    }
+
+    // Reductions run sequentially in row order
+    if(dot != nullptr)
+    {
+        *dot = static_cast<T>(0);
+
+        for(J i = 0; i < M; ++i)
+        {
+            *dot = std::fma(rocsparse_conj(x[i]), y_out[i], *dot);
+        }
+    }
+
+    if(nrm2 != nullptr)
+    {
+        *nrm2 = static_cast<T>(0);
+
+        for(J i = 0; i < M; ++i)
+        {
+            *nrm2 = std::fma(rocsparse_conj(y_out[i]), y_out[i], *nrm2);
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_cscmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
+                I                    nnz,
+                T                    alpha,
+                const I*             csc_col_ptr,
+                const J*             csc_row_ind,
+                const T*             csc_val,
+                const T*             x,
+                T                    beta,
+                T*                   y,
+                rocsparse_index_base base)
+{
+    if(trans == rocsparse_operation_none)
+    {
+        // Scatter the columns of A into y
+        for(J i = 0; i < M; ++i)
+        {
+            y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+        }
+
+        for(J j = 0; j < N; ++j)
+        {
+            I col_begin = csc_col_ptr[j] - base;
+            I col_end   = csc_col_ptr[j + 1] - base;
+
+            for(I k = col_begin; k < col_end; ++k)
+            {
+                y[csc_row_ind[k] - base] += alpha * csc_val[k] * x[j];
+            }
+        }
+
+        return;
+    }
+
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    // Columns of A are rows of op(A)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J j = 0; j < N; ++j)
+    {
+        I col_begin = csc_col_ptr[j] - base;
+        I col_end   = csc_col_ptr[j + 1] - base;
+
+        T sum = static_cast<T>(0);
+
+        for(I k = col_begin; k < col_end; ++k)
+        {
+            T val = conj ? rocsparse_conj(csc_val[k]) : csc_val[k];
+            sum   = std::fma(val, x[csc_row_ind[k] - base], sum);
+        }
+
+        if(beta == static_cast<T>(0))
+        {
+            y[j] = alpha * sum;
+        }
+        else
+        {
+            y[j] = std::fma(beta, y[j], alpha * sum);
+        }
+    }
+}
+
 template <typename T>
 static void host_csr_lsolve(rocsparse_int        M,
                             T                    alpha,
@@ -1532,17 +1937,66 @@ void host_ellmv(I                    M,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(I i = 0; i < M; ++i)
+    for(I i = 0; i < M; ++i)
+    {
+        T sum = static_cast<T>(0);
+        for(I p = 0; p < ell_width; ++p)
+        {
+            I idx = p * M + i;
+            I col = ell_col_ind[idx] - base;
+
+            if(col >= 0 && col < N)
+            {
+                sum = std::fma(ell_val[idx], x[col], sum);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+}
+
+template <typename I, typename T>
+void host_sellmv(I                    M,
+                 I                    N,
+                 T                    alpha,
+                 const I*             sell_slice_ptr,
+                 const I*             sell_row_perm,
+                 const I*             sell_col_ind,
+                 const T*             sell_val,
+                 I                    sell_slice_size,
+                 const T*             x,
+                 T                    beta,
+                 T*                   y,
+                 rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I p = 0; p < M; ++p)
     {
+        I slice_begin = sell_slice_ptr[p / sell_slice_size] - base;
+        I slice_end   = sell_slice_ptr[p / sell_slice_size + 1] - base;
+        I row         = sell_row_perm[p] - base;
+
         T sum = static_cast<T>(0);
-        for(I p = 0; p < ell_width; ++p)
+        for(I idx = slice_begin + p % sell_slice_size; idx < slice_end; idx += sell_slice_size)
         {
-            I idx = p * M + i;
-            I col = ell_col_ind[idx] - base;
+            I col = sell_col_ind[idx] - base;
 
             if(col >= 0 && col < N)
             {
-                sum = std::fma(ell_val[idx], x[col], sum);
+                sum = std::fma(sell_val[idx], x[col], sum);
             }
             else
             {
@@ -1550,6 +2004,47 @@ void host_ellmv(I                    M,
             }
         }
 
+        if(beta != static_cast<T>(0))
+        {
+            y[row] = std::fma(beta, y[row], alpha * sum);
+        }
+        else
+        {
+            y[row] = alpha * sum;
+        }
+    }
+}
+
+template <typename I, typename T>
+void host_csr16mv(I                    M,
+                  I                    N,
+                  T                    alpha,
+                  const I*             csr16_row_ptr,
+                  const I*             csr16_row_base,
+                  const uint16_t*      csr16_col_off,
+                  const T*             csr16_val,
+                  I                    csr16_esc_nnz,
+                  const I*             csr16_esc_row_ind,
+                  const I*             csr16_esc_col_ind,
+                  const T*             csr16_esc_val,
+                  const T*             x,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        I col_base = csr16_row_base[i] - base;
+
+        T sum = static_cast<T>(0);
+        for(I j = csr16_row_ptr[i] - base; j < csr16_row_ptr[i + 1] - base; ++j)
+        {
+            sum = std::fma(csr16_val[j], x[col_base + csr16_col_off[j]], sum);
+        }
+
         if(beta != static_cast<T>(0))
         {
             y[i] = std::fma(beta, y[i], alpha * sum);
@@ -1559,6 +2054,15 @@ void host_ellmv(I                    M,
             y[i] = alpha * sum;
         }
     }
+
+    // Escaped entries
+    for(I j = 0; j < csr16_esc_nnz; ++j)
+    {
+        I row = csr16_esc_row_ind[j] - base;
+        I col = csr16_esc_col_ind[j] - base;
+
+        y[row] = std::fma(alpha * csr16_esc_val[j], x[col], y[row]);
+    }
 }
 
 template <typename T>
@@ -1679,27 +2183,27 @@ void host_bsrmm(rocsparse_handle          handle,
     }
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 void host_gebsrmm(rocsparse_handle          handle,
                   rocsparse_direction       dir,
                   rocsparse_operation       transA,
                   rocsparse_operation       transB,
-                  rocsparse_int             Mb,
-                  rocsparse_int             N,
-                  rocsparse_int             Kb,
-                  rocsparse_int             nnzb,
+                  J                         Mb,
+                  J                         N,
+                  J                         Kb,
+                  I                         nnzb,
                   const T*                  alpha,
                   const rocsparse_mat_descr descr,
                   const T*                  bsr_val_A,
-                  const rocsparse_int*      bsr_row_ptr_A,
-                  const rocsparse_int*      bsr_col_ind_A,
-                  rocsparse_int             row_block_dim,
-                  rocsparse_int             col_block_dim,
+                  const I*                  bsr_row_ptr_A,
+                  const J*                  bsr_col_ind_A,
+                  J                         row_block_dim,
+                  J                         col_block_dim,
                   const T*                  B,
-                  rocsparse_int             ldb,
+                  J                         ldb,
                   const T*                  beta,
                   T*                        C,
-                  rocsparse_int             ldc)
+                  J                         ldc)
 {
     if(transA != rocsparse_operation_none)
     {
@@ -1712,39 +2216,38 @@ void host_gebsrmm(rocsparse_handle          handle,
     }
     rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
 
-    rocsparse_int M = Mb * row_block_dim;
+    J M = Mb * row_block_dim;
 
-    const rocsparse_int rowXcol_block_dim = row_block_dim * col_block_dim;
+    const J rowXcol_block_dim = row_block_dim * col_block_dim;
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int row_idx = 0; row_idx < M; ++row_idx)
+    for(J row_idx = 0; row_idx < M; ++row_idx)
     {
-        const rocsparse_int row_block_idx = row_idx / row_block_dim,
-                            row_local_idx = row_idx % row_block_dim;
+        const J row_block_idx = row_idx / row_block_dim, row_local_idx = row_idx % row_block_dim;
 
-        const rocsparse_int start = bsr_row_ptr_A[row_block_idx] - base,
-                            bound = bsr_row_ptr_A[row_block_idx + 1] - base;
+        const I start = bsr_row_ptr_A[row_block_idx] - base,
+                bound = bsr_row_ptr_A[row_block_idx + 1] - base;
 
-        for(rocsparse_int col_idx = 0; col_idx < N; ++col_idx)
+        for(J col_idx = 0; col_idx < N; ++col_idx)
         {
-            const rocsparse_int idx_C = ldc * col_idx + row_idx;
+            const I idx_C = ldc * col_idx + row_idx;
 
             T sum = static_cast<T>(0);
 
-            for(rocsparse_int at = start; at < bound; ++at)
+            for(I at = start; at < bound; ++at)
             {
-                for(rocsparse_int col_local_idx = 0; col_local_idx < col_block_dim; ++col_local_idx)
+                for(J col_local_idx = 0; col_local_idx < col_block_dim; ++col_local_idx)
                 {
-                    const rocsparse_int idx_A
+                    const I idx_A
                         = (dir == rocsparse_direction_row)
                               ? rowXcol_block_dim * at + col_block_dim * row_local_idx
                                     + col_local_idx
                               : rowXcol_block_dim * at + row_block_dim * col_local_idx
                                     + row_local_idx;
 
-                    const rocsparse_int idx_B
+                    const I idx_B
                         = (transB == rocsparse_operation_none)
                               ? col_idx * ldb + col_block_dim * (bsr_col_ind_A[at] - base)
                                     + col_local_idx
@@ -1895,6 +2398,108 @@ void host_csrmm(J                     M,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_cscmm(J                     M,
+                J                     N,
+                J                     K,
+                rocsparse_operation   transA,
+                rocsparse_operation   transB,
+                T                     alpha,
+                const std::vector<I>& csc_col_ptr_A,
+                const std::vector<J>& csc_row_ind_A,
+                const std::vector<T>& csc_val_A,
+                const std::vector<T>& B,
+                J                     ldb,
+                T                     beta,
+                std::vector<T>&       C,
+                J                     ldc,
+                rocsparse_order       order,
+                rocsparse_index_base  base)
+{
+    // B is accessed by column if op(B) is stored column wise
+    bool col_B = (transB == rocsparse_operation_none && order == rocsparse_order_column)
+                 || (transB != rocsparse_operation_none && order == rocsparse_order_row);
+
+    if(transA == rocsparse_operation_none)
+    {
+        // scale C by beta
+        for(size_t i = 0; i < M; i++)
+        {
+            for(J j = 0; j < N; ++j)
+            {
+                J idx_C  = (order == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
+                C[idx_C] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * C[idx_C];
+            }
+        }
+
+        // Scatter the columns of A into C
+        for(J i = 0; i < K; ++i)
+        {
+            I col_begin = csc_col_ptr_A[i] - base;
+            I col_end   = csc_col_ptr_A[i + 1] - base;
+
+            for(J j = 0; j < N; ++j)
+            {
+                J idx_B = col_B ? (i + j * ldb) : (j + i * ldb);
+                T val_B = (transB == rocsparse_operation_conjugate_transpose)
+                              ? rocsparse_conj(B[idx_B])
+                              : B[idx_B];
+
+                for(I k = col_begin; k < col_end; ++k)
+                {
+                    J row   = csc_row_ind_A[k] - base;
+                    J idx_C = (order == rocsparse_order_column) ? row + j * ldc : row * ldc + j;
+
+                    C[idx_C] += alpha * csc_val_A[k] * val_B;
+                }
+            }
+        }
+    }
+    else
+    {
+        // Columns of A are rows of op(A)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < M; i++)
+        {
+            I col_begin = csc_col_ptr_A[i] - base;
+            I col_end   = csc_col_ptr_A[i + 1] - base;
+
+            for(J j = 0; j < N; ++j)
+            {
+                J idx_C = (order == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
+
+                T sum = static_cast<T>(0);
+
+                for(I k = col_begin; k < col_end; ++k)
+                {
+                    J row   = csc_row_ind_A[k] - base;
+                    J idx_B = col_B ? (row + j * ldb) : (j + row * ldb);
+
+                    T val_A = (transA == rocsparse_operation_conjugate_transpose)
+                                  ? rocsparse_conj(csc_val_A[k])
+                                  : csc_val_A[k];
+                    T val_B = (transB == rocsparse_operation_conjugate_transpose)
+                                  ? rocsparse_conj(B[idx_B])
+                                  : B[idx_B];
+
+                    sum = std::fma(val_A, val_B, sum);
+                }
+
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum;
+                }
+                else
+                {
+                    C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+                }
+            }
+        }
+    }
+}
+
 template <typename I, typename T>
 void host_coomm_atomic(I                     M,
                        I                     N,
@@ -2159,6 +2764,74 @@ void host_coomm_segmented(I                     M,
     }
 }
 
+template <typename I, typename T>
+void host_sellmm(I                     M,
+                 I                     N,
+                 I                     K,
+                 rocsparse_operation   transB,
+                 T                     alpha,
+                 const std::vector<I>& sell_slice_ptr_A,
+                 const std::vector<I>& sell_row_perm_A,
+                 const std::vector<I>& sell_col_ind_A,
+                 const std::vector<T>& sell_val_A,
+                 I                     sell_slice_size_A,
+                 const std::vector<T>& B,
+                 I                     ldb,
+                 T                     beta,
+                 std::vector<T>&       C,
+                 I                     ldc,
+                 rocsparse_order       order,
+                 rocsparse_index_base  base)
+{
+    // B is accessed by column if op(B) is stored column wise
+    bool col_B = (transB == rocsparse_operation_none && order == rocsparse_order_column)
+                 || (transB != rocsparse_operation_none && order == rocsparse_order_row);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I p = 0; p < M; ++p)
+    {
+        I slice_begin = sell_slice_ptr_A[p / sell_slice_size_A] - base;
+        I slice_end   = sell_slice_ptr_A[p / sell_slice_size_A + 1] - base;
+        I row         = sell_row_perm_A[p] - base;
+
+        for(I j = 0; j < N; ++j)
+        {
+            T sum = static_cast<T>(0);
+
+            for(I idx = slice_begin + p % sell_slice_size_A; idx < slice_end;
+                idx += sell_slice_size_A)
+            {
+                I col = sell_col_ind_A[idx] - base;
+
+                if(col < 0 || col >= K)
+                {
+                    break;
+                }
+
+                I idx_B = col_B ? (col + j * ldb) : (j + col * ldb);
+                T val_B = (transB == rocsparse_operation_conjugate_transpose)
+                              ? rocsparse_conj(B[idx_B])
+                              : B[idx_B];
+
+                sum = std::fma(sell_val_A[idx], val_B, sum);
+            }
+
+            I idx_C = (order == rocsparse_order_column) ? row + j * ldc : row * ldc + j;
+
+            if(beta != static_cast<T>(0))
+            {
+                C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+            }
+            else
+            {
+                C[idx_C] = alpha * sum;
+            }
+        }
+    }
+}
+
 template <typename I, typename T>
 void host_coomm(rocsparse_spmm_alg    alg,
                 I                     M,
@@ -4536,6 +5209,64 @@ void host_csx2dense(J                    m,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_gebsr2dense(rocsparse_direction  dir,
+                      J                    mb,
+                      J                    nb,
+                      J                    row_block_dim,
+                      J                    col_block_dim,
+                      rocsparse_index_base base,
+                      rocsparse_order      order,
+                      const T*             bsr_val,
+                      const I*             bsr_row_ptr,
+                      const J*             bsr_col_ind,
+                      T*                   A,
+                      I                    ld)
+{
+    I m = static_cast<I>(mb) * row_block_dim;
+    I n = static_cast<I>(nb) * col_block_dim;
+
+    for(I i = 0; i < (order == rocsparse_order_column ? n : m); ++i)
+    {
+        for(I j = 0; j < (order == rocsparse_order_column ? m : n); ++j)
+        {
+            A[j + ld * i] = static_cast<T>(0);
+        }
+    }
+
+    for(J mbrow = 0; mbrow < mb; ++mbrow)
+    {
+        I start = bsr_row_ptr[mbrow] - base;
+        I end   = bsr_row_ptr[mbrow + 1] - base;
+
+        for(I at = start; at < end; ++at)
+        {
+            J mbcol = bsr_col_ind[at] - base;
+
+            for(J bi = 0; bi < row_block_dim; ++bi)
+            {
+                for(J bj = 0; bj < col_block_dim; ++bj)
+                {
+                    I row = static_cast<I>(mbrow) * row_block_dim + bi;
+                    I col = static_cast<I>(mbcol) * col_block_dim + bj;
+                    T val = bsr_val[row_block_dim * col_block_dim * at
+                                    + (dir == rocsparse_direction_row ? col_block_dim * bi + bj
+                                                                      : row_block_dim * bj + bi)];
+
+                    if(order == rocsparse_order_column)
+                    {
+                        A[row + ld * col] = val;
+                    }
+                    else
+                    {
+                        A[col + ld * row] = val;
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename I, typename T>
 void host_dense_to_coo(I                     m,
                        I                     n,
@@ -5527,21 +6258,6 @@ template void host_gthrz(rocsparse_int        nnz,
  *    level 2 SPARSE
  * ===========================================================================
  */
-template void host_bsrmv(rocsparse_direction  dir,
-                         rocsparse_operation  trans,
-                         rocsparse_int        mb,
-                         rocsparse_int        nb,
-                         rocsparse_int        nnzb,
-                         float                alpha,
-                         const rocsparse_int* bsr_row_ptr,
-                         const rocsparse_int* bsr_col_ind,
-                         const float*         bsr_val,
-                         rocsparse_int        bsr_dim,
-                         const float*         x,
-                         float                beta,
-                         float*               y,
-                         rocsparse_index_base base);
-
 template void host_bsrsv(rocsparse_operation  trans,
                          rocsparse_direction  dir,
                          rocsparse_int        mb,
@@ -5590,22 +6306,6 @@ template void host_hybmv(rocsparse_int        M,
                          float*               y,
                          rocsparse_index_base base);
 
-template void host_gebsrmv(rocsparse_direction  dir,
-                           rocsparse_operation  trans,
-                           rocsparse_int        mb,
-                           rocsparse_int        nb,
-                           rocsparse_int        nnzb,
-                           float                alpha,
-                           const rocsparse_int* bsr_row_ptr,
-                           const rocsparse_int* bsr_col_ind,
-                           const float*         bsr_val,
-                           rocsparse_int        row_block_dim,
-                           rocsparse_int        col_block_dim,
-                           const float*         x,
-                           float                beta,
-                           float*               y,
-                           rocsparse_index_base base);
-
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -5631,90 +6331,6 @@ template void host_bsrmm(rocsparse_handle          handle,
                          float*                    C,
                          rocsparse_int             ldc);
 
-template void host_gebsrmm(rocsparse_handle          handle,
-                           rocsparse_direction       dir,
-                           rocsparse_operation       trans_A,
-                           rocsparse_operation       trans_B,
-                           rocsparse_int             mb,
-                           rocsparse_int             n,
-                           rocsparse_int             kb,
-                           rocsparse_int             nnzb,
-                           const float*              alpha,
-                           const rocsparse_mat_descr descr,
-                           const float*              bsr_val,
-                           const rocsparse_int*      bsr_row_ptr,
-                           const rocsparse_int*      bsr_col_ind,
-                           rocsparse_int             row_block_dim,
-                           rocsparse_int             col_block_dim,
-                           const float*              B,
-                           rocsparse_int             ldb,
-                           const float*              beta,
-                           float*                    C,
-                           rocsparse_int             ldc);
-
-template void host_gebsrmm(rocsparse_handle          handle,
-                           rocsparse_direction       dir,
-                           rocsparse_operation       trans_A,
-                           rocsparse_operation       trans_B,
-                           rocsparse_int             mb,
-                           rocsparse_int             n,
-                           rocsparse_int             kb,
-                           rocsparse_int             nnzb,
-                           const double*             alpha,
-                           const rocsparse_mat_descr descr,
-                           const double*             bsr_val,
-                           const rocsparse_int*      bsr_row_ptr,
-                           const rocsparse_int*      bsr_col_ind,
-                           rocsparse_int             row_block_dim,
-                           rocsparse_int             col_block_dim,
-                           const double*             B,
-                           rocsparse_int             ldb,
-                           const double*             beta,
-                           double*                   C,
-                           rocsparse_int             ldc);
-
-template void host_gebsrmm(rocsparse_handle               handle,
-                           rocsparse_direction            dir,
-                           rocsparse_operation            trans_A,
-                           rocsparse_operation            trans_B,
-                           rocsparse_int                  mb,
-                           rocsparse_int                  n,
-                           rocsparse_int                  kb,
-                           rocsparse_int                  nnzb,
-                           const rocsparse_float_complex* alpha,
-                           const rocsparse_mat_descr      descr,
-                           const rocsparse_float_complex* bsr_val,
-                           const rocsparse_int*           bsr_row_ptr,
-                           const rocsparse_int*           bsr_col_ind,
-                           rocsparse_int                  row_block_dim,
-                           rocsparse_int                  col_block_dim,
-                           const rocsparse_float_complex* B,
-                           rocsparse_int                  ldb,
-                           const rocsparse_float_complex* beta,
-                           rocsparse_float_complex*       C,
-                           rocsparse_int                  ldc);
-
-template void host_gebsrmm(rocsparse_handle                handle,
-                           rocsparse_direction             dir,
-                           rocsparse_operation             trans_A,
-                           rocsparse_operation             trans_B,
-                           rocsparse_int                   mb,
-                           rocsparse_int                   n,
-                           rocsparse_int                   kb,
-                           rocsparse_int                   nnzb,
-                           const rocsparse_double_complex* alpha,
-                           const rocsparse_mat_descr       descr,
-                           const rocsparse_double_complex* bsr_val,
-                           const rocsparse_int*            bsr_row_ptr,
-                           const rocsparse_int*            bsr_col_ind,
-                           rocsparse_int                   row_block_dim,
-                           rocsparse_int                   col_block_dim,
-                           const rocsparse_double_complex* B,
-                           rocsparse_int                   ldb,
-                           const rocsparse_double_complex* beta,
-                           rocsparse_double_complex*       C,
-                           rocsparse_int                   ldc);
-
 template void host_csrsm(rocsparse_int                     M,
                          rocsparse_int                     nrhs,
                          rocsparse_int                     nnz,
@@ -6057,21 +6673,6 @@ template void host_gthrz(rocsparse_int        nnz,
  *    level 2 SPARSE
  * ===========================================================================
  */
-template void host_bsrmv(rocsparse_direction  dir,
-                         rocsparse_operation  trans,
-                         rocsparse_int        mb,
-                         rocsparse_int        nb,
-                         rocsparse_int        nnzb,
-                         double               alpha,
-                         const rocsparse_int* bsr_row_ptr,
-                         const rocsparse_int* bsr_col_ind,
-                         const double*        bsr_val,
-                         rocsparse_int        bsr_dim,
-                         const double*        x,
-                         double               beta,
-                         double*              y,
-                         rocsparse_index_base base);
-
 template void host_bsrsv(rocsparse_operation  trans,
                          rocsparse_direction  dir,
                          rocsparse_int        mb,
@@ -6120,22 +6721,6 @@ template void host_hybmv(rocsparse_int        M,
                          double*              y,
                          rocsparse_index_base base);
 
-template void host_gebsrmv(rocsparse_direction  dir,
-                           rocsparse_operation  trans,
-                           rocsparse_int        mb,
-                           rocsparse_int        nb,
-                           rocsparse_int        nnzb,
-                           double               alpha,
-                           const rocsparse_int* bsr_row_ptr,
-                           const rocsparse_int* bsr_col_ind,
-                           const double*        bsr_val,
-                           rocsparse_int        row_block_dim,
-                           rocsparse_int        col_block_dim,
-                           const double*        x,
-                           double               beta,
-                           double*              y,
-                           rocsparse_index_base base);
-
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -6503,21 +7088,6 @@ template void host_gthrz(rocsparse_int             nnz,
  *    level 2 SPARSE
  * ===========================================================================
  */
-template void host_bsrmv(rocsparse_direction             dir,
-                         rocsparse_operation             trans,
-                         rocsparse_int                   mb,
-                         rocsparse_int                   nb,
-                         rocsparse_int                   nnzb,
-                         rocsparse_double_complex        alpha,
-                         const rocsparse_int*            bsr_row_ptr,
-                         const rocsparse_int*            bsr_col_ind,
-                         const rocsparse_double_complex* bsr_val,
-                         rocsparse_int                   bsr_dim,
-                         const rocsparse_double_complex* x,
-                         rocsparse_double_complex        beta,
-                         rocsparse_double_complex*       y,
-                         rocsparse_index_base            base);
-
 template void host_bsrsv(rocsparse_operation             trans,
                          rocsparse_direction             dir,
                          rocsparse_int                   mb,
@@ -6566,22 +7136,6 @@ template void host_hybmv(rocsparse_int                   M,
                          rocsparse_double_complex*       y,
                          rocsparse_index_base            base);
 
-template void host_gebsrmv(rocsparse_direction             dir,
-                           rocsparse_operation             trans,
-                           rocsparse_int                   mb,
-                           rocsparse_int                   nb,
-                           rocsparse_int                   nnzb,
-                           rocsparse_double_complex        alpha,
-                           const rocsparse_int*            bsr_row_ptr,
-                           const rocsparse_int*            bsr_col_ind,
-                           const rocsparse_double_complex* bsr_val,
-                           rocsparse_int                   row_block_dim,
-                           rocsparse_int                   col_block_dim,
-                           const rocsparse_double_complex* x,
-                           rocsparse_double_complex        beta,
-                           rocsparse_double_complex*       y,
-                           rocsparse_index_base            base);
-
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -6901,21 +7455,6 @@ template void host_gthrz(rocsparse_int            nnz,
  *    level 2 SPARSE
  * ===========================================================================
  */
-template void host_bsrmv(rocsparse_direction            dir,
-                         rocsparse_operation            trans,
-                         rocsparse_int                  mb,
-                         rocsparse_int                  nb,
-                         rocsparse_int                  nnzb,
-                         rocsparse_float_complex        alpha,
-                         const rocsparse_int*           bsr_row_ptr,
-                         const rocsparse_int*           bsr_col_ind,
-                         const rocsparse_float_complex* bsr_val,
-                         rocsparse_int                  bsr_dim,
-                         const rocsparse_float_complex* x,
-                         rocsparse_float_complex        beta,
-                         rocsparse_float_complex*       y,
-                         rocsparse_index_base           base);
-
 template void host_bsrsv(rocsparse_operation            trans,
                          rocsparse_direction            dir,
                          rocsparse_int                  mb,
@@ -6964,22 +7503,6 @@ template void host_hybmv(rocsparse_int                  M,
                          rocsparse_float_complex*       y,
                          rocsparse_index_base           base);
 
-template void host_gebsrmv(rocsparse_direction            dir,
-                           rocsparse_operation            trans,
-                           rocsparse_int                  mb,
-                           rocsparse_int                  nb,
-                           rocsparse_int                  nnzb,
-                           rocsparse_float_complex        alpha,
-                           const rocsparse_int*           bsr_row_ptr,
-                           const rocsparse_int*           bsr_col_ind,
-                           const rocsparse_float_complex* bsr_val,
-                           rocsparse_int                  row_block_dim,
-                           rocsparse_int                  col_block_dim,
-                           const rocsparse_float_complex* x,
-                           rocsparse_float_complex        beta,
-                           rocsparse_float_complex*       y,
-                           rocsparse_index_base           base);
-
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -7323,6 +7846,19 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                            TTYPE                beta,                            \
                                            TTYPE*               y,                               \
                                            rocsparse_index_base base);                           \
+    template void host_coomv_symmetric<ITYPE, TTYPE>(rocsparse_operation   trans,                \
+                                                     ITYPE                 M,                    \
+                                                     ITYPE                 nnz,                  \
+                                                     TTYPE                 alpha,                \
+                                                     const ITYPE*          coo_row_ind,          \
+                                                     const ITYPE*          coo_col_ind,          \
+                                                     const TTYPE*          coo_val,              \
+                                                     const TTYPE*          x,                    \
+                                                     TTYPE                 beta,                 \
+                                                     TTYPE*                y,                    \
+                                                     rocsparse_matrix_type matrix_type,          \
+                                                     rocsparse_fill_mode   fill_mode,            \
+                                                     rocsparse_index_base  base);                \
     template void host_coomv_aos<ITYPE, TTYPE>(ITYPE                M,                           \
                                                ITYPE                nnz,                         \
                                                TTYPE                alpha,                       \
@@ -7342,6 +7878,50 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                            TTYPE                beta,                            \
                                            TTYPE*               y,                               \
                                            rocsparse_index_base base);                           \
+    template void host_sellmv<ITYPE, TTYPE>(ITYPE                M,                              \
+                                            ITYPE                N,                              \
+                                            TTYPE                alpha,                          \
+                                            const ITYPE*         sell_slice_ptr,                 \
+                                            const ITYPE*         sell_row_perm,                  \
+                                            const ITYPE*         sell_col_ind,                   \
+                                            const TTYPE*         sell_val,                       \
+                                            ITYPE                sell_slice_size,                \
+                                            const TTYPE*         x,                              \
+                                            TTYPE                beta,                           \
+                                            TTYPE*               y,                              \
+                                            rocsparse_index_base base);                          \
+    template void host_csr16mv<ITYPE, TTYPE>(ITYPE                M,                             \
+                                             ITYPE                N,                             \
+                                             TTYPE                alpha,                         \
+                                             const ITYPE*         csr16_row_ptr,                 \
+                                             const ITYPE*         csr16_row_base,                \
+                                             const uint16_t*      csr16_col_off,                 \
+                                             const TTYPE*         csr16_val,                     \
+                                             ITYPE                csr16_esc_nnz,                 \
+                                             const ITYPE*         csr16_esc_row_ind,             \
+                                             const ITYPE*         csr16_esc_col_ind,             \
+                                             const TTYPE*         csr16_esc_val,                 \
+                                             const TTYPE*         x,                             \
+                                             TTYPE                beta,                          \
+                                             TTYPE*               y,                             \
+                                             rocsparse_index_base base);                         \
+    template void host_sellmm<ITYPE, TTYPE>(ITYPE                     M,                         \
+                                            ITYPE                     N,                         \
+                                            ITYPE                     K,                         \
+                                            rocsparse_operation       transB,                    \
+                                            TTYPE                     alpha,                     \
+                                            const std::vector<ITYPE>& sell_slice_ptr_A,          \
+                                            const std::vector<ITYPE>& sell_row_perm_A,           \
+                                            const std::vector<ITYPE>& sell_col_ind_A,            \
+                                            const std::vector<TTYPE>& sell_val_A,                \
+                                            ITYPE                     sell_slice_size_A,         \
+                                            const std::vector<TTYPE>& B,                         \
+                                            ITYPE                     ldb,                       \
+                                            TTYPE                     beta,                      \
+                                            std::vector<TTYPE>&       C,                         \
+                                            ITYPE                     ldc,                       \
+                                            rocsparse_order           order,                     \
+                                            rocsparse_index_base      base);                     \
     template void host_coomm<ITYPE, TTYPE>(rocsparse_spmm_alg        alg,                        \
                                            ITYPE                     M,                          \
                                            ITYPE                     N,                          \
@@ -7401,6 +7981,73 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                   TTYPE*               y,                        \
                                                   rocsparse_index_base base,                     \
                                                   int                  algo);                                     \
+    template void host_csrmv<ITYPE, JTYPE, TTYPE>(rocsparse_operation  trans,                    \
+                                                  JTYPE                M,                        \
+                                                  JTYPE                N,                        \
+                                                  ITYPE                nnz,                      \
+                                                  TTYPE                alpha,                    \
+                                                  const ITYPE*         csr_row_ptr,              \
+                                                  const JTYPE*         csr_col_ind,              \
+                                                  const TTYPE*         csr_val,                  \
+                                                  const TTYPE*         x,                        \
+                                                  TTYPE                beta,                     \
+                                                  TTYPE*               y,                        \
+                                                  rocsparse_index_base base,                     \
+                                                  int                  algo);                    \
+    template void host_cscmv<ITYPE, JTYPE, TTYPE>(rocsparse_operation  trans,                    \
+                                                  JTYPE                M,                        \
+                                                  JTYPE                N,                        \
+                                                  ITYPE                nnz,                      \
+                                                  TTYPE                alpha,                    \
+                                                  const ITYPE*         csc_col_ptr,              \
+                                                  const JTYPE*         csc_row_ind,              \
+                                                  const TTYPE*         csc_val,                  \
+                                                  const TTYPE*         x,                        \
+                                                  TTYPE                beta,                     \
+                                                  TTYPE*               y,                        \
+                                                  rocsparse_index_base base);                    \
+    template void host_csrmv_strided_batched<ITYPE, JTYPE, TTYPE>(                               \
+        JTYPE                M,                                                                  \
+        ITYPE                nnz,                                                                \
+        int                  batch_count,                                                        \
+        TTYPE                alpha,                                                              \
+        const ITYPE*         csr_row_ptr,                                                        \
+        const JTYPE*         csr_col_ind,                                                        \
+        const TTYPE*         csr_val,                                                            \
+        int64_t              val_batch_stride,                                                   \
+        const TTYPE*         x,                                                                  \
+        int64_t              x_batch_stride,                                                     \
+        TTYPE                beta,                                                               \
+        TTYPE*               y,                                                                  \
+        int64_t              y_batch_stride,                                                     \
+        rocsparse_index_base base);                                                              \
+    template void host_csrmv_fused<ITYPE, JTYPE, TTYPE>(JTYPE                M,                  \
+                                                        ITYPE                nnz,                \
+                                                        TTYPE                alpha,              \
+                                                        const ITYPE*         csr_row_ptr,        \
+                                                        const JTYPE*         csr_col_ind,        \
+                                                        const TTYPE*         csr_val,            \
+                                                        const TTYPE*         x,                  \
+                                                        TTYPE                beta,               \
+                                                        const TTYPE*         y_in,               \
+                                                        TTYPE*               y_out,              \
+                                                        TTYPE*               dot,                \
+                                                        TTYPE*               nrm2,               \
+                                                        rocsparse_index_base base);              \
+    template void host_csrmv_symmetric<ITYPE, JTYPE, TTYPE>(                                     \
+        rocsparse_operation   trans,                                                             \
+        JTYPE                 M,                                                                 \
+        ITYPE                 nnz,                                                               \
+        TTYPE                 alpha,                                                             \
+        const ITYPE*          csr_row_ptr,                                                       \
+        const JTYPE*          csr_col_ind,                                                       \
+        const TTYPE*          csr_val,                                                           \
+        const TTYPE*          x,                                                                 \
+        TTYPE                 beta,                                                              \
+        TTYPE*                y,                                                                 \
+        rocsparse_matrix_type matrix_type,                                                       \
+        rocsparse_fill_mode   fill_mode,                                                         \
+        rocsparse_index_base  base);                                                             \
     template void host_csrmm<ITYPE, JTYPE, TTYPE>(JTYPE                     M,                   \
                                                   JTYPE                     N,                   \
                                                   JTYPE                     K,                   \
@@ -7417,6 +8064,22 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                   JTYPE                     ldc,                 \
                                                   rocsparse_order           order,               \
                                                   rocsparse_index_base      base);                    \
+    template void host_cscmm<ITYPE, JTYPE, TTYPE>(JTYPE                     M,                   \
+                                                  JTYPE                     N,                   \
+                                                  JTYPE                     K,                   \
+                                                  rocsparse_operation       transA,              \
+                                                  rocsparse_operation       transB,              \
+                                                  TTYPE                     alpha,               \
+                                                  const std::vector<ITYPE>& csc_col_ptr_A,       \
+                                                  const std::vector<JTYPE>& csc_row_ind_A,       \
+                                                  const std::vector<TTYPE>& csc_val_A,           \
+                                                  const std::vector<TTYPE>& B,                   \
+                                                  JTYPE                     ldb,                 \
+                                                  TTYPE                     beta,                \
+                                                  std::vector<TTYPE>&       C,                   \
+                                                  JTYPE                     ldc,                 \
+                                                  rocsparse_order           order,               \
+                                                  rocsparse_index_base      base);               \
     template void host_csrgemm_nnz<ITYPE, JTYPE, TTYPE>(JTYPE                     M,             \
                                                         JTYPE                     N,             \
                                                         JTYPE                     K,             \
@@ -7454,7 +8117,68 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                     rocsparse_index_base      base_A,            \
                                                     rocsparse_index_base      base_B,            \
                                                     rocsparse_index_base      base_C,            \
-                                                    rocsparse_index_base      base_D);
+                                                    rocsparse_index_base      base_D);           \
+    template void host_bsrmv<ITYPE, JTYPE, TTYPE>(rocsparse_direction  dir,                      \
+                                                  rocsparse_operation  trans,                    \
+                                                  JTYPE                mb,                       \
+                                                  JTYPE                nb,                       \
+                                                  ITYPE                nnzb,                     \
+                                                  TTYPE                alpha,                    \
+                                                  const ITYPE*         bsr_row_ptr,              \
+                                                  const JTYPE*         bsr_col_ind,              \
+                                                  const TTYPE*         bsr_val,                  \
+                                                  JTYPE                bsr_dim,                  \
+                                                  const TTYPE*         x,                        \
+                                                  TTYPE                beta,                     \
+                                                  TTYPE*               y,                        \
+                                                  rocsparse_index_base base);                    \
+    template void host_gebsrmv<ITYPE, JTYPE, TTYPE>(rocsparse_direction  dir,                    \
+                                                    rocsparse_operation  trans,                  \
+                                                    JTYPE                mb,                     \
+                                                    JTYPE                nb,                     \
+                                                    ITYPE                nnzb,                   \
+                                                    TTYPE                alpha,                  \
+                                                    const ITYPE*         bsr_row_ptr,            \
+                                                    const JTYPE*         bsr_col_ind,            \
+                                                    const TTYPE*         bsr_val,                \
+                                                    JTYPE                row_block_dim,          \
+                                                    JTYPE                col_block_dim,          \
+                                                    const TTYPE*         x,                      \
+                                                    TTYPE                beta,                   \
+                                                    TTYPE*               y,                      \
+                                                    rocsparse_index_base base);                  \
+    template void host_gebsrmm<ITYPE, JTYPE, TTYPE>(rocsparse_handle          handle,            \
+                                                    rocsparse_direction       dir,               \
+                                                    rocsparse_operation       trans_A,           \
+                                                    rocsparse_operation       trans_B,           \
+                                                    JTYPE                     mb,                \
+                                                    JTYPE                     n,                 \
+                                                    JTYPE                     kb,                \
+                                                    ITYPE                     nnzb,              \
+                                                    const TTYPE*              alpha,             \
+                                                    const rocsparse_mat_descr descr,             \
+                                                    const TTYPE*              bsr_val,           \
+                                                    const ITYPE*              bsr_row_ptr,       \
+                                                    const JTYPE*              bsr_col_ind,       \
+                                                    JTYPE                     row_block_dim,     \
+                                                    JTYPE                     col_block_dim,     \
+                                                    const TTYPE*              B,                 \
+                                                    JTYPE                     ldb,               \
+                                                    const TTYPE*              beta,              \
+                                                    TTYPE*                    C,                 \
+                                                    JTYPE                     ldc);              \
+    template void host_gebsr2dense<ITYPE, JTYPE, TTYPE>(rocsparse_direction  dir,                \
+                                                        JTYPE                mb,                 \
+                                                        JTYPE                nb,                 \
+                                                        JTYPE                row_block_dim,      \
+                                                        JTYPE                col_block_dim,      \
+                                                        rocsparse_index_base base,               \
+                                                        rocsparse_order      order,              \
+                                                        const TTYPE*         bsr_val,            \
+                                                        const ITYPE*         bsr_row_ptr,        \
+                                                        const JTYPE*         bsr_col_ind,        \
+                                                        TTYPE*               A,                  \
+                                                        ITYPE                ld);
 
 #define INSTANTIATE4(DIR, ITYPE, JTYPE, TTYPE)                                                       \
     template void host_dense2csx<DIR, TTYPE, ITYPE, JTYPE>(JTYPE                m,                   \
@@ -7499,6 +8223,27 @@ INSTANTIATE3(int64_t, int64_t, double);
 INSTANTIATE3(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE3(int64_t, int64_t, rocsparse_double_complex);
 
+#define INSTANTIATE_MIXED(ITYPE, JTYPE, ATYPE, TTYPE)                                            \
+    template void host_csrmv_mixed<ITYPE, JTYPE, ATYPE, TTYPE>(rocsparse_operation  trans,       \
+                                                               JTYPE                M,           \
+                                                               JTYPE                N,           \
+                                                               ITYPE                nnz,         \
+                                                               TTYPE                alpha,       \
+                                                               const ITYPE*         csr_row_ptr, \
+                                                               const JTYPE*         csr_col_ind, \
+                                                               const ATYPE*         csr_val,     \
+                                                               const TTYPE*         x,           \
+                                                               TTYPE                beta,        \
+                                                               TTYPE*               y,           \
+                                                               rocsparse_index_base base)
+
+INSTANTIATE_MIXED(int32_t, int32_t, float, double);
+INSTANTIATE_MIXED(int32_t, int32_t, rocsparse_float_complex, rocsparse_double_complex);
+INSTANTIATE_MIXED(int64_t, int32_t, float, double);
+INSTANTIATE_MIXED(int64_t, int32_t, rocsparse_float_complex, rocsparse_double_complex);
+INSTANTIATE_MIXED(int64_t, int64_t, float, double);
+INSTANTIATE_MIXED(int64_t, int64_t, rocsparse_float_complex, rocsparse_double_complex);
+
 INSTANTIATE4(rocsparse_direction_row, int32_t, int32_t, float);
 INSTANTIATE4(rocsparse_direction_row, int32_t, int32_t, double);
 INSTANTIATE4(rocsparse_direction_row, int32_t, int32_t, rocsparse_float_complex);
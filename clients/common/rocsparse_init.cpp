@@ -157,6 +157,266 @@ void host_csr_to_ell(J                     M,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csr_to_sell(J                     M,
+                      const std::vector<I>& csr_row_ptr,
+                      const std::vector<J>& csr_col_ind,
+                      const std::vector<T>& csr_val,
+                      J                     slice_size,
+                      J                     sigma,
+                      std::vector<J>&       sell_slice_ptr,
+                      std::vector<J>&       sell_row_perm,
+                      std::vector<J>&       sell_col_ind,
+                      std::vector<T>&       sell_val,
+                      J&                    sell_nnz,
+                      rocsparse_index_base  csr_base,
+                      rocsparse_index_base  sell_base)
+{
+    J nslices = (M > 0) ? (M - 1) / slice_size + 1 : 0;
+
+    sell_slice_ptr.resize(nslices + 1);
+    sell_row_perm.resize(M);
+
+    // Sort the rows within each window of sigma rows by decreasing number of non-zeros
+    for(J window_begin = 0; window_begin < M; window_begin += sigma)
+    {
+        J window_end = std::min(window_begin + sigma, M);
+
+        std::vector<J> rows(window_end - window_begin);
+        for(J i = window_begin; i < window_end; ++i)
+        {
+            rows[i - window_begin] = i;
+        }
+
+        std::stable_sort(rows.begin(), rows.end(), [&](J a, J b) {
+            return csr_row_ptr[a + 1] - csr_row_ptr[a] > csr_row_ptr[b + 1] - csr_row_ptr[b];
+        });
+
+        for(J i = window_begin; i < window_end; ++i)
+        {
+            sell_row_perm[i] = rows[i - window_begin] + sell_base;
+        }
+    }
+
+    // Each slice is as wide as its longest row
+    sell_slice_ptr[0] = sell_base;
+
+    for(J s = 0; s < nslices; ++s)
+    {
+        J width = 0;
+
+        for(J p = s * slice_size; p < std::min((s + 1) * slice_size, M); ++p)
+        {
+            J row     = sell_row_perm[p] - sell_base;
+            J row_nnz = csr_row_ptr[row + 1] - csr_row_ptr[row];
+            width     = std::max(row_nnz, width);
+        }
+
+        sell_slice_ptr[s + 1] = sell_slice_ptr[s] + width * slice_size;
+    }
+
+    sell_nnz = sell_slice_ptr[nslices] - sell_base;
+
+    // Slices are stored column wise, unused entries are padded
+    sell_col_ind.assign(sell_nnz, -1);
+    sell_val.assign(sell_nnz, static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J p = 0; p < M; ++p)
+    {
+        J row    = sell_row_perm[p] - sell_base;
+        J offset = sell_slice_ptr[p / slice_size] - sell_base + p % slice_size;
+
+        I row_begin = csr_row_ptr[row] - csr_base;
+        I row_end   = csr_row_ptr[row + 1] - csr_base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            J idx = offset + (j - row_begin) * slice_size;
+
+            sell_col_ind[idx] = csr_col_ind[j] - csr_base + sell_base;
+            sell_val[idx]     = csr_val[j];
+        }
+    }
+}
+
+template <typename I, typename T>
+void host_csr_to_csr16(I                      M,
+                       const std::vector<I>&  csr_row_ptr,
+                       const std::vector<I>&  csr_col_ind,
+                       const std::vector<T>&  csr_val,
+                       std::vector<I>&        csr16_row_ptr,
+                       std::vector<I>&        csr16_row_base,
+                       std::vector<uint16_t>& csr16_col_off,
+                       std::vector<T>&        csr16_val,
+                       std::vector<I>&        csr16_esc_row_ind,
+                       std::vector<I>&        csr16_esc_col_ind,
+                       std::vector<T>&        csr16_esc_val,
+                       I&                     csr16_nnz,
+                       I&                     csr16_esc_nnz,
+                       rocsparse_index_base   csr_base,
+                       rocsparse_index_base   csr16_base)
+{
+    static constexpr I max_offset = 0xFFFF;
+
+    csr16_row_ptr.resize(M + 1);
+    csr16_row_base.resize(M);
+
+    csr16_row_ptr[0] = csr16_base;
+
+    // The base column of each row is the start of the first window of max_offset + 1
+    // columns that covers most of the (sorted) column indices of the row
+    for(I i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - csr_base;
+        I row_end   = csr_row_ptr[i + 1] - csr_base;
+
+        I base  = 0;
+        I width = 0;
+        I lo    = row_begin;
+
+        for(I hi = row_begin; hi < row_end; ++hi)
+        {
+            while(csr_col_ind[hi] - csr_col_ind[lo] > max_offset)
+            {
+                ++lo;
+            }
+
+            if(hi - lo + 1 > width)
+            {
+                width = hi - lo + 1;
+                base  = csr_col_ind[lo] - csr_base;
+            }
+        }
+
+        I nnz = 0;
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            I off = csr_col_ind[j] - csr_base - base;
+
+            if(off >= 0 && off <= max_offset)
+            {
+                ++nnz;
+            }
+        }
+
+        csr16_row_base[i]    = base + csr16_base;
+        csr16_row_ptr[i + 1] = csr16_row_ptr[i] + nnz;
+    }
+
+    csr16_nnz     = csr16_row_ptr[M] - csr16_base;
+    csr16_esc_nnz = (csr_row_ptr[M] - csr_row_ptr[0]) - csr16_nnz;
+
+    csr16_col_off.resize(csr16_nnz);
+    csr16_val.resize(csr16_nnz);
+    csr16_esc_row_ind.resize(csr16_esc_nnz);
+    csr16_esc_col_ind.resize(csr16_esc_nnz);
+    csr16_esc_val.resize(csr16_esc_nnz);
+
+    // Entries outside of the window are escaped in COO format, sorted by row
+    I esc = 0;
+    for(I i = 0; i < M; ++i)
+    {
+        I idx  = csr16_row_ptr[i] - csr16_base;
+        I base = csr16_row_base[i] - csr16_base;
+
+        for(I j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base; ++j)
+        {
+            I col = csr_col_ind[j] - csr_base;
+            I off = col - base;
+
+            if(off >= 0 && off <= max_offset)
+            {
+                csr16_col_off[idx] = static_cast<uint16_t>(off);
+                csr16_val[idx]     = csr_val[j];
+                ++idx;
+            }
+            else
+            {
+                csr16_esc_row_ind[esc] = i + csr16_base;
+                csr16_esc_col_ind[esc] = col + csr16_base;
+                csr16_esc_val[esc]     = csr_val[j];
+                ++esc;
+            }
+        }
+    }
+}
+
+template <typename I, typename T>
+void host_csr16_to_csr(I                            M,
+                       const std::vector<I>&        csr16_row_ptr,
+                       const std::vector<I>&        csr16_row_base,
+                       const std::vector<uint16_t>& csr16_col_off,
+                       const std::vector<T>&        csr16_val,
+                       I                            csr16_esc_nnz,
+                       const std::vector<I>&        csr16_esc_row_ind,
+                       const std::vector<I>&        csr16_esc_col_ind,
+                       const std::vector<T>&        csr16_esc_val,
+                       std::vector<I>&              csr_row_ptr,
+                       std::vector<I>&              csr_col_ind,
+                       std::vector<T>&              csr_val,
+                       rocsparse_index_base         csr16_base,
+                       rocsparse_index_base         csr_base)
+{
+    I csr16_nnz = csr16_row_ptr[M] - csr16_row_ptr[0];
+
+    csr_row_ptr.resize(M + 1);
+    csr_col_ind.resize(csr16_nnz + csr16_esc_nnz);
+    csr_val.resize(csr16_nnz + csr16_esc_nnz);
+
+    // Merge the escaped entries back into their rows, keeping the columns sorted
+    I esc = 0;
+    I idx = 0;
+
+    csr_row_ptr[0] = csr_base;
+
+    for(I i = 0; i < M; ++i)
+    {
+        I row_begin = idx;
+        I base      = csr16_row_base[i] - csr16_base;
+
+        for(I j = csr16_row_ptr[i] - csr16_base; j < csr16_row_ptr[i + 1] - csr16_base; ++j)
+        {
+            csr_col_ind[idx] = base + csr16_col_off[j] + csr_base;
+            csr_val[idx]     = csr16_val[j];
+            ++idx;
+        }
+
+        while(esc < csr16_esc_nnz && csr16_esc_row_ind[esc] - csr16_base == i)
+        {
+            csr_col_ind[idx] = csr16_esc_col_ind[esc] - csr16_base + csr_base;
+            csr_val[idx]     = csr16_esc_val[esc];
+            ++esc;
+            ++idx;
+        }
+
+        std::vector<I> perm(idx - row_begin);
+        for(I j = 0; j < idx - row_begin; ++j)
+        {
+            perm[j] = row_begin + j;
+        }
+
+        std::stable_sort(perm.begin(), perm.end(), [&](I a, I b) {
+            return csr_col_ind[a] < csr_col_ind[b];
+        });
+
+        std::vector<I> col(perm.size());
+        std::vector<T> val(perm.size());
+        for(size_t j = 0; j < perm.size(); ++j)
+        {
+            col[j] = csr_col_ind[perm[j]];
+            val[j] = csr_val[perm[j]];
+        }
+
+        std::copy(col.begin(), col.end(), csr_col_ind.begin() + row_begin);
+        std::copy(val.begin(), val.end(), csr_val.begin() + row_begin);
+
+        csr_row_ptr[i + 1] = idx + csr_base;
+    }
+}
+
 /* ==================================================================================== */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
@@ -1554,7 +1814,36 @@ void rocsparse_init_coo_matrix(std::vector<I>&       coo_row_ind,
                                                           rocsparse_matrix_init matrix,      \
                                                           const char*           filename,    \
                                                           bool                  toint,       \
-                                                          bool                  full_rank);
+                                                          bool                  full_rank);   \
+    template void host_csr_to_csr16<ITYPE, TTYPE>(ITYPE                     M,                 \
+                                                  const std::vector<ITYPE>& csr_row_ptr,       \
+                                                  const std::vector<ITYPE>& csr_col_ind,       \
+                                                  const std::vector<TTYPE>& csr_val,           \
+                                                  std::vector<ITYPE>&       csr16_row_ptr,     \
+                                                  std::vector<ITYPE>&       csr16_row_base,    \
+                                                  std::vector<uint16_t>&    csr16_col_off,     \
+                                                  std::vector<TTYPE>&       csr16_val,         \
+                                                  std::vector<ITYPE>&       csr16_esc_row_ind, \
+                                                  std::vector<ITYPE>&       csr16_esc_col_ind, \
+                                                  std::vector<TTYPE>&       csr16_esc_val,     \
+                                                  ITYPE&                    csr16_nnz,         \
+                                                  ITYPE&                    csr16_esc_nnz,     \
+                                                  rocsparse_index_base      csr_base,          \
+                                                  rocsparse_index_base      csr16_base);       \
+    template void host_csr16_to_csr<ITYPE, TTYPE>(ITYPE                        M,                 \
+                                                  const std::vector<ITYPE>&    csr16_row_ptr,     \
+                                                  const std::vector<ITYPE>&    csr16_row_base,    \
+                                                  const std::vector<uint16_t>& csr16_col_off,     \
+                                                  const std::vector<TTYPE>&    csr16_val,         \
+                                                  ITYPE                        csr16_esc_nnz,     \
+                                                  const std::vector<ITYPE>&    csr16_esc_row_ind, \
+                                                  const std::vector<ITYPE>&    csr16_esc_col_ind, \
+                                                  const std::vector<TTYPE>&    csr16_esc_val,     \
+                                                  std::vector<ITYPE>&          csr_row_ptr,       \
+                                                  std::vector<ITYPE>&          csr_col_ind,       \
+                                                  std::vector<TTYPE>&          csr_val,           \
+                                                  rocsparse_index_base         csr16_base,        \
+                                                  rocsparse_index_base         csr_base);
 
 #define INSTANTIATE3(ITYPE, JTYPE, TTYPE)                                                           \
     template void rocsparse_init_csr_laplace2d<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,   \
@@ -1625,7 +1914,20 @@ void rocsparse_init_coo_matrix(std::vector<I>&       coo_row_ind,
                                                        std::vector<TTYPE>&       ell_val,           \
                                                        JTYPE&                    ell_width,         \
                                                        rocsparse_index_base      csr_base,          \
-                                                       rocsparse_index_base      ell_base);
+                                                       rocsparse_index_base      ell_base);         \
+    template void host_csr_to_sell<ITYPE, JTYPE, TTYPE>(JTYPE                     M,                \
+                                                        const std::vector<ITYPE>& csr_row_ptr,      \
+                                                        const std::vector<JTYPE>& csr_col_ind,      \
+                                                        const std::vector<TTYPE>& csr_val,          \
+                                                        JTYPE                     slice_size,       \
+                                                        JTYPE                     sigma,            \
+                                                        std::vector<JTYPE>&       sell_slice_ptr,   \
+                                                        std::vector<JTYPE>&       sell_row_perm,    \
+                                                        std::vector<JTYPE>&       sell_col_ind,     \
+                                                        std::vector<TTYPE>&       sell_val,         \
+                                                        JTYPE&                    sell_nnz,         \
+                                                        rocsparse_index_base      csr_base,         \
+                                                        rocsparse_index_base      sell_base);
 
 #define INSTANTIATE4(ITYPE)                                                         \
     template void host_csr_to_coo_aos<ITYPE>(ITYPE                     M,           \
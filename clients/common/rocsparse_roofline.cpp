@@ -0,0 +1,149 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_roofline.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+bool rocsparse_machine_profile::load(const std::string& filename)
+{
+    std::ifstream ifs(filename);
+    if(!ifs.is_open())
+    {
+        std::cerr << "Error: cannot open machine profile " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int         lineno = 0;
+    while(std::getline(ifs, line))
+    {
+        ++lineno;
+
+        // Strip comments
+        size_t pos = line.find('#');
+        if(pos != std::string::npos)
+        {
+            line.erase(pos);
+        }
+
+        // Allow "key = value" as well as "key value"
+        std::replace(line.begin(), line.end(), '=', ' ');
+
+        std::istringstream iss(line);
+        std::string        key;
+        if(!(iss >> key))
+        {
+            continue;
+        }
+
+        bool ok = true;
+        if(key == "name")
+        {
+            std::getline(iss >> std::ws, this->name);
+        }
+        else if(key == "bandwidth")
+        {
+            ok = static_cast<bool>(iss >> this->bandwidth);
+        }
+        else if(key == "gflops_f32")
+        {
+            ok = static_cast<bool>(iss >> this->gflops_f32);
+        }
+        else if(key == "gflops_f64")
+        {
+            ok = static_cast<bool>(iss >> this->gflops_f64);
+        }
+        else
+        {
+            std::cerr << "Warning: unknown key '" << key << "' in machine profile " << filename
+                      << ":" << lineno << std::endl;
+        }
+
+        if(!ok)
+        {
+            std::cerr << "Error: invalid value for '" << key << "' in machine profile "
+                      << filename << ":" << lineno << std::endl;
+            return false;
+        }
+    }
+
+    if(!this->valid())
+    {
+        std::cerr << "Error: machine profile " << filename
+                  << " requires positive bandwidth and gflops_f32 or gflops_f64" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool rocsparse_machine_profile::valid() const
+{
+    return this->bandwidth > 0.0 && (this->gflops_f32 > 0.0 || this->gflops_f64 > 0.0);
+}
+
+double rocsparse_machine_profile::peak_gflops() const
+{
+    // Complex arithmetic runs on the units of its real counterpart
+    bool f64 = (this->precision == 'd' || this->precision == 'z');
+
+    double peak = f64 ? this->gflops_f64 : this->gflops_f32;
+
+    // Fall back to the other precision if only one of them is specified
+    return (peak > 0.0) ? peak : std::max(this->gflops_f32, this->gflops_f64);
+}
+
+rocsparse_machine_profile& rocsparse_machine_profile::active()
+{
+    static rocsparse_machine_profile profile;
+    return profile;
+}
+
+rocsparse_roofline rocsparse_roofline_compute(const rocsparse_machine_profile& profile,
+                                              double                           gflops,
+                                              double                           gbyte)
+{
+    rocsparse_roofline roof;
+
+    if(!profile.valid() || gbyte <= 0.0)
+    {
+        return roof;
+    }
+
+    double peak_gflops = profile.peak_gflops();
+    double ridge       = peak_gflops / profile.bandwidth;
+
+    roof.intensity         = gflops / gbyte;
+    roof.attainable        = std::min(peak_gflops, roof.intensity * profile.bandwidth);
+    roof.percent_bandwidth = 100.0 * gbyte / profile.bandwidth;
+    roof.percent_compute   = 100.0 * gflops / peak_gflops;
+    roof.percent_roof      = (roof.attainable > 0.0) ? 100.0 * gflops / roof.attainable : 0.0;
+    roof.bound             = (roof.intensity < ridge) ? "memory" : "compute";
+
+    return roof;
+}
@@ -0,0 +1,302 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_sweep.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+std::vector<std::pair<std::string, std::string>>& rocsparse_timing_record()
+{
+    static std::vector<std::pair<std::string, std::string>> record;
+    return record;
+}
+
+static bool rocsparse_sweep_parse_int(const std::string& s, int64_t& value)
+{
+    if(s.empty())
+    {
+        return false;
+    }
+
+    char* end;
+    value = strtoll(s.c_str(), &end, 10);
+
+    return *end == '\0';
+}
+
+bool rocsparse_sweep_parse(const std::string& spec, std::vector<int64_t>& values)
+{
+    values.clear();
+
+    std::istringstream iss(spec);
+    std::string        item;
+    while(std::getline(iss, item, ','))
+    {
+        // Strip white spaces
+        item.erase(std::remove_if(item.begin(), item.end(), ::isspace), item.end());
+
+        size_t colon = item.find(':');
+        if(colon == std::string::npos)
+        {
+            int64_t value;
+            if(!rocsparse_sweep_parse_int(item, value))
+            {
+                return false;
+            }
+
+            values.push_back(value);
+            continue;
+        }
+
+        // Range
+        std::string first = item.substr(0, colon);
+        std::string last  = item.substr(colon + 1);
+        std::string step  = "1";
+        bool        geom  = false;
+
+        size_t sep = last.find_first_of(":*");
+        if(sep != std::string::npos)
+        {
+            geom = (last[sep] == '*');
+            step = last.substr(sep + 1);
+            last = last.substr(0, sep);
+        }
+
+        int64_t a, b, s;
+        if(!rocsparse_sweep_parse_int(first, a) || !rocsparse_sweep_parse_int(last, b)
+           || !rocsparse_sweep_parse_int(step, s) || a > b)
+        {
+            return false;
+        }
+
+        if(geom)
+        {
+            // Geometric range requires a positive start and a factor larger than one
+            if(a <= 0 || s <= 1)
+            {
+                return false;
+            }
+
+            for(int64_t v = a; v <= b; v *= s)
+            {
+                values.push_back(v);
+            }
+        }
+        else
+        {
+            if(s <= 0)
+            {
+                return false;
+            }
+
+            for(int64_t v = a; v <= b; v += s)
+            {
+                values.push_back(v);
+            }
+        }
+    }
+
+    return !values.empty();
+}
+
+void rocsparse_sweep::add(const std::string& name, const std::vector<int64_t>& values)
+{
+    this->names.push_back(name);
+    this->values.push_back(values);
+}
+
+bool rocsparse_sweep::active() const
+{
+    for(const std::vector<int64_t>& v : this->values)
+    {
+        if(v.size() > 1)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t rocsparse_sweep::size() const
+{
+    size_t size = 1;
+    for(const std::vector<int64_t>& v : this->values)
+    {
+        size *= v.size();
+    }
+
+    return size;
+}
+
+std::vector<int64_t> rocsparse_sweep::point(size_t index) const
+{
+    // Last parameter varies fastest
+    std::vector<int64_t> p(this->values.size());
+    for(size_t i = this->values.size(); i-- > 0;)
+    {
+        p[i] = this->values[i][index % this->values[i].size()];
+        index /= this->values[i].size();
+    }
+
+    return p;
+}
+
+void rocsparse_sweep::record(size_t index)
+{
+    this->points.push_back(index);
+    this->results.push_back(rocsparse_timing_record());
+}
+
+static const std::string* rocsparse_sweep_find(
+    const std::vector<std::pair<std::string, std::string>>& result, const std::string& name)
+{
+    for(const std::pair<std::string, std::string>& column : result)
+    {
+        if(column.first == name)
+        {
+            return &column.second;
+        }
+    }
+
+    return nullptr;
+}
+
+void rocsparse_sweep::write(std::ostream& os, const std::string& metric) const
+{
+    // Parameters that are actually swept
+    std::vector<size_t> swept;
+    for(size_t i = 0; i < this->values.size(); ++i)
+    {
+        if(this->values[i].size() > 1)
+        {
+            swept.push_back(i);
+        }
+    }
+
+    // Union of all result columns, in order of appearance, skipping swept parameters
+    std::vector<std::string> columns;
+    for(const std::vector<std::pair<std::string, std::string>>& result : this->results)
+    {
+        for(const std::pair<std::string, std::string>& column : result)
+        {
+            bool is_swept = false;
+            for(size_t i : swept)
+            {
+                is_swept |= (column.first == this->names[i]);
+            }
+
+            if(!is_swept
+               && std::find(columns.begin(), columns.end(), column.first) == columns.end())
+            {
+                columns.push_back(column.first);
+            }
+        }
+    }
+
+    // One row per point
+    for(size_t i = 0; i < swept.size(); ++i)
+    {
+        os << (i ? "," : "") << this->names[swept[i]];
+    }
+    for(const std::string& column : columns)
+    {
+        os << "," << column;
+    }
+    os << std::endl;
+
+    for(size_t r = 0; r < this->results.size(); ++r)
+    {
+        std::vector<int64_t> p = this->point(this->points[r]);
+
+        for(size_t i = 0; i < swept.size(); ++i)
+        {
+            os << (i ? "," : "") << p[swept[i]];
+        }
+        for(const std::string& column : columns)
+        {
+            const std::string* value = rocsparse_sweep_find(this->results[r], column);
+            os << "," << (value ? *value : "");
+        }
+        os << std::endl;
+    }
+
+    if(swept.size() != 2)
+    {
+        return;
+    }
+
+    // Matrix of the selected metric, falling back to the usual rate and time columns
+    std::string name;
+    const std::string candidates[] = {metric, "GFlop/s", "GB/s", "msec"};
+    for(const std::string& candidate : candidates)
+    {
+        if(std::find(columns.begin(), columns.end(), candidate) != columns.end())
+        {
+            name = candidate;
+            break;
+        }
+    }
+
+    if(name.empty())
+    {
+        return;
+    }
+
+    const std::vector<int64_t>& rows = this->values[swept[0]];
+    const std::vector<int64_t>& cols = this->values[swept[1]];
+
+    os << std::endl;
+    os << name << ": " << this->names[swept[0]] << " \\ " << this->names[swept[1]];
+    for(int64_t col : cols)
+    {
+        os << "," << col;
+    }
+    os << std::endl;
+
+    for(size_t i = 0; i < rows.size(); ++i)
+    {
+        os << rows[i];
+        for(size_t j = 0; j < cols.size(); ++j)
+        {
+            // All other parameters take a single value
+            size_t index = i * cols.size() + j;
+
+            const std::string* value = nullptr;
+            for(size_t r = 0; r < this->results.size(); ++r)
+            {
+                if(this->points[r] == index)
+                {
+                    value = rocsparse_sweep_find(this->results[r], name);
+                }
+            }
+
+            os << "," << (value ? *value : "");
+        }
+        os << std::endl;
+    }
+}
@@ -30,8 +30,11 @@
 #ifndef AUTO_TESTING_BAD_ARG_HPP
 #define AUTO_TESTING_BAD_ARG_HPP
 
+#include "rocsparse_roofline.hpp"
+#include "rocsparse_sweep.hpp"
 #include "rocsparse_test.hpp"
 #include <hip/hip_runtime_api.h>
+#include <sstream>
 #include <vector>
 
 //
@@ -303,32 +306,95 @@ inline void auto_testing_bad_arg(F f, int n, const int* idx, Ts... ts)
 //
 // Template to display timing information.
 //
+inline int display_timing_info_width(const char* name)
+{
+    // Columns are at least 12 characters wide and never shorter than their legend
+    return std::max(12, static_cast<int>(strlen(name)) + 1);
+}
+
 template <typename T, typename... Ts>
 inline void display_timing_info_legend(const char* name, T t)
 {
-    std::cout << std::setw(12) << name;
+    std::cout << std::setw(display_timing_info_width(name)) << name;
 }
 
 template <typename T, typename... Ts>
 inline void display_timing_info_legend(const char* name, T t, Ts... ts)
 {
-    std::cout << std::setw(12) << name;
+    std::cout << std::setw(display_timing_info_width(name)) << name;
     display_timing_info_legend(ts...);
 }
 
 template <typename T, typename... Ts>
 inline void display_timing_info_values(const char* name, T t)
 {
-    std::cout << std::setw(12) << t;
+    std::cout << std::setw(display_timing_info_width(name)) << t;
 }
 
 template <typename T, typename... Ts>
 inline void display_timing_info_values(const char* name, T t, Ts... ts)
 {
-    std::cout << std::setw(12) << t;
+    std::cout << std::setw(display_timing_info_width(name)) << t;
     display_timing_info_values(ts...);
 }
 
+//
+// Keep the timing information, e.g. to collect the results of a parameter sweep.
+//
+template <typename T>
+inline void display_timing_info_record(const char* name, T t)
+{
+    std::ostringstream value;
+    value.precision(2);
+    value.setf(std::ios::fixed);
+    value << t;
+
+    rocsparse_timing_record().push_back(std::make_pair(std::string(name), value.str()));
+}
+
+template <typename T, typename... Ts>
+inline void display_timing_info_record(const char* name, T t, Ts... ts)
+{
+    display_timing_info_record(name, t);
+    display_timing_info_record(ts...);
+}
+
+//
+// Extract the measured GFlop/s and GB/s from the timing information.
+//
+template <typename T>
+inline double display_timing_info_to_double(T t, std::true_type)
+{
+    return static_cast<double>(t);
+}
+
+template <typename T>
+inline double display_timing_info_to_double(T t, std::false_type)
+{
+    return 0.0;
+}
+
+template <typename T>
+inline void display_timing_info_rates(double& gflops, double& gbyte, const char* name, T t)
+{
+    if(!strcmp(name, "GFlop/s"))
+    {
+        gflops = display_timing_info_to_double(t, std::is_arithmetic<T>{});
+    }
+    else if(!strcmp(name, "GB/s"))
+    {
+        gbyte = display_timing_info_to_double(t, std::is_arithmetic<T>{});
+    }
+}
+
+template <typename T, typename... Ts>
+inline void
+    display_timing_info_rates(double& gflops, double& gbyte, const char* name, T t, Ts... ts)
+{
+    display_timing_info_rates(gflops, gbyte, name, t);
+    display_timing_info_rates(gflops, gbyte, ts...);
+}
+
 template <typename T, typename... Ts>
 inline void display_timing_info(const char* name, T t, Ts... ts)
 {
@@ -336,10 +402,51 @@ inline void display_timing_info(const char* name, T t, Ts... ts)
     std::cout.setf(std::ios::fixed);
     std::cout.setf(std::ios::left);
 
+    // Roofline information is only available if both rates are reported
+    // and a machine profile has been loaded
+    double gflops = -1.0;
+    double gbyte  = -1.0;
+    display_timing_info_rates(gflops, gbyte, name, t, ts...);
+
+    const rocsparse_machine_profile& profile = rocsparse_machine_profile::active();
+    bool roofline = profile.valid() && gflops >= 0.0 && gbyte > 0.0;
+
     display_timing_info_legend(name, t, ts...);
+    if(roofline)
+    {
+        display_timing_info_legend(
+            "Flop/Byte", 0, "%peak BW", 0, "%peak Flop", 0, "%roof", 0, "bound", 0);
+    }
     std::cout << std::endl;
 
+    rocsparse_timing_record().clear();
+
     display_timing_info_values(name, t, ts...);
+    display_timing_info_record(name, t, ts...);
+    if(roofline)
+    {
+        rocsparse_roofline roof = rocsparse_roofline_compute(profile, gflops, gbyte);
+        display_timing_info_values("Flop/Byte",
+                                   roof.intensity,
+                                   "%peak BW",
+                                   roof.percent_bandwidth,
+                                   "%peak Flop",
+                                   roof.percent_compute,
+                                   "%roof",
+                                   roof.percent_roof,
+                                   "bound",
+                                   roof.bound);
+        display_timing_info_record("Flop/Byte",
+                                   roof.intensity,
+                                   "%peak BW",
+                                   roof.percent_bandwidth,
+                                   "%peak Flop",
+                                   roof.percent_compute,
+                                   "%roof",
+                                   roof.percent_roof,
+                                   "bound",
+                                   roof.bound);
+    }
     std::cout << std::endl;
 }
 
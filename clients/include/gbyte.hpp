@@ -105,6 +105,33 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
            / 1e9;
 }
 
+template <typename A, typename T, typename I, typename J>
+constexpr double csrmv_mixed_gbyte_count(J M, J N, I nnz, bool beta = false)
+{
+    return ((M + 1) * sizeof(I) + nnz * sizeof(J) + nnz * sizeof(A)
+            + (M + N + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T, typename I, typename J>
+constexpr double csrmv_strided_batched_gbyte_count(
+    J M, J N, I nnz, int batch_count, bool x_batched, bool beta = false)
+{
+    // The sparsity pattern is shared by all batches
+    return ((M + 1) * sizeof(I) + nnz * sizeof(J)
+            + (batch_count * (nnz + M + (beta ? M : 0)) + (x_batched ? batch_count : 1) * N)
+                  * sizeof(T))
+           / 1e9;
+}
+
+template <typename T, typename I>
+constexpr double csr16mv_gbyte_count(I M, I N, I nnz, I esc_nnz, bool beta = false)
+{
+    return ((2.0 * M + 1 + 2.0 * esc_nnz) * sizeof(I) + nnz * sizeof(uint16_t)
+            + (M + N + nnz + esc_nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double bsrsv_gbyte_count(rocsparse_int mb, rocsparse_int nnzb, rocsparse_int bsr_dim)
 {
@@ -406,6 +433,17 @@ constexpr double csx2dense_gbyte_count(J M, J N, I nnz)
     return (read_csx + write_dense) / 1e9;
 }
 
+template <typename T, typename I, typename J>
+constexpr double gebsr2dense_gbyte_count(J Mb, J Nb, I nnzb, J row_block_dim, J col_block_dim)
+{
+    const size_t block_size = size_t(row_block_dim) * col_block_dim;
+    const size_t read_bsr   = nnzb * block_size * sizeof(T) + nnzb * sizeof(J) + (Mb + 1) * sizeof(I);
+    const size_t write_dense
+        = Mb * row_block_dim * Nb * col_block_dim * sizeof(T)
+          + nnzb * block_size * sizeof(T); // set to zero + block assignments.
+    return (read_bsr + write_dense) / 1e9;
+}
+
 template <typename T, typename I>
 constexpr double coo2dense_gbyte_count(I M, I N, I nnz)
 {
@@ -459,6 +497,25 @@ constexpr double csr2ell_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocspar
     return ((M + 1.0 + ell_nnz) * sizeof(rocsparse_int) + (nnz + ell_nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2sell_gbyte_count(rocsparse_int M,
+                                      rocsparse_int nslices,
+                                      rocsparse_int nnz,
+                                      rocsparse_int sell_nnz)
+{
+    return ((2.0 * M + 1.0 + nslices + 1.0 + nnz + sell_nnz) * sizeof(rocsparse_int)
+            + (nnz + sell_nnz) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csr2csr16_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int esc_nnz)
+{
+    return ((3.0 * M + 2.0 + 2.0 * nnz + 2.0 * esc_nnz) * sizeof(rocsparse_int)
+            + (nnz - esc_nnz) * sizeof(uint16_t) + 2.0 * nnz * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double ell2csr_gbyte_count(rocsparse_int M, rocsparse_int csr_nnz, rocsparse_int ell_nnz)
 {
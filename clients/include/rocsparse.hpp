@@ -1090,6 +1090,38 @@ REAL_COMPLEX_TEMPLATE(csr2ell,
                       T*                        ell_val,
                       rocsparse_int*            ell_col_ind);
 
+// csr2sell
+REAL_COMPLEX_TEMPLATE(csr2sell,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      const rocsparse_mat_descr csr_descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const rocsparse_mat_descr sell_descr,
+                      rocsparse_int             slice_size,
+                      const rocsparse_int*      sell_slice_ptr,
+                      const rocsparse_int*      sell_row_perm,
+                      T*                        sell_val,
+                      rocsparse_int*            sell_col_ind);
+
+// csr2csr16
+REAL_COMPLEX_TEMPLATE(csr2csr16,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      const rocsparse_mat_descr csr_descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const rocsparse_mat_descr csr16_descr,
+                      const rocsparse_int*      csr16_row_ptr,
+                      const rocsparse_int*      csr16_row_base,
+                      T*                        csr16_val,
+                      uint16_t*                 csr16_col_off,
+                      T*                        csr16_esc_val,
+                      rocsparse_int*            csr16_esc_row_ind,
+                      rocsparse_int*            csr16_esc_col_ind);
+
 // csr2hyb
 REAL_COMPLEX_TEMPLATE(csr2hyb,
                       rocsparse_handle          handle,
@@ -1103,6 +1135,27 @@ REAL_COMPLEX_TEMPLATE(csr2hyb,
                       rocsparse_int             user_ell_width,
                       rocsparse_hyb_partition   partition_type);
 
+// csr2hyb_bounded
+REAL_COMPLEX_TEMPLATE(csr2hyb_bounded,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             n,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             user_ell_width,
+                      rocsparse_hyb_partition   partition_type,
+                      rocsparse_int*            ell_width,
+                      T*                        ell_val,
+                      rocsparse_int*            ell_col_ind,
+                      rocsparse_int*            coo_nnz,
+                      T*                        coo_val,
+                      rocsparse_int*            coo_row_ind,
+                      rocsparse_int*            coo_col_ind,
+                      void*                     temp_buffer);
+
 // csr2bsr
 REAL_COMPLEX_TEMPLATE(csr2bsr,
                       rocsparse_handle          handle,
@@ -1386,4 +1439,18 @@ REAL_COMPLEX_TEMPLATE(csrcolor,
                       rocsparse_int*            reordering,
                       rocsparse_mat_info        info);
 
+// csrcolor_async
+REAL_COMPLEX_TEMPLATE(csrcolor_async,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const T*                  fraction_to_color,
+                      rocsparse_int*            ncolors,
+                      rocsparse_int*            coloring,
+                      rocsparse_mat_info        info);
+
 #endif // ROCSPARSE_HPP
@@ -0,0 +1,91 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_ab.hpp provides interleaved A/B benchmarking of two or more
+ *  configurations of the same operation. Calls of all configurations are issued in
+ *  randomized order within each round, such that frequency and thermal drift affect
+ *  all configurations alike, and paired differences between rounds are reported.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_AB_HPP
+#define ROCSPARSE_AB_HPP
+
+#include "utility.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/* ==================================================================================== */
+/*! \brief  Options of the A/B benchmarks. */
+struct rocsparse_ab_options
+{
+    // Comma separated list of configurations, empty for the default of the function
+    std::string configs;
+
+    // Seed of the order in which configurations are run within each round
+    unsigned int seed = 0;
+
+    // Options that are used by all A/B benchmarks
+    static rocsparse_ab_options& active();
+};
+
+/* ==================================================================================== */
+/*! \brief  A single configuration that takes part in an A/B comparison. */
+struct rocsparse_ab_config
+{
+    // Name, e.g. "csr_adaptive"
+    std::string name;
+
+    // Issues a single call of the operation
+    std::function<void()> run;
+
+    // Work of a single call, to report rates
+    double gflop_count = 0.0;
+    double gbyte_count = 0.0;
+};
+
+/*! \brief  Split the configurations of the active options, or \p defaults if none have
+ *  been given, into a list of names.
+ */
+std::vector<std::string> rocsparse_ab_config_names(const std::string& defaults);
+
+/*! \brief  Run \p rounds rounds, each timing one call of every configuration in a random
+ *  order. Returns the samples in microseconds, indexed by configuration and round.
+ */
+std::vector<std::vector<double>> rocsparse_ab_run(hipStream_t                             stream,
+                                                  int                                     rounds,
+                                                  const std::vector<rocsparse_ab_config>& configs);
+
+/*! \brief  Print the timing of each configuration and the paired differences of all
+ *  configurations against the first one to stdout.
+ */
+void rocsparse_ab_report(const char*                             function,
+                         const char*                             precision,
+                         const std::vector<rocsparse_ab_config>& configs,
+                         const std::vector<std::vector<double>>& samples);
+
+#endif // ROCSPARSE_AB_HPP
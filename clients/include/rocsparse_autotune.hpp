@@ -0,0 +1,132 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_autotune.hpp provides the bookkeeping to compare different
+ *  storage formats and algorithms of the same operation, including the one time
+ *  costs of conversion and analysis.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_AUTOTUNE_HPP
+#define ROCSPARSE_AUTOTUNE_HPP
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* ==================================================================================== */
+/*! \brief  Options of the autotuning benchmarks. */
+struct rocsparse_autotune_options
+{
+    // Number of times the operation is expected to be reused with the same matrix
+    int reuses = 100;
+
+    // File the JSON report is written to, empty for stdout
+    std::string json;
+
+    // Options that are used by all autotuning benchmarks
+    static rocsparse_autotune_options& active();
+};
+
+/* ==================================================================================== */
+/*! \brief  Timing results of a single format / algorithm combination. */
+struct rocsparse_autotune_candidate
+{
+    // Storage format, e.g. "csr"
+    std::string format;
+    // Algorithm, e.g. "adaptive"
+    std::string alg;
+    // Additional parameters, e.g. "block_dim=4"
+    std::string params;
+
+    // One time costs in milliseconds
+    double convert_msec  = 0.0;
+    double analysis_msec = 0.0;
+
+    // Per call costs in milliseconds
+    double median_msec = 0.0;
+    double min_msec    = 0.0;
+
+    // Rates at median time
+    double gflops = 0.0;
+    double gbyte  = 0.0;
+
+    // Amortized total time of conversion, analysis and the given number of calls
+    double total_msec(int reuses) const;
+};
+
+/*! \brief  Median of a set of timing samples. */
+double rocsparse_autotune_median(std::vector<double> samples);
+
+/*! \brief  Time each of \p iters calls of \p f individually, such that outliers do not
+ *  affect the result, and store median and minimum time in \p candidate.
+ */
+template <typename F>
+inline void rocsparse_autotune_time(rocsparse_autotune_candidate& candidate,
+                                    hipStream_t                   stream,
+                                    int                           iters,
+                                    F&&                           f)
+{
+    // Warm up
+    for(int iter = 0; iter < 2; ++iter)
+    {
+        f();
+    }
+
+    std::vector<double> samples(std::max(iters, 1));
+    for(double& sample : samples)
+    {
+        double time_used = get_time_us_sync(stream);
+        f();
+        sample = get_time_us_sync(stream) - time_used;
+    }
+
+    candidate.median_msec = rocsparse_autotune_median(samples) / 1e3;
+    candidate.min_msec    = *std::min_element(samples.begin(), samples.end()) / 1e3;
+}
+
+/*! \brief  Time a single call of \p f in milliseconds, e.g. a conversion. */
+template <typename F>
+inline double rocsparse_autotune_time_once(hipStream_t stream, F&& f)
+{
+    double time_used = get_time_us_sync(stream);
+    f();
+    return (get_time_us_sync(stream) - time_used) / 1e3;
+}
+
+/*! \brief  Print the table of all candidates together with the recommended one to
+ *  stdout and write the JSON report. Returns the index of the recommended candidate.
+ */
+size_t rocsparse_autotune_report(const char*                                      function,
+                                 const char*                                      precision,
+                                 int64_t                                          M,
+                                 int64_t                                          N,
+                                 int64_t                                          nnz,
+                                 const std::vector<rocsparse_autotune_candidate>& candidates);
+
+#endif // ROCSPARSE_AUTOTUNE_HPP
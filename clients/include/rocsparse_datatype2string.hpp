@@ -239,6 +239,12 @@ constexpr auto rocsparse_format2string(rocsparse_format format)
         return "csc";
     case rocsparse_format_ell:
         return "ell";
+    case rocsparse_format_sell:
+        return "sell";
+    case rocsparse_format_bsr:
+        return "bsr";
+    case rocsparse_format_csr16:
+        return "csr16";
     }
     return "invalid";
 }
@@ -267,6 +273,8 @@ constexpr auto rocsparse_spmvalg2string(rocsparse_spmv_alg alg)
         return "csrstream";
     case rocsparse_spmv_alg_ell:
         return "ell";
+    case rocsparse_spmv_alg_csr_merge:
+        return "csrmerge";
     }
     return "invalid";
 }
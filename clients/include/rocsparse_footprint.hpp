@@ -0,0 +1,129 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_footprint.hpp provides host side accounting of the device memory
+ *  footprint of the different sparse storage formats.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_FOOTPRINT_HPP
+#define ROCSPARSE_FOOTPRINT_HPP
+
+#include <rocsparse.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/* ==================================================================================== */
+/*! \brief  Device memory footprint of a sparse matrix in a given storage format. */
+struct rocsparse_footprint
+{
+    // Bytes of device memory occupied by the matrix
+    size_t bytes = 0;
+    // Number of stored entries, including explicit zeros from padding or block fill
+    int64_t stored = 0;
+    // Number of non-zero entries of the original matrix
+    int64_t nnz = 0;
+    // Size of the temporary buffer in bytes, as returned by the buffer size query
+    size_t buffer = 0;
+
+    // Footprint in MB
+    double megabytes() const;
+
+    // Ratio of stored entries to non-zero entries
+    double padding() const;
+};
+
+/*! \brief  If set, conversion benchmarks compute the footprint on the host only and do
+ *  not run any kernels.
+ */
+bool& rocsparse_footprint_only();
+
+/*! \brief  Footprint of CSR and CSC matrices, \p dim is the number of rows (CSR) or
+ *  columns (CSC).
+ */
+rocsparse_footprint
+    rocsparse_footprint_csx(int64_t dim, int64_t nnz, size_t index_size, size_t value_size);
+
+/*! \brief  Footprint of COO and COO AoS matrices. */
+rocsparse_footprint rocsparse_footprint_coo(int64_t nnz, size_t index_size, size_t value_size);
+
+/*! \brief  Footprint of ELL matrices. */
+rocsparse_footprint rocsparse_footprint_ell(
+    int64_t m, int64_t ell_width, int64_t nnz, size_t index_size, size_t value_size);
+
+/*! \brief  Footprint of SELL-C-sigma matrices, \p sell_nnz includes the padding. */
+rocsparse_footprint rocsparse_footprint_sell(int64_t m,
+                                             int64_t nslices,
+                                             int64_t sell_nnz,
+                                             int64_t nnz,
+                                             size_t  index_size,
+                                             size_t  value_size);
+
+/*! \brief  Footprint of CSR16 matrices, \p nnz includes the \p esc_nnz escaped entries. */
+rocsparse_footprint rocsparse_footprint_csr16(
+    int64_t m, int64_t nnz, int64_t esc_nnz, size_t index_size, size_t value_size);
+
+/*! \brief  Footprint of HYB matrices. */
+rocsparse_footprint rocsparse_footprint_hyb(int64_t m,
+                                            int64_t ell_width,
+                                            int64_t coo_nnz,
+                                            int64_t nnz,
+                                            size_t  index_size,
+                                            size_t  value_size);
+
+/*! \brief  Footprint of BSR and GEBSR matrices. */
+rocsparse_footprint rocsparse_footprint_gebsr(int64_t mb,
+                                              int64_t nnzb,
+                                              int64_t row_block_dim,
+                                              int64_t col_block_dim,
+                                              int64_t nnz,
+                                              size_t  index_size,
+                                              size_t  value_size);
+
+/*! \brief  Maximum number of non-zero entries per row, i.e. the ELL width. */
+rocsparse_int rocsparse_footprint_ell_width(rocsparse_int m, const rocsparse_int* csr_row_ptr);
+
+/*! \brief  ELL width of the ELL part of a HYB matrix, following \ref rocsparse_csr2hyb. */
+rocsparse_int rocsparse_footprint_hyb_width(rocsparse_int           m,
+                                            rocsparse_int           nnz,
+                                            const rocsparse_int*    csr_row_ptr,
+                                            rocsparse_hyb_partition partition,
+                                            rocsparse_int           user_ell_width);
+
+/*! \brief  Number of entries in the COO part of a HYB matrix. */
+rocsparse_int rocsparse_footprint_hyb_coo_nnz(rocsparse_int        m,
+                                              const rocsparse_int* csr_row_ptr,
+                                              rocsparse_int        ell_width);
+
+/*! \brief  Number of non-zero blocks of the GEBSR representation of a CSR matrix. */
+rocsparse_int rocsparse_footprint_gebsr_nnzb(rocsparse_int        m,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_index_base base,
+                                             rocsparse_int        row_block_dim,
+                                             rocsparse_int        col_block_dim);
+
+#endif // ROCSPARSE_FOOTPRINT_HPP
@@ -36,6 +36,31 @@
 #include <omp.h>
 #endif
 
+// Convert a value into another precision, complex values convert componentwise
+template <typename T>
+inline T host_convert_value(float x)
+{
+    return static_cast<T>(x);
+}
+
+template <typename T>
+inline T host_convert_value(double x)
+{
+    return static_cast<T>(x);
+}
+
+template <typename T>
+inline T host_convert_value(const rocsparse_float_complex& x)
+{
+    return T(std::real(x), std::imag(x));
+}
+
+template <typename T>
+inline T host_convert_value(const rocsparse_double_complex& x)
+{
+    return T(std::real(x), std::imag(x));
+}
+
 template <typename T, typename I, typename J>
 struct rocsparse_host
 {
@@ -180,17 +205,17 @@ void host_sctr(I nnz, const T* x_val, const I* x_ind, T* y, rocsparse_index_base
  *    level 2 SPARSE
  * ===========================================================================
  */
-template <typename T>
+template <typename I, typename J, typename T>
 void host_bsrmv(rocsparse_direction  dir,
                 rocsparse_operation  trans,
-                rocsparse_int        mb,
-                rocsparse_int        nb,
-                rocsparse_int        nnzb,
+                J                    mb,
+                J                    nb,
+                I                    nnzb,
                 T                    alpha,
-                const rocsparse_int* bsr_row_ptr,
-                const rocsparse_int* bsr_col_ind,
+                const I*             bsr_row_ptr,
+                const J*             bsr_col_ind,
                 const T*             bsr_val,
-                rocsparse_int        bsr_dim,
+                J                    bsr_dim,
                 const T*             x,
                 T                    beta,
                 T*                   y,
@@ -250,6 +275,110 @@ void host_csrmv(J                    M,
                 rocsparse_index_base base,
                 int                  algo);
 
+template <typename I, typename J, typename T>
+void host_csrmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
+                I                    nnz,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                const T*             x,
+                T                    beta,
+                T*                   y,
+                rocsparse_index_base base,
+                int                  algo);
+
+template <typename I, typename J, typename A, typename T>
+void host_csrmv_mixed(rocsparse_operation  trans,
+                      J                    M,
+                      J                    N,
+                      I                    nnz,
+                      T                    alpha,
+                      const I*             csr_row_ptr,
+                      const J*             csr_col_ind,
+                      const A*             csr_val,
+                      const T*             x,
+                      T                    beta,
+                      T*                   y,
+                      rocsparse_index_base base);
+
+template <typename I, typename J, typename T>
+void host_csrmv_strided_batched(J                    M,
+                                I                    nnz,
+                                int                  batch_count,
+                                T                    alpha,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const T*             csr_val,
+                                int64_t              val_batch_stride,
+                                const T*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                T*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base);
+
+template <typename I, typename J, typename T>
+void host_csrmv_fused(J                    M,
+                      I                    nnz,
+                      T                    alpha,
+                      const I*             csr_row_ptr,
+                      const J*             csr_col_ind,
+                      const T*             csr_val,
+                      const T*             x,
+                      T                    beta,
+                      const T*             y_in,
+                      T*                   y_out,
+                      T*                   dot,
+                      T*                   nrm2,
+                      rocsparse_index_base base);
+
+template <typename I, typename J, typename T>
+void host_cscmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
+                I                    nnz,
+                T                    alpha,
+                const I*             csc_col_ptr,
+                const J*             csc_row_ind,
+                const T*             csc_val,
+                const T*             x,
+                T                    beta,
+                T*                   y,
+                rocsparse_index_base base);
+
+template <typename I, typename J, typename T>
+void host_csrmv_symmetric(rocsparse_operation   trans,
+                          J                     M,
+                          I                     nnz,
+                          T                     alpha,
+                          const I*              csr_row_ptr,
+                          const J*              csr_col_ind,
+                          const T*              csr_val,
+                          const T*              x,
+                          T                     beta,
+                          T*                    y,
+                          rocsparse_matrix_type matrix_type,
+                          rocsparse_fill_mode   fill_mode,
+                          rocsparse_index_base  base);
+
+template <typename I, typename T>
+void host_coomv_symmetric(rocsparse_operation   trans,
+                          I                     M,
+                          I                     nnz,
+                          T                     alpha,
+                          const I*              coo_row_ind,
+                          const I*              coo_col_ind,
+                          const T*              coo_val,
+                          const T*              x,
+                          T                     beta,
+                          T*                    y,
+                          rocsparse_matrix_type matrix_type,
+                          rocsparse_fill_mode   fill_mode,
+                          rocsparse_index_base  base);
+
 template <typename T>
 void host_csrsv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -278,6 +407,37 @@ void host_ellmv(I                    M,
                 T*                   y,
                 rocsparse_index_base base);
 
+template <typename I, typename T>
+void host_sellmv(I                    M,
+                 I                    N,
+                 T                    alpha,
+                 const I*             sell_slice_ptr,
+                 const I*             sell_row_perm,
+                 const I*             sell_col_ind,
+                 const T*             sell_val,
+                 I                    sell_slice_size,
+                 const T*             x,
+                 T                    beta,
+                 T*                   y,
+                 rocsparse_index_base base);
+
+template <typename I, typename T>
+void host_csr16mv(I                    M,
+                  I                    N,
+                  T                    alpha,
+                  const I*             csr16_row_ptr,
+                  const I*             csr16_row_base,
+                  const uint16_t*      csr16_col_off,
+                  const T*             csr16_val,
+                  I                    csr16_esc_nnz,
+                  const I*             csr16_esc_row_ind,
+                  const I*             csr16_esc_col_ind,
+                  const T*             csr16_esc_val,
+                  const T*             x,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base);
+
 template <typename T>
 void host_hybmv(rocsparse_int        M,
                 rocsparse_int        N,
@@ -295,18 +455,18 @@ void host_hybmv(rocsparse_int        M,
                 T*                   y,
                 rocsparse_index_base base);
 
-template <typename T>
+template <typename I, typename J, typename T>
 void host_gebsrmv(rocsparse_direction  dir,
                   rocsparse_operation  trans,
-                  rocsparse_int        mb,
-                  rocsparse_int        nb,
-                  rocsparse_int        nnzb,
+                  J                    mb,
+                  J                    nb,
+                  I                    nnzb,
                   T                    alpha,
-                  const rocsparse_int* bsr_row_ptr,
-                  const rocsparse_int* bsr_col_ind,
+                  const I*             bsr_row_ptr,
+                  const J*             bsr_col_ind,
                   const T*             bsr_val,
-                  rocsparse_int        row_block_dim,
-                  rocsparse_int        col_block_dim,
+                  J                    row_block_dim,
+                  J                    col_block_dim,
                   const T*             x,
                   T                    beta,
                   T*                   y,
@@ -350,27 +510,27 @@ void host_bsrmm(rocsparse_handle          handle,
                 T*                        C,
                 rocsparse_int             ldc);
 
-template <typename T>
+template <typename I, typename J, typename T>
 void host_gebsrmm(rocsparse_handle          handle,
                   rocsparse_direction       dir,
                   rocsparse_operation       trans_A,
                   rocsparse_operation       trans_B,
-                  rocsparse_int             mb,
-                  rocsparse_int             n,
-                  rocsparse_int             kb,
-                  rocsparse_int             nnzb,
+                  J                         mb,
+                  J                         n,
+                  J                         kb,
+                  I                         nnzb,
                   const T*                  alpha,
                   const rocsparse_mat_descr descr,
                   const T*                  bsr_val,
-                  const rocsparse_int*      bsr_row_ptr,
-                  const rocsparse_int*      bsr_col_ind,
-                  rocsparse_int             row_block_dim,
-                  rocsparse_int             col_block_dim,
+                  const I*                  bsr_row_ptr,
+                  const J*                  bsr_col_ind,
+                  J                         row_block_dim,
+                  J                         col_block_dim,
                   const T*                  B,
-                  rocsparse_int             ldb,
+                  J                         ldb,
                   const T*                  beta,
                   T*                        C,
-                  rocsparse_int             ldc);
+                  J                         ldc);
 
 template <typename I, typename J, typename T>
 void host_csrmm(J                     M,
@@ -390,6 +550,43 @@ void host_csrmm(J                     M,
                 rocsparse_order       order,
                 rocsparse_index_base  base);
 
+template <typename I, typename J, typename T>
+void host_cscmm(J                     M,
+                J                     N,
+                J                     K,
+                rocsparse_operation   transA,
+                rocsparse_operation   transB,
+                T                     alpha,
+                const std::vector<I>& csc_col_ptr_A,
+                const std::vector<J>& csc_row_ind_A,
+                const std::vector<T>& csc_val_A,
+                const std::vector<T>& B,
+                J                     ldb,
+                T                     beta,
+                std::vector<T>&       C,
+                J                     ldc,
+                rocsparse_order       order,
+                rocsparse_index_base  base);
+
+template <typename I, typename T>
+void host_sellmm(I                     M,
+                 I                     N,
+                 I                     K,
+                 rocsparse_operation   transB,
+                 T                     alpha,
+                 const std::vector<I>& sell_slice_ptr_A,
+                 const std::vector<I>& sell_row_perm_A,
+                 const std::vector<I>& sell_col_ind_A,
+                 const std::vector<T>& sell_val_A,
+                 I                     sell_slice_size_A,
+                 const std::vector<T>& B,
+                 I                     ldb,
+                 T                     beta,
+                 std::vector<T>&       C,
+                 I                     ldc,
+                 rocsparse_order       order,
+                 rocsparse_index_base  base);
+
 template <typename I, typename T>
 void host_coomm(rocsparse_spmm_alg    alg,
                 I                     M,
@@ -650,6 +847,20 @@ void host_csx2dense(J                    m,
                     T*                   A,
                     I                    ld);
 
+template <typename I, typename J, typename T>
+void host_gebsr2dense(rocsparse_direction  dir,
+                      J                    mb,
+                      J                    nb,
+                      J                    row_block_dim,
+                      J                    col_block_dim,
+                      rocsparse_index_base base,
+                      rocsparse_order      order,
+                      const T*             bsr_val,
+                      const I*             bsr_row_ptr,
+                      const J*             bsr_col_ind,
+                      T*                   A,
+                      I                    ld);
+
 template <typename I, typename T>
 void host_dense_to_coo(I                     m,
                        I                     n,
@@ -792,6 +1003,54 @@ void host_csr_to_ell(J                     M,
                      rocsparse_index_base  csr_base,
                      rocsparse_index_base  ell_base);
 
+template <typename I, typename J, typename T>
+void host_csr_to_sell(J                     M,
+                      const std::vector<I>& csr_row_ptr,
+                      const std::vector<J>& csr_col_ind,
+                      const std::vector<T>& csr_val,
+                      J                     slice_size,
+                      J                     sigma,
+                      std::vector<J>&       sell_slice_ptr,
+                      std::vector<J>&       sell_row_perm,
+                      std::vector<J>&       sell_col_ind,
+                      std::vector<T>&       sell_val,
+                      J&                    sell_nnz,
+                      rocsparse_index_base  csr_base,
+                      rocsparse_index_base  sell_base);
+
+template <typename I, typename T>
+void host_csr_to_csr16(I                      M,
+                       const std::vector<I>&  csr_row_ptr,
+                       const std::vector<I>&  csr_col_ind,
+                       const std::vector<T>&  csr_val,
+                       std::vector<I>&        csr16_row_ptr,
+                       std::vector<I>&        csr16_row_base,
+                       std::vector<uint16_t>& csr16_col_off,
+                       std::vector<T>&        csr16_val,
+                       std::vector<I>&        csr16_esc_row_ind,
+                       std::vector<I>&        csr16_esc_col_ind,
+                       std::vector<T>&        csr16_esc_val,
+                       I&                     csr16_nnz,
+                       I&                     csr16_esc_nnz,
+                       rocsparse_index_base   csr_base,
+                       rocsparse_index_base   csr16_base);
+
+template <typename I, typename T>
+void host_csr16_to_csr(I                            M,
+                       const std::vector<I>&        csr16_row_ptr,
+                       const std::vector<I>&        csr16_row_base,
+                       const std::vector<uint16_t>& csr16_col_off,
+                       const std::vector<T>&        csr16_val,
+                       I                            csr16_esc_nnz,
+                       const std::vector<I>&        csr16_esc_row_ind,
+                       const std::vector<I>&        csr16_esc_col_ind,
+                       const std::vector<T>&        csr16_esc_val,
+                       std::vector<I>&              csr_row_ptr,
+                       std::vector<I>&              csr_col_ind,
+                       std::vector<T>&              csr_val,
+                       rocsparse_index_base         csr16_base,
+                       rocsparse_index_base         csr_base);
+
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
@@ -103,8 +103,10 @@ struct managed_scalar : public managed_dense_matrix<T>
 
 #include "rocsparse_matrix_coo.hpp"
 #include "rocsparse_matrix_coo_aos.hpp"
+#include "rocsparse_matrix_csr16.hpp"
 #include "rocsparse_matrix_csx.hpp"
 #include "rocsparse_matrix_ell.hpp"
 #include "rocsparse_matrix_gebsx.hpp"
+#include "rocsparse_matrix_sell.hpp"
 
 #endif // ROCSPARSE_MATRIX_HPP.
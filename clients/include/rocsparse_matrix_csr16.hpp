@@ -0,0 +1,197 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_CSR16_HPP
+#define ROCSPARSE_MATRIX_CSR16_HPP
+
+#include "rocsparse_vector.hpp"
+
+template <memory_mode::value_t MODE, typename T, typename I = rocsparse_int>
+struct csr16_matrix
+{
+    template <typename S>
+    using array_t = typename memory_traits<MODE>::template array_t<S>;
+
+    I                    m{};
+    I                    n{};
+    I                    nnz{};
+    I                    esc_nnz{};
+    rocsparse_index_base base{};
+    array_t<I>           ptr{};
+    array_t<I>           row_base{};
+    array_t<uint16_t>    off{};
+    array_t<T>           val{};
+    array_t<I>           esc_row{};
+    array_t<I>           esc_col{};
+    array_t<T>           esc_val{};
+
+    csr16_matrix(){};
+    ~csr16_matrix(){};
+
+    csr16_matrix(I m_, I n_, I nnz_, I esc_nnz_, rocsparse_index_base base_)
+        : m(m_)
+        , n(n_)
+        , nnz(nnz_)
+        , esc_nnz(esc_nnz_)
+        , base(base_)
+        , ptr(m_ + 1)
+        , row_base(m_)
+        , off(nnz_)
+        , val(nnz_)
+        , esc_row(esc_nnz_)
+        , esc_col(esc_nnz_)
+        , esc_val(esc_nnz_){};
+
+    csr16_matrix(const csr16_matrix<MODE, T, I>& that_, bool transfer = true)
+        : csr16_matrix<MODE, T, I>(that_.m, that_.n, that_.nnz, that_.esc_nnz, that_.base)
+    {
+        if(transfer)
+        {
+            this->transfer_from(that_);
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    csr16_matrix(const csr16_matrix<THAT_MODE, T, I>& that_, bool transfer = true)
+        : csr16_matrix<MODE, T, I>(that_.m, that_.n, that_.nnz, that_.esc_nnz, that_.base)
+    {
+        if(transfer)
+        {
+            this->transfer_from(that_);
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    void transfer_from(const csr16_matrix<THAT_MODE, T, I>& that)
+    {
+        CHECK_HIP_ERROR((this->m == that.m && this->n == that.n && this->nnz == that.nnz
+                         && this->esc_nnz == that.esc_nnz && this->base == that.base)
+                            ? hipSuccess
+                            : hipErrorInvalidValue);
+
+        this->ptr.transfer_from(that.ptr);
+        this->row_base.transfer_from(that.row_base);
+        this->off.transfer_from(that.off);
+        this->val.transfer_from(that.val);
+        this->esc_row.transfer_from(that.esc_row);
+        this->esc_col.transfer_from(that.esc_col);
+        this->esc_val.transfer_from(that.esc_val);
+    };
+
+    void define(I m_, I n_, I nnz_, I esc_nnz_, rocsparse_index_base base_)
+    {
+        if(m_ != this->m)
+        {
+            this->m = m_;
+            this->ptr.resize(this->m + 1);
+            this->row_base.resize(this->m);
+        }
+
+        if(n_ != this->n)
+        {
+            this->n = n_;
+        }
+
+        if(nnz_ != this->nnz)
+        {
+            this->nnz = nnz_;
+            this->off.resize(this->nnz);
+            this->val.resize(this->nnz);
+        }
+
+        if(esc_nnz_ != this->esc_nnz)
+        {
+            this->esc_nnz = esc_nnz_;
+            this->esc_row.resize(this->esc_nnz);
+            this->esc_col.resize(this->esc_nnz);
+            this->esc_val.resize(this->esc_nnz);
+        }
+
+        if(base_ != this->base)
+        {
+            this->base = base_;
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    void near_check(const csr16_matrix<THAT_MODE, T, I>& that_,
+                    floating_data_t<T>                   tol = default_tolerance<T>::value) const
+    {
+        switch(MODE)
+        {
+        case memory_mode::device:
+        {
+            csr16_matrix<memory_mode::host, T, I> on_host(*this);
+            on_host.near_check(that_, tol);
+            break;
+        }
+
+        case memory_mode::managed:
+        case memory_mode::host:
+        {
+            switch(THAT_MODE)
+            {
+            case memory_mode::managed:
+            case memory_mode::host:
+            {
+                unit_check_general<I>(1, 1, 1, &this->m, &that_.m);
+                unit_check_general<I>(1, 1, 1, &this->n, &that_.n);
+                unit_check_general<I>(1, 1, 1, &this->nnz, &that_.nnz);
+                unit_check_general<I>(1, 1, 1, &this->esc_nnz, &that_.esc_nnz);
+                {
+                    I a = (I)this->base;
+                    I b = (I)that_.base;
+                    unit_check_general<I>(1, 1, 1, &a, &b);
+                }
+                unit_check_general<I>(1, that_.m + 1, 1, this->ptr, that_.ptr);
+                unit_check_general<I>(1, that_.m, 1, this->row_base, that_.row_base);
+                unit_check_general<uint16_t>(1, that_.nnz, 1, this->off, that_.off);
+                near_check_general<T>(1, that_.nnz, 1, this->val, that_.val, tol);
+                unit_check_general<I>(1, that_.esc_nnz, 1, this->esc_row, that_.esc_row);
+                unit_check_general<I>(1, that_.esc_nnz, 1, this->esc_col, that_.esc_col);
+                near_check_general<T>(1, that_.esc_nnz, 1, this->esc_val, that_.esc_val, tol);
+                break;
+            }
+            case memory_mode::device:
+            {
+                csr16_matrix<memory_mode::host, T, I> that(that_);
+                this->near_check(that, tol);
+                break;
+            }
+            }
+            break;
+        }
+        }
+    }
+};
+
+template <typename T, typename I = rocsparse_int>
+using host_csr16_matrix = csr16_matrix<memory_mode::host, T, I>;
+template <typename T, typename I = rocsparse_int>
+using device_csr16_matrix = csr16_matrix<memory_mode::device, T, I>;
+template <typename T, typename I = rocsparse_int>
+using managed_csr16_matrix = csr16_matrix<memory_mode::managed, T, I>;
+
+#endif // ROCSPARSE_MATRIX_CSR16_HPP
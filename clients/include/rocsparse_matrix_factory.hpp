@@ -1727,6 +1727,15 @@ public:
         col_block_dim_ = that.col_block_dim;
     }
 
+    void init_gebsr(host_gebsr_matrix<T, I, J>& that, J& mb_, J& nb_, rocsparse_index_base base_)
+    {
+        rocsparse_direction block_dir     = this->m_arg.direction;
+        I                   nnzb          = this->m_arg.nnz;
+        J                   row_block_dim = this->m_arg.row_block_dimA;
+        J                   col_block_dim = this->m_arg.col_block_dimA;
+        this->init_gebsr(that, block_dir, mb_, nb_, nnzb, row_block_dim, col_block_dim, base_);
+    }
+
     void init_gebsr(host_gebsr_matrix<T, I, J>& that)
     {
         that.block_direction = this->m_arg.direction;
@@ -1878,6 +1887,54 @@ public:
         that.nnz = that.width * that.m;
     }
 
+    void init_sell(host_sell_matrix<T, I>& that, I& M, I& N, rocsparse_index_base base)
+    {
+        host_csr_matrix<T, I, I> hA;
+        this->init_csr(hA, M, N, base);
+
+        // Slice size and sorting window are taken from the block dimensions
+        I slice_size = this->m_arg.block_dim;
+        I sigma      = this->m_arg.row_block_dimA;
+
+        that.define(hA.m, hA.n, slice_size, sigma, 0, hA.base);
+        host_csr_to_sell(hA.m,
+                         hA.ptr,
+                         hA.ind,
+                         hA.val,
+                         that.slice_size,
+                         that.sigma,
+                         that.ptr,
+                         that.perm,
+                         that.ind,
+                         that.val,
+                         that.nnz,
+                         hA.base,
+                         that.base);
+    }
+
+    void init_csr16(host_csr16_matrix<T, I>& that, I& M, I& N, rocsparse_index_base base)
+    {
+        host_csr_matrix<T, I, I> hA;
+        this->init_csr(hA, M, N, base);
+
+        that.define(hA.m, hA.n, 0, 0, hA.base);
+        host_csr_to_csr16(hA.m,
+                          hA.ptr,
+                          hA.ind,
+                          hA.val,
+                          that.ptr,
+                          that.row_base,
+                          that.off,
+                          that.val,
+                          that.esc_row,
+                          that.esc_col,
+                          that.esc_val,
+                          that.nnz,
+                          that.esc_nnz,
+                          hA.base,
+                          that.base);
+    }
+
     void init_hyb(
         rocsparse_hyb_mat hyb, I& M, I& N, I& nnz, rocsparse_index_base base, bool& conform)
     {
@@ -0,0 +1,195 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_SELL_HPP
+#define ROCSPARSE_MATRIX_SELL_HPP
+
+#include "rocsparse_vector.hpp"
+
+template <memory_mode::value_t MODE, typename T, typename I = rocsparse_int>
+struct sell_matrix
+{
+    template <typename S>
+    using array_t = typename memory_traits<MODE>::template array_t<S>;
+
+    I                    m{};
+    I                    n{};
+    I                    slice_size{1};
+    I                    sigma{1};
+    I                    nnz{};
+    rocsparse_index_base base{};
+    array_t<I>           ptr{};
+    array_t<I>           perm{};
+    array_t<I>           ind{};
+    array_t<T>           val{};
+
+    static I nslices(I m_, I slice_size_)
+    {
+        return (m_ > 0) ? (m_ - 1) / slice_size_ + 1 : 0;
+    }
+
+    sell_matrix(){};
+    ~sell_matrix(){};
+
+    sell_matrix(I m_, I n_, I slice_size_, I sigma_, I nnz_, rocsparse_index_base base_)
+        : m(m_)
+        , n(n_)
+        , slice_size(slice_size_)
+        , sigma(sigma_)
+        , nnz(nnz_)
+        , base(base_)
+        , ptr(nslices(m_, slice_size_) + 1)
+        , perm(m_)
+        , ind(nnz_)
+        , val(nnz_){};
+
+    sell_matrix(const sell_matrix<MODE, T, I>& that_, bool transfer = true)
+        : sell_matrix<MODE, T, I>(
+            that_.m, that_.n, that_.slice_size, that_.sigma, that_.nnz, that_.base)
+    {
+        if(transfer)
+        {
+            this->transfer_from(that_);
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    sell_matrix(const sell_matrix<THAT_MODE, T, I>& that_, bool transfer = true)
+        : sell_matrix<MODE, T, I>(
+            that_.m, that_.n, that_.slice_size, that_.sigma, that_.nnz, that_.base)
+    {
+        if(transfer)
+        {
+            this->transfer_from(that_);
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    void transfer_from(const sell_matrix<THAT_MODE, T, I>& that)
+    {
+        CHECK_HIP_ERROR((this->m == that.m && this->n == that.n
+                         && this->slice_size == that.slice_size && this->sigma == that.sigma
+                         && this->nnz == that.nnz && this->base == that.base)
+                            ? hipSuccess
+                            : hipErrorInvalidValue);
+
+        this->ptr.transfer_from(that.ptr);
+        this->perm.transfer_from(that.perm);
+        this->ind.transfer_from(that.ind);
+        this->val.transfer_from(that.val);
+    };
+
+    void define(I m_, I n_, I slice_size_, I sigma_, I nnz_, rocsparse_index_base base_)
+    {
+        if(m_ != this->m || slice_size_ != this->slice_size)
+        {
+            this->m          = m_;
+            this->slice_size = slice_size_;
+            this->ptr.resize(nslices(this->m, this->slice_size) + 1);
+            this->perm.resize(this->m);
+        }
+
+        if(n_ != this->n)
+        {
+            this->n = n_;
+        }
+
+        if(sigma_ != this->sigma)
+        {
+            this->sigma = sigma_;
+        }
+
+        if(nnz_ != this->nnz)
+        {
+            this->nnz = nnz_;
+            this->ind.resize(this->nnz);
+            this->val.resize(this->nnz);
+        }
+
+        if(base_ != this->base)
+        {
+            this->base = base_;
+        }
+    }
+
+    template <memory_mode::value_t THAT_MODE>
+    void near_check(const sell_matrix<THAT_MODE, T, I>& that_,
+                    floating_data_t<T>                  tol = default_tolerance<T>::value) const
+    {
+        switch(MODE)
+        {
+        case memory_mode::device:
+        {
+            sell_matrix<memory_mode::host, T, I> on_host(*this);
+            on_host.near_check(that_, tol);
+            break;
+        }
+
+        case memory_mode::managed:
+        case memory_mode::host:
+        {
+            switch(THAT_MODE)
+            {
+            case memory_mode::managed:
+            case memory_mode::host:
+            {
+                unit_check_general<I>(1, 1, 1, &this->m, &that_.m);
+                unit_check_general<I>(1, 1, 1, &this->n, &that_.n);
+                unit_check_general<I>(1, 1, 1, &this->slice_size, &that_.slice_size);
+                unit_check_general<I>(1, 1, 1, &this->sigma, &that_.sigma);
+                unit_check_general<I>(1, 1, 1, &this->nnz, &that_.nnz);
+                {
+                    I a = (I)this->base;
+                    I b = (I)that_.base;
+                    unit_check_general<I>(1, 1, 1, &a, &b);
+                }
+                unit_check_general<I>(
+                    1, nslices(that_.m, that_.slice_size) + 1, 1, this->ptr, that_.ptr);
+                unit_check_general<I>(1, that_.m, 1, this->perm, that_.perm);
+                unit_check_general<I>(1, that_.nnz, 1, this->ind, that_.ind);
+                near_check_general<T>(1, that_.nnz, 1, this->val, that_.val, tol);
+                break;
+            }
+            case memory_mode::device:
+            {
+                sell_matrix<memory_mode::host, T, I> that(that_);
+                this->near_check(that, tol);
+                break;
+            }
+            }
+            break;
+        }
+        }
+    }
+};
+
+template <typename T, typename I = rocsparse_int>
+using host_sell_matrix = sell_matrix<memory_mode::host, T, I>;
+template <typename T, typename I = rocsparse_int>
+using device_sell_matrix = sell_matrix<memory_mode::device, T, I>;
+template <typename T, typename I = rocsparse_int>
+using managed_sell_matrix = sell_matrix<memory_mode::managed, T, I>;
+
+#endif // ROCSPARSE_MATRIX_SELL_HPP
@@ -0,0 +1,100 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_roofline.hpp provides a simple roofline model to relate the
+ *  measured GFlop/s and GB/s of a benchmark to the peak capabilities of a machine.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_ROOFLINE_HPP
+#define ROCSPARSE_ROOFLINE_HPP
+
+#include <string>
+
+/* ==================================================================================== */
+/*! \brief  Peak capabilities of a machine, read from a profile file.
+ *
+ *  The profile file contains one "key = value" pair per line, '#' starts a comment.
+ *  Supported keys are
+ *
+ *    name            descriptive name of the machine
+ *    bandwidth       peak memory bandwidth in GB/s
+ *    gflops_f32      peak single precision throughput in GFlop/s
+ *    gflops_f64      peak double precision throughput in GFlop/s
+ *
+ *  The same file format is used to describe a device or the host, such that timings
+ *  obtained on either side can be put into relation with the corresponding roofs.
+ */
+struct rocsparse_machine_profile
+{
+    std::string name;
+    double      bandwidth  = 0.0;
+    double      gflops_f32 = 0.0;
+    double      gflops_f64 = 0.0;
+
+    // Precision the current benchmark is run in, 's', 'd', 'c' or 'z'
+    char precision = 's';
+
+    // Load the profile from file, returns false on failure
+    bool load(const std::string& filename);
+
+    // Returns true if the profile holds usable peak values
+    bool valid() const;
+
+    // Peak compute throughput for the selected precision in GFlop/s
+    double peak_gflops() const;
+
+    // Profile that is used to annotate all timing results
+    static rocsparse_machine_profile& active();
+};
+
+/* ==================================================================================== */
+/*! \brief  Roofline characteristics of a single benchmark result. */
+struct rocsparse_roofline
+{
+    // Arithmetic intensity in Flop/Byte
+    double intensity = 0.0;
+    // Attainable GFlop/s for this arithmetic intensity
+    double attainable = 0.0;
+    // Achieved percentage of peak bandwidth
+    double percent_bandwidth = 0.0;
+    // Achieved percentage of peak compute
+    double percent_compute = 0.0;
+    // Achieved percentage of the attainable performance
+    double percent_roof = 0.0;
+    // Either "memory" or "compute"
+    const char* bound = "";
+};
+
+/*! \brief  Compute roofline characteristics from measured rates.
+ *
+ *  Both rates refer to the same elapsed time, thus their ratio equals the arithmetic
+ *  intensity as modelled by flops.hpp and gbyte.hpp.
+ */
+rocsparse_roofline rocsparse_roofline_compute(const rocsparse_machine_profile& profile,
+                                              double                           gflops,
+                                              double                           gbyte);
+
+#endif // ROCSPARSE_ROOFLINE_HPP
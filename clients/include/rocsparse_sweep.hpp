@@ -0,0 +1,89 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_sweep.hpp provides parameter sweeps for the benchmark client,
+ *  running a benchmark for each point of a parameter space and collecting the results
+ *  in a table that is suitable for plotting heatmaps.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_SWEEP_HPP
+#define ROCSPARSE_SWEEP_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*! \brief  Columns of the most recent timing output, as pairs of legend and value. */
+std::vector<std::pair<std::string, std::string>>& rocsparse_timing_record();
+
+/*! \brief  Parse a sweep specification into a list of values.
+ *
+ *  A specification is a comma separated list of items, where each item is either
+ *
+ *    a              a single value
+ *    a:b            all values from a to b
+ *    a:b:s          all values from a to b with stride s
+ *    a:b*f          all values from a to b, multiplied by f in each step
+ *
+ *  e.g. "1,2:16*2,24" results in 1, 2, 4, 8, 16, 24. Returns false on malformed input.
+ */
+bool rocsparse_sweep_parse(const std::string& spec, std::vector<int64_t>& values);
+
+/* ==================================================================================== */
+/*! \brief  Parameter space of a sweep and the results collected at each point. */
+class rocsparse_sweep
+{
+public:
+    // Add a parameter with its values
+    void add(const std::string& name, const std::vector<int64_t>& values);
+
+    // Returns true if any parameter takes more than one value
+    bool active() const;
+
+    // Number of points in the parameter space
+    size_t size() const;
+
+    // Values of all parameters at the given point, in the order they have been added
+    std::vector<int64_t> point(size_t index) const;
+
+    // Store the most recent timing output as result of the given point
+    void record(size_t index);
+
+    // Write all results as comma separated table with one row per point. If exactly
+    // two parameters are swept, the given metric is additionally written as matrix.
+    void write(std::ostream& os, const std::string& metric) const;
+
+private:
+    std::vector<std::string>          names;
+    std::vector<std::vector<int64_t>> values;
+
+    std::vector<size_t>                                           points;
+    std::vector<std::vector<std::pair<std::string, std::string>>> results;
+};
+
+#endif // ROCSPARSE_SWEEP_HPP
@@ -42,6 +42,18 @@ struct testing_matrix_type_traits<rocsparse_format_csr, I, J, T>
     using device_sparse_matrix = device_csr_matrix<U, I, J>;
 };
 
+//
+// TRAITS FOR CSC FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_matrix_type_traits<rocsparse_format_csc, I, J, T>
+{
+    template <typename U>
+    using host_sparse_matrix = host_csc_matrix<U, I, J>;
+    template <typename U>
+    using device_sparse_matrix = device_csc_matrix<U, I, J>;
+};
+
 //
 // TRAITS FOR COO FORMAT.
 //
@@ -78,6 +90,42 @@ struct testing_matrix_type_traits<rocsparse_format_ell, I, I, T>
     using device_sparse_matrix = device_ell_matrix<U, I>;
 };
 
+//
+// TRAITS FOR SELL FORMAT.
+//
+template <typename I, typename T>
+struct testing_matrix_type_traits<rocsparse_format_sell, I, I, T>
+{
+    template <typename U>
+    using host_sparse_matrix = host_sell_matrix<U, I>;
+    template <typename U>
+    using device_sparse_matrix = device_sell_matrix<U, I>;
+};
+
+//
+// TRAITS FOR CSR16 FORMAT.
+//
+template <typename I, typename T>
+struct testing_matrix_type_traits<rocsparse_format_csr16, I, I, T>
+{
+    template <typename U>
+    using host_sparse_matrix = host_csr16_matrix<U, I>;
+    template <typename U>
+    using device_sparse_matrix = device_csr16_matrix<U, I>;
+};
+
+//
+// TRAITS FOR BSR FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_matrix_type_traits<rocsparse_format_bsr, I, J, T>
+{
+    template <typename U>
+    using host_sparse_matrix = host_gebsr_matrix<U, I, J>;
+    template <typename U>
+    using device_sparse_matrix = device_gebsr_matrix<U, I, J>;
+};
+
 template <rocsparse_format FORMAT, typename I, typename J, typename T>
 struct testing_spmv_dispatch_traits;
 
@@ -102,11 +150,71 @@ struct testing_spmv_dispatch_traits<rocsparse_format_csr, I, J, T>
         matrix_factory.init_csr(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
-        host_csrmv<I, J, T>(
-            hA.m, hA.nnz, *h_alpha, hA.ptr, hA.ind, hA.val, hx, *h_beta, hy, hA.base, adaptive);
+        host_csrmv<I, J, T>(trans,
+                            hA.m,
+                            hA.n,
+                            hA.nnz,
+                            *h_alpha,
+                            hA.ptr,
+                            hA.ind,
+                            hA.val,
+                            hx,
+                            *h_beta,
+                            hy,
+                            hA.base,
+                            adaptive);
+    }
+};
+
+//
+// TRAITS FOR CSC FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_spmv_dispatch_traits<rocsparse_format_csc, I, J, T>
+{
+    using traits = testing_matrix_type_traits<rocsparse_format_csc, I, J, T>;
+
+    template <typename U>
+    using host_sparse_matrix = typename traits::template host_sparse_matrix<U>;
+    template <typename U>
+    using device_sparse_matrix = typename traits::template device_sparse_matrix<U>;
+
+    template <typename... Ts>
+    static void sparse_initialization(rocsparse_matrix_factory<T, I, J>& matrix_factory,
+                                      host_sparse_matrix<T>&             hA,
+                                      Ts&&... ts)
+    {
+        matrix_factory.init_csc(hA, ts...);
+    }
+
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
+    {
+        host_cscmv<I, J, T>(trans,
+                            hA.m,
+                            hA.n,
+                            hA.nnz,
+                            *h_alpha,
+                            hA.ptr,
+                            hA.ind,
+                            hA.val,
+                            hx,
+                            *h_beta,
+                            hy,
+                            hA.base);
     }
 };
 
@@ -131,8 +239,13 @@ struct testing_spmv_dispatch_traits<rocsparse_format_coo, I, I, T>
         matrix_factory.init_coo(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
         host_coomv<I, T>(
             hA.m, hA.nnz, *h_alpha, hA.row_ind, hA.col_ind, hA.val, hx, *h_beta, hy, hA.base);
@@ -160,8 +273,13 @@ struct testing_spmv_dispatch_traits<rocsparse_format_coo_aos, I, I, T>
         matrix_factory.init_coo_aos(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
         host_coomv_aos<I, T>(hA.m, hA.nnz, *h_alpha, hA.ind, hA.val, hx, *h_beta, hy, hA.base);
     };
@@ -187,13 +305,197 @@ struct testing_spmv_dispatch_traits<rocsparse_format_ell, I, I, T>
         matrix_factory.init_ell(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
         host_ellmv<I, T>(hA.m, hA.n, *h_alpha, hA.ind, hA.val, hA.width, hx, *h_beta, hy, hA.base);
     };
 };
 
+//
+// TRAITS FOR SELL FORMAT.
+//
+template <typename I, typename T>
+struct testing_spmv_dispatch_traits<rocsparse_format_sell, I, I, T>
+{
+    using traits = testing_matrix_type_traits<rocsparse_format_sell, I, I, T>;
+    template <typename U>
+    using host_sparse_matrix = typename traits::template host_sparse_matrix<U>;
+    template <typename U>
+    using device_sparse_matrix = typename traits::template device_sparse_matrix<U>;
+
+    template <typename... Ts>
+    static void sparse_initialization(rocsparse_matrix_factory<T, I, I>& matrix_factory,
+                                      host_sparse_matrix<T>&             hA,
+                                      Ts&&... ts)
+    {
+        matrix_factory.init_sell(hA, ts...);
+    }
+
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
+    {
+        host_sellmv<I, T>(hA.m,
+                          hA.n,
+                          *h_alpha,
+                          hA.ptr,
+                          hA.perm,
+                          hA.ind,
+                          hA.val,
+                          hA.slice_size,
+                          hx,
+                          *h_beta,
+                          hy,
+                          hA.base);
+    };
+};
+
+//
+// TRAITS FOR CSR16 FORMAT.
+//
+template <typename I, typename T>
+struct testing_spmv_dispatch_traits<rocsparse_format_csr16, I, I, T>
+{
+    using traits = testing_matrix_type_traits<rocsparse_format_csr16, I, I, T>;
+    template <typename U>
+    using host_sparse_matrix = typename traits::template host_sparse_matrix<U>;
+    template <typename U>
+    using device_sparse_matrix = typename traits::template device_sparse_matrix<U>;
+
+    template <typename... Ts>
+    static void sparse_initialization(rocsparse_matrix_factory<T, I, I>& matrix_factory,
+                                      host_sparse_matrix<T>&             hA,
+                                      Ts&&... ts)
+    {
+        matrix_factory.init_csr16(hA, ts...);
+    }
+
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
+    {
+        host_csr16mv<I, T>(hA.m,
+                           hA.n,
+                           *h_alpha,
+                           hA.ptr,
+                           hA.row_base,
+                           hA.off,
+                           hA.val,
+                           hA.esc_nnz,
+                           hA.esc_row,
+                           hA.esc_col,
+                           hA.esc_val,
+                           hx,
+                           *h_beta,
+                           hy,
+                           hA.base);
+    };
+};
+
+//
+// TRAITS FOR BSR FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_spmv_dispatch_traits<rocsparse_format_bsr, I, J, T>
+{
+    using traits = testing_matrix_type_traits<rocsparse_format_bsr, I, J, T>;
+    template <typename U>
+    using host_sparse_matrix = typename traits::template host_sparse_matrix<U>;
+    template <typename U>
+    using device_sparse_matrix = typename traits::template device_sparse_matrix<U>;
+
+    // M and N are given in number of blocks and are returned in number of rows and columns
+    static void sparse_initialization(rocsparse_matrix_factory<T, I, J>& matrix_factory,
+                                      host_sparse_matrix<T>&             hA,
+                                      J&                                 M,
+                                      J&                                 N,
+                                      rocsparse_index_base               base)
+    {
+        matrix_factory.init_gebsr(hA, M, N, base);
+        M = hA.mb * hA.row_block_dim;
+        N = hA.nb * hA.col_block_dim;
+    }
+
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
+    {
+        host_gebsrmv<I, J, T>(hA.block_direction,
+                              trans,
+                              hA.mb,
+                              hA.nb,
+                              hA.nnzb,
+                              *h_alpha,
+                              hA.ptr,
+                              hA.ind,
+                              hA.val,
+                              hA.row_block_dim,
+                              hA.col_block_dim,
+                              hx,
+                              *h_beta,
+                              hy,
+                              hA.base);
+    };
+};
+
+//
+// NUMBER OF STORED ENTRIES, BLOCK FORMATS STORE FULL BLOCKS.
+//
+template <typename A>
+inline int64_t testing_spmv_nnz(const A& dA)
+{
+    return dA.nnz;
+}
+
+template <memory_mode::value_t MODE,
+          rocsparse_direction  DIRECTION_,
+          typename T,
+          typename I,
+          typename J>
+inline int64_t testing_spmv_nnz(const gebsx_matrix<MODE, DIRECTION_, T, I, J>& dA)
+{
+    return int64_t(dA.nnzb) * dA.row_block_dim * dA.col_block_dim;
+}
+
+template <memory_mode::value_t MODE, typename T, typename I>
+inline int64_t testing_spmv_nnz(const csr16_matrix<MODE, T, I>& dA)
+{
+    return int64_t(dA.nnz) + dA.esc_nnz;
+}
+
+//
+// BYTES MOVED, CSR16 STORES 16 BIT COLUMN OFFSETS AND ESCAPED ENTRIES.
+//
+template <typename T, typename A, typename J>
+inline double testing_spmv_gbyte_count(const A& dA, J M, J N, bool beta)
+{
+    return csrmv_gbyte_count<T>(M, N, testing_spmv_nnz(dA), beta);
+}
+
+template <typename T, memory_mode::value_t MODE, typename I>
+inline double testing_spmv_gbyte_count(const csr16_matrix<MODE, T, I>& dA, I M, I N, bool beta)
+{
+    return csr16mv_gbyte_count<T>(M, N, dA.nnz, dA.esc_nnz, beta);
+}
+
 template <rocsparse_format FORMAT, typename I, typename J, typename T>
 struct testing_spmv_dispatch
 {
@@ -247,6 +549,13 @@ public:
                 break;
             }
             case rocsparse_datatype_f64_r:
+            {
+                // Single precision values with double precision compute are supported
+                device_sparse_matrix<rocsparse_float_complex> dA;
+                rocsparse_local_spmat                         A(dA);
+                EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+                break;
+            }
             case rocsparse_datatype_f32_c:
             case rocsparse_datatype_f64_c:
             {
@@ -420,11 +729,11 @@ public:
 
         device_sparse_matrix<T> dA(hA);
 
-        host_dense_matrix<T> hx(N, 1);
+        host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
         rocsparse_matrix_utils::init_exact(hx);
         device_dense_matrix<T> dx(hx);
 
-        host_dense_matrix<T> hy(M, 1);
+        host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
         rocsparse_matrix_utils::init_exact(hy);
 
         device_dense_matrix<T> dy(hy);
@@ -450,7 +759,7 @@ public:
                 //
                 // HOST CALCULATION
                 //
-                traits::host_calculation(h_alpha, hA, hx, h_beta, hy, adaptive);
+                traits::host_calculation(trans, h_alpha, hA, hx, h_beta, hy, adaptive);
                 hy.near_check(dy);
                 dy.transfer_from(hy_copy);
             }
@@ -489,9 +798,11 @@ public:
 
             gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
 
-            double gflop_count = spmv_gflop_count(dA.m, dA.nnz, *h_beta != static_cast<T>(0));
+            int64_t nnz = testing_spmv_nnz(dA);
+
+            double gflop_count = spmv_gflop_count(M, nnz, *h_beta != static_cast<T>(0));
             double gbyte_count
-                = csrmv_gbyte_count<T>(dA.m, dA.n, dA.nnz, *h_beta != static_cast<T>(0));
+                = testing_spmv_gbyte_count<T>(dA, M, N, *h_beta != static_cast<T>(0));
 
             double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
             double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -501,7 +812,7 @@ public:
                                 "N",
                                 N,
                                 "nnz",
-                                dA.nnz,
+                                nnz,
                                 "alpha",
                                 *h_alpha,
                                 "beta",
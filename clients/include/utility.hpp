@@ -396,6 +396,153 @@ public:
     {
     }
 
+    rocsparse_local_spmat(int64_t              m,
+                          int64_t              n,
+                          int64_t              nnz,
+                          int64_t              slice_size,
+                          int64_t              sigma,
+                          void*                sell_slice_ptr,
+                          void*                sell_row_perm,
+                          void*                sell_col_ind,
+                          void*                sell_val,
+                          rocsparse_indextype  idx_type,
+                          rocsparse_index_base idx_base,
+                          rocsparse_datatype   compute_type)
+    {
+        rocsparse_create_sell_descr(&this->descr,
+                                    m,
+                                    n,
+                                    nnz,
+                                    slice_size,
+                                    sigma,
+                                    sell_slice_ptr,
+                                    sell_row_perm,
+                                    sell_col_ind,
+                                    sell_val,
+                                    idx_type,
+                                    idx_base,
+                                    compute_type);
+    }
+
+    template <memory_mode::value_t MODE, typename T, typename I = rocsparse_int>
+    rocsparse_local_spmat(sell_matrix<MODE, T, I>& h)
+        : rocsparse_local_spmat(h.m,
+                                h.n,
+                                h.nnz,
+                                h.slice_size,
+                                h.sigma,
+                                h.ptr,
+                                h.perm,
+                                h.ind,
+                                h.val,
+                                get_indextype<I>(),
+                                h.base,
+                                get_datatype<T>())
+    {
+    }
+
+    rocsparse_local_spmat(int64_t              mb,
+                          int64_t              nb,
+                          int64_t              nnzb,
+                          rocsparse_direction  block_dir,
+                          int64_t              row_block_dim,
+                          int64_t              col_block_dim,
+                          void*                bsr_row_ptr,
+                          void*                bsr_col_ind,
+                          void*                bsr_val,
+                          rocsparse_indextype  row_ptr_type,
+                          rocsparse_indextype  col_ind_type,
+                          rocsparse_index_base idx_base,
+                          rocsparse_datatype   compute_type)
+    {
+        rocsparse_create_bsr_descr(&this->descr,
+                                   mb,
+                                   nb,
+                                   nnzb,
+                                   block_dir,
+                                   row_block_dim,
+                                   col_block_dim,
+                                   bsr_row_ptr,
+                                   bsr_col_ind,
+                                   bsr_val,
+                                   row_ptr_type,
+                                   col_ind_type,
+                                   idx_base,
+                                   compute_type);
+    }
+
+    template <memory_mode::value_t MODE,
+              typename T,
+              typename I = rocsparse_int,
+              typename J = rocsparse_int>
+    rocsparse_local_spmat(gebsx_matrix<MODE, rocsparse_direction_row, T, I, J>& h)
+        : rocsparse_local_spmat(h.mb,
+                                h.nb,
+                                h.nnzb,
+                                h.block_direction,
+                                h.row_block_dim,
+                                h.col_block_dim,
+                                h.ptr,
+                                h.ind,
+                                h.val,
+                                get_indextype<I>(),
+                                get_indextype<J>(),
+                                h.base,
+                                get_datatype<T>())
+    {
+    }
+
+    rocsparse_local_spmat(int64_t              m,
+                          int64_t              n,
+                          int64_t              nnz,
+                          int64_t              esc_nnz,
+                          void*                csr16_row_ptr,
+                          void*                csr16_row_base,
+                          void*                csr16_col_off,
+                          void*                csr16_val,
+                          void*                csr16_esc_row_ind,
+                          void*                csr16_esc_col_ind,
+                          void*                csr16_esc_val,
+                          rocsparse_indextype  idx_type,
+                          rocsparse_index_base idx_base,
+                          rocsparse_datatype   compute_type)
+    {
+        rocsparse_create_csr16_descr(&this->descr,
+                                     m,
+                                     n,
+                                     nnz,
+                                     esc_nnz,
+                                     csr16_row_ptr,
+                                     csr16_row_base,
+                                     csr16_col_off,
+                                     csr16_val,
+                                     csr16_esc_row_ind,
+                                     csr16_esc_col_ind,
+                                     csr16_esc_val,
+                                     idx_type,
+                                     idx_base,
+                                     compute_type);
+    }
+
+    template <memory_mode::value_t MODE, typename T, typename I = rocsparse_int>
+    rocsparse_local_spmat(csr16_matrix<MODE, T, I>& h)
+        : rocsparse_local_spmat(h.m,
+                                h.n,
+                                h.nnz,
+                                h.esc_nnz,
+                                h.ptr,
+                                h.row_base,
+                                h.off,
+                                h.val,
+                                h.esc_row,
+                                h.esc_col,
+                                h.esc_val,
+                                get_indextype<I>(),
+                                h.base,
+                                get_datatype<T>())
+    {
+    }
+
     ~rocsparse_local_spmat()
     {
         if(this->descr != nullptr)
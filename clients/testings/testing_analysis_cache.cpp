@@ -0,0 +1,318 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_analysis_cache_bad_arg(const Arguments& arg)
+{
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    size_t  size;
+    size_t  used;
+    int64_t hits;
+    int64_t misses;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_analysis_cache_size(nullptr, 1024),
+                            rocsparse_status_invalid_handle);
+
+#define PARAMS(handle_, size_, used_, hits_, misses_) handle_, size_, used_, hits_, misses_
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(PARAMS(nullptr, &size, &used, &hits, &misses)),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(PARAMS(handle, nullptr, &used, &hits, &misses)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(PARAMS(handle, &size, nullptr, &hits, &misses)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(PARAMS(handle, &size, &used, nullptr, &misses)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_analysis_cache_info(PARAMS(handle, &size, &used, &hits, nullptr)),
+        rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_analysis_cache(const Arguments& arg)
+{
+    auto                      tol  = get_near_check_tol<T>(arg);
+    rocsparse_int             M    = arg.M;
+    rocsparse_int             N    = arg.M;
+    rocsparse_index_base      base = arg.baseA;
+    rocsparse_analysis_policy apol = rocsparse_analysis_policy_reuse;
+    rocsparse_solve_policy    spol = rocsparse_solve_policy_auto;
+
+    // Cache capacity in bytes
+    static constexpr size_t cache_size = 64 * 1024 * 1024;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_descr descr_upper;
+
+    // Info that is analysed, info that is served by the cache and info of a different
+    // descriptor
+    rocsparse_local_mat_info info_analysed;
+    rocsparse_local_mat_info info_cached;
+    rocsparse_local_mat_info info_upper;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_upper, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_upper, rocsparse_fill_mode_upper));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, cache_size));
+
+    size_t  size;
+    size_t  used;
+    int64_t hits;
+    int64_t misses;
+
+    // Expected cache statistics
+    size_t  expected_size;
+    size_t  expected_used;
+    int64_t expected_hits;
+    int64_t expected_misses;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(handle,
+                                                            rocsparse_operation_none,
+                                                            M,
+                                                            M,
+                                                            0,
+                                                            descr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            info_analysed),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+
+        // Quick return does not touch the cache
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &size, &used, &hits, &misses));
+
+        expected_hits   = 0;
+        expected_misses = 0;
+        unit_check_general<int64_t>(1, 1, 1, &expected_hits, &hits);
+        unit_check_general<int64_t>(1, 1, 1, &expected_misses, &misses);
+
+        return;
+    }
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(M, 1);
+    rocsparse_matrix_utils::init(hx);
+
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy_analysed(M, 1), dy_cached(M, 1);
+    device_dense_matrix<T> dz_analysed(M, 1), dz_cached(M, 1);
+
+    // Buffer for the triangular solve
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         dA.m,
+                                                         dA.nnz,
+                                                         descr,
+                                                         dA.val,
+                                                         dA.ptr,
+                                                         dA.ind,
+                                                         info_analysed,
+                                                         &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+#define PARAMS_MV_ANALYSIS(info_) \
+    handle, rocsparse_operation_none, dA.m, dA.n, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_
+#define PARAMS_CSRMV(info_, y_)                                                                   \
+    handle, rocsparse_operation_none, dA.m, dA.n, dA.nnz, h_alpha, descr, dA.val, dA.ptr, dA.ind, \
+        info_, dx, h_beta, y_
+#define PARAMS_SV_ANALYSIS(descr_, info_)                                                        \
+    handle, rocsparse_operation_none, dA.m, dA.nnz, descr_, dA.val, dA.ptr, dA.ind, info_, apol, \
+        spol, dbuffer
+#define PARAMS_SOLVE(info_, z_)                                                                    \
+    handle, rocsparse_operation_none, dA.m, dA.nnz, h_alpha, descr, dA.val, dA.ptr, dA.ind, info_, \
+        dx, z_, spol, dbuffer
+
+    // First analysis populates the cache
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info_analysed)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr, info_analysed)));
+
+    // Second analysis of an identical pattern is served by the cache
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info_cached)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr, info_cached)));
+
+    // A different fill mode must not be served by the cache
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr_upper, info_upper)));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &size, &used, &hits, &misses));
+
+        expected_size   = cache_size;
+        expected_hits   = 2;
+        expected_misses = 3;
+        unit_check_general<size_t>(1, 1, 1, &expected_size, &size);
+        unit_check_general<int64_t>(1, 1, 1, &expected_hits, &hits);
+        unit_check_general<int64_t>(1, 1, 1, &expected_misses, &misses);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(info_analysed, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(info_cached, dy_cached)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(info_analysed, dz_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(info_cached, dz_cached)));
+
+        // Results of the cached meta data must match
+        host_dense_matrix<T> hy_analysed(dy_analysed), hz_analysed(dz_analysed);
+        hy_analysed.near_check(dy_cached, tol);
+        hz_analysed.near_check(dz_cached, tol);
+
+        // Zero pivot must match
+        host_scalar<rocsparse_int> h_pivot_analysed, h_pivot_cached;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrsv_zero_pivot(handle, descr, info_cached, h_pivot_cached),
+            rocsparse_csrsv_zero_pivot(handle, descr, info_analysed, h_pivot_analysed));
+        unit_check_general<rocsparse_int>(1, 1, 1, h_pivot_analysed, h_pivot_cached);
+
+        // Disabling the cache releases its memory
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &size, &used, &hits, &misses));
+
+        expected_size = 0;
+        expected_used = 0;
+        unit_check_general<size_t>(1, 1, 1, &expected_size, &size);
+        unit_check_general<size_t>(1, 1, 1, &expected_used, &used);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, cache_size));
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        // Analysis without cache
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+
+        double gpu_analysis_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr, info)));
+        }
+
+        gpu_analysis_time_used = (get_time_us() - gpu_analysis_time_used) / number_hot_calls;
+
+        // Analysis served by the cache
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, cache_size));
+
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr, info)));
+        }
+
+        double gpu_cached_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(descr, info)));
+        }
+
+        gpu_cached_time_used = (get_time_us() - gpu_cached_time_used) / number_hot_calls;
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_get_analysis_cache_info(handle, &size, &used, &hits, &misses));
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "cache bytes",
+                            used,
+                            "analysis msec",
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            "cached msec",
+                            get_gpu_time_msec(gpu_cached_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS_MV_ANALYSIS
+#undef PARAMS_CSRMV
+#undef PARAMS_SV_ANALYSIS
+#undef PARAMS_SOLVE
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_analysis_cache_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_analysis_cache<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
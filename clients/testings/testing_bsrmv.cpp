@@ -170,20 +170,20 @@ void testing_bsrmv(const Arguments& arg)
         {
             host_dense_matrix<T> hy_copy(hy);
             // CPU bsrmv
-            host_bsrmv<T>(dir,
-                          trans,
-                          hA.mb,
-                          hA.nb,
-                          hA.nnzb,
-                          *h_alpha,
-                          hA.ptr,
-                          hA.ind,
-                          hA.val,
-                          hA.row_block_dim,
-                          hx,
-                          *h_beta,
-                          hy,
-                          base);
+            host_bsrmv<rocsparse_int, rocsparse_int, T>(dir,
+                                                        trans,
+                                                        hA.mb,
+                                                        hA.nb,
+                                                        hA.nnzb,
+                                                        *h_alpha,
+                                                        hA.ptr,
+                                                        hA.ind,
+                                                        hA.val,
+                                                        hA.row_block_dim,
+                                                        hx,
+                                                        *h_beta,
+                                                        hy,
+                                                        base);
 
             hy.near_check(dy);
             dy.transfer_from(hy_copy);
@@ -77,13 +77,23 @@ void testing_coomv_bad_arg(const Arguments& arg)
 
     for(auto matrix_type : rocsparse_matrix_type_t::values)
     {
-        if(matrix_type != rocsparse_matrix_type_general)
+        if(matrix_type == rocsparse_matrix_type_triangular)
         {
             CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
             EXPECT_ROCSPARSE_STATUS(rocsparse_coomv<T>(PARAMS), rocsparse_status_not_implemented);
         }
     }
 
+    // Symmetric and hermitian matrices have to be square
+    n = m + 1;
+    for(auto matrix_type : {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_coomv<T>(PARAMS), rocsparse_status_invalid_size);
+    }
+    n = m;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
 #undef PARAMS
 }
 
@@ -165,6 +175,57 @@ void testing_coomv(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
         CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
         hy.near_check(dy);
+
+        // Symmetric and hermitian storage, only the triangle given by the fill mode is read
+        if(M == N)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, arg.uplo));
+
+            for(auto matrix_type :
+                {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+
+                for(auto op : rocsparse_operation_t::values)
+                {
+                    host_dense_matrix<T> hy_symm(hy);
+                    dy.transfer_from(hy);
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(handle,
+                                                             op,
+                                                             dA.m,
+                                                             dA.n,
+                                                             dA.nnz,
+                                                             h_alpha,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.row_ind,
+                                                             dA.col_ind,
+                                                             dx,
+                                                             h_beta,
+                                                             dy));
+
+                    host_coomv_symmetric<rocsparse_int, T>(op,
+                                                           hA.m,
+                                                           hA.nnz,
+                                                           *h_alpha,
+                                                           hA.row_ind,
+                                                           hA.col_ind,
+                                                           hA.val,
+                                                           hx,
+                                                           *h_beta,
+                                                           hy_symm,
+                                                           matrix_type,
+                                                           arg.uplo,
+                                                           hA.base);
+                    hy_symm.near_check(dy);
+                }
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+            dy.transfer_from(hy);
+        }
     }
 
     if(arg.timing)
@@ -0,0 +1,388 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "handle_resources.h"
+
+#include <cstring>
+
+// Host runtime double of the handle resources, counting all operations
+struct handle_resources_mock_runtime
+{
+    rocsparse_status malloc(void** ptr, size_t size)
+    {
+        ++mallocs;
+        if(fail_malloc)
+        {
+            return rocsparse_status_memory_error;
+        }
+
+        *ptr = new char[size];
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status free(void* ptr)
+    {
+        ++frees;
+        delete[] static_cast<char*>(ptr);
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status upload(void* dst, const void* src, size_t size, hipStream_t stream)
+    {
+        ++uploads;
+        if(fail_upload)
+        {
+            return rocsparse_status_internal_error;
+        }
+
+        memcpy(dst, src, size);
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status synchronize(hipStream_t stream)
+    {
+        ++synchronizations;
+        return rocsparse_status_success;
+    }
+
+    int  mallocs          = 0;
+    int  frees            = 0;
+    int  uploads          = 0;
+    int  synchronizations = 0;
+    bool fail_malloc      = false;
+    bool fail_upload      = false;
+};
+
+template <typename T>
+void testing_create_handle_with_flags_bad_arg(const Arguments& arg)
+{
+    rocsparse_handle handle;
+
+    // Invalid handle pointer
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_handle_with_flags(nullptr, 0),
+                            rocsparse_status_invalid_handle);
+
+    // Unknown flags
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_handle_with_flags(&handle, 0x4),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_handle_with_flags(&handle, ~0u),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_create_handle_with_flags(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        nnz  = arg.nnz;
+    rocsparse_index_base base = arg.baseA;
+
+    static constexpr unsigned int flags[] = {rocsparse_handle_flags_none,
+                                             rocsparse_handle_flags_lazy,
+                                             rocsparse_handle_flags_pooled,
+                                             rocsparse_handle_flags_lazy
+                                                 | rocsparse_handle_flags_pooled};
+
+    if(M <= 0 || nnz <= 0)
+    {
+        return;
+    }
+
+    // Allocate host memory
+    host_vector<rocsparse_int> hx_ind(nnz);
+    host_vector<T>             hx_val(nnz);
+    host_vector<T>             hy(M);
+    host_vector<T>             hdot_1(1);
+    host_vector<T>             hdot_2(1);
+    host_vector<T>             hdot_gold(1);
+
+    // Initialize data on CPU
+    rocsparse_seedrand();
+    rocsparse_init_index(hx_ind, nnz, 1, M);
+    rocsparse_init_alternating_sign<T>(hx_val, 1, nnz, 1);
+    rocsparse_init_exact<T>(hy, 1, M, 1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dx_ind(nnz);
+    device_vector<T>             dx_val(nnz);
+    device_vector<T>             dy(M);
+    device_vector<T>             ddot_2(1);
+
+    if(!dx_ind || !dx_val || !dy || !ddot_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // CPU doti
+        host_doti<rocsparse_int, T>(nnz, hx_val, hx_ind, hy, hdot_gold, base);
+
+        for(unsigned int f : flags)
+        {
+            rocsparse_handle handle;
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_with_flags(&handle, f));
+
+            // doti requires the device buffer of the handle
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_doti<T>(handle, nnz, dx_val, dx_ind, dy, &hdot_1[0], base));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_doti<T>(handle, nnz, dx_val, dx_ind, dy, ddot_2, base));
+
+            CHECK_HIP_ERROR(hipMemcpy(hdot_2, ddot_2, sizeof(T), hipMemcpyDeviceToHost));
+
+            unit_check_general<T>(1, 1, 1, hdot_gold, hdot_1);
+            unit_check_general<T>(1, 1, 1, hdot_gold, hdot_2);
+
+            // Leave a user stream behind, which must not be seen by the next owner
+            hipStream_t stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+            if(f & rocsparse_handle_flags_pooled)
+            {
+                rocsparse_handle pooled;
+                CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_with_flags(&pooled, f));
+
+                // The destroyed handle is reused, unless the pool has been disabled
+                if(getenv("ROCSPARSE_HANDLE_POOL_SIZE") == nullptr)
+                {
+                    int64_t expected_handle = reinterpret_cast<intptr_t>(handle);
+                    int64_t pooled_handle   = reinterpret_cast<intptr_t>(pooled);
+                    unit_check_general<int64_t>(1, 1, 1, &expected_handle, &pooled_handle);
+                }
+
+                hipStream_t            pooled_stream;
+                rocsparse_pointer_mode pooled_mode;
+                CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(pooled, &pooled_stream));
+                CHECK_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(pooled, &pooled_mode));
+
+                int64_t expected_stream = 0;
+                int64_t stream_value    = reinterpret_cast<intptr_t>(pooled_stream);
+                int64_t expected_mode   = rocsparse_pointer_mode_host;
+                int64_t mode_value      = pooled_mode;
+                unit_check_general<int64_t>(1, 1, 1, &expected_stream, &stream_value);
+                unit_check_general<int64_t>(1, 1, 1, &expected_mode, &mode_value);
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(pooled, rocsparse_pointer_mode_host));
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_doti<T>(pooled, nnz, dx_val, dx_ind, dy, &hdot_1[0], base));
+                unit_check_general<T>(1, 1, 1, hdot_gold, hdot_1);
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(pooled));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        double gpu_time_used[4];
+
+        for(int i = 0; i < 4; ++i)
+        {
+            // Fill the pool
+            rocsparse_handle handle;
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_with_flags(&handle, flags[i]));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+
+            gpu_time_used[i] = get_time_us();
+
+            // Handle creation, first call and destruction, as in a short-lived request
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_with_flags(&handle, flags[i]));
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_doti<T>(handle, nnz, dx_val, dx_ind, dy, &hdot_1[0], base));
+                CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+            }
+
+            gpu_time_used[i] = (get_time_us() - gpu_time_used[i]) / number_hot_calls;
+        }
+
+        display_timing_info("nnz",
+                            nnz,
+                            "default usec",
+                            gpu_time_used[0],
+                            "lazy usec",
+                            gpu_time_used[1],
+                            "pooled usec",
+                            gpu_time_used[2],
+                            "lazy pooled usec",
+                            gpu_time_used[3],
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+template <typename T>
+void testing_handle_resources(const Arguments& arg)
+{
+    static constexpr size_t buffer_size = 1024;
+
+    handle_resources_mock_runtime runtime;
+
+    int expected;
+    int state;
+
+    {
+        rocsparse_handle_resources<handle_resources_mock_runtime> resources(runtime);
+        resources.set_buffer_size(buffer_size);
+
+        // Nothing is allocated before first use
+        expected = 0;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.mallocs);
+
+        expected = static_cast<int>(rocsparse_resource_state::unallocated);
+        state    = static_cast<int>(resources.buffer_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+        state = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        // First use allocates the buffer, further uses return the same buffer
+        void* buffer_1;
+        void* buffer_2;
+        CHECK_ROCSPARSE_ERROR(resources.get_buffer(&buffer_1));
+        CHECK_ROCSPARSE_ERROR(resources.get_buffer(&buffer_2));
+
+        expected = 1;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.mallocs);
+
+        int64_t expected_buffer = reinterpret_cast<intptr_t>(buffer_1);
+        int64_t buffer_value    = reinterpret_cast<intptr_t>(buffer_2);
+        unit_check_general<int64_t>(1, 1, 1, &expected_buffer, &buffer_value);
+
+        expected = static_cast<int>(rocsparse_resource_state::allocated);
+        state    = static_cast<int>(resources.buffer_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        // The buffer does not allocate the constants
+        expected = static_cast<int>(rocsparse_resource_state::unallocated);
+        state    = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        // All constants share a single upload
+        float*                    sone;
+        double*                   done;
+        rocsparse_float_complex*  cone;
+        rocsparse_double_complex* zone;
+        CHECK_ROCSPARSE_ERROR(resources.get_one(&sone, nullptr));
+        CHECK_ROCSPARSE_ERROR(resources.get_one(&done, nullptr));
+        CHECK_ROCSPARSE_ERROR(resources.get_one(&cone, nullptr));
+        CHECK_ROCSPARSE_ERROR(resources.get_one(&zone, nullptr));
+
+        expected = 2;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.mallocs);
+        expected = 1;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.uploads);
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.synchronizations);
+
+        float                    expected_sone = 1.0f;
+        double                   expected_done = 1.0;
+        rocsparse_float_complex  expected_cone(1.0f, 0.0f);
+        rocsparse_double_complex expected_zone(1.0, 0.0);
+        unit_check_general<float>(1, 1, 1, &expected_sone, sone);
+        unit_check_general<double>(1, 1, 1, &expected_done, done);
+        unit_check_general<rocsparse_float_complex>(1, 1, 1, &expected_cone, cone);
+        unit_check_general<rocsparse_double_complex>(1, 1, 1, &expected_zone, zone);
+
+        // Release returns to the initial state
+        CHECK_ROCSPARSE_ERROR(resources.release());
+
+        expected = 2;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.frees);
+
+        expected = static_cast<int>(rocsparse_resource_state::unallocated);
+        state    = static_cast<int>(resources.buffer_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+        state = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        // Failed allocations leave the resources unallocated, the next use retries
+        runtime.fail_malloc = true;
+        EXPECT_ROCSPARSE_STATUS(resources.get_buffer(&buffer_1), rocsparse_status_memory_error);
+        EXPECT_ROCSPARSE_STATUS(resources.get_one(&sone, nullptr), rocsparse_status_memory_error);
+
+        state = static_cast<int>(resources.buffer_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+        state = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        runtime.fail_malloc = false;
+        runtime.fail_upload = true;
+        EXPECT_ROCSPARSE_STATUS(resources.get_one(&sone, nullptr),
+                                rocsparse_status_internal_error);
+
+        // The constants of the failed upload are freed again
+        expected = 3;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.frees);
+
+        expected = static_cast<int>(rocsparse_resource_state::unallocated);
+        state    = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+
+        // Initialization allocates everything at once, and only once
+        runtime.fail_upload = false;
+        CHECK_ROCSPARSE_ERROR(resources.initialize(nullptr));
+        CHECK_ROCSPARSE_ERROR(resources.initialize(nullptr));
+
+        expected = 7;
+        unit_check_general<int>(1, 1, 1, &expected, &runtime.mallocs);
+
+        expected = static_cast<int>(rocsparse_resource_state::allocated);
+        state    = static_cast<int>(resources.buffer_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+        state = static_cast<int>(resources.ones_state());
+        unit_check_general<int>(1, 1, 1, &expected, &state);
+    }
+
+    // Destruction frees all successful allocations
+    expected = runtime.mallocs - 2;
+    unit_check_general<int>(1, 1, 1, &expected, &runtime.frees);
+}
+
+#define INSTANTIATE(TYPE)                                                               \
+    template void testing_create_handle_with_flags_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_create_handle_with_flags<TYPE>(const Arguments& arg);         \
+    template void testing_handle_resources<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -24,6 +24,10 @@
 
 #include "testing.hpp"
 
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
 template <typename T>
 void testing_csr2bsr_bad_arg(const Arguments& arg)
 {
@@ -477,6 +481,37 @@ void testing_csr2bsr(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, N, nnz, csr_base);
 
+    // Footprint is computed from the matrix as generated, including explicit zeros
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_int Mb   = (M + block_dim - 1) / block_dim;
+        rocsparse_int Nb   = (N + block_dim - 1) / block_dim;
+        rocsparse_int nnzb = rocsparse_footprint_gebsr_nnzb(
+            M, hcsr_row_ptr_A, hcsr_col_ind_A, csr_base, block_dim, block_dim);
+        rocsparse_footprint fp = rocsparse_footprint_gebsr(
+            Mb, nnzb, block_dim, block_dim, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "Mb",
+                            Mb,
+                            "Nb",
+                            Nb,
+                            "blockdim",
+                            block_dim,
+                            "nnzb",
+                            nnzb,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
     // Uncompressed CSR matrix on device
     device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
     device_vector<rocsparse_int> dcsr_col_ind_A(nnz);
@@ -841,20 +876,37 @@ void testing_csr2bsr(const Arguments& arg)
         double gpu_gbyte
             = csr2bsr_gbyte_count<T>(M, Mb, nnz, hbsr_nnzb, block_dim) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
-                  << std::setw(12) << "Nb" << std::setw(12) << "blockdim" << std::setw(12) << "nnzb"
-                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
-                  << std::setw(12) << Nb << std::setw(12) << block_dim << std::setw(12) << hbsr_nnzb
-                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        rocsparse_footprint fp = rocsparse_footprint_gebsr(
+            Mb, hbsr_nnzb, block_dim, block_dim, nnz_C, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "Mb",
+                            Mb,
+                            "Nb",
+                            Nb,
+                            "blockdim",
+                            block_dim,
+                            "nnzb",
+                            hbsr_nnzb,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz_C / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
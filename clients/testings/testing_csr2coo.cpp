@@ -24,6 +24,10 @@
 
 #include "testing.hpp"
 
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
 template <typename T>
 void testing_csr2coo_bad_arg(const Arguments& arg)
 {
@@ -97,6 +101,25 @@ void testing_csr2coo(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
 
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_footprint fp = rocsparse_footprint_coo(nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
     // Allocate host memory for COO matrix
     host_vector<rocsparse_int> hcoo_row_ind(nnz);
     host_vector<rocsparse_int> hcoo_row_ind_gold(nnz);
@@ -154,18 +177,30 @@ void testing_csr2coo(const Arguments& arg)
 
         double gpu_gbyte = csr2coo_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
-                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
-                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        rocsparse_footprint fp = rocsparse_footprint_coo(nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
@@ -24,6 +24,10 @@
 
 #include "testing.hpp"
 
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
 template <typename T>
 void testing_csr2csc_bad_arg(const Arguments& arg)
 {
@@ -269,6 +273,31 @@ void testing_csr2csc(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
 
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_footprint fp = rocsparse_footprint_csx(N, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        // Buffer size query does not access the matrix arrays
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size(
+            handle, M, N, nnz, hcsr_row_ptr, hcsr_col_ind, action, &fp.buffer));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "action",
+                            rocsparse_action2string(action),
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
     // Allocate host memory for CSC matrix
     host_vector<rocsparse_int> hcsc_row_ind(nnz);
     host_vector<rocsparse_int> hcsc_col_ptr(N + 1);
@@ -398,18 +427,33 @@ void testing_csr2csc(const Arguments& arg)
 
         double gpu_gbyte = csr2csc_gbyte_count<T>(M, N, nnz, action) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
-                  << std::setw(12) << "action" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
-                  << std::setw(12) << rocsparse_action2string(action) << std::setw(12) << gpu_gbyte
-                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+        rocsparse_footprint fp = rocsparse_footprint_csx(N, nnz, sizeof(rocsparse_int), sizeof(T));
+        fp.buffer              = buffer_size;
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "action",
+                            rocsparse_action2string(action),
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 
     // Free buffer
@@ -0,0 +1,490 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_csr2csr16_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_csr_descr;
+    rocsparse_local_mat_descr local_csr16_descr;
+
+    rocsparse_handle          handle            = local_handle;
+    rocsparse_int             m                 = safe_size;
+    const rocsparse_mat_descr csr_descr         = local_csr_descr;
+    const T*                  csr_val           = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr       = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind       = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr csr16_descr       = local_csr16_descr;
+    rocsparse_int*            csr16_row_ptr     = (rocsparse_int*)0x4;
+    rocsparse_int*            csr16_row_base    = (rocsparse_int*)0x4;
+    rocsparse_int*            csr16_esc_nnz     = (rocsparse_int*)0x4;
+    T*                        csr16_val         = (T*)0x4;
+    uint16_t*                 csr16_col_off     = (uint16_t*)0x4;
+    T*                        csr16_esc_val     = (T*)0x4;
+    rocsparse_int*            csr16_esc_row_ind = (rocsparse_int*)0x4;
+    rocsparse_int*            csr16_esc_col_ind = (rocsparse_int*)0x4;
+
+#define PARAMS_NNZ                                                                         \
+    handle, m, csr_descr, csr_row_ptr, csr_col_ind, csr16_descr, csr16_row_ptr, csr16_row_base, \
+        csr16_esc_nnz
+    auto_testing_bad_arg(rocsparse_csr2csr16_nnz, PARAMS_NNZ);
+#undef PARAMS_NNZ
+
+#define PARAMS                                                                               \
+    handle, m, csr_descr, csr_val, csr_row_ptr, csr_col_ind, csr16_descr, csr16_row_ptr,     \
+        csr16_row_base, csr16_val, csr16_col_off, csr16_esc_val, csr16_esc_row_ind,          \
+        csr16_esc_col_ind
+    auto_testing_bad_arg(rocsparse_csr2csr16<T>, PARAMS);
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csr2csr16(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M     = arg.M;
+    rocsparse_int               N     = arg.N;
+    rocsparse_index_base        baseA = arg.baseA;
+    rocsparse_index_base        baseB = arg.baseB;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for CSR16 matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dcsr16_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr16_row_base(safe_size);
+        device_vector<uint16_t>      dcsr16_col_off(safe_size);
+        device_vector<T>             dcsr16_val(safe_size);
+        device_vector<rocsparse_int> dcsr16_esc_row_ind(safe_size);
+        device_vector<rocsparse_int> dcsr16_esc_col_ind(safe_size);
+        device_vector<T>             dcsr16_esc_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr16_row_ptr || !dcsr16_row_base
+           || !dcsr16_col_off || !dcsr16_val || !dcsr16_esc_row_ind || !dcsr16_esc_col_ind
+           || !dcsr16_esc_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        rocsparse_int esc_nnz;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csr16_nnz(handle,
+                                                        M,
+                                                        descrA,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        descrB,
+                                                        dcsr16_row_ptr,
+                                                        dcsr16_row_base,
+                                                        &esc_nnz),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csr16<T>(handle,
+                                                       M,
+                                                       descrA,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       descrB,
+                                                       dcsr16_row_ptr,
+                                                       dcsr16_row_base,
+                                                       dcsr16_val,
+                                                       dcsr16_col_off,
+                                                       dcsr16_esc_val,
+                                                       dcsr16_esc_row_ind,
+                                                       dcsr16_esc_col_ind),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, baseA);
+
+    // The host encoder serves as reference and to account for the escaped entries
+    host_vector<rocsparse_int> hcsr16_row_ptr_gold;
+    host_vector<rocsparse_int> hcsr16_row_base_gold;
+    host_vector<uint16_t>      hcsr16_col_off_gold;
+    host_vector<T>             hcsr16_val_gold;
+    host_vector<rocsparse_int> hcsr16_esc_row_ind_gold;
+    host_vector<rocsparse_int> hcsr16_esc_col_ind_gold;
+    host_vector<T>             hcsr16_esc_val_gold;
+    rocsparse_int              csr16_nnz_gold;
+    rocsparse_int              esc_nnz_gold;
+
+    host_csr_to_csr16<rocsparse_int, T>(M,
+                                        hcsr_row_ptr,
+                                        hcsr_col_ind,
+                                        hcsr_val,
+                                        hcsr16_row_ptr_gold,
+                                        hcsr16_row_base_gold,
+                                        hcsr16_col_off_gold,
+                                        hcsr16_val_gold,
+                                        hcsr16_esc_row_ind_gold,
+                                        hcsr16_esc_col_ind_gold,
+                                        hcsr16_esc_val_gold,
+                                        csr16_nnz_gold,
+                                        esc_nnz_gold,
+                                        baseA,
+                                        baseB);
+
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_footprint fp
+            = rocsparse_footprint_csr16(M, nnz, esc_nnz_gold, sizeof(rocsparse_int), sizeof(T));
+        rocsparse_footprint fp_csr
+            = rocsparse_footprint_csx(M, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "escaped",
+                            esc_nnz_gold,
+                            "MB",
+                            fp.megabytes(),
+                            "CSR MB",
+                            fp_csr.megabytes(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcsr16_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr16_row_base(M);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr16_row_ptr || !dcsr16_row_base)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Obtain row pointers and base columns, the number of escaped entries is
+        // checked in both pointer modes
+        rocsparse_int                esc_nnz;
+        device_vector<rocsparse_int> desc_nnz(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16_nnz(handle,
+                                                      M,
+                                                      descrA,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      descrB,
+                                                      dcsr16_row_ptr,
+                                                      dcsr16_row_base,
+                                                      desc_nnz));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16_nnz(handle,
+                                                      M,
+                                                      descrA,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      descrB,
+                                                      dcsr16_row_ptr,
+                                                      dcsr16_row_base,
+                                                      &esc_nnz));
+
+        rocsparse_int esc_nnz_device;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&esc_nnz_device, desc_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &esc_nnz_gold, &esc_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &esc_nnz_gold, &esc_nnz_device);
+
+        rocsparse_int csr16_nnz = nnz - esc_nnz;
+
+        // Allocate device memory
+        device_vector<uint16_t>      dcsr16_col_off(csr16_nnz);
+        device_vector<T>             dcsr16_val(csr16_nnz);
+        device_vector<rocsparse_int> dcsr16_esc_row_ind(esc_nnz);
+        device_vector<rocsparse_int> dcsr16_esc_col_ind(esc_nnz);
+        device_vector<T>             dcsr16_esc_val(esc_nnz);
+
+        if(!dcsr16_col_off || !dcsr16_val || !dcsr16_esc_row_ind || !dcsr16_esc_col_ind
+           || !dcsr16_esc_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform CSR16 conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16<T>(handle,
+                                                     M,
+                                                     descrA,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     descrB,
+                                                     dcsr16_row_ptr,
+                                                     dcsr16_row_base,
+                                                     dcsr16_val,
+                                                     dcsr16_col_off,
+                                                     dcsr16_esc_val,
+                                                     dcsr16_esc_row_ind,
+                                                     dcsr16_esc_col_ind));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr16_row_ptr(M + 1);
+        host_vector<rocsparse_int> hcsr16_row_base(M);
+        host_vector<uint16_t>      hcsr16_col_off(csr16_nnz);
+        host_vector<T>             hcsr16_val(csr16_nnz);
+        host_vector<rocsparse_int> hcsr16_esc_row_ind(esc_nnz);
+        host_vector<rocsparse_int> hcsr16_esc_col_ind(esc_nnz);
+        host_vector<T>             hcsr16_esc_val(esc_nnz);
+
+        hcsr16_row_ptr.transfer_from(dcsr16_row_ptr);
+        hcsr16_row_base.transfer_from(dcsr16_row_base);
+        hcsr16_col_off.transfer_from(dcsr16_col_off);
+        hcsr16_val.transfer_from(dcsr16_val);
+        hcsr16_esc_row_ind.transfer_from(dcsr16_esc_row_ind);
+        hcsr16_esc_col_ind.transfer_from(dcsr16_esc_col_ind);
+        hcsr16_esc_val.transfer_from(dcsr16_esc_val);
+
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr16_row_ptr_gold, hcsr16_row_ptr);
+        unit_check_general<rocsparse_int>(1, M, 1, hcsr16_row_base_gold, hcsr16_row_base);
+        unit_check_general<uint16_t>(1, csr16_nnz, 1, hcsr16_col_off_gold, hcsr16_col_off);
+        unit_check_general<T>(1, csr16_nnz, 1, hcsr16_val_gold, hcsr16_val);
+        unit_check_general<rocsparse_int>(
+            1, esc_nnz, 1, hcsr16_esc_row_ind_gold, hcsr16_esc_row_ind);
+        unit_check_general<rocsparse_int>(
+            1, esc_nnz, 1, hcsr16_esc_col_ind_gold, hcsr16_esc_col_ind);
+        unit_check_general<T>(1, esc_nnz, 1, hcsr16_esc_val_gold, hcsr16_esc_val);
+
+        // Decoding the device result has to reproduce the original matrix
+        host_vector<rocsparse_int> hcsr_row_ptr_decoded;
+        host_vector<rocsparse_int> hcsr_col_ind_decoded;
+        host_vector<T>             hcsr_val_decoded;
+
+        host_csr16_to_csr<rocsparse_int, T>(M,
+                                            hcsr16_row_ptr,
+                                            hcsr16_row_base,
+                                            hcsr16_col_off,
+                                            hcsr16_val,
+                                            esc_nnz,
+                                            hcsr16_esc_row_ind,
+                                            hcsr16_esc_col_ind,
+                                            hcsr16_esc_val,
+                                            hcsr_row_ptr_decoded,
+                                            hcsr_col_ind_decoded,
+                                            hcsr_val_decoded,
+                                            baseB,
+                                            baseA);
+
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr, hcsr_row_ptr_decoded);
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcsr_col_ind, hcsr_col_ind_decoded);
+        unit_check_general<T>(1, nnz, 1, hcsr_val, hcsr_val_decoded);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int esc_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16_nnz(handle,
+                                                          M,
+                                                          descrA,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          descrB,
+                                                          dcsr16_row_ptr,
+                                                          dcsr16_row_base,
+                                                          &esc_nnz));
+
+            device_vector<uint16_t>      dcsr16_col_off(nnz - esc_nnz);
+            device_vector<T>             dcsr16_val(nnz - esc_nnz);
+            device_vector<rocsparse_int> dcsr16_esc_row_ind(esc_nnz);
+            device_vector<rocsparse_int> dcsr16_esc_col_ind(esc_nnz);
+            device_vector<T>             dcsr16_esc_val(esc_nnz);
+
+            if(!dcsr16_col_off || !dcsr16_val || !dcsr16_esc_row_ind || !dcsr16_esc_col_ind
+               || !dcsr16_esc_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16<T>(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         descrB,
+                                                         dcsr16_row_ptr,
+                                                         dcsr16_row_base,
+                                                         dcsr16_val,
+                                                         dcsr16_col_off,
+                                                         dcsr16_esc_val,
+                                                         dcsr16_esc_row_ind,
+                                                         dcsr16_esc_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16_nnz(handle,
+                                                          M,
+                                                          descrA,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          descrB,
+                                                          dcsr16_row_ptr,
+                                                          dcsr16_row_base,
+                                                          &esc_nnz));
+
+            device_vector<uint16_t>      dcsr16_col_off(nnz - esc_nnz);
+            device_vector<T>             dcsr16_val(nnz - esc_nnz);
+            device_vector<rocsparse_int> dcsr16_esc_row_ind(esc_nnz);
+            device_vector<rocsparse_int> dcsr16_esc_col_ind(esc_nnz);
+            device_vector<T>             dcsr16_esc_val(esc_nnz);
+
+            if(!dcsr16_col_off || !dcsr16_val || !dcsr16_esc_row_ind || !dcsr16_esc_col_ind
+               || !dcsr16_esc_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr16<T>(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         descrB,
+                                                         dcsr16_row_ptr,
+                                                         dcsr16_row_base,
+                                                         dcsr16_val,
+                                                         dcsr16_col_off,
+                                                         dcsr16_esc_val,
+                                                         dcsr16_esc_row_ind,
+                                                         dcsr16_esc_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csr2csr16_gbyte_count<T>(M, nnz, esc_nnz) / gpu_time_used * 1e6;
+
+        rocsparse_footprint fp
+            = rocsparse_footprint_csr16(M, nnz, esc_nnz, sizeof(rocsparse_int), sizeof(T));
+        rocsparse_footprint fp_csr
+            = rocsparse_footprint_csx(M, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "escaped",
+                            esc_nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "CSR MB",
+                            fp_csr.megabytes(),
+                            "Mnnz/s",
+                            nnz / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csr2csr16_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr2csr16<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
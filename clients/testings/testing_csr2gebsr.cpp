@@ -24,6 +24,10 @@
 
 #include "testing.hpp"
 
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
 template <typename T>
 void testing_csr2gebsr_bad_arg(const Arguments& arg)
 {
@@ -441,6 +445,53 @@ void testing_csr2gebsr(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, N, nnz, csr_base);
 
+    // Footprint is computed from the matrix as generated, including explicit zeros
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_int Mb   = (M + row_block_dim - 1) / row_block_dim;
+        rocsparse_int Nb   = (N + col_block_dim - 1) / col_block_dim;
+        rocsparse_int nnzb = rocsparse_footprint_gebsr_nnzb(
+            M, hcsr_row_ptr_A, hcsr_col_ind_A, csr_base, row_block_dim, col_block_dim);
+        rocsparse_footprint fp = rocsparse_footprint_gebsr(
+            Mb, nnzb, row_block_dim, col_block_dim, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        // Buffer size query does not access the matrix arrays
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr_buffer_size<T>(handle,
+                                                                 direction,
+                                                                 M,
+                                                                 N,
+                                                                 csr_descr,
+                                                                 hcsr_val_A,
+                                                                 hcsr_row_ptr_A,
+                                                                 hcsr_col_ind_A,
+                                                                 row_block_dim,
+                                                                 col_block_dim,
+                                                                 &fp.buffer));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "Mb",
+                            Mb,
+                            "Nb",
+                            Nb,
+                            "rowblockdim",
+                            row_block_dim,
+                            "colblockdim",
+                            col_block_dim,
+                            "nnzb",
+                            nnzb,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
     // Uncompressed CSR matrix on device
     device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
     device_vector<rocsparse_int> dcsr_col_ind_A(nnz);
@@ -878,21 +929,45 @@ void testing_csr2gebsr(const Arguments& arg)
             = csr2gebsr_gbyte_count<T>(M, Mb, nnz, hbsr_nnzb, row_block_dim, col_block_dim)
               / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
-                  << std::setw(12) << "Nb" << std::setw(12) << "rowblockdim" << std::setw(12)
-                  << "colblockdim" << std::setw(12) << "nnzb" << std::setw(12) << "GB/s"
-                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
-                  << std::setw(12) << Nb << std::setw(12) << row_block_dim << std::setw(12)
-                  << col_block_dim << std::setw(12) << hbsr_nnzb << std::setw(12) << gpu_gbyte
-                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+        rocsparse_footprint fp = rocsparse_footprint_gebsr(Mb,
+                                                           hbsr_nnzb,
+                                                           row_block_dim,
+                                                           col_block_dim,
+                                                           nnz_C,
+                                                           sizeof(rocsparse_int),
+                                                           sizeof(T));
+        fp.buffer              = buffer_size;
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "Mb",
+                            Mb,
+                            "Nb",
+                            Nb,
+                            "rowblockdim",
+                            row_block_dim,
+                            "colblockdim",
+                            col_block_dim,
+                            "nnzb",
+                            hbsr_nnzb,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz_C / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
@@ -24,6 +24,10 @@
 
 #include "testing.hpp"
 
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
 template <typename T>
 void testing_csr2hyb_bad_arg(const Arguments& arg)
 {
@@ -116,6 +120,90 @@ void testing_csr2hyb_bad_arg(const Arguments& arg)
                                                  0,
                                                  rocsparse_hyb_partition_auto),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_bounded_buffer_size()
+    rocsparse_int ell_width_bound;
+    rocsparse_int coo_nnz_bound;
+    size_t        buffer_size;
+
+#define PARAMS_BUFFER_SIZE(handle_, part_, width_, ell_bound_, coo_bound_, buffer_size_) \
+    handle_, safe_size, safe_size, safe_size, width_, part_, ell_bound_, coo_bound_, buffer_size_
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded_buffer_size(PARAMS_BUFFER_SIZE(nullptr,
+                                                                 rocsparse_hyb_partition_auto,
+                                                                 0,
+                                                                 &ell_width_bound,
+                                                                 &coo_nnz_bound,
+                                                                 &buffer_size)),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded_buffer_size(PARAMS_BUFFER_SIZE(handle,
+                                                                 rocsparse_hyb_partition_auto,
+                                                                 0,
+                                                                 nullptr,
+                                                                 &coo_nnz_bound,
+                                                                 &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded_buffer_size(PARAMS_BUFFER_SIZE(handle,
+                                                                 rocsparse_hyb_partition_auto,
+                                                                 0,
+                                                                 &ell_width_bound,
+                                                                 nullptr,
+                                                                 &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded_buffer_size(PARAMS_BUFFER_SIZE(handle,
+                                                                 rocsparse_hyb_partition_auto,
+                                                                 0,
+                                                                 &ell_width_bound,
+                                                                 &coo_nnz_bound,
+                                                                 nullptr)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded_buffer_size(PARAMS_BUFFER_SIZE(handle,
+                                                                 rocsparse_hyb_partition_user,
+                                                                 -1,
+                                                                 &ell_width_bound,
+                                                                 &coo_nnz_bound,
+                                                                 &buffer_size)),
+        rocsparse_status_invalid_value);
+
+#undef PARAMS_BUFFER_SIZE
+
+    // Test rocsparse_csr2hyb_bounded()
+    device_vector<rocsparse_int> dell_width(1);
+    device_vector<rocsparse_int> dcoo_nnz(1);
+    device_vector<rocsparse_int> dind(safe_size);
+    device_vector<T>             dval(safe_size);
+    device_vector<char>          dbuffer(safe_size);
+
+#define PARAMS(handle_, descr_, ell_width_, coo_nnz_, coo_row_ind_, buffer_)                   \
+    handle_, safe_size, safe_size, safe_size, descr_, dcsr_val, dcsr_row_ptr, dcsr_col_ind, 0, \
+        rocsparse_hyb_partition_auto, ell_width_, dval, dind, coo_nnz_, dval, coo_row_ind_,    \
+        dind, buffer_
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(nullptr, descr, dell_width, dcoo_nnz, dind, dbuffer)),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(handle, nullptr, dell_width, dcoo_nnz, dind, dbuffer)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(handle, descr, nullptr, dcoo_nnz, dind, dbuffer)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(handle, descr, dell_width, nullptr, dind, dbuffer)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(handle, descr, dell_width, dcoo_nnz, nullptr, dbuffer)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_bounded<T>(PARAMS(handle, descr, dell_width, dcoo_nnz, dind, nullptr)),
+        rocsparse_status_invalid_pointer);
+
+#undef PARAMS
 }
 
 template <typename T>
@@ -187,6 +275,31 @@ void testing_csr2hyb(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
 
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_int ell_width
+            = rocsparse_footprint_hyb_width(M, nnz, hcsr_row_ptr, part, user_ell_width);
+        rocsparse_int       coo_nnz = rocsparse_footprint_hyb_coo_nnz(M, hcsr_row_ptr, ell_width);
+        rocsparse_footprint fp      = rocsparse_footprint_hyb(
+            M, ell_width, coo_nnz, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "ELL nnz",
+                            ell_width * M,
+                            "COO nnz",
+                            coo_nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
     // Allocate device memory
     device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
     device_vector<rocsparse_int> dcsr_col_ind(nnz);
@@ -264,8 +377,17 @@ void testing_csr2hyb(const Arguments& arg)
 
     if(arg.unit_check)
     {
+        int64_t sync_count_before;
+        int64_t sync_count_after;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_before));
         CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(
             handle, M, N, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, hyb, user_ell_width, part));
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_after));
+
+        // The conversion synchronizes the host exactly once
+        int64_t sync_count_delta = sync_count_after - sync_count_before;
+        int64_t sync_count_gold  = 1;
+        unit_check_general<int64_t>(1, 1, 1, &sync_count_gold, &sync_count_delta);
 
         // Copy output to host
         rocsparse_hyb_mat ptr  = hyb;
@@ -329,6 +451,85 @@ void testing_csr2hyb(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_row_ind_gold, hhyb_coo_row_ind);
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_col_ind_gold, hhyb_coo_col_ind);
         unit_check_general<T>(1, coo_nnz, 1, hhyb_coo_val_gold, hhyb_coo_val);
+
+        // The bounded conversion into preallocated arrays does not synchronize the host
+        // and yields the same ELL and COO parts
+        rocsparse_int ell_width_bound;
+        rocsparse_int coo_nnz_bound;
+        size_t        buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_bounded_buffer_size(handle,
+                                                                    M,
+                                                                    N,
+                                                                    nnz,
+                                                                    user_ell_width,
+                                                                    part,
+                                                                    &ell_width_bound,
+                                                                    &coo_nnz_bound,
+                                                                    &buffer_size));
+
+        device_vector<rocsparse_int> dell_width(1);
+        device_vector<rocsparse_int> dcoo_nnz(1);
+        device_vector<rocsparse_int> dell_col_ind(std::max(M * ell_width_bound, 1));
+        device_vector<T>             dell_val(std::max(M * ell_width_bound, 1));
+        device_vector<rocsparse_int> dcoo_row_ind(std::max(coo_nnz_bound, 1));
+        device_vector<rocsparse_int> dcoo_col_ind(std::max(coo_nnz_bound, 1));
+        device_vector<T>             dcoo_val(std::max(coo_nnz_bound, 1));
+        device_vector<char>          dbuffer(buffer_size);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_before));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_bounded<T>(handle,
+                                                           M,
+                                                           N,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           user_ell_width,
+                                                           part,
+                                                           dell_width,
+                                                           dell_val,
+                                                           dell_col_ind,
+                                                           dcoo_nnz,
+                                                           dcoo_val,
+                                                           dcoo_row_ind,
+                                                           dcoo_col_ind,
+                                                           dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_after));
+        unit_check_general<int64_t>(1, 1, 1, &sync_count_before, &sync_count_after);
+
+        rocsparse_int hell_width;
+        rocsparse_int hcoo_nnz;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hell_width, dell_width, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hcoo_nnz, dcoo_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &ell_width_gold, &hell_width);
+        unit_check_general<rocsparse_int>(1, 1, 1, &coo_nnz_gold, &hcoo_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_ell_col_ind,
+                                  dell_col_ind,
+                                  sizeof(rocsparse_int) * ell_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hhyb_ell_val, dell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_coo_row_ind,
+                                  dcoo_row_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_coo_col_ind,
+                                  dcoo_col_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hhyb_coo_val, dcoo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, ell_nnz, 1, hhyb_ell_col_ind_gold, hhyb_ell_col_ind);
+        unit_check_general<T>(1, ell_nnz, 1, hhyb_ell_val_gold, hhyb_ell_val);
+        unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_row_ind_gold, hhyb_coo_row_ind);
+        unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_col_ind_gold, hhyb_coo_col_ind);
+        unit_check_general<T>(1, coo_nnz, 1, hhyb_coo_val_gold, hhyb_coo_val);
     }
 
     if(arg.timing)
@@ -378,18 +579,33 @@ void testing_csr2hyb(const Arguments& arg)
 
         double gpu_gbyte = csr2hyb_gbyte_count<T>(M, nnz, ell_nnz, coo_nnz) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL nnz"
-                  << std::setw(12) << "COO nnz" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << ell_nnz
-                  << std::setw(12) << coo_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
-                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        rocsparse_footprint fp = rocsparse_footprint_hyb(
+            M, dhyb->ell_width, coo_nnz, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "ELL nnz",
+                            ell_nnz,
+                            "COO nnz",
+                            coo_nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
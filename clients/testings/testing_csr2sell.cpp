@@ -0,0 +1,449 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_footprint.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_csr2sell_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_csr_descr;
+    rocsparse_local_mat_descr local_sell_descr;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_int             m              = safe_size;
+    const rocsparse_mat_descr csr_descr      = local_csr_descr;
+    const T*                  csr_val        = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind    = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr sell_descr     = local_sell_descr;
+    rocsparse_int             slice_size     = 4;
+    rocsparse_int             sigma          = 16;
+    rocsparse_int*            sell_slice_ptr = (rocsparse_int*)0x4;
+    rocsparse_int*            sell_row_perm  = (rocsparse_int*)0x4;
+    rocsparse_int*            sell_nnz       = (rocsparse_int*)0x4;
+    T*                        sell_val       = (T*)0x4;
+    rocsparse_int*            sell_col_ind   = (rocsparse_int*)0x4;
+
+#define PARAMS_NNZ                                                                    \
+    handle, m, csr_descr, csr_row_ptr, sell_descr, slice_size, sigma, sell_slice_ptr, \
+        sell_row_perm, sell_nnz
+    auto_testing_bad_arg(rocsparse_csr2sell_nnz, PARAMS_NNZ);
+
+    slice_size = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    slice_size = 4;
+    sigma      = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    sigma = 16;
+#undef PARAMS_NNZ
+
+#define PARAMS                                                                        \
+    handle, m, csr_descr, csr_val, csr_row_ptr, csr_col_ind, sell_descr, slice_size, \
+        sell_slice_ptr, sell_row_perm, sell_val, sell_col_ind
+    auto_testing_bad_arg(rocsparse_csr2sell<T>, PARAMS);
+
+    slice_size = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(PARAMS), rocsparse_status_invalid_size);
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csr2sell(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M          = arg.M;
+    rocsparse_int               N          = arg.N;
+    rocsparse_int               slice_size = arg.block_dim;
+    rocsparse_int               sigma      = arg.row_block_dimA;
+    rocsparse_index_base        baseA      = arg.baseA;
+    rocsparse_index_base        baseB      = arg.baseB;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for SELL matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+        device_vector<rocsparse_int> dsell_row_perm(safe_size);
+        device_vector<rocsparse_int> dsell_col_ind(safe_size);
+        device_vector<T>             dsell_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_row_perm
+           || !dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        rocsparse_int sell_nnz;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                       M,
+                                                       descrA,
+                                                       dcsr_row_ptr,
+                                                       descrB,
+                                                       slice_size,
+                                                       sigma,
+                                                       dsell_slice_ptr,
+                                                       dsell_row_perm,
+                                                       &sell_nnz),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                      M,
+                                                      descrA,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      descrB,
+                                                      slice_size,
+                                                      dsell_slice_ptr,
+                                                      dsell_row_perm,
+                                                      dsell_val,
+                                                      dsell_col_ind),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, baseA);
+
+    rocsparse_int nslices = (M - 1) / slice_size + 1;
+
+    // The host conversion serves as reference and to account for the padding
+    host_vector<rocsparse_int> hsell_slice_ptr_gold;
+    host_vector<rocsparse_int> hsell_row_perm_gold;
+    host_vector<rocsparse_int> hsell_col_ind_gold;
+    host_vector<T>             hsell_val_gold;
+    rocsparse_int              sell_nnz_gold;
+
+    host_csr_to_sell<rocsparse_int, rocsparse_int, T>(M,
+                                                      hcsr_row_ptr,
+                                                      hcsr_col_ind,
+                                                      hcsr_val,
+                                                      slice_size,
+                                                      sigma,
+                                                      hsell_slice_ptr_gold,
+                                                      hsell_row_perm_gold,
+                                                      hsell_col_ind_gold,
+                                                      hsell_val_gold,
+                                                      sell_nnz_gold,
+                                                      baseA,
+                                                      baseB);
+
+    if(rocsparse_footprint_only())
+    {
+        rocsparse_footprint fp = rocsparse_footprint_sell(
+            M, nslices, sell_nnz_gold, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "C",
+                            slice_size,
+                            "sigma",
+                            sigma,
+                            "SELL nnz",
+                            fp.stored,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer);
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dsell_slice_ptr(nslices + 1);
+    device_vector<rocsparse_int> dsell_row_perm(M);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_row_perm)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Obtain slice pointers and row permutation, the number of stored entries is
+        // checked in both pointer modes
+        rocsparse_int                sell_nnz;
+        device_vector<rocsparse_int> dsell_nnz(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                     M,
+                                                     descrA,
+                                                     dcsr_row_ptr,
+                                                     descrB,
+                                                     slice_size,
+                                                     sigma,
+                                                     dsell_slice_ptr,
+                                                     dsell_row_perm,
+                                                     dsell_nnz));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                     M,
+                                                     descrA,
+                                                     dcsr_row_ptr,
+                                                     descrB,
+                                                     slice_size,
+                                                     sigma,
+                                                     dsell_slice_ptr,
+                                                     dsell_row_perm,
+                                                     &sell_nnz));
+
+        rocsparse_int sell_nnz_device;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&sell_nnz_device, dsell_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &sell_nnz_gold, &sell_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &sell_nnz_gold, &sell_nnz_device);
+
+        // Allocate device memory
+        device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+        device_vector<T>             dsell_val(sell_nnz);
+
+        if(!dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform SELL conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                    M,
+                                                    descrA,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    descrB,
+                                                    slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_row_perm,
+                                                    dsell_val,
+                                                    dsell_col_ind));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hsell_slice_ptr(nslices + 1);
+        host_vector<rocsparse_int> hsell_row_perm(M);
+        host_vector<rocsparse_int> hsell_col_ind(sell_nnz);
+        host_vector<T>             hsell_val(sell_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hsell_slice_ptr,
+                                  dsell_slice_ptr,
+                                  sizeof(rocsparse_int) * (nslices + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hsell_row_perm, dsell_row_perm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hsell_col_ind, dsell_col_ind, sizeof(rocsparse_int) * sell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_val, dsell_val, sizeof(T) * sell_nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, nslices + 1, 1, hsell_slice_ptr_gold, hsell_slice_ptr);
+        unit_check_general<rocsparse_int>(1, M, 1, hsell_row_perm_gold, hsell_row_perm);
+        unit_check_general<rocsparse_int>(1, sell_nnz, 1, hsell_col_ind_gold, hsell_col_ind);
+        unit_check_general<T>(1, sell_nnz, 1, hsell_val_gold, hsell_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int sell_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_row_ptr,
+                                                         descrB,
+                                                         slice_size,
+                                                         sigma,
+                                                         dsell_slice_ptr,
+                                                         dsell_row_perm,
+                                                         &sell_nnz));
+
+            device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+            device_vector<T>             dsell_val(sell_nnz);
+
+            if(!dsell_col_ind || !dsell_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                        M,
+                                                        descrA,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        descrB,
+                                                        slice_size,
+                                                        dsell_slice_ptr,
+                                                        dsell_row_perm,
+                                                        dsell_val,
+                                                        dsell_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_row_ptr,
+                                                         descrB,
+                                                         slice_size,
+                                                         sigma,
+                                                         dsell_slice_ptr,
+                                                         dsell_row_perm,
+                                                         &sell_nnz));
+
+            device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+            device_vector<T>             dsell_val(sell_nnz);
+
+            if(!dsell_col_ind || !dsell_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                        M,
+                                                        descrA,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        descrB,
+                                                        slice_size,
+                                                        dsell_slice_ptr,
+                                                        dsell_row_perm,
+                                                        dsell_val,
+                                                        dsell_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2sell_gbyte_count<T>(M, nslices, nnz, sell_nnz) / gpu_time_used * 1e6;
+
+        rocsparse_footprint fp = rocsparse_footprint_sell(
+            M, nslices, sell_nnz, nnz, sizeof(rocsparse_int), sizeof(T));
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "C",
+                            slice_size,
+                            "sigma",
+                            sigma,
+                            "SELL nnz",
+                            sell_nnz,
+                            "MB",
+                            fp.megabytes(),
+                            "padding",
+                            fp.padding(),
+                            "buffer",
+                            fp.buffer,
+                            "Mnnz/s",
+                            nnz / gpu_time_used,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csr2sell_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr2sell<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -27,6 +27,28 @@
 #include "auto_testing_bad_arg.hpp"
 #include "rocsparse_enum.hpp"
 
+// Device allocator counting the calls it receives
+struct csrcolor_counting_allocator
+{
+    int64_t allocs = 0;
+    int64_t frees  = 0;
+};
+
+static rocsparse_status
+    csrcolor_counting_alloc(void** ptr, size_t size, hipStream_t stream, void* user_data)
+{
+    ++static_cast<csrcolor_counting_allocator*>(user_data)->allocs;
+    return (hipMalloc(ptr, size) == hipSuccess) ? rocsparse_status_success
+                                                : rocsparse_status_memory_error;
+}
+
+static rocsparse_status csrcolor_counting_free(void* ptr, hipStream_t stream, void* user_data)
+{
+    ++static_cast<csrcolor_counting_allocator*>(user_data)->frees;
+    return (hipFree(ptr) == hipSuccess) ? rocsparse_status_success
+                                        : rocsparse_status_internal_error;
+}
+
 template <typename T>
 void testing_csrcolor_bad_arg(const Arguments& arg)
 {
@@ -90,6 +112,34 @@ void testing_csrcolor_bad_arg(const Arguments& arg)
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
 
 #undef PARAMS
+
+#define PARAMS                                                                            \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, fraction_to_color, ncolors, \
+        coloring, info
+
+    auto_testing_bad_arg(rocsparse_csrcolor_async<T>, PARAMS);
+
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_async<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS
+
+    //
+    // Synchronization counter.
+    //
+    int64_t sync_count;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_sync_count(nullptr, &sync_count),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_sync_count(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -293,6 +343,89 @@ void testing_csrcolor(const Arguments& arg)
                                         rocsparse_status_success);
             }
         }
+
+        //
+        // fraction_to_color and ncolors are host pointers in both pointer modes.
+        //
+        {
+            rocsparse_int ncolor_device_mode;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                        dA.m,
+                                                        dA.nnz,
+                                                        csr_descr,
+                                                        dA.val,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        &fraction_to_color,
+                                                        &ncolor_device_mode,
+                                                        dcoloring,
+                                                        nullptr,
+                                                        mat_info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            host_dense_vector<rocsparse_int> hcoloring_device_mode(dcoloring);
+            unit_check_general<rocsparse_int>(1, 1, 1, &ncolor, &ncolor_device_mode);
+            unit_check_general<rocsparse_int>(1, M, 1, hcoloring, hcoloring_device_mode);
+        }
+
+        //
+        // rocsparse_csrcolor_async must not synchronize the host, neither explicitly nor
+        // by releasing device memory.
+        //
+        {
+            csrcolor_counting_allocator counter;
+            device_dense_vector<floating_data_t<T>> dfraction_to_color(1);
+            device_dense_vector<rocsparse_int>      dncolor(1);
+            CHECK_HIP_ERROR(hipMemcpy(dfraction_to_color,
+                                      &fraction_to_color,
+                                      sizeof(floating_data_t<T>),
+                                      hipMemcpyHostToDevice));
+
+            int64_t sync_count_before;
+            int64_t sync_count_after;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(
+                handle, csrcolor_counting_alloc, csrcolor_counting_free, &counter));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_before));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_async<T>(handle,
+                                                              dA.m,
+                                                              dA.nnz,
+                                                              csr_descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              dfraction_to_color,
+                                                              dncolor,
+                                                              dcoloring,
+                                                              mat_info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_sync_count(handle, &sync_count_after));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(handle, nullptr, nullptr, nullptr));
+
+            int device_id;
+            int cooperative_launch;
+            CHECK_HIP_ERROR(hipGetDevice(&device_id));
+            CHECK_HIP_ERROR(hipDeviceGetAttribute(
+                &cooperative_launch, hipDeviceAttributeCooperativeLaunch, device_id));
+            if(cooperative_launch)
+            {
+                unit_check_general<int64_t>(1, 1, 1, &sync_count_before, &sync_count_after);
+            }
+
+            int64_t zero = 0;
+            unit_check_general<int64_t>(1, 1, 1, &zero, &counter.allocs);
+            unit_check_general<int64_t>(1, 1, 1, &zero, &counter.frees);
+
+            //
+            // Both routines run the coloring rounds until the same fraction of nodes is
+            // colored, such that they agree on the number of colors and on the coloring.
+            //
+            host_dense_vector<rocsparse_int> hcoloring_async(dcoloring);
+            host_dense_vector<rocsparse_int> hncolor(dncolor);
+
+            unit_check_general<rocsparse_int>(1, 1, 1, &ncolor, hncolor);
+            unit_check_general<rocsparse_int>(1, M, 1, hcoloring, hcoloring_async);
+        }
     }
 
     if(arg.timing)
@@ -1108,23 +1108,32 @@ void testing_csrgeam(const Arguments& arg)
         double gpu_gbyte = csrgeam_gbyte_count<T>(M, nnz_A, nnz_B, nnz_C, &h_alpha, &h_beta)
                            / gpu_solve_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz_A"
-                  << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C" << std::setw(12)
-                  << "alpha" << std::setw(12) << "beta" << std::setw(12) << "GFlop/s"
-                  << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec" << std::setw(16)
-                  << "gemm msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
-                  << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz_A
-                  << std::setw(12) << nnz_B << std::setw(12) << nnz_C << std::setw(12) << h_alpha
-                  << std::setw(12) << h_beta << std::setw(12) << gpu_gflops << std::setw(12)
-                  << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
-                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz_A",
+                            nnz_A,
+                            "nnz_B",
+                            nnz_B,
+                            "nnz_C",
+                            nnz_C,
+                            "alpha",
+                            h_alpha,
+                            "beta",
+                            h_beta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "nnz msec",
+                            gpu_analysis_time_used / 1e3,
+                            "gemm msec",
+                            gpu_solve_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
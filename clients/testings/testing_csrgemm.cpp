@@ -2926,42 +2926,63 @@ void testing_csrgemm(const Arguments& arg)
             = csrgemm_gbyte_count(M, N, K, nnz_A, nnz_B, hnnz_C_1, nnz_D, halpha_ptr, hbeta_ptr)
               / gpu_solve_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "opA" << std::setw(12) << "opB" << std::setw(12) << "M"
-                  << std::setw(12) << "N" << std::setw(12) << "K" << std::setw(12) << "nnz_A"
-                  << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C" << std::setw(12)
-                  << "nnz_D" << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
-                  << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec"
-                  << std::setw(16) << "gemm msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
-
-        std::cout << std::setw(12) << rocsparse_operation2string(transA) << std::setw(12)
-                  << rocsparse_operation2string(transB) << std::setw(12) << M << std::setw(12) << N
-                  << std::setw(12) << K << std::setw(12) << nnz_A << std::setw(12) << nnz_B
-                  << std::setw(12) << hnnz_C_1 << std::setw(12) << nnz_D;
+        // alpha and beta are only meaningful in some scenarios
+        std::ostringstream alpha_str, beta_str;
+        alpha_str.precision(2);
+        alpha_str.setf(std::ios::fixed);
+        beta_str.precision(2);
+        beta_str.setf(std::ios::fixed);
         if(scenario == 2 || scenario == 4)
         {
-            std::cout << std::setw(12) << h_alpha;
+            alpha_str << h_alpha;
         }
         else
         {
-            std::cout << std::setw(12) << "null";
+            alpha_str << "null";
         }
         if(scenario == 3 || scenario == 4)
         {
-            std::cout << std::setw(12) << h_beta;
+            beta_str << h_beta;
         }
         else
         {
-            std::cout << std::setw(12) << "null";
+            beta_str << "null";
         }
-        std::cout << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(16)
-                  << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        display_timing_info("opA",
+                            rocsparse_operation2string(transA),
+                            "opB",
+                            rocsparse_operation2string(transB),
+                            "M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz_A",
+                            nnz_A,
+                            "nnz_B",
+                            nnz_B,
+                            "nnz_C",
+                            hnnz_C_1,
+                            "nnz_D",
+                            nnz_D,
+                            "alpha",
+                            alpha_str.str(),
+                            "beta",
+                            beta_str.str(),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "nnz msec",
+                            gpu_analysis_time_used / 1e3,
+                            "gemm msec",
+                            gpu_solve_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 
     // Free buffer
@@ -78,7 +78,7 @@ void testing_csrmv_bad_arg(const Arguments& arg)
 
     for(auto matrix_type : rocsparse_matrix_type_t::values)
     {
-        if(matrix_type != rocsparse_matrix_type_general)
+        if(matrix_type == rocsparse_matrix_type_triangular)
         {
             CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(PARAMS_ANALYSIS),
@@ -87,6 +87,18 @@ void testing_csrmv_bad_arg(const Arguments& arg)
         }
     }
 
+    // Symmetric and hermitian matrices have to be square
+    n = m + 1;
+    for(auto matrix_type : {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(PARAMS_ANALYSIS),
+                                rocsparse_status_invalid_size);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv<T>(PARAMS), rocsparse_status_invalid_size);
+    }
+    n = m;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
 #undef PARAMS_ANALYSIS
 #undef PARAMS
 }
@@ -176,11 +188,15 @@ void testing_csrmv(const Arguments& arg)
     matrix_factory.init_csr(hA, M, N);
     device_csr_matrix<T> dA(hA);
 
-    host_dense_matrix<T> hx(N, 1);
+    // Transposed operations swap the dimensions of x and y
+    rocsparse_int x_size = (trans == rocsparse_operation_none) ? N : M;
+    rocsparse_int y_size = (trans == rocsparse_operation_none) ? M : N;
+
+    host_dense_matrix<T> hx(x_size, 1);
     rocsparse_matrix_utils::init_exact(hx);
     device_dense_matrix<T> dx(hx);
 
-    host_dense_matrix<T> hy(M, 1);
+    host_dense_matrix<T> hy(y_size, 1);
     rocsparse_matrix_utils::init_exact(hy);
     device_dense_matrix<T> dy(hy);
 
@@ -199,8 +215,19 @@ void testing_csrmv(const Arguments& arg)
         {
             host_dense_matrix<T> hy_copy(hy);
             // CPU csrmv
-            host_csrmv<rocsparse_int, rocsparse_int, T>(
-                M, hA.nnz, *h_alpha, hA.ptr, hA.ind, hA.val, hx, *h_beta, hy, base, adaptive);
+            host_csrmv<rocsparse_int, rocsparse_int, T>(trans,
+                                                        M,
+                                                        N,
+                                                        hA.nnz,
+                                                        *h_alpha,
+                                                        hA.ptr,
+                                                        hA.ind,
+                                                        hA.val,
+                                                        hx,
+                                                        *h_beta,
+                                                        hy,
+                                                        base,
+                                                        adaptive);
             hy.near_check(dy, tol);
             dy.transfer_from(hy_copy);
         }
@@ -210,6 +237,58 @@ void testing_csrmv(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
         CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
         hy.near_check(dy, tol);
+
+        // Symmetric and hermitian storage, only the triangle given by the fill mode is read
+        if(M == N)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, arg.uplo));
+
+            for(auto matrix_type :
+                {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+
+                for(auto op : rocsparse_operation_t::values)
+                {
+                    host_dense_matrix<T> hy_symm(hy);
+                    dy.transfer_from(hy);
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                             op,
+                                                             dA.m,
+                                                             dA.n,
+                                                             dA.nnz,
+                                                             h_alpha,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info,
+                                                             dx,
+                                                             h_beta,
+                                                             dy));
+
+                    host_csrmv_symmetric<rocsparse_int, rocsparse_int, T>(op,
+                                                                          M,
+                                                                          hA.nnz,
+                                                                          *h_alpha,
+                                                                          hA.ptr,
+                                                                          hA.ind,
+                                                                          hA.val,
+                                                                          hx,
+                                                                          *h_beta,
+                                                                          hy_symm,
+                                                                          matrix_type,
+                                                                          arg.uplo,
+                                                                          base);
+                    hy_symm.near_check(dy, tol);
+                }
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+            dy.transfer_from(hy);
+        }
     }
 
     if(arg.timing)
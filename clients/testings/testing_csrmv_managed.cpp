@@ -580,22 +580,28 @@ void testing_csrmv_managed(const Arguments& arg)
         double gpu_gbyte
             = csrmv_gbyte_count<T>(M, N, nnz, *beta != static_cast<T>(0)) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
-                  << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
-                  << "Algorithm" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
-                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
-                  << std::setw(12) << *alpha << std::setw(12) << *beta << std::setw(12)
-                  << (adaptive ? "adaptive" : "stream") << std::setw(12) << gpu_gflops
-                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            nnz,
+                            "alpha",
+                            *alpha,
+                            "beta",
+                            *beta,
+                            "Algorithm",
+                            (adaptive ? "adaptive" : "stream"),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 
     // If adaptive, clear analysis data
@@ -0,0 +1,193 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "csrmv_merge_path.h"
+
+// Compare the tile boundaries of the merge path search against a serial walk along the
+// merge path, where the end of a row is consumed before the entries of the next row
+template <typename I, typename J>
+static void testing_csrmv_merge_tiles_check(const I* ptr, J m, rocsparse_index_base base)
+{
+    I       nnz    = ptr[m] - base;
+    int64_t nitems = static_cast<int64_t>(m) + nnz;
+
+    // Tiny tiles, such that all kinds of boundaries are exercised, and the tile size of
+    // the device kernels
+    static constexpr int64_t tile_items[] = {1, 3, 64, CSRMV_MERGE_TILE_ITEMS};
+
+    for(int64_t items : tile_items)
+    {
+        int64_t ntiles = csrmv_merge_path_ntiles(m, nnz, items);
+
+        // Serial reference
+        std::vector<J> ref_row(ntiles + 1);
+        std::vector<I> ref_nnz(ntiles + 1);
+
+        J       row  = 0;
+        I       j    = 0;
+        int64_t tile = 0;
+
+        for(int64_t d = 0; d <= nitems; ++d)
+        {
+            if(d % items == 0 || d == nitems)
+            {
+                ref_row[tile] = row;
+                ref_nnz[tile] = j;
+                ++tile;
+            }
+
+            if(d < nitems)
+            {
+                if(j < ptr[row + 1] - base)
+                {
+                    ++j;
+                }
+                else
+                {
+                    ++row;
+                }
+            }
+        }
+
+        int64_t expected_tiles = ntiles + 1;
+        unit_check_general<int64_t>(1, 1, 1, &expected_tiles, &tile);
+
+        // Merge path search
+        std::vector<J> tile_row(ntiles + 1, -1);
+        std::vector<I> tile_nnz(ntiles + 1, -1);
+        csrmv_merge_path_tiles(m, nnz, ptr, base, items, tile_row.data(), tile_nnz.data());
+
+        unit_check_general<J>(1, ntiles + 1, 1, ref_row.data(), tile_row.data());
+        unit_check_general<I>(1, ntiles + 1, 1, ref_nnz.data(), tile_nnz.data());
+    }
+}
+
+template <typename T>
+void testing_csrmv_merge_tiles(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = false;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    // Quick return, the analysis does not compute tiles for empty matrices
+    if(M <= 0)
+    {
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        testing_csrmv_merge_tiles_check<rocsparse_int, rocsparse_int>(hA.ptr, M, base);
+
+        // 64 bit row pointers
+        const rocsparse_int* hptr = hA.ptr;
+        std::vector<int64_t> ptr64(hptr, hptr + M + 1);
+        testing_csrmv_merge_tiles_check<int64_t, rocsparse_int>(ptr64.data(), M, base);
+
+        // Synthetic row length patterns, covering empty rows, a few huge rows among tiny
+        // rows, matrices without entries and a single row holding all entries
+        std::vector<rocsparse_int> ptr(M + 1);
+
+        for(int pattern = 0; pattern < 4; ++pattern)
+        {
+            ptr[0] = base;
+            for(rocsparse_int i = 0; i < M; ++i)
+            {
+                rocsparse_int nnz_row = (i % 3 == 0) ? 0 : 2;
+
+                if(pattern == 1)
+                {
+                    nnz_row = (i % 997 == 0) ? 20000 : 1;
+                }
+                else if(pattern == 2)
+                {
+                    nnz_row = 0;
+                }
+                else if(pattern == 3)
+                {
+                    nnz_row = (i == M - 1) ? 5000 : 0;
+                }
+
+                ptr[i + 1] = ptr[i] + nnz_row;
+            }
+
+            testing_csrmv_merge_tiles_check<rocsparse_int, rocsparse_int>(ptr.data(), M, base);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        rocsparse_int nnz    = hA.nnz;
+        int64_t       ntiles = csrmv_merge_path_ntiles(M, nnz, CSRMV_MERGE_TILE_ITEMS);
+
+        std::vector<rocsparse_int> tile_row(ntiles + 1);
+        std::vector<rocsparse_int> tile_nnz(ntiles + 1);
+
+        double cpu_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            csrmv_merge_path_tiles(M,
+                                   nnz,
+                                   (const rocsparse_int*)hA.ptr,
+                                   base,
+                                   CSRMV_MERGE_TILE_ITEMS,
+                                   tile_row.data(),
+                                   tile_nnz.data());
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "tiles",
+                            ntiles,
+                            "msec",
+                            get_gpu_time_msec(cpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE) template void testing_csrmv_merge_tiles<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
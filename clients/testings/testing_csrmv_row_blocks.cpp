@@ -0,0 +1,177 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "csrmv_row_blocks.h"
+
+#include <thread>
+
+// Compare the row blocks of the multi-threaded builder against the serial reference
+template <typename I, typename J>
+static void testing_csrmv_row_blocks_check(const I* ptr, I m)
+{
+    // Serial reference
+    size_t size;
+    ComputeRowBlocks<I, J>((I*)nullptr, (J*)nullptr, size, ptr, m, false);
+
+    std::vector<I> row_blocks(size, 0);
+    std::vector<J> wg_ids(size, 0);
+    ComputeRowBlocks<I, J>(row_blocks.data(), wg_ids.data(), size, ptr, m, true);
+
+    // Use small chunks, such that the chunk boundaries are actually exercised
+    static constexpr int nchunks[]      = {1, 2, 3, 8};
+    static constexpr I   min_chunk_rows = 64;
+    int64_t              expected_size  = size;
+
+    for(int c : nchunks)
+    {
+        csrmv_row_blocks_builder<I, J> builder;
+
+        int64_t builder_size = builder.plan(ptr, m, c, min_chunk_rows);
+        unit_check_general<int64_t>(1, 1, 1, &expected_size, &builder_size);
+
+        std::vector<I> builder_row_blocks(size, -1);
+        std::vector<J> builder_wg_ids(size, -1);
+        builder.fill(ptr, builder_row_blocks.data(), builder_wg_ids.data());
+
+        unit_check_general<I>(1, size, 1, row_blocks.data(), builder_row_blocks.data());
+        unit_check_general<J>(1, size, 1, wg_ids.data(), builder_wg_ids.data());
+    }
+}
+
+template <typename T>
+void testing_csrmv_row_blocks(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = false;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Quick return, the analysis does not compute row blocks for empty matrices
+    if(M <= 0)
+    {
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        testing_csrmv_row_blocks_check<rocsparse_int, rocsparse_int>(hA.ptr, M);
+
+        // Synthetic row length patterns, covering short rows, long rows exceeding the
+        // block size and rows alternating between both
+        std::vector<rocsparse_int> ptr(M + 1);
+
+        for(int pattern = 0; pattern < 3; ++pattern)
+        {
+            ptr[0] = arg.baseA;
+            for(rocsparse_int i = 0; i < M; ++i)
+            {
+                rocsparse_int nnz_row = 3;
+
+                if(pattern == 1)
+                {
+                    nnz_row = (i % 17 == 0) ? 2000 : 5;
+                }
+                else if(pattern == 2)
+                {
+                    nnz_row = (i % 2 == 0) ? 700 : 1;
+                }
+
+                ptr[i + 1] = ptr[i] + nnz_row;
+            }
+
+            testing_csrmv_row_blocks_check<rocsparse_int, rocsparse_int>(ptr.data(), M);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+        int nthreads         = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+        size_t                     size = 0;
+        std::vector<rocsparse_int> row_blocks;
+        std::vector<rocsparse_int> wg_ids;
+
+        // Serial performance
+        double cpu_serial_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            ComputeRowBlocks<rocsparse_int, rocsparse_int>(
+                (rocsparse_int*)nullptr, (rocsparse_int*)nullptr, size, hA.ptr, M, false);
+            row_blocks.resize(size);
+            wg_ids.resize(size);
+            ComputeRowBlocks<rocsparse_int, rocsparse_int>(
+                row_blocks.data(), wg_ids.data(), size, hA.ptr, M, true);
+        }
+
+        cpu_serial_time_used = (get_time_us() - cpu_serial_time_used) / number_hot_calls;
+
+        // Multi-threaded performance
+        double cpu_builder_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            csrmv_row_blocks_builder<rocsparse_int, rocsparse_int> builder;
+
+            size = builder.plan(hA.ptr, M, nthreads);
+            row_blocks.resize(size);
+            wg_ids.resize(size);
+            builder.fill(hA.ptr, row_blocks.data(), wg_ids.data());
+        }
+
+        cpu_builder_time_used = (get_time_us() - cpu_builder_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            hA.nnz,
+                            "row blocks",
+                            size,
+                            "threads",
+                            nthreads,
+                            "serial msec",
+                            get_gpu_time_msec(cpu_serial_time_used),
+                            "parallel msec",
+                            get_gpu_time_msec(cpu_builder_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE) template void testing_csrmv_row_blocks<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
@@ -1282,30 +1282,40 @@ void testing_csrsm(const Arguments& arg)
         double gpu_gflops = csrsv_gflop_count(M, nnz, diag) / gpu_solve_time_used * 1e6 * nrhs;
         double gpu_gbyte  = csrsv_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6 * nrhs;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nrhs"
-                  << std::setw(12) << "alpha" << std::setw(12) << "pivot" << std::setw(16)
-                  << "op(A)" << std::setw(12) << "op(B)" << std::setw(12) << "diag_type"
-                  << std::setw(12) << "fill_mode" << std::setw(16) << "analysis_policy"
-                  << std::setw(16) << "solve_policy" << std::setw(12) << "GFlop/s" << std::setw(12)
-                  << "GB/s" << std::setw(16) << "analysis_msec" << std::setw(16) << "solve_msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
-
-        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nrhs
-                  << std::setw(12) << *h_alpha.val << std::setw(12)
-                  << std::min(*h_analysis_pivot.val, *h_solve_pivot.val) << std::setw(16)
-                  << rocsparse_operation2string(transA) << std::setw(12)
-                  << rocsparse_operation2string(transB) << std::setw(12)
-                  << rocsparse_diagtype2string(diag) << std::setw(12)
-                  << rocsparse_fillmode2string(uplo) << std::setw(16)
-                  << rocsparse_analysis2string(apol) << std::setw(16)
-                  << rocsparse_solve2string(spol) << std::setw(12) << gpu_gflops << std::setw(12)
-                  << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
-                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "nrhs",
+                            nrhs,
+                            "alpha",
+                            *h_alpha.val,
+                            "pivot",
+                            std::min(*h_analysis_pivot.val, *h_solve_pivot.val),
+                            "op(A)",
+                            rocsparse_operation2string(transA),
+                            "op(B)",
+                            rocsparse_operation2string(transB),
+                            "diag_type",
+                            rocsparse_diagtype2string(diag),
+                            "fill_mode",
+                            rocsparse_fillmode2string(uplo),
+                            "analysis_policy",
+                            rocsparse_analysis2string(apol),
+                            "solve_policy",
+                            rocsparse_solve2string(spol),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "analysis_msec",
+                            gpu_analysis_time_used / 1e3,
+                            "solve_msec",
+                            gpu_solve_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 
     // Clear csrsm meta data
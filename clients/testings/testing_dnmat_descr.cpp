@@ -109,6 +109,24 @@ void testing_dnmat_descr_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_values(A, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // rocsparse_dnmat_set_strided_batch
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(nullptr, 2, ld * cols),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(A, 0, ld * cols),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(A, 2, -1),
+                            rocsparse_status_invalid_size);
+
+    // rocsparse_dnmat_get_strided_batch
+    int     batch_count;
+    int64_t batch_stride;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_get_strided_batch(nullptr, &batch_count, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_get_strided_batch(A, nullptr, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_get_strided_batch(A, &batch_count, nullptr),
+                            rocsparse_status_invalid_pointer);
+
     // Destroy valid descriptor
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_dnmat_descr(A), rocsparse_status_success);
 }
@@ -83,6 +83,24 @@ void testing_dnvec_descr_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_values(x, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // rocsparse_dnvec_set_strided_batch
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(nullptr, 2, size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 0, size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 2, size - 1),
+                            rocsparse_status_invalid_size);
+
+    // rocsparse_dnvec_get_strided_batch
+    int     batch_count;
+    int64_t batch_stride;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(nullptr, &batch_count, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(x, nullptr, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(x, &batch_count, nullptr),
+                            rocsparse_status_invalid_pointer);
+
     // Destroy valid descriptor
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_dnvec_descr(x), rocsparse_status_success);
 }
@@ -183,18 +183,18 @@ void testing_dotci(const Arguments& arg)
         double gpu_gflops = doti_gflop_count(nnz) / gpu_time_used * 1e6;
         double gpu_gbyte  = doti_gbyte_count<T>(nnz) / gpu_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "nnz" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
-                  << std::setw(12) << "usec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
-
-        std::cout << std::setw(12) << nnz << std::setw(12) << gpu_gflops << std::setw(12)
-                  << gpu_gbyte << std::setw(12) << gpu_time_used << std::setw(12)
-                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
-                  << std::endl;
+        display_timing_info("nnz",
+                            nnz,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "usec",
+                            gpu_time_used,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
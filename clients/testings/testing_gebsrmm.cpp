@@ -247,7 +247,7 @@ void testing_gebsrmm(const Arguments& arg)
         //
         {
             host_dense_matrix<T> hC_copy(hC);
-            host_gebsrmm<T>(PARAMS(h_alpha, hA, hB, h_beta, hC));
+            host_gebsrmm<rocsparse_int, rocsparse_int, T>(PARAMS(h_alpha, hA, hB, h_beta, hC));
             hC.near_check(dC);
             dC.transfer_from(hC_copy);
         }
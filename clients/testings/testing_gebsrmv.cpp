@@ -198,21 +198,21 @@ void testing_gebsrmv(const Arguments& arg)
         {
             host_dense_matrix<T> hy_copy(hy);
             // CPU gebsrmv
-            host_gebsrmv<T>(hA.block_direction,
-                            trans,
-                            hA.mb,
-                            hA.nb,
-                            hA.nnzb,
-                            *h_alpha,
-                            hA.ptr,
-                            hA.ind,
-                            hA.val,
-                            hA.row_block_dim,
-                            hA.col_block_dim,
-                            hx,
-                            *h_beta,
-                            hy,
-                            base);
+            host_gebsrmv<rocsparse_int, rocsparse_int, T>(hA.block_direction,
+                                                          trans,
+                                                          hA.mb,
+                                                          hA.nb,
+                                                          hA.nnzb,
+                                                          *h_alpha,
+                                                          hA.ptr,
+                                                          hA.ind,
+                                                          hA.val,
+                                                          hA.row_block_dim,
+                                                          hA.col_block_dim,
+                                                          hx,
+                                                          *h_beta,
+                                                          hy,
+                                                          base);
             hy.near_check(dy, tol);
             dy.transfer_from(hy_copy);
         }
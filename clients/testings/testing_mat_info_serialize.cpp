@@ -0,0 +1,450 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_mat_info_serialize_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    rocsparse_int        m           = safe_size;
+    rocsparse_int        n           = safe_size;
+    rocsparse_int        nnz         = safe_size;
+    const rocsparse_int* csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int* csr_col_ind = (const rocsparse_int*)0x4;
+    size_t               buffer_size = safe_size;
+    char                 buffer[safe_size];
+
+#define PARAMS_SERIALIZE(handle_, m_, descr_, ptr_, info_, size_) \
+    handle_, m_, n, nnz, descr_, ptr_, csr_col_ind, info_, size_, buffer
+#define PARAMS_DESERIALIZE(handle_, m_, descr_, ptr_, info_, buffer_) \
+    handle_, m_, n, nnz, descr_, ptr_, csr_col_ind, info_, buffer_size, buffer_
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(PARAMS_SERIALIZE(
+                                nullptr, m, descr, csr_row_ptr, info, &buffer_size)),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(PARAMS_SERIALIZE(
+                                handle, -1, descr, csr_row_ptr, info, &buffer_size)),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(PARAMS_SERIALIZE(
+                                handle, m, nullptr, csr_row_ptr, info, &buffer_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(PARAMS_SERIALIZE(
+                                handle, m, descr, nullptr, info, &buffer_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(PARAMS_SERIALIZE(
+                                handle, m, descr, csr_row_ptr, nullptr, &buffer_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_serialize(
+                                PARAMS_SERIALIZE(handle, m, descr, csr_row_ptr, info, nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                nullptr, m, descr, csr_row_ptr, info, buffer)),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, -1, descr, csr_row_ptr, info, buffer)),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, m, nullptr, csr_row_ptr, info, buffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, m, descr, nullptr, info, buffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, m, descr, csr_row_ptr, nullptr, buffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, m, descr, csr_row_ptr, info, nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+    // Buffer does not hold serialized meta data
+    memset(buffer, 0, sizeof(buffer));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(PARAMS_DESERIALIZE(
+                                handle, m, descr, csr_row_ptr, info, buffer)),
+                            rocsparse_status_invalid_value);
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_mat_info_save(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_mat_info_load(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, nullptr),
+        rocsparse_status_invalid_pointer);
+
+#undef PARAMS_SERIALIZE
+#undef PARAMS_DESERIALIZE
+}
+
+template <typename T>
+void testing_mat_info_serialize(const Arguments& arg)
+{
+    auto                      tol  = get_near_check_tol<T>(arg);
+    rocsparse_int             M    = arg.M;
+    rocsparse_int             N    = arg.M;
+    rocsparse_index_base      base = arg.baseA;
+    rocsparse_analysis_policy apol = rocsparse_analysis_policy_reuse;
+    rocsparse_solve_policy    spol = rocsparse_solve_policy_auto;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Info that is analysed and info that is restored
+    rocsparse_local_mat_info info_analysed;
+    rocsparse_local_mat_info info_restored;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        size_t buffer_size;
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_mat_info_serialize(
+                handle, M, M, 0, descr, nullptr, nullptr, info_analysed, &buffer_size, nullptr),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(M, 1);
+    rocsparse_matrix_utils::init(hx);
+
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy_analysed(M, 1), dy_restored(M, 1);
+    device_dense_matrix<T> dz_analysed(M, 1), dz_restored(M, 1);
+
+    // Buffer for the triangular solve
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         dA.m,
+                                                         dA.nnz,
+                                                         descr,
+                                                         dA.val,
+                                                         dA.ptr,
+                                                         dA.ind,
+                                                         info_analysed,
+                                                         &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+#define PARAMS_CSRMV(info_, y_)                                                                   \
+    handle, rocsparse_operation_none, dA.m, dA.n, dA.nnz, h_alpha, descr, dA.val, dA.ptr, dA.ind, \
+        info_, dx, h_beta, y_
+#define PARAMS_ANALYSIS(info_)                                                                  \
+    handle, rocsparse_operation_none, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_, apol, \
+        spol, dbuffer
+#define PARAMS_SOLVE(info_, z_)                                                                    \
+    handle, rocsparse_operation_none, dA.m, dA.nnz, h_alpha, descr, dA.val, dA.ptr, dA.ind, info_, \
+        dx, z_, spol, dbuffer
+
+    // Analyse the matrix and serialize the meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      dA.m,
+                                                      dA.n,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      info_analysed));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(info_analysed)));
+
+    size_t info_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(
+        handle, dA.m, dA.n, dA.nnz, descr, dA.ptr, dA.ind, info_analysed, &info_size, nullptr));
+
+    std::vector<char> info_buffer(info_size);
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle,
+                                                       dA.m,
+                                                       dA.n,
+                                                       dA.nnz,
+                                                       descr,
+                                                       dA.ptr,
+                                                       dA.ind,
+                                                       info_analysed,
+                                                       &info_size,
+                                                       info_buffer.data()));
+
+    if(arg.unit_check)
+    {
+        // Truncated meta data is rejected
+        EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(handle,
+                                                               dA.m,
+                                                               dA.n,
+                                                               dA.nnz,
+                                                               descr,
+                                                               dA.ptr,
+                                                               dA.ind,
+                                                               info_restored,
+                                                               info_size - 1,
+                                                               info_buffer.data()),
+                                rocsparse_status_invalid_size);
+
+        // Meta data of a different sparsity pattern is rejected
+        {
+            host_csr_matrix<T> hB(hA);
+            hB.ind[0] += 1;
+            device_csr_matrix<T> dB(hB);
+
+            EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(handle,
+                                                                   dB.m,
+                                                                   dB.n,
+                                                                   dB.nnz,
+                                                                   descr,
+                                                                   dB.ptr,
+                                                                   dB.ind,
+                                                                   info_restored,
+                                                                   info_size,
+                                                                   info_buffer.data()),
+                                    rocsparse_status_invalid_value);
+        }
+    }
+
+    // Restore the meta data, the analysis is skipped due to the reuse policy
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_deserialize(handle,
+                                                         dA.m,
+                                                         dA.n,
+                                                         dA.nnz,
+                                                         descr,
+                                                         dA.ptr,
+                                                         dA.ind,
+                                                         info_restored,
+                                                         info_size,
+                                                         info_buffer.data()));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(info_restored)));
+
+    if(arg.unit_check)
+    {
+        // Meta data cannot be restored twice
+        EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_deserialize(handle,
+                                                               dA.m,
+                                                               dA.n,
+                                                               dA.nnz,
+                                                               descr,
+                                                               dA.ptr,
+                                                               dA.ind,
+                                                               info_restored,
+                                                               info_size,
+                                                               info_buffer.data()),
+                                rocsparse_status_invalid_value);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(info_analysed, dy_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMV(info_restored, dy_restored)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(info_analysed, dz_analysed)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(info_restored, dz_restored)));
+
+        // Results of the restored meta data must match
+        host_dense_matrix<T> hy_analysed(dy_analysed), hz_analysed(dz_analysed);
+        hy_analysed.near_check(dy_restored, tol);
+        hz_analysed.near_check(dz_restored, tol);
+
+        // Zero pivot must match
+        host_scalar<rocsparse_int> h_pivot_analysed, h_pivot_restored;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrsv_zero_pivot(handle, descr, info_restored, h_pivot_restored),
+            rocsparse_csrsv_zero_pivot(handle, descr, info_analysed, h_pivot_analysed));
+        unit_check_general<rocsparse_int>(1, 1, 1, h_pivot_analysed, h_pivot_restored);
+
+        // Meta data of a transposed operation holds the CSC structure instead of row blocks
+        {
+            rocsparse_local_mat_info info_t_analysed;
+            rocsparse_local_mat_info info_t_restored;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                              rocsparse_operation_transpose,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info_t_analysed));
+
+            size_t info_t_size;
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle,
+                                                               dA.m,
+                                                               dA.n,
+                                                               dA.nnz,
+                                                               descr,
+                                                               dA.ptr,
+                                                               dA.ind,
+                                                               info_t_analysed,
+                                                               &info_t_size,
+                                                               nullptr));
+
+            std::vector<char> info_t_buffer(info_t_size);
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle,
+                                                               dA.m,
+                                                               dA.n,
+                                                               dA.nnz,
+                                                               descr,
+                                                               dA.ptr,
+                                                               dA.ind,
+                                                               info_t_analysed,
+                                                               &info_t_size,
+                                                               info_t_buffer.data()));
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_deserialize(handle,
+                                                                 dA.m,
+                                                                 dA.n,
+                                                                 dA.nnz,
+                                                                 descr,
+                                                                 dA.ptr,
+                                                                 dA.ind,
+                                                                 info_t_restored,
+                                                                 info_t_size,
+                                                                 info_t_buffer.data()));
+
+#define PARAMS_CSRMVT(info_, y_)                                                               \
+    handle, rocsparse_operation_transpose, dA.m, dA.n, dA.nnz, h_alpha, descr, dA.val, dA.ptr, \
+        dA.ind, info_, dx, h_beta, y_
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMVT(info_t_analysed, dy_analysed)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS_CSRMVT(info_t_restored, dy_restored)));
+
+#undef PARAMS_CSRMVT
+
+            host_dense_matrix<T> hyt_analysed(dy_analysed);
+            hyt_analysed.near_check(dy_restored, tol);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        // Analysis
+        double gpu_analysis_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(info)));
+        }
+
+        gpu_analysis_time_used = (get_time_us() - gpu_analysis_time_used) / number_hot_calls;
+
+        // Deserialization
+        double gpu_restore_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_deserialize(handle,
+                                                                 dA.m,
+                                                                 dA.n,
+                                                                 dA.nnz,
+                                                                 descr,
+                                                                 dA.ptr,
+                                                                 dA.ind,
+                                                                 info,
+                                                                 info_size,
+                                                                 info_buffer.data()));
+        }
+
+        gpu_restore_time_used = (get_time_us() - gpu_restore_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "bytes",
+                            info_size,
+                            "analysis msec",
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            "deserialize msec",
+                            get_gpu_time_msec(gpu_restore_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS_CSRMV
+#undef PARAMS_ANALYSIS
+#undef PARAMS_SOLVE
+}
+
+#define INSTANTIATE(TYPE)                                                         \
+    template void testing_mat_info_serialize_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_mat_info_serialize<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
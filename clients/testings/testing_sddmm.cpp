@@ -26,6 +26,116 @@
 
 #include "testing_sddmm_dispatch.hpp"
 
+//
+// SDDMM is not implemented for the SELL, BSR and CSR16 formats, make sure
+// every stage of the API reports it.
+//
+template <typename I, typename J, typename T>
+static void testing_sddmm_not_implemented(rocsparse_format format)
+{
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle      = local_handle;
+    rocsparse_operation trans_A     = rocsparse_operation_none;
+    rocsparse_operation trans_B     = rocsparse_operation_none;
+    const void*         p_alpha     = (const void*)&alpha;
+    const void*         p_beta      = (const void*)&beta;
+    rocsparse_sddmm_alg alg         = rocsparse_sddmm_alg_default;
+    size_t              buffer_size = 0;
+    void*               temp_buffer = (void*)0x4;
+    rocsparse_datatype  ttype       = get_datatype<T>();
+    rocsparse_order     order       = rocsparse_order_column;
+
+    // Descriptors only hold the pointers, nothing is dereferenced
+    void* ptr = (void*)0x4;
+
+    rocsparse_local_dnmat A(2, 2, 2, ptr, ttype, order);
+    rocsparse_local_dnmat B(2, 2, 2, ptr, ttype, order);
+
+    rocsparse_spmat_descr C = nullptr;
+    switch(format)
+    {
+    case rocsparse_format_sell:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_sell_descr(&C,
+                                                          2,
+                                                          2,
+                                                          1,
+                                                          2,
+                                                          2,
+                                                          ptr,
+                                                          ptr,
+                                                          ptr,
+                                                          ptr,
+                                                          get_indextype<I>(),
+                                                          rocsparse_index_base_zero,
+                                                          ttype));
+        break;
+    }
+
+    case rocsparse_format_bsr:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_bsr_descr(&C,
+                                                         1,
+                                                         1,
+                                                         1,
+                                                         rocsparse_direction_row,
+                                                         2,
+                                                         2,
+                                                         ptr,
+                                                         ptr,
+                                                         ptr,
+                                                         get_indextype<I>(),
+                                                         get_indextype<J>(),
+                                                         rocsparse_index_base_zero,
+                                                         ttype));
+        break;
+    }
+
+    case rocsparse_format_csr16:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_csr16_descr(&C,
+                                                           2,
+                                                           2,
+                                                           1,
+                                                           0,
+                                                           ptr,
+                                                           ptr,
+                                                           ptr,
+                                                           ptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           get_indextype<I>(),
+                                                           rocsparse_index_base_zero,
+                                                           ttype));
+        break;
+    }
+
+    default:
+    {
+        return;
+    }
+    }
+
+#define PARAMS_BUFFER_SIZE \
+    handle, trans_A, trans_B, p_alpha, A, B, p_beta, C, ttype, alg, &buffer_size
+#define PARAMS handle, trans_A, trans_B, p_alpha, A, B, p_beta, C, ttype, alg, temp_buffer
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_buffer_size(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_preprocess(PARAMS), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(C));
+}
+
 template <typename I, typename J, typename T>
 void testing_sddmm_bad_arg(const Arguments& arg)
 {
@@ -60,6 +170,14 @@ void testing_sddmm_bad_arg(const Arguments& arg)
         testing_sddmm_dispatch<rocsparse_format_ell, I, I, T>::testing_sddmm_bad_arg(arg);
         return;
     }
+
+    case rocsparse_format_sell:
+    case rocsparse_format_bsr:
+    case rocsparse_format_csr16:
+    {
+        testing_sddmm_not_implemented<I, J, T>(arg.format);
+        return;
+    }
     }
 }
 
@@ -99,6 +217,14 @@ void testing_sddmm(const Arguments& arg)
         testing_sddmm_dispatch<rocsparse_format_ell, I, I, T>::testing_sddmm(arg);
         return;
     }
+
+    case rocsparse_format_sell:
+    case rocsparse_format_bsr:
+    case rocsparse_format_csr16:
+    {
+        testing_sddmm_not_implemented<I, J, T>(arg.format);
+        return;
+    }
     }
 }
 
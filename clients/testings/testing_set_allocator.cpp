@@ -0,0 +1,457 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <map>
+
+// Test double of a device allocator, counting the calls it receives
+struct counting_allocator
+{
+    int64_t allocs = 0;
+    int64_t frees  = 0;
+    bool    fail   = false;
+
+    // Live allocations and their sizes
+    std::map<void*, size_t> live;
+};
+
+static rocsparse_status counting_alloc(void** ptr, size_t size, hipStream_t stream, void* user_data)
+{
+    counting_allocator* counter = static_cast<counting_allocator*>(user_data);
+
+    if(counter->fail)
+    {
+        return rocsparse_status_memory_error;
+    }
+
+    if(hipMalloc(ptr, size) != hipSuccess)
+    {
+        return rocsparse_status_memory_error;
+    }
+
+    ++counter->allocs;
+    counter->live[*ptr] = size;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status counting_free(void* ptr, hipStream_t stream, void* user_data)
+{
+    counting_allocator* counter = static_cast<counting_allocator*>(user_data);
+
+    // Memory must only be returned to the allocator it came from
+    if(counter->live.erase(ptr) != 1)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    ++counter->frees;
+
+    return (hipFree(ptr) == hipSuccess) ? rocsparse_status_success
+                                        : rocsparse_status_internal_error;
+}
+
+template <typename T>
+void testing_set_allocator_bad_arg(const Arguments& arg)
+{
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    counting_allocator counter;
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_set_allocator(nullptr, counting_alloc, counting_free, &counter),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_allocator(handle, counting_alloc, nullptr, &counter),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_allocator(handle, nullptr, counting_free, &counter),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_memory_pool_size(nullptr, 1024),
+                            rocsparse_status_invalid_handle);
+
+    size_t  used;
+    size_t  cached;
+    size_t  high_water;
+    int64_t hits;
+    int64_t misses;
+
+#define PARAMS(handle_, used_, cached_, high_water_, hits_, misses_) \
+    handle_, used_, cached_, high_water_, hits_, misses_
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_pool_info(
+                                PARAMS(nullptr, &used, &cached, &high_water, &hits, &misses)),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_pool_info(
+                                PARAMS(handle, nullptr, &cached, &high_water, &hits, &misses)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_pool_info(
+                                PARAMS(handle, &used, nullptr, &high_water, &hits, &misses)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_memory_pool_info(PARAMS(handle, &used, &cached, nullptr, &hits, &misses)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_pool_info(
+                                PARAMS(handle, &used, &cached, &high_water, nullptr, &misses)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_pool_info(
+                                PARAMS(handle, &used, &cached, &high_water, &hits, nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_set_allocator(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Pool capacity in bytes
+    static constexpr size_t pool_size = 64 * 1024 * 1024;
+
+    const floating_data_t<T> fraction_to_color = static_cast<floating_data_t<T>>(1);
+
+    // The allocator has to outlive the handle, which releases its pool with it
+    counting_allocator counter;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, 0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_set_allocator(handle, counting_alloc, counting_free, &counter));
+
+    size_t  used;
+    size_t  cached;
+    size_t  high_water;
+    int64_t hits;
+    int64_t misses;
+
+    // Expected allocator and pool statistics
+    int64_t expected_count;
+    size_t  expected_bytes;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        rocsparse_local_mat_info info;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(handle,
+                                                            rocsparse_operation_none,
+                                                            M,
+                                                            M,
+                                                            0,
+                                                            descr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            info),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+
+        // Quick return does not allocate
+        expected_count = 0;
+        unit_check_general<int64_t>(1, 1, 1, &expected_count, &counter.allocs);
+
+        return;
+    }
+
+    // Sample matrix, symmetric for coloring
+    host_csr_matrix<T> hA;
+
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        host_csr_matrix<T>          nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    device_csr_matrix<T>               dA(hA);
+    device_dense_vector<rocsparse_int> dcoloring(hA.m);
+    device_dense_vector<rocsparse_int> dreordering(hA.m);
+
+    // User buffer of the triangular solve, not allocated by the library
+    size_t buffer_size;
+    {
+        rocsparse_local_mat_info info;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                             rocsparse_operation_none,
+                                                             dA.m,
+                                                             dA.nnz,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info,
+                                                             &buffer_size));
+    }
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    rocsparse_int ncolors;
+
+#define PARAMS_MV_ANALYSIS(info_) \
+    handle, rocsparse_operation_none, dA.m, dA.n, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_
+#define PARAMS_SV_ANALYSIS(info_)                                                         \
+    handle, rocsparse_operation_none, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_, \
+        rocsparse_analysis_policy_force, rocsparse_solve_policy_auto, dbuffer
+#define PARAMS_CSR2HYB(hyb_) \
+    handle, dA.m, dA.n, descr, dA.val, dA.ptr, dA.ind, hyb_, 0, rocsparse_hyb_partition_auto
+#define PARAMS_CSRCOLOR(info_)                                                         \
+    handle, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, &fraction_to_color, &ncolors, \
+        dcoloring, dreordering, info_
+
+    // Number of allocations per routine
+    int64_t allocs_csrmv;
+    int64_t allocs_csrsv;
+    int64_t allocs_csr2hyb;
+    int64_t allocs_csrcolor;
+
+    {
+        rocsparse_local_mat_info info_mv;
+        rocsparse_local_mat_info info_sv;
+        rocsparse_local_mat_info info_color;
+        rocsparse_local_hyb_mat  hyb;
+
+        int64_t allocs = counter.allocs;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info_mv)));
+        allocs_csrmv = counter.allocs - allocs;
+
+        allocs = counter.allocs;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_SV_ANALYSIS(info_sv)));
+        allocs_csrsv = counter.allocs - allocs;
+
+        allocs = counter.allocs;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(PARAMS_CSR2HYB(hyb)));
+        allocs_csr2hyb = counter.allocs - allocs;
+
+        allocs = counter.allocs;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info_color)));
+        allocs_csrcolor = counter.allocs - allocs;
+
+        if(arg.unit_check)
+        {
+            // Row map, diagonal indices and zero pivot
+            expected_count = 3;
+            unit_check_general<int64_t>(1, 1, 1, &expected_count, &allocs_csrsv);
+
+            EXPECT_ROCSPARSE_STATUS(
+                (allocs_csr2hyb > 0 && allocs_csrcolor > 0) ? rocsparse_status_success
+                                                            : rocsparse_status_internal_error,
+                rocsparse_status_success);
+
+            // Failing allocations are reported to the caller
+            counter.fail = true;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb<T>(PARAMS_CSR2HYB(hyb)),
+                                    rocsparse_status_memory_error);
+            counter.fail = false;
+        }
+    }
+
+    if(arg.unit_check)
+    {
+        // All meta data has been released with the allocator it came from
+        unit_check_general<int64_t>(1, 1, 1, &counter.allocs, &counter.frees);
+
+        size_t expected_live = 0;
+        size_t live          = counter.live.size();
+        unit_check_general<size_t>(1, 1, 1, &expected_live, &live);
+
+        // Analysis cache entries are allocated with the allocator of the handle
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, pool_size));
+
+        {
+            rocsparse_local_mat_info info;
+
+            int64_t allocs = counter.allocs;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(PARAMS_MV_ANALYSIS(info)));
+            allocs = counter.allocs - allocs;
+
+            EXPECT_ROCSPARSE_STATUS((allocs > allocs_csrmv) ? rocsparse_status_success
+                                                            : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+        }
+
+        size_t  cache_size;
+        size_t  cache_used;
+        int64_t cache_hits;
+        int64_t cache_misses;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_analysis_cache_info(
+            handle, &cache_size, &cache_used, &cache_hits, &cache_misses));
+
+        // The entry outlives the info structure
+        live = counter.live.size();
+        EXPECT_ROCSPARSE_STATUS((cache_used > 0 && live > 0) ? rocsparse_status_success
+                                                             : rocsparse_status_internal_error,
+                                rocsparse_status_success);
+
+        // Disabling the cache returns its memory to the allocator
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+        unit_check_general<int64_t>(1, 1, 1, &counter.allocs, &counter.frees);
+
+        live = counter.live.size();
+        unit_check_general<size_t>(1, 1, 1, &expected_live, &live);
+
+        // Repeated calls are served by the memory pool
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, pool_size));
+
+        int64_t allocs = counter.allocs;
+
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info)));
+        }
+
+        int64_t allocs_first = counter.allocs - allocs;
+
+        allocs = counter.allocs;
+
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info)));
+        }
+
+        // The second call does not reach the allocator
+        expected_count = 0;
+        allocs         = counter.allocs - allocs;
+        unit_check_general<int64_t>(1, 1, 1, &expected_count, &allocs);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_pool_info(
+            handle, &used, &cached, &high_water, &hits, &misses));
+
+        // Each request is either a hit or a miss, misses are passed to the allocator
+        expected_count = 2 * allocs_csrcolor;
+        int64_t served = hits + misses;
+        unit_check_general<int64_t>(1, 1, 1, &expected_count, &served);
+        unit_check_general<int64_t>(1, 1, 1, &allocs_first, &misses);
+
+        expected_bytes = 0;
+        unit_check_general<size_t>(1, 1, 1, &expected_bytes, &used);
+        EXPECT_ROCSPARSE_STATUS((cached > 0 && high_water >= cached)
+                                    ? rocsparse_status_success
+                                    : rocsparse_status_internal_error,
+                                rocsparse_status_success);
+
+        // Disabling the pool returns all cached memory to the allocator
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, 0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_pool_info(
+            handle, &used, &cached, &high_water, &hits, &misses));
+
+        unit_check_general<size_t>(1, 1, 1, &expected_bytes, &cached);
+        unit_check_general<int64_t>(1, 1, 1, &counter.allocs, &counter.frees);
+    }
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        // Coloring without pool
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(handle, nullptr, nullptr, nullptr));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, 0));
+
+        double gpu_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // Coloring served by the pool
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, pool_size));
+
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info)));
+        }
+
+        double gpu_pooled_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_local_mat_info info;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(PARAMS_CSRCOLOR(info)));
+        }
+
+        gpu_pooled_time_used = (get_time_us() - gpu_pooled_time_used) / number_hot_calls;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_pool_info(
+            handle, &used, &cached, &high_water, &hits, &misses));
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "allocs csrmv",
+                            allocs_csrmv,
+                            "allocs csrsv",
+                            allocs_csrsv,
+                            "allocs csr2hyb",
+                            allocs_csr2hyb,
+                            "allocs csrcolor",
+                            allocs_csrcolor,
+                            "pool bytes",
+                            high_water,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "pooled msec",
+                            get_gpu_time_msec(gpu_pooled_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    // Restore the default allocator before the counter goes out of scope
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_pool_size(handle, 0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(handle, nullptr, nullptr, nullptr));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS_MV_ANALYSIS
+#undef PARAMS_SV_ANALYSIS
+#undef PARAMS_CSR2HYB
+#undef PARAMS_CSRCOLOR
+}
+
+#define INSTANTIATE(TYPE)                                                    \
+    template void testing_set_allocator_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_set_allocator<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
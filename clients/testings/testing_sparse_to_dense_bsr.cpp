@@ -0,0 +1,326 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename J, typename T>
+void testing_sparse_to_dense_bsr_bad_arg(const Arguments& arg)
+{
+    J mb            = 10;
+    J nb            = 10;
+    I nnzb          = 10;
+    J row_block_dim = 2;
+    J col_block_dim = 3;
+    I ld            = mb * row_block_dim;
+
+    rocsparse_index_base          base  = rocsparse_index_base_zero;
+    rocsparse_direction           dir   = rocsparse_direction_row;
+    rocsparse_sparse_to_dense_alg alg   = rocsparse_sparse_to_dense_alg_default;
+    rocsparse_order               order = rocsparse_order_column;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    device_vector<T> d_dense_val(ld * nb * col_block_dim);
+    device_vector<I> d_bsr_row_ptr(mb + 1);
+    device_vector<J> d_bsr_col_ind(nnzb);
+    device_vector<T> d_bsr_val(nnzb * row_block_dim * col_block_dim);
+
+    if(!d_dense_val || !d_bsr_row_ptr || !d_bsr_col_ind || !d_bsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Sparse and dense matrix structures
+    rocsparse_local_spmat mat_A(mb,
+                                nb,
+                                nnzb,
+                                dir,
+                                row_block_dim,
+                                col_block_dim,
+                                d_bsr_row_ptr,
+                                d_bsr_col_ind,
+                                d_bsr_val,
+                                itype,
+                                jtype,
+                                base,
+                                ttype);
+    rocsparse_local_dnmat mat_B(
+        mb * row_block_dim, nb * col_block_dim, ld, d_dense_val, ttype, order);
+
+    size_t buffer_size;
+
+    // Testing invalid handle.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(nullptr, mat_A, mat_B, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_handle);
+
+    // Testing invalid pointers.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, nullptr, mat_B, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, mat_A, nullptr, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, nullptr, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Testing invalid descriptor creation.
+    rocsparse_spmat_descr descr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_bsr_descr(&descr,
+                                                       mb,
+                                                       nb,
+                                                       nnzb,
+                                                       dir,
+                                                       0,
+                                                       col_block_dim,
+                                                       d_bsr_row_ptr,
+                                                       d_bsr_col_ind,
+                                                       d_bsr_val,
+                                                       itype,
+                                                       jtype,
+                                                       base,
+                                                       ttype),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_bsr_descr(&descr,
+                                                       mb,
+                                                       nb,
+                                                       nnzb,
+                                                       dir,
+                                                       row_block_dim,
+                                                       col_block_dim,
+                                                       nullptr,
+                                                       d_bsr_col_ind,
+                                                       d_bsr_val,
+                                                       itype,
+                                                       jtype,
+                                                       base,
+                                                       ttype),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename I, typename J, typename T>
+void testing_sparse_to_dense_bsr(const Arguments& arg)
+{
+    J                             M             = arg.M;
+    J                             N             = arg.N;
+    I                             ld            = arg.denseld;
+    J                             row_block_dim = arg.row_block_dimA;
+    J                             col_block_dim = arg.col_block_dimA;
+    rocsparse_index_base          base          = arg.baseA;
+    rocsparse_sparse_to_dense_alg alg           = arg.sparse_to_dense_alg;
+    rocsparse_order               order         = arg.order;
+
+    J Mb = (M + row_block_dim - 1) / row_block_dim;
+    J Nb = (N + col_block_dim - 1) / col_block_dim;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || Nb <= 0)
+    {
+        // Check conversion when structures can be created
+        if(Mb == 0 && Nb == 0)
+        {
+            device_gebsr_matrix<T, I, J> dA;
+            device_dense_matrix<T>       dB(0, 0, order);
+
+            rocsparse_local_spmat mat_A(dA);
+            rocsparse_local_dnmat mat_B(dB);
+
+            size_t buffer_size;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, &buffer_size, nullptr),
+                rocsparse_status_success);
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, &buffer_size, dbuffer),
+                rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Sample matrix, sizes are returned in number of blocks
+    host_gebsr_matrix<T, I, J>        hA;
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+    matrix_factory.init_gebsr(hA, Mb, Nb, base);
+
+    M = hA.mb * hA.row_block_dim;
+    N = hA.nb * hA.col_block_dim;
+
+    I mn = (order == rocsparse_order_column) ? M : N;
+    I nm = (order == rocsparse_order_column) ? N : M;
+
+    // Leading dimension too small for the dense matrix
+    if(ld < mn)
+    {
+        return;
+    }
+
+    device_gebsr_matrix<T, I, J> dA(hA);
+
+    // Allocate memory, padding entries are set to a sentinel value
+    host_vector<T>   h_dense_val(ld * nm, static_cast<T>(-2));
+    device_vector<T> d_dense_val(ld * nm);
+
+    if(!d_dense_val || !h_dense_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_dense_val, h_dense_val, sizeof(T) * ld * nm, hipMemcpyHostToDevice));
+
+    rocsparse_local_spmat mat_sparse(dA);
+    rocsparse_local_dnmat mat_dense(M, N, ld, d_dense_val, get_datatype<T>(), order);
+
+    // Find size of required temporary buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_sparse_to_dense(handle, mat_sparse, mat_dense, alg, &buffer_size, nullptr));
+
+    // Allocate temporary buffer on device
+    device_vector<char> d_temp_buffer(buffer_size);
+
+    if(!d_temp_buffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Complete conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_sparse_to_dense(
+            handle, mat_sparse, mat_dense, alg, &buffer_size, d_temp_buffer));
+
+        host_vector<T> gpu_dense_val(ld * nm);
+        CHECK_HIP_ERROR(
+            hipMemcpy(gpu_dense_val, d_dense_val, sizeof(T) * ld * nm, hipMemcpyDeviceToHost));
+
+        host_vector<T> cpu_dense_val = h_dense_val;
+
+        host_gebsr2dense(hA.block_direction,
+                         hA.mb,
+                         hA.nb,
+                         hA.row_block_dim,
+                         hA.col_block_dim,
+                         base,
+                         order,
+                         hA.val.data(),
+                         hA.ptr.data(),
+                         hA.ind.data(),
+                         cpu_dense_val.data(),
+                         ld);
+
+        unit_check_general(ld, nm, ld, (T*)cpu_dense_val, (T*)gpu_dense_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm-up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sparse_to_dense(
+                handle, mat_sparse, mat_dense, alg, &buffer_size, d_temp_buffer));
+        }
+
+        double gpu_time_used = get_time_us();
+        {
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_sparse_to_dense(
+                    handle, mat_sparse, mat_dense, alg, &buffer_size, d_temp_buffer));
+            }
+        }
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used,
+                                         gebsr2dense_gbyte_count<T>(hA.mb,
+                                                                    hA.nb,
+                                                                    hA.nnzb,
+                                                                    hA.row_block_dim,
+                                                                    hA.col_block_dim));
+
+        display_timing_info("order",
+                            order,
+                            "M",
+                            M,
+                            "N",
+                            N,
+                            "LD",
+                            ld,
+                            "nnzb",
+                            hA.nnzb,
+                            "row_block_dim",
+                            hA.row_block_dim,
+                            "col_block_dim",
+                            hA.col_block_dim,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TYPE)                                                          \
+    template void testing_sparse_to_dense_bsr_bad_arg<ITYPE, JTYPE, TYPE>(const Arguments& arg); \
+    template void testing_sparse_to_dense_bsr<ITYPE, JTYPE, TYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -734,26 +734,40 @@ void testing_spgemm_csr(const Arguments& arg)
                                M, N, K, dA.nnz, dB.nnz, C_nnz, dD.nnz, h_alpha_ptr, h_beta_ptr)
                            / gpu_solve_time_used * 1e6;
 
-        std::cout.precision(2);
-        std::cout.setf(std::ios::fixed);
-        std::cout.setf(std::ios::left);
-
-        std::cout << std::setw(12) << "opA" << std::setw(12) << "opB" << std::setw(12) << "M"
-                  << std::setw(12) << "N" << std::setw(12) << "K" << std::setw(12) << "nnz_A"
-                  << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C" << std::setw(12)
-                  << "nnz_D" << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
-                  << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec"
-                  << std::setw(16) << "gemm msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
-
-        std::cout << std::setw(12) << rocsparse_operation2string(trans_A) << std::setw(12)
-                  << rocsparse_operation2string(trans_B) << std::setw(12) << M << std::setw(12) << N
-                  << std::setw(12) << K << std::setw(12) << dA.nnz << std::setw(12) << dB.nnz
-                  << std::setw(12) << C_nnz << std::setw(12) << dD.nnz << std::setw(12) << h_alpha
-                  << std::setw(12) << h_beta << std::setw(12) << gpu_gflops << std::setw(12)
-                  << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
-                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        display_timing_info("opA",
+                            rocsparse_operation2string(trans_A),
+                            "opB",
+                            rocsparse_operation2string(trans_B),
+                            "M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz_A",
+                            dA.nnz,
+                            "nnz_B",
+                            dB.nnz,
+                            "nnz_C",
+                            C_nnz,
+                            "nnz_D",
+                            dD.nnz,
+                            "alpha",
+                            h_alpha,
+                            "beta",
+                            h_beta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "nnz msec",
+                            gpu_analysis_time_used / 1e3,
+                            "gemm msec",
+                            gpu_solve_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
     }
 }
 
@@ -667,6 +667,80 @@ void testing_spmat_descr_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_spmat_set_values(coo, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // rocsparse_spmat_set_attribute
+    rocsparse_matrix_type matrix_type = rocsparse_matrix_type_symmetric;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_set_attribute(
+            nullptr, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_set_attribute(
+            coo, rocsparse_spmat_matrix_type, nullptr, sizeof(matrix_type)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_set_attribute(coo, rocsparse_spmat_matrix_type, &matrix_type, 1),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_set_attribute(
+            coo, (rocsparse_spmat_attribute)-1, &matrix_type, sizeof(matrix_type)),
+        rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_set_attribute(
+            coo, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)),
+        rocsparse_status_success);
+
+    // rocsparse_spmat_get_attribute
+    matrix_type = rocsparse_matrix_type_general;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_get_attribute(
+            nullptr, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_get_attribute(
+            coo, rocsparse_spmat_matrix_type, nullptr, sizeof(matrix_type)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_get_attribute(coo, rocsparse_spmat_matrix_type, &matrix_type, 1),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmat_get_attribute(
+            coo, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)),
+        rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS((matrix_type == rocsparse_matrix_type_symmetric)
+                                ? rocsparse_status_success
+                                : rocsparse_status_internal_error,
+                            rocsparse_status_success);
+
+    // rocsparse_csr_set_strided_batch
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(nullptr, 2, nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(coo, 2, nnz),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(csr, 0, nnz),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(csr, 2, -1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(csr, 2, nnz - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(csr, 2, nnz),
+                            rocsparse_status_success);
+
+    // rocsparse_csr_get_strided_batch
+    int     batch_count;
+    int64_t batch_stride;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_get_strided_batch(nullptr, &batch_count, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_get_strided_batch(csr, nullptr, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_get_strided_batch(csr, &batch_count, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_get_strided_batch(csr, &batch_count, &batch_stride),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS((batch_count == 2 && batch_stride == nnz)
+                                ? rocsparse_status_success
+                                : rocsparse_status_internal_error,
+                            rocsparse_status_success);
+
     // Destroy valid descriptors
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(coo), rocsparse_status_success);
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(csr), rocsparse_status_success);
@@ -0,0 +1,194 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_ab.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <memory>
+
+template <typename T>
+void testing_spmm_ab(const Arguments& arg)
+{
+    rocsparse_int        M       = arg.M;
+    rocsparse_int        N       = arg.N;
+    rocsparse_int        K       = arg.K;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_order      order   = rocsparse_order_column;
+    int                  iters   = arg.iters;
+
+    T    h_alpha = arg.get_alpha<T>();
+    T    h_beta  = arg.get_beta<T>();
+    bool beta_nz = h_beta != static_cast<T>(0);
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    std::vector<std::string> names = rocsparse_ab_config_names("coo_atomic,coo_segmented");
+    for(const std::string& name : names)
+    {
+        if(name != "csr" && name != "coo_atomic" && name != "coo_segmented")
+        {
+            std::cerr << "Invalid A/B configuration " << name
+                      << " for spmm. Options: csr, coo_atomic, coo_segmented" << std::endl;
+            return;
+        }
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        rocsparse_matrix_factory<T> matrix_factory(arg);
+        matrix_factory.init_csr(hA, M, K, base);
+    }
+
+    if(M <= 0 || N <= 0 || K <= 0 || hA.nnz <= 0)
+    {
+        std::cerr << "A/B benchmarking requires a non-empty matrix" << std::endl;
+        return;
+    }
+
+    rocsparse_int nnz   = hA.nnz;
+    rocsparse_int nnz_B = K * N;
+    rocsparse_int nnz_C = M * N;
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hB(K, N, order);
+    host_dense_matrix<T> hC(M, N, order);
+    rocsparse_matrix_utils::init_exact(hB);
+    rocsparse_matrix_utils::init_exact(hC);
+
+    device_dense_matrix<T> dB(hB);
+    device_dense_matrix<T> dC(hC);
+
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C(dC);
+
+    // COO matrix is only allocated if any configuration requires it
+    std::unique_ptr<device_coo_matrix<T>> dCOO;
+
+    // Each configuration owns its descriptor
+    std::vector<std::unique_ptr<rocsparse_local_spmat>> descrs;
+    std::vector<void*>                                  buffers;
+    std::vector<rocsparse_ab_config>                    configs;
+
+    for(const std::string& name : names)
+    {
+        rocsparse_ab_config config;
+        config.name        = name;
+        config.gflop_count = spmm_gflop_count(N, nnz, nnz_C, beta_nz);
+
+        rocsparse_spmm_alg alg;
+        if(name == "csr")
+        {
+            alg                = rocsparse_spmm_alg_csr;
+            config.gbyte_count = csrmm_gbyte_count<T>(M, nnz, nnz_B, nnz_C, beta_nz);
+            descrs.emplace_back(new rocsparse_local_spmat(dA));
+        }
+        else
+        {
+            if(!dCOO)
+            {
+                dCOO.reset(new device_coo_matrix<T>(M, K, nnz, base));
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csr2coo(handle, dA.ptr, nnz, M, dCOO->row_ind, base));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dCOO->col_ind, dA.ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dCOO->val, dA.val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+            }
+
+            alg = (name == "coo_atomic") ? rocsparse_spmm_alg_coo_atomic
+                                         : rocsparse_spmm_alg_coo_segmented;
+            config.gbyte_count = coomm_gbyte_count<T>(nnz, nnz_B, nnz_C, beta_nz);
+            descrs.emplace_back(new rocsparse_local_spmat(*dCOO));
+        }
+
+        rocsparse_handle      h = handle;
+        rocsparse_spmat_descr A = *descrs.back();
+        rocsparse_dnmat_descr X = B;
+        rocsparse_dnmat_descr Y = C;
+
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(h,
+                                             trans_A,
+                                             trans_B,
+                                             &h_alpha,
+                                             A,
+                                             X,
+                                             &h_beta,
+                                             Y,
+                                             ttype,
+                                             alg,
+                                             &buffer_size,
+                                             nullptr));
+
+        void* dbuffer;
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+        buffers.push_back(dbuffer);
+
+        config.run = [=, &h_alpha, &h_beta]() mutable {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(h,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &h_alpha,
+                                                 A,
+                                                 X,
+                                                 &h_beta,
+                                                 Y,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        };
+
+        configs.push_back(config);
+    }
+
+    std::vector<std::vector<double>> samples = rocsparse_ab_run(stream, iters, configs);
+
+    rocsparse_ab_report("spmm", rocsparse_datatype2string(ttype), configs, samples);
+
+    for(void* dbuffer : buffers)
+    {
+        CHECK_HIP_ERROR(hipFree(dbuffer));
+    }
+}
+
+#define INSTANTIATE(TYPE) template void testing_spmm_ab<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
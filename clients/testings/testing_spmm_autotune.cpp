@@ -0,0 +1,298 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_autotune.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+// Formats that store more than this multiple of the non-zero entries are not considered
+static constexpr double autotune_max_fill = 4.0;
+
+template <typename T>
+void testing_spmm_autotune(const Arguments& arg)
+{
+    rocsparse_int        M       = arg.M;
+    rocsparse_int        N       = arg.N;
+    rocsparse_int        K       = arg.K;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_order      order   = rocsparse_order_column;
+    int                  iters   = arg.iters;
+
+    T    h_alpha = arg.get_alpha<T>();
+    T    h_beta  = arg.get_beta<T>();
+    bool beta_nz = h_beta != static_cast<T>(0);
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        rocsparse_matrix_factory<T> matrix_factory(arg);
+        matrix_factory.init_csr(hA, M, K, base);
+    }
+
+    if(M <= 0 || N <= 0 || K <= 0 || hA.nnz <= 0)
+    {
+        std::cerr << "Autotuning requires a non-empty matrix" << std::endl;
+        return;
+    }
+
+    rocsparse_int nnz   = hA.nnz;
+    rocsparse_int nnz_B = K * N;
+    rocsparse_int nnz_C = M * N;
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hB(K, N, order);
+    host_dense_matrix<T> hC(M, N, order);
+    rocsparse_matrix_utils::init_exact(hB);
+    rocsparse_matrix_utils::init_exact(hC);
+
+    device_dense_matrix<T> dB(hB);
+    device_dense_matrix<T> dC(hC);
+
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C(dC);
+
+    double gflop_count = spmm_gflop_count(N, nnz, nnz_C, beta_nz);
+
+    std::vector<rocsparse_autotune_candidate> candidates;
+
+    auto finish = [&](rocsparse_autotune_candidate& c, double gbyte_count) {
+        double gpu_time_used = c.median_msec * 1e3;
+        c.gflops             = get_gpu_gflops(gpu_time_used, gflop_count);
+        c.gbyte              = get_gpu_gbyte(gpu_time_used, gbyte_count);
+        candidates.push_back(c);
+    };
+
+    // Generic SpMM on a given sparse matrix descriptor
+    auto generic = [&](rocsparse_autotune_candidate& c,
+                       rocsparse_spmat_descr         A,
+                       rocsparse_spmm_alg            alg,
+                       double                        gbyte_count) {
+        size_t buffer_size;
+        c.analysis_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &h_alpha,
+                                                 A,
+                                                 B,
+                                                 &h_beta,
+                                                 C,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 nullptr));
+        });
+
+        void* dbuffer;
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+        rocsparse_autotune_time(c, stream, iters, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &h_alpha,
+                                                 A,
+                                                 B,
+                                                 &h_beta,
+                                                 C,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        });
+
+        CHECK_HIP_ERROR(hipFree(dbuffer));
+
+        finish(c, gbyte_count);
+    };
+
+    //
+    // CSR, no conversion required
+    //
+    {
+        rocsparse_local_spmat A(dA);
+
+        rocsparse_autotune_candidate c;
+        c.format = rocsparse_format2string(rocsparse_format_csr);
+        c.alg    = rocsparse_spmmalg2string(rocsparse_spmm_alg_csr);
+
+        generic(c,
+                A,
+                rocsparse_spmm_alg_csr,
+                csrmm_gbyte_count<T>(M, nnz, nnz_B, nnz_C, beta_nz));
+    }
+
+    //
+    // COO
+    //
+    {
+        device_coo_matrix<T> dCOO(M, K, nnz, base);
+
+        double convert_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2coo(handle, dA.ptr, nnz, M, dCOO.row_ind, base));
+            CHECK_HIP_ERROR(hipMemcpyAsync(dCOO.col_ind,
+                                           dA.ind,
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+            CHECK_HIP_ERROR(
+                hipMemcpyAsync(dCOO.val, dA.val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+        });
+
+        for(rocsparse_spmm_alg alg :
+            {rocsparse_spmm_alg_coo_segmented, rocsparse_spmm_alg_coo_atomic})
+        {
+            rocsparse_local_spmat A(dCOO);
+
+            rocsparse_autotune_candidate c;
+            c.format       = rocsparse_format2string(rocsparse_format_coo);
+            c.alg          = rocsparse_spmmalg2string(alg);
+            c.convert_msec = convert_msec;
+
+            generic(c, A, alg, coomm_gbyte_count<T>(nnz, nnz_B, nnz_C, beta_nz));
+        }
+    }
+
+    //
+    // BSR
+    //
+    for(rocsparse_int block_dim : {2, 4, 8, 16})
+    {
+        rocsparse_int mb = (M + block_dim - 1) / block_dim;
+        rocsparse_int kb = (K + block_dim - 1) / block_dim;
+
+        device_vector<rocsparse_int> dbsr_row_ptr(mb + 1);
+
+        rocsparse_int nnzb;
+        double        nnzb_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                        rocsparse_direction_row,
+                                                        M,
+                                                        K,
+                                                        descr,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        block_dim,
+                                                        descr,
+                                                        dbsr_row_ptr,
+                                                        &nnzb));
+        });
+
+        if(static_cast<double>(nnzb) * block_dim * block_dim > autotune_max_fill * nnz)
+        {
+            std::cout << "Skipping bsr: block_dim " << block_dim << " exceeds fill limit"
+                      << std::endl;
+            continue;
+        }
+
+        device_vector<rocsparse_int> dbsr_col_ind(nnzb);
+        device_vector<T>             dbsr_val(size_t(nnzb) * block_dim * block_dim);
+
+        rocsparse_autotune_candidate c;
+        c.format       = "bsr";
+        c.alg          = rocsparse_direction2string(rocsparse_direction_row);
+        c.params       = "block_dim=" + std::to_string(block_dim);
+        c.convert_msec = nnzb_msec + rocsparse_autotune_time_once(stream, [&] {
+                             CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
+                                                                        rocsparse_direction_row,
+                                                                        M,
+                                                                        K,
+                                                                        descr,
+                                                                        dA.val,
+                                                                        dA.ptr,
+                                                                        dA.ind,
+                                                                        block_dim,
+                                                                        descr,
+                                                                        dbsr_val,
+                                                                        dbsr_row_ptr,
+                                                                        dbsr_col_ind));
+                         });
+
+        // BSR operates on padded dense matrices
+        rocsparse_int ldb = kb * block_dim;
+        rocsparse_int ldc = mb * block_dim;
+
+        device_vector<T> dB_pad(size_t(ldb) * N);
+        device_vector<T> dC_pad(size_t(ldc) * N);
+        CHECK_HIP_ERROR(hipMemset(dB_pad, 0, sizeof(T) * ldb * N));
+        CHECK_HIP_ERROR(hipMemset(dC_pad, 0, sizeof(T) * ldc * N));
+        CHECK_HIP_ERROR(hipMemcpy2D(dB_pad,
+                                    sizeof(T) * ldb,
+                                    dB.val,
+                                    sizeof(T) * K,
+                                    sizeof(T) * K,
+                                    N,
+                                    hipMemcpyDeviceToDevice));
+
+        rocsparse_autotune_time(c, stream, iters, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm<T>(handle,
+                                                     rocsparse_direction_row,
+                                                     trans_A,
+                                                     trans_B,
+                                                     mb,
+                                                     N,
+                                                     kb,
+                                                     nnzb,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dbsr_val,
+                                                     dbsr_row_ptr,
+                                                     dbsr_col_ind,
+                                                     block_dim,
+                                                     dB_pad,
+                                                     ldb,
+                                                     &h_beta,
+                                                     dC_pad,
+                                                     ldc));
+        });
+
+        finish(c, bsrmm_gbyte_count<T>(mb, nnzb, block_dim, nnz_B, nnz_C, beta_nz));
+    }
+
+    rocsparse_autotune_report("spmm", rocsparse_datatype2string(ttype), M, N, nnz, candidates);
+}
+
+#define INSTANTIATE(TYPE) template void testing_spmm_autotune<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,523 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+// Runs host_csrmm on each batch, a zero stride of B shares a single matrix B
+template <typename I, typename J, typename T>
+static void host_csrmm_strided_batched(J                     M,
+                                       J                     N,
+                                       J                     K,
+                                       int                   batch_count,
+                                       rocsparse_operation   trans_A,
+                                       rocsparse_operation   trans_B,
+                                       T                     alpha,
+                                       const std::vector<I>& csr_row_ptr,
+                                       const std::vector<J>& csr_col_ind,
+                                       const std::vector<T>& csr_val,
+                                       int64_t               csr_val_batch_stride,
+                                       const std::vector<T>& B,
+                                       J                     ldb,
+                                       int64_t               B_batch_stride,
+                                       int64_t               B_size,
+                                       T                     beta,
+                                       std::vector<T>&       C,
+                                       J                     ldc,
+                                       int64_t               C_batch_stride,
+                                       int64_t               C_size,
+                                       rocsparse_order       order,
+                                       rocsparse_index_base  base)
+{
+    I nnz = csr_col_ind.size();
+
+    for(int batch = 0; batch < batch_count; ++batch)
+    {
+        std::vector<T> val(csr_val.begin() + batch * csr_val_batch_stride,
+                           csr_val.begin() + batch * csr_val_batch_stride + nnz);
+        std::vector<T> B_batch(B.begin() + batch * B_batch_stride,
+                               B.begin() + batch * B_batch_stride + B_size);
+        std::vector<T> C_batch(C.begin() + batch * C_batch_stride,
+                               C.begin() + batch * C_batch_stride + C_size);
+
+        host_csrmm(M,
+                   N,
+                   K,
+                   trans_A,
+                   trans_B,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   val,
+                   B_batch,
+                   ldb,
+                   beta,
+                   C_batch,
+                   ldc,
+                   order,
+                   base);
+
+        std::copy(C_batch.begin(), C_batch.end(), C.begin() + batch * C_batch_stride);
+    }
+}
+
+template <typename I, typename J, typename T>
+void testing_spmm_batched_bad_arg(const Arguments& arg)
+{
+    J m   = 2;
+    J n   = 2;
+    J k   = 2;
+    I nnz = 2;
+
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle  = local_handle;
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_order      order   = rocsparse_order_column;
+    const void*          p_alpha = (const void*)&alpha;
+    const void*          p_beta  = (const void*)&beta;
+    rocsparse_spmm_alg   alg     = rocsparse_spmm_alg_csr;
+    size_t               buffer_size;
+    size_t*              p_buffer_size = &buffer_size;
+    void*                temp_buffer   = (void*)0x4;
+    rocsparse_indextype  itype         = get_indextype<I>();
+    rocsparse_indextype  jtype         = get_indextype<J>();
+    rocsparse_datatype   ttype         = get_datatype<T>();
+
+    // Descriptors only hold the pointers, the batch checks fail before any access
+    void* ptr = (void*)0x4;
+
+    rocsparse_local_spmat A(
+        m, k, nnz, ptr, ptr, ptr, itype, jtype, base, ttype, rocsparse_format_csr);
+    rocsparse_local_dnmat B(k, n, k, ptr, ttype, order);
+    rocsparse_local_dnmat C(m, n, m, ptr, ttype, order);
+
+#define PARAMS                                                                           \
+    handle, trans_A, trans_B, p_alpha, (const rocsparse_spmat_descr&)A,                  \
+        (const rocsparse_dnmat_descr&)B, p_beta, (const rocsparse_dnmat_descr&)C, ttype, \
+        alg, p_buffer_size, temp_buffer
+
+    //
+    // BATCH COUNT OF C HAS TO MATCH THE MATRIX
+    //
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(A, 4, nnz));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_size);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C, 3, m * n));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_size);
+
+    //
+    // A BATCH OF C REQUIRES A BATCH OF A
+    //
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(A, 1, 0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C, 4, m * n));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_size);
+
+    //
+    // B IS EITHER SHARED OR HOLDS THE SAME BATCH COUNT
+    //
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(A, 4, nnz));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, 3, k * n));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_size);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, 5, k * n));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_size);
+
+    //
+    // INVALID STRIDES, BATCHES MUST NOT OVERLAP
+    //
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 4, nnz - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(B, 4, k * n - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(C, 0, m * n),
+                            rocsparse_status_invalid_size);
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmm_batched(const Arguments& arg)
+{
+    J                     M           = arg.M;
+    J                     N           = arg.N;
+    J                     K           = arg.K;
+    int                   batch_count = arg.block_dim;
+    int32_t               dim_x       = arg.dimx;
+    int32_t               dim_y       = arg.dimy;
+    int32_t               dim_z       = arg.dimz;
+    rocsparse_operation   trans_A     = arg.transA;
+    rocsparse_operation   trans_B     = arg.transB;
+    rocsparse_index_base  base        = arg.baseA;
+    rocsparse_spmm_alg    alg         = arg.spmm_alg;
+    rocsparse_order       order       = arg.order;
+    rocsparse_matrix_init mat         = arg.matrix;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0 || batch_count <= 0)
+    {
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind;
+    host_vector<T> hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample the sparsity pattern shared by all batches
+    I nnz_A;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              trans_A == rocsparse_operation_none ? M : K,
+                              trans_A == rocsparse_operation_none ? K : M,
+                              N,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_A,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              false);
+
+    // Some matrix properties
+    J A_m = trans_A == rocsparse_operation_none ? M : K;
+    J A_n = trans_A == rocsparse_operation_none ? K : M;
+    J B_m = trans_B == rocsparse_operation_none ? K : N;
+    J B_n = trans_B == rocsparse_operation_none ? N : K;
+    J C_m = M;
+    J C_n = N;
+
+    J ldb = order == rocsparse_order_column ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
+                                            : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
+    J ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
+
+    int64_t size_B = int64_t(ldb) * (order == rocsparse_order_column ? B_n : B_m);
+    int64_t size_C = int64_t(ldc) * (order == rocsparse_order_column ? C_n : C_m);
+
+    // Pad the strides, so that the batch offsets differ from the matrix sizes
+    int64_t stride_A = int64_t(nnz_A) + 3;
+    int64_t stride_B = size_B + 5;
+    int64_t stride_C = size_C + 7;
+
+    // Each batch holds its own values and matrices B and C
+    host_vector<T> hval(stride_A * batch_count);
+    host_vector<T> hB(stride_B * batch_count);
+    host_vector<T> hC(stride_C * batch_count);
+
+    rocsparse_init<T>(hval, hval.size(), 1, 1);
+    rocsparse_init<T>(hB, hB.size(), 1, 1);
+    rocsparse_init<T>(hC, hC.size(), 1, 1);
+
+    // Allocate device memory
+    device_vector<I> dcsr_row_ptr(A_m + 1);
+    device_vector<J> dcsr_col_ind(nnz_A);
+    device_vector<T> dval(hval.size());
+    device_vector<T> dB(hB.size());
+    device_vector<T> dC_1(hC.size());
+    device_vector<T> dC_2(hC.size());
+    device_vector<T> dC_3(hC.size());
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dval || !dB || !dC_1 || !dC_2 || !dC_3 || !dalpha
+       || !dbeta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (A_m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval, sizeof(T) * hval.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_3, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(A_m,
+                            A_n,
+                            nnz_A,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dval,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+    rocsparse_local_dnmat B_shared(B_m, B_n, ldb, dB, ttype, order);
+    rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
+    rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, order);
+    rocsparse_local_dnmat C3(C_m, C_n, ldc, dC_3, ttype, order);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(A, batch_count, stride_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, batch_count, stride_B));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C1, batch_count, stride_C));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C2, batch_count, stride_C));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C3, batch_count, stride_C));
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        handle, trans_A, trans_B, &halpha, A, B, &hbeta, C1, ttype, alg, &buffer_size, nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             &halpha,
+                                             A,
+                                             B,
+                                             &hbeta,
+                                             C1,
+                                             ttype,
+                                             alg,
+                                             &buffer_size,
+                                             dbuffer));
+
+        // A single matrix B broadcast to all batches
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             &halpha,
+                                             A,
+                                             B_shared,
+                                             &hbeta,
+                                             C3,
+                                             ttype,
+                                             alg,
+                                             &buffer_size,
+                                             dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+            handle, trans_A, trans_B, dalpha, A, B, dbeta, C2, ttype, alg, &buffer_size, dbuffer));
+
+        // Copy output to host
+        host_vector<T> hC_1(hC.size());
+        host_vector<T> hC_2(hC.size());
+        host_vector<T> hC_3(hC.size());
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_3, dC_3, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+
+        // CPU batched csrmm
+        host_vector<T> hC_gold(hC);
+        host_csrmm_strided_batched(M,
+                                   N,
+                                   K,
+                                   batch_count,
+                                   trans_A,
+                                   trans_B,
+                                   halpha,
+                                   hcsr_row_ptr,
+                                   hcsr_col_ind,
+                                   hval,
+                                   stride_A,
+                                   hB,
+                                   ldb,
+                                   stride_B,
+                                   size_B,
+                                   hbeta,
+                                   hC_gold,
+                                   ldc,
+                                   stride_C,
+                                   size_C,
+                                   order,
+                                   base);
+
+        near_check_general<T>(hC.size(), 1, 1, hC_gold, hC_1);
+        near_check_general<T>(hC.size(), 1, 1, hC_gold, hC_2);
+
+        // CPU batched csrmm with the first matrix B shared by all batches
+        host_vector<T> hC_gold_shared(hC);
+        host_csrmm_strided_batched(M,
+                                   N,
+                                   K,
+                                   batch_count,
+                                   trans_A,
+                                   trans_B,
+                                   halpha,
+                                   hcsr_row_ptr,
+                                   hcsr_col_ind,
+                                   hval,
+                                   stride_A,
+                                   hB,
+                                   ldb,
+                                   int64_t(0),
+                                   size_B,
+                                   hbeta,
+                                   hC_gold_shared,
+                                   ldc,
+                                   stride_C,
+                                   size_C,
+                                   order,
+                                   base);
+
+        near_check_general<T>(hC.size(), 1, 1, hC_gold_shared, hC_3);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = batch_count
+              * spmm_gflop_count(N, nnz_A, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count
+            = batch_count
+              * csrmm_gbyte_count<T>(
+                  A_m, nnz_A, (I)B_m * (I)B_n, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz_A",
+                            nnz_A,
+                            "batch_count",
+                            batch_count,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "Algorithm",
+                            rocsparse_spmmalg2string(alg),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                   \
+    template void testing_spmm_batched_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_batched<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,365 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmm_bsr_bad_arg(const Arguments& arg)
+{
+    J mb            = 10;
+    J n             = 10;
+    J kb            = 10;
+    I nnzb          = 10;
+    J row_block_dim = 2;
+    J col_block_dim = 3;
+
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_direction  dir     = rocsparse_direction_row;
+    rocsparse_spmm_alg   alg     = rocsparse_spmm_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    J m = mb * row_block_dim;
+    J k = kb * col_block_dim;
+
+    // Allocate memory on device
+    device_vector<I> dbsr_row_ptr(mb + 1);
+    device_vector<J> dbsr_col_ind(nnzb);
+    device_vector<T> dbsr_val(nnzb * row_block_dim * col_block_dim);
+    device_vector<T> dB(k * n);
+    device_vector<T> dC(m * n);
+
+    if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // SpMM structures
+    rocsparse_local_spmat A(mb,
+                            kb,
+                            nnzb,
+                            dir,
+                            row_block_dim,
+                            col_block_dim,
+                            dbsr_row_ptr,
+                            dbsr_col_ind,
+                            dbsr_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype);
+    rocsparse_local_dnmat B(k, n, k, dB, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C(m, n, m, dC, ttype, rocsparse_order_column);
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+
+    size_t buffer_size;
+
+#define PARAMS(A_, B_, C_) \
+    handle, trans_A, trans_B, &alpha, A_, B_, &beta, C_, ttype, alg, &buffer_size, dbuffer
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            nullptr, trans_A, trans_B, &alpha, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, nullptr, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, &alpha, A, B, nullptr, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(nullptr, B, C)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, nullptr, C)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+    // BSR matrices can only be used without transposition
+    trans_A = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, C)), rocsparse_status_not_implemented);
+    trans_A = rocsparse_operation_none;
+
+    // BSR matrices do not support the conjugate transpose of B
+    trans_B = rocsparse_operation_conjugate_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, C)), rocsparse_status_not_implemented);
+    trans_B = rocsparse_operation_none;
+
+    // BSR matrices require column ordered dense matrices
+    {
+        rocsparse_local_dnmat B_row(k, n, n, dB, ttype, rocsparse_order_row);
+        rocsparse_local_dnmat C_row(m, n, n, dC, ttype, rocsparse_order_row);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B_row, C_row)),
+                                rocsparse_status_not_implemented);
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename I, typename J, typename T>
+void testing_spmm_bsr(const Arguments& arg)
+{
+    J                    M             = arg.M;
+    J                    N             = arg.N;
+    J                    K             = arg.K;
+    J                    row_block_dim = arg.row_block_dimA;
+    J                    col_block_dim = arg.col_block_dimA;
+    rocsparse_operation  trans_A       = arg.transA;
+    rocsparse_operation  trans_B       = arg.transB;
+    rocsparse_index_base base          = arg.baseA;
+    rocsparse_spmm_alg   alg           = arg.spmm_alg;
+
+    J Mb = (M + row_block_dim - 1) / row_block_dim;
+    J Kb = (K + col_block_dim - 1) / col_block_dim;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    // Data type
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+#define PARAMS(alpha_, A_, B_, beta_, C_) \
+    handle, trans_A, trans_B, alpha_, A_, B_, beta_, C_, ttype, alg, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || N <= 0 || Kb <= 0)
+    {
+        // Check SpMM when structures can be created
+        if(Mb == 0 && N == 0 && Kb == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            device_gebsr_matrix<T, I, J> dA;
+            device_dense_matrix<T>       dB(0, 0), dC(0, 0);
+
+            rocsparse_local_spmat A(dA);
+            rocsparse_local_dnmat B(dB);
+            rocsparse_local_dnmat C(dC);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Sample matrix, sizes are returned in number of blocks
+    host_gebsr_matrix<T, I, J>        hA;
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+    matrix_factory.init_gebsr(hA, Mb, Kb, base);
+
+    M = hA.mb * hA.row_block_dim;
+    K = hA.nb * hA.col_block_dim;
+
+    // Allocate host memory for dense matrices
+    host_dense_matrix<T> hB((trans_B == rocsparse_operation_none) ? K : N,
+                            (trans_B == rocsparse_operation_none) ? N : K);
+    host_dense_matrix<T> hC(M, N);
+
+    rocsparse_matrix_utils::init(hB);
+    rocsparse_matrix_utils::init(hC);
+
+    device_gebsr_matrix<T, I, J> dA(hA);
+    device_dense_matrix<T>       dB(hB), dC(hC);
+
+    // Create descriptors
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C(dC);
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    void*  dbuffer = nullptr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+
+    // Allocate buffer
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+
+        // CPU gebsrmm
+        {
+            rocsparse_local_mat_descr descr;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+            host_dense_matrix<T> hC_copy(hC);
+            host_gebsrmm<I, J, T>(handle,
+                                  hA.block_direction,
+                                  trans_A,
+                                  trans_B,
+                                  hA.mb,
+                                  N,
+                                  hA.nb,
+                                  hA.nnzb,
+                                  h_alpha.val,
+                                  descr,
+                                  hA.val,
+                                  hA.ptr,
+                                  hA.ind,
+                                  hA.row_block_dim,
+                                  hA.col_block_dim,
+                                  hB.val,
+                                  (J)hB.ld,
+                                  h_beta.val,
+                                  hC.val,
+                                  (J)hC.ld);
+            hC.near_check(dC);
+            dC.transfer_from(hC_copy);
+        }
+
+        // Pointer mode device
+        device_scalar<T> d_alpha(h_alpha);
+        device_scalar<T> d_beta(h_beta);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(d_alpha, A, B, d_beta, C)));
+        hC.near_check(dC);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = gebsrmm_gflop_count(N,
+                                                 dA.nnzb,
+                                                 dA.row_block_dim,
+                                                 dA.col_block_dim,
+                                                 dC.m * dC.n,
+                                                 *h_beta.val != static_cast<T>(0));
+
+        double gbyte_count = gebsrmm_gbyte_count<T>(dA.mb,
+                                                    dA.nnzb,
+                                                    dA.row_block_dim,
+                                                    dA.col_block_dim,
+                                                    dB.m * dB.n,
+                                                    dC.m * dC.n,
+                                                    *h_beta.val != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "dir",
+                            dA.block_direction,
+                            "transB",
+                            trans_B,
+                            "nnzb",
+                            dA.nnzb,
+                            "row_block_dim",
+                            dA.row_block_dim,
+                            "col_block_dim",
+                            dA.col_block_dim,
+                            "alpha",
+                            *h_alpha.val,
+                            "beta",
+                            *h_beta.val,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
+    template void testing_spmm_bsr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_bsr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
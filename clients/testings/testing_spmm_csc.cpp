@@ -0,0 +1,585 @@
+/* ************************************************************************
+* Copyright (c) 2021 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmm_csc_bad_arg(const Arguments& arg)
+{
+    J m   = 100;
+    J n   = 100;
+    J k   = 100;
+    J B_n = 100;
+    I nnz = 100;
+
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_spmm_alg   alg     = rocsparse_spmm_alg_csr;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<I> dcsc_col_ptr(nnz);
+    device_vector<J> dcsc_row_ind(nnz);
+    device_vector<T> dcsc_val(nnz);
+    device_vector<T> dB(k * B_n);
+    device_vector<T> dC(m * n);
+
+    if(!dcsc_col_ptr || !dcsc_row_ind || !dcsc_val || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // SpMM structures
+    rocsparse_local_spmat A(m,
+                            n,
+                            nnz,
+                            dcsc_col_ptr,
+                            dcsc_row_ind,
+                            dcsc_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csc);
+    rocsparse_local_dnmat B(k, B_n, k, dB, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C(m, n, m, dC, ttype, rocsparse_order_column);
+
+    // Test SpMM with invalid buffer
+    size_t buffer_size;
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            nullptr, trans_A, trans_B, &alpha, A, B, &beta, C, ttype, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, nullptr, A, B, &beta, C, ttype, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           nullptr,
+                                           B,
+                                           &beta,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           nullptr,
+                                           &beta,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, &alpha, A, B, nullptr, C, ttype, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           B,
+                                           &beta,
+                                           nullptr,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, &alpha, A, B, &beta, C, ttype, alg, nullptr, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    // Test SpMM with valid buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            nullptr, trans_A, trans_B, &alpha, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, nullptr, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           nullptr,
+                                           B,
+                                           &beta,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           nullptr,
+                                           &beta,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, &alpha, A, B, nullptr, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           B,
+                                           &beta,
+                                           nullptr,
+                                           ttype,
+                                           alg,
+                                           &buffer_size,
+                                           dbuffer),
+                            rocsparse_status_invalid_pointer);
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename I, typename J, typename T>
+void testing_spmm_csc(const Arguments& arg)
+{
+    J                     M         = arg.M;
+    J                     N         = arg.N;
+    J                     K         = arg.K;
+    int32_t               dim_x     = arg.dimx;
+    int32_t               dim_y     = arg.dimy;
+    int32_t               dim_z     = arg.dimz;
+    rocsparse_operation   trans_A   = arg.transA;
+    rocsparse_operation   trans_B   = arg.transB;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_spmm_alg    alg       = arg.spmm_alg;
+    rocsparse_order       order     = arg.order;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        // M == N == 0 means nnz can only be 0, too
+        I nnz_A = 0;
+
+        static const I safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<I> dcsc_col_ptr(safe_size);
+        device_vector<J> dcsc_row_ind(safe_size);
+        device_vector<T> dcsc_val(safe_size);
+        device_vector<T> dB(safe_size);
+        device_vector<T> dC(safe_size);
+
+        if(!dcsc_col_ptr || !dcsc_row_ind || !dcsc_val || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Check SpMM when structures can be created
+        if(M == 0 && N == 0 && K == 0)
+        {
+            // Pointer mode
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            J A_m = trans_A == rocsparse_operation_none ? M : K;
+            J A_n = trans_A == rocsparse_operation_none ? K : M;
+            J B_m = trans_B == rocsparse_operation_none ? K : N;
+            J B_n = trans_B == rocsparse_operation_none ? N : K;
+            J C_m = M;
+            J C_n = N;
+
+            J ldb = order == rocsparse_order_column
+                        ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
+                        : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
+
+            J ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
+
+            // Check structures
+            rocsparse_local_spmat A(A_m,
+                                    A_n,
+                                    nnz_A,
+                                    dcsc_col_ptr,
+                                    dcsc_row_ind,
+                                    dcsc_val,
+                                    itype,
+                                    jtype,
+                                    base,
+                                    ttype,
+                                    rocsparse_format_csc);
+            rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+            rocsparse_local_dnmat C(C_m, C_n, ldc, dC, ttype, order);
+
+            size_t buffer_size;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   &buffer_size,
+                                                   nullptr),
+                                    rocsparse_status_success);
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, safe_size));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   &buffer_size,
+                                                   dbuffer),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsc_col_ptr;
+    host_vector<J> hcsc_row_ind;
+    host_vector<T> hcsc_val;
+
+    rocsparse_seedrand();
+
+    // Wavefront size
+    int dev;
+    hipGetDevice(&dev);
+
+    hipDeviceProp_t prop;
+    hipGetDeviceProperties(&prop, dev);
+
+    // Sample matrix, the CSR representation of the transpose is the CSC representation of A
+    I nnz_A;
+    rocsparse_init_csr_matrix(hcsc_col_ptr,
+                              hcsc_row_ind,
+                              hcsc_val,
+                              trans_A == rocsparse_operation_none ? K : M,
+                              trans_A == rocsparse_operation_none ? M : K,
+                              N,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_A,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Some matrix properties
+    J A_m = trans_A == rocsparse_operation_none ? M : K;
+    J A_n = trans_A == rocsparse_operation_none ? K : M;
+    J B_m = trans_B == rocsparse_operation_none ? K : N;
+    J B_n = trans_B == rocsparse_operation_none ? N : K;
+    J C_m = M;
+    J C_n = N;
+
+    J ldb = order == rocsparse_order_column ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
+                                            : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
+    J ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
+
+    J nrowB = order == rocsparse_order_column ? ldb : B_m;
+    J ncolB = order == rocsparse_order_column ? B_n : ldb;
+    J nrowC = order == rocsparse_order_column ? ldc : C_m;
+    J ncolC = order == rocsparse_order_column ? C_n : ldc;
+
+    I nnz_B = nrowB * ncolB;
+    I nnz_C = nrowC * ncolC;
+
+    // Allocate host memory for vectors
+    host_vector<T> hB(nnz_B);
+    host_vector<T> hC_1(nnz_C);
+    host_vector<T> hC_2(nnz_C);
+    host_vector<T> hC_gold(nnz_C);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hB, nnz_B, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C, 1, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate device memory
+    device_vector<I> dcsc_col_ptr(A_n + 1);
+    device_vector<J> dcsc_row_ind(nnz_A);
+    device_vector<T> dcsc_val(nnz_A);
+    device_vector<T> dB(nnz_B);
+    device_vector<T> dC_1(nnz_C);
+    device_vector<T> dC_2(nnz_C);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    if(!dcsc_col_ptr || !dcsc_row_ind || !dcsc_val || !dB || !dC_1 || !dC_2 || !dalpha || !dbeta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsc_col_ptr, hcsc_col_ptr.data(), sizeof(I) * (A_n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsc_row_ind, hcsc_row_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsc_val, hcsc_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(A_m,
+                            A_n,
+                            nnz_A,
+                            dcsc_col_ptr,
+                            dcsc_row_ind,
+                            dcsc_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csc);
+    rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+    rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
+    rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, order);
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        handle, trans_A, trans_B, &halpha, A, B, &hbeta, C1, ttype, alg, &buffer_size, nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // SpMM
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             &halpha,
+                                             A,
+                                             B,
+                                             &hbeta,
+                                             C1,
+                                             ttype,
+                                             alg,
+                                             &buffer_size,
+                                             dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+            handle, trans_A, trans_B, dalpha, A, B, dbeta, C2, ttype, alg, &buffer_size, dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU cscmm
+        host_cscmm(M,
+                   N,
+                   K,
+                   trans_A,
+                   trans_B,
+                   halpha,
+                   hcsc_col_ptr,
+                   hcsc_row_ind,
+                   hcsc_val,
+                   hB,
+                   ldb,
+                   hbeta,
+                   hC_gold,
+                   ldc,
+                   order,
+                   base);
+
+        near_check_general<T>(nnz_C, 1, 1, hC_gold, hC_1);
+        near_check_general<T>(nnz_C, 1, 1, hC_gold, hC_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = spmm_gflop_count(N, nnz_A, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = csrmm_gbyte_count<T>(
+            A_n, nnz_A, (I)B_m * (I)B_n, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz_A",
+                            nnz_A,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "Algorithm",
+                            rocsparse_spmmalg2string(alg),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
+    template void testing_spmm_csc_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_csc<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,532 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename T>
+void testing_spmm_sell_bad_arg(const Arguments& arg)
+{
+    I m          = 100;
+    I n          = 100;
+    I k          = 100;
+    I nnz        = 100;
+    I slice_size = 4;
+    I sigma      = 16;
+
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_spmm_alg   alg     = rocsparse_spmm_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<I> dsell_slice_ptr((m - 1) / slice_size + 2);
+    device_vector<I> dsell_row_perm(m);
+    device_vector<I> dsell_col_ind(nnz);
+    device_vector<T> dsell_val(nnz);
+    device_vector<T> dB(k * n);
+    device_vector<T> dC(m * n);
+
+    if(!dsell_slice_ptr || !dsell_row_perm || !dsell_col_ind || !dsell_val || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // SpMM structures
+    rocsparse_local_spmat A(m,
+                            k,
+                            nnz,
+                            slice_size,
+                            sigma,
+                            dsell_slice_ptr,
+                            dsell_row_perm,
+                            dsell_col_ind,
+                            dsell_val,
+                            itype,
+                            base,
+                            ttype);
+    rocsparse_local_dnmat B(k, n, k, dB, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C(m, n, m, dC, ttype, rocsparse_order_column);
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+
+    size_t buffer_size;
+
+#define PARAMS(A_, B_, C_) \
+    handle, trans_A, trans_B, &alpha, A_, B_, &beta, C_, ttype, alg, &buffer_size, dbuffer
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            nullptr, trans_A, trans_B, &alpha, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, nullptr, A, B, &beta, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmm(
+            handle, trans_A, trans_B, &alpha, A, B, nullptr, C, ttype, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(nullptr, B, C)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, nullptr, C)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+    // SELL-C-sigma matrices can only be used without transposition
+    trans_A = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, C)), rocsparse_status_not_implemented);
+    trans_A = rocsparse_operation_none;
+
+    // B and C need to share the same order
+    {
+        rocsparse_local_dnmat C_row(m, n, n, dC, ttype, rocsparse_order_row);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(A, B, C_row)),
+                                rocsparse_status_invalid_value);
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename I, typename T>
+void testing_spmm_sell(const Arguments& arg)
+{
+    I                     M          = arg.M;
+    I                     N          = arg.N;
+    I                     K          = arg.K;
+    I                     slice_size = arg.block_dim;
+    I                     sigma      = arg.row_block_dimA;
+    int32_t               dim_x      = arg.dimx;
+    int32_t               dim_y      = arg.dimy;
+    int32_t               dim_z      = arg.dimz;
+    rocsparse_operation   trans_A    = arg.transA;
+    rocsparse_operation   trans_B    = arg.transB;
+    rocsparse_index_base  base       = arg.baseA;
+    rocsparse_spmm_alg    alg        = arg.spmm_alg;
+    rocsparse_order       order      = arg.order;
+    rocsparse_matrix_init mat        = arg.matrix;
+    bool                  full_rank  = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const I safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<I> dsell_slice_ptr(safe_size);
+        device_vector<I> dsell_row_perm(safe_size);
+        device_vector<I> dsell_col_ind(safe_size);
+        device_vector<T> dsell_val(safe_size);
+        device_vector<T> dB(safe_size);
+        device_vector<T> dC(safe_size);
+
+        if(!dsell_slice_ptr || !dsell_row_perm || !dsell_col_ind || !dsell_val || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Check SpMM when structures can be created
+        if(M == 0 && N == 0 && K == 0)
+        {
+            // Pointer mode
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            I B_m = trans_B == rocsparse_operation_none ? K : N;
+            I B_n = trans_B == rocsparse_operation_none ? N : K;
+
+            I ldb = order == rocsparse_order_column
+                        ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
+                        : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
+
+            I ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
+
+            // Check structures
+            rocsparse_local_spmat A(M,
+                                    K,
+                                    0,
+                                    slice_size,
+                                    sigma,
+                                    dsell_slice_ptr,
+                                    dsell_row_perm,
+                                    dsell_col_ind,
+                                    dsell_val,
+                                    itype,
+                                    base,
+                                    ttype);
+            rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+            rocsparse_local_dnmat C(M, N, ldc, dC, ttype, order);
+
+            size_t buffer_size;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   &buffer_size,
+                                                   nullptr),
+                                    rocsparse_status_success);
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, safe_size));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   &halpha,
+                                                   A,
+                                                   B,
+                                                   &hbeta,
+                                                   C,
+                                                   ttype,
+                                                   alg,
+                                                   &buffer_size,
+                                                   dbuffer),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<I> hcsr_col_ind;
+    host_vector<T> hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    I nnz_A;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              K,
+                              N,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_A,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Convert to SELL-C-sigma on the host
+    host_vector<I> hsell_slice_ptr;
+    host_vector<I> hsell_row_perm;
+    host_vector<I> hsell_col_ind;
+    host_vector<T> hsell_val;
+    I              sell_nnz;
+
+    host_csr_to_sell(M,
+                     hcsr_row_ptr,
+                     hcsr_col_ind,
+                     hcsr_val,
+                     slice_size,
+                     sigma,
+                     hsell_slice_ptr,
+                     hsell_row_perm,
+                     hsell_col_ind,
+                     hsell_val,
+                     sell_nnz,
+                     base,
+                     base);
+
+    I nslices = (M - 1) / slice_size + 1;
+
+    // Some matrix properties
+    I B_m = trans_B == rocsparse_operation_none ? K : N;
+    I B_n = trans_B == rocsparse_operation_none ? N : K;
+    I C_m = M;
+    I C_n = N;
+
+    I ldb = order == rocsparse_order_column ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
+                                            : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
+    I ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
+
+    I nrowB = order == rocsparse_order_column ? ldb : B_m;
+    I ncolB = order == rocsparse_order_column ? B_n : ldb;
+    I nrowC = order == rocsparse_order_column ? ldc : C_m;
+    I ncolC = order == rocsparse_order_column ? C_n : ldc;
+
+    I nnz_B = nrowB * ncolB;
+    I nnz_C = nrowC * ncolC;
+
+    // Allocate host memory for vectors
+    host_vector<T> hB(nnz_B);
+    host_vector<T> hC_1(nnz_C);
+    host_vector<T> hC_2(nnz_C);
+    host_vector<T> hC_gold(nnz_C);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hB, nnz_B, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C, 1, 1);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate device memory
+    device_vector<I> dsell_slice_ptr(nslices + 1);
+    device_vector<I> dsell_row_perm(M);
+    device_vector<I> dsell_col_ind(sell_nnz);
+    device_vector<T> dsell_val(sell_nnz);
+    device_vector<T> dB(nnz_B);
+    device_vector<T> dC_1(nnz_C);
+    device_vector<T> dC_2(nnz_C);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    if(!dsell_slice_ptr || !dsell_row_perm || !dsell_col_ind || !dsell_val || !dB || !dC_1
+       || !dC_2 || !dalpha || !dbeta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dsell_slice_ptr,
+                              hsell_slice_ptr.data(),
+                              sizeof(I) * (nslices + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dsell_row_perm, hsell_row_perm.data(), sizeof(I) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dsell_col_ind, hsell_col_ind.data(), sizeof(I) * sell_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dsell_val, hsell_val.data(), sizeof(T) * sell_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(M,
+                            K,
+                            sell_nnz,
+                            slice_size,
+                            sigma,
+                            dsell_slice_ptr,
+                            dsell_row_perm,
+                            dsell_col_ind,
+                            dsell_val,
+                            itype,
+                            base,
+                            ttype);
+    rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, order);
+    rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
+    rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, order);
+
+    // Query SpMM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        handle, trans_A, trans_B, &halpha, A, B, &hbeta, C1, ttype, alg, &buffer_size, nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             &halpha,
+                                             A,
+                                             B,
+                                             &hbeta,
+                                             C1,
+                                             ttype,
+                                             alg,
+                                             &buffer_size,
+                                             dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+            handle, trans_A, trans_B, dalpha, A, B, dbeta, C2, ttype, alg, &buffer_size, dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU sellmm
+        host_sellmm(M,
+                    N,
+                    K,
+                    trans_B,
+                    halpha,
+                    hsell_slice_ptr,
+                    hsell_row_perm,
+                    hsell_col_ind,
+                    hsell_val,
+                    slice_size,
+                    hB,
+                    ldb,
+                    hbeta,
+                    hC_gold,
+                    ldc,
+                    order,
+                    base);
+
+        near_check_general<T>(nnz_C, 1, 1, hC_gold, hC_1);
+        near_check_general<T>(nnz_C, 1, 1, hC_gold, hC_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 &hbeta,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = spmm_gflop_count(N, nnz_A, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        // Padded entries are read, too
+        double gbyte_count = csrmm_gbyte_count<T>(
+            M, sell_nnz, (I)B_m * (I)B_n, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "C",
+                            slice_size,
+                            "sigma",
+                            sigma,
+                            "nnz_A",
+                            nnz_A,
+                            "SELL nnz",
+                            sell_nnz,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            gpu_time_used / 1e3,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                                \
+    template void testing_spmm_sell_bad_arg<ITYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_sell<ITYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, float);
+INSTANTIATE(int32_t, double);
+INSTANTIATE(int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, float);
+INSTANTIATE(int64_t, double);
+INSTANTIATE(int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, rocsparse_double_complex);
@@ -0,0 +1,213 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_ab.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <memory>
+
+template <typename T>
+void testing_spmv_ab(const Arguments& arg)
+{
+    rocsparse_int        M     = arg.M;
+    rocsparse_int        N     = arg.N;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_operation  trans = rocsparse_operation_none;
+    int                  iters = arg.iters;
+
+    T    h_alpha = arg.get_alpha<T>();
+    T    h_beta  = arg.get_beta<T>();
+    bool beta_nz = h_beta != static_cast<T>(0);
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    std::vector<std::string> names = rocsparse_ab_config_names("csr_adaptive,csr_stream");
+    for(const std::string& name : names)
+    {
+        if(name != "csr_adaptive" && name != "csr_stream" && name != "csr_merge" && name != "coo"
+           && name != "ell")
+        {
+            std::cerr << "Invalid A/B configuration " << name
+                      << " for spmv. Options: csr_adaptive, csr_stream, csr_merge, coo, ell"
+                      << std::endl;
+            return;
+        }
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        rocsparse_matrix_factory<T> matrix_factory(arg);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    if(M <= 0 || N <= 0 || hA.nnz <= 0)
+    {
+        std::cerr << "A/B benchmarking requires a non-empty matrix" << std::endl;
+        return;
+    }
+
+    rocsparse_int nnz = hA.nnz;
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    rocsparse_matrix_utils::init_exact(hy);
+
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    // Converted matrices are only allocated if any configuration requires them
+    std::unique_ptr<device_coo_matrix<T>> dCOO;
+    std::unique_ptr<device_ell_matrix<T>> dELL;
+
+    // Each configuration owns its descriptor, holding the analysis data of the algorithm
+    std::vector<std::unique_ptr<rocsparse_local_spmat>> descrs;
+    std::vector<void*>                                  buffers;
+    std::vector<rocsparse_ab_config>                    configs;
+
+    for(const std::string& name : names)
+    {
+        rocsparse_ab_config config;
+        config.name        = name;
+        config.gflop_count = spmv_gflop_count(M, nnz, beta_nz);
+
+        rocsparse_spmv_alg alg;
+        if(name == "coo")
+        {
+            if(!dCOO)
+            {
+                dCOO.reset(new device_coo_matrix<T>(M, N, nnz, base));
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csr2coo(handle, dA.ptr, nnz, M, dCOO->row_ind, base));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dCOO->col_ind, dA.ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dCOO->val, dA.val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+            }
+
+            alg                = rocsparse_spmv_alg_coo;
+            config.gbyte_count = coomv_gbyte_count<T>(M, N, nnz, beta_nz);
+            descrs.emplace_back(new rocsparse_local_spmat(*dCOO));
+        }
+        else if(name == "ell")
+        {
+            if(!dELL)
+            {
+                rocsparse_int ell_width;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csr2ell_width(handle, M, descr, dA.ptr, descr, &ell_width));
+
+                dELL.reset(new device_ell_matrix<T>(M, N, ell_width, base));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell<T>(handle,
+                                                           M,
+                                                           descr,
+                                                           dA.val,
+                                                           dA.ptr,
+                                                           dA.ind,
+                                                           descr,
+                                                           ell_width,
+                                                           dELL->val,
+                                                           dELL->ind));
+            }
+
+            alg                = rocsparse_spmv_alg_ell;
+            config.gbyte_count = ellmv_gbyte_count<T>(M, N, dELL->nnz, beta_nz);
+            descrs.emplace_back(new rocsparse_local_spmat(*dELL));
+        }
+        else
+        {
+            if(name == "csr_adaptive")
+            {
+                alg = rocsparse_spmv_alg_csr_adaptive;
+            }
+            else if(name == "csr_merge")
+            {
+                alg = rocsparse_spmv_alg_csr_merge;
+            }
+            else
+            {
+                alg = rocsparse_spmv_alg_csr_stream;
+            }
+
+            config.gbyte_count = csrmv_gbyte_count<T>(M, N, nnz, beta_nz);
+            descrs.emplace_back(new rocsparse_local_spmat(dA));
+        }
+
+        rocsparse_handle      h = handle;
+        rocsparse_spmat_descr A = *descrs.back();
+        rocsparse_dnvec_descr X = x;
+        rocsparse_dnvec_descr Y = y;
+
+        // Analysis is part of the buffer size query
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+            h, trans, &h_alpha, A, X, &h_beta, Y, ttype, alg, &buffer_size, nullptr));
+
+        void* dbuffer;
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+        buffers.push_back(dbuffer);
+
+        config.run = [=, &h_alpha, &h_beta]() mutable {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                h, trans, &h_alpha, A, X, &h_beta, Y, ttype, alg, &buffer_size, dbuffer));
+        };
+
+        configs.push_back(config);
+    }
+
+    std::vector<std::vector<double>> samples = rocsparse_ab_run(stream, iters, configs);
+
+    rocsparse_ab_report("spmv", rocsparse_datatype2string(ttype), configs, samples);
+
+    for(void* dbuffer : buffers)
+    {
+        CHECK_HIP_ERROR(hipFree(dbuffer));
+    }
+}
+
+#define INSTANTIATE(TYPE) template void testing_spmv_ab<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,349 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_autotune.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+// Formats that store more than this multiple of the non-zero entries are not considered
+static constexpr double autotune_max_fill = 4.0;
+
+template <typename T>
+void testing_spmv_autotune(const Arguments& arg)
+{
+    rocsparse_int        M     = arg.M;
+    rocsparse_int        N     = arg.N;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_operation  trans = rocsparse_operation_none;
+    int                  iters = arg.iters;
+
+    T    h_alpha = arg.get_alpha<T>();
+    T    h_beta  = arg.get_beta<T>();
+    bool beta_nz = h_beta != static_cast<T>(0);
+
+    rocsparse_indextype itype = get_indextype<rocsparse_int>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Sample matrix
+    host_csr_matrix<T> hA;
+    {
+        rocsparse_matrix_factory<T> matrix_factory(arg);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    if(M <= 0 || N <= 0 || hA.nnz <= 0)
+    {
+        std::cerr << "Autotuning requires a non-empty matrix" << std::endl;
+        return;
+    }
+
+    rocsparse_int nnz = hA.nnz;
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    rocsparse_matrix_utils::init_exact(hy);
+
+    device_dense_matrix<T> dx(hx);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    double gflop_count = spmv_gflop_count(M, nnz, beta_nz);
+
+    std::vector<rocsparse_autotune_candidate> candidates;
+
+    auto finish = [&](rocsparse_autotune_candidate& c, double gbyte_count) {
+        double gpu_time_used = c.median_msec * 1e3;
+        c.gflops             = get_gpu_gflops(gpu_time_used, gflop_count);
+        c.gbyte              = get_gpu_gbyte(gpu_time_used, gbyte_count);
+        candidates.push_back(c);
+    };
+
+    // Generic SpMV on a given sparse matrix descriptor, analysis is part of the buffer size query
+    auto generic = [&](rocsparse_autotune_candidate& c,
+                       rocsparse_spmat_descr         A,
+                       rocsparse_spmv_alg            alg,
+                       double                        gbyte_count) {
+        size_t buffer_size;
+        c.analysis_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                handle, trans, &h_alpha, A, x, &h_beta, y, ttype, alg, &buffer_size, nullptr));
+        });
+
+        void* dbuffer;
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+        rocsparse_autotune_time(c, stream, iters, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+                handle, trans, &h_alpha, A, x, &h_beta, y, ttype, alg, &buffer_size, dbuffer));
+        });
+
+        CHECK_HIP_ERROR(hipFree(dbuffer));
+
+        finish(c, gbyte_count);
+    };
+
+    //
+    // CSR, no conversion required
+    //
+    for(rocsparse_spmv_alg alg : {rocsparse_spmv_alg_csr_adaptive,
+                                  rocsparse_spmv_alg_csr_stream,
+                                  rocsparse_spmv_alg_csr_merge})
+    {
+        rocsparse_local_spmat A(dA);
+
+        rocsparse_autotune_candidate c;
+        c.format = rocsparse_format2string(rocsparse_format_csr);
+        c.alg    = rocsparse_spmvalg2string(alg);
+
+        generic(c, A, alg, csrmv_gbyte_count<T>(M, N, nnz, beta_nz));
+    }
+
+    //
+    // COO
+    //
+    {
+        device_coo_matrix<T> dC(M, N, nnz, base);
+
+        rocsparse_autotune_candidate c;
+        c.format       = rocsparse_format2string(rocsparse_format_coo);
+        c.alg          = rocsparse_spmvalg2string(rocsparse_spmv_alg_coo);
+        c.convert_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2coo(handle, dA.ptr, nnz, M, dC.row_ind, base));
+            CHECK_HIP_ERROR(hipMemcpyAsync(
+                dC.col_ind, dA.ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+            CHECK_HIP_ERROR(
+                hipMemcpyAsync(dC.val, dA.val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+        });
+
+        rocsparse_local_spmat A(dC);
+        generic(c, A, rocsparse_spmv_alg_coo, coomv_gbyte_count<T>(M, N, nnz, beta_nz));
+    }
+
+    //
+    // COO AoS, there is no device conversion, thus the conversion is done on the host
+    //
+    {
+        device_coo_aos_matrix<T> dC(M, N, nnz, base);
+
+        rocsparse_autotune_candidate c;
+        c.format       = rocsparse_format2string(rocsparse_format_coo_aos);
+        c.alg          = rocsparse_spmvalg2string(rocsparse_spmv_alg_coo);
+        c.params       = "host conversion";
+        c.convert_msec = rocsparse_autotune_time_once(stream, [&] {
+            host_coo_aos_matrix<T> hC(M, N, nnz, base);
+            host_csr_to_coo_aos(M, nnz, hA.ptr, hA.ind, hC.ind, base);
+            hC.val = hA.val;
+            dC.transfer_from(hC);
+        });
+
+        rocsparse_local_spmat A(dC);
+        generic(c, A, rocsparse_spmv_alg_coo, coomv_gbyte_count<T>(M, N, nnz, beta_nz));
+    }
+
+    //
+    // ELL
+    //
+    rocsparse_int ell_width;
+    double        ell_width_msec = rocsparse_autotune_time_once(stream, [&] {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell_width(handle, M, descr, dA.ptr, descr, &ell_width));
+    });
+
+    if(static_cast<double>(ell_width) * M > autotune_max_fill * nnz)
+    {
+        std::cout << "Skipping ell: width " << ell_width << " exceeds fill limit" << std::endl;
+    }
+    else
+    {
+        device_ell_matrix<T> dE(M, N, ell_width, base);
+
+        rocsparse_autotune_candidate c;
+        c.format       = rocsparse_format2string(rocsparse_format_ell);
+        c.alg          = rocsparse_spmvalg2string(rocsparse_spmv_alg_ell);
+        c.convert_msec = ell_width_msec + rocsparse_autotune_time_once(stream, [&] {
+                             CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell<T>(handle,
+                                                                        M,
+                                                                        descr,
+                                                                        dA.val,
+                                                                        dA.ptr,
+                                                                        dA.ind,
+                                                                        descr,
+                                                                        ell_width,
+                                                                        dE.val,
+                                                                        dE.ind));
+                         });
+
+        rocsparse_local_spmat A(dE);
+        generic(c, A, rocsparse_spmv_alg_ell, ellmv_gbyte_count<T>(M, N, dE.nnz, beta_nz));
+    }
+
+    //
+    // HYB
+    //
+    for(rocsparse_hyb_partition part :
+        {rocsparse_hyb_partition_auto, rocsparse_hyb_partition_user, rocsparse_hyb_partition_max})
+    {
+        if(part == rocsparse_hyb_partition_max
+           && static_cast<double>(ell_width) * M > autotune_max_fill * nnz)
+        {
+            continue;
+        }
+
+        // User partition stores the average number of entries per row in the ELL part
+        rocsparse_int user_ell_width = (nnz - 1) / M + 1;
+
+        rocsparse_local_hyb_mat hyb;
+
+        rocsparse_autotune_candidate c;
+        c.format       = "hyb";
+        c.alg          = rocsparse_partition2string(part);
+        c.params       = (part == rocsparse_hyb_partition_user)
+                             ? "width=" + std::to_string(user_ell_width)
+                             : "";
+        c.convert_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(
+                handle, M, N, descr, dA.val, dA.ptr, dA.ind, hyb, user_ell_width, part));
+        });
+
+        rocsparse_autotune_time(c, stream, iters, [&] {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_hybmv<T>(handle, trans, &h_alpha, descr, hyb, dx, &h_beta, dy));
+        });
+
+        rocsparse_hyb_mat ptr  = hyb;
+        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
+
+        finish(c,
+               ellmv_gbyte_count<T>(M, N, dhyb->ell_nnz, beta_nz)
+                   + coomv_gbyte_count<T>(M, N, dhyb->coo_nnz, true));
+    }
+
+    //
+    // BSR
+    //
+    for(rocsparse_int block_dim : {2, 4, 8, 16})
+    {
+        rocsparse_int mb = (M + block_dim - 1) / block_dim;
+        rocsparse_int nb = (N + block_dim - 1) / block_dim;
+
+        device_vector<rocsparse_int> dbsr_row_ptr(mb + 1);
+
+        rocsparse_int nnzb;
+        double        nnzb_msec = rocsparse_autotune_time_once(stream, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                        rocsparse_direction_row,
+                                                        M,
+                                                        N,
+                                                        descr,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        block_dim,
+                                                        descr,
+                                                        dbsr_row_ptr,
+                                                        &nnzb));
+        });
+
+        if(static_cast<double>(nnzb) * block_dim * block_dim > autotune_max_fill * nnz)
+        {
+            std::cout << "Skipping bsr: block_dim " << block_dim << " exceeds fill limit"
+                      << std::endl;
+            continue;
+        }
+
+        device_vector<rocsparse_int> dbsr_col_ind(nnzb);
+        device_vector<T>             dbsr_val(size_t(nnzb) * block_dim * block_dim);
+
+        rocsparse_autotune_candidate c;
+        c.format       = "bsr";
+        c.alg          = rocsparse_direction2string(rocsparse_direction_row);
+        c.params       = "block_dim=" + std::to_string(block_dim);
+        c.convert_msec = nnzb_msec + rocsparse_autotune_time_once(stream, [&] {
+                             CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
+                                                                        rocsparse_direction_row,
+                                                                        M,
+                                                                        N,
+                                                                        descr,
+                                                                        dA.val,
+                                                                        dA.ptr,
+                                                                        dA.ind,
+                                                                        block_dim,
+                                                                        descr,
+                                                                        dbsr_val,
+                                                                        dbsr_row_ptr,
+                                                                        dbsr_col_ind));
+                         });
+
+        // BSR operates on padded vectors
+        device_vector<T> dx_pad(size_t(nb) * block_dim);
+        device_vector<T> dy_pad(size_t(mb) * block_dim);
+        CHECK_HIP_ERROR(hipMemset(dx_pad, 0, sizeof(T) * nb * block_dim));
+        CHECK_HIP_ERROR(hipMemset(dy_pad, 0, sizeof(T) * mb * block_dim));
+        CHECK_HIP_ERROR(hipMemcpy(dx_pad, dx.val, sizeof(T) * N, hipMemcpyDeviceToDevice));
+
+        rocsparse_autotune_time(c, stream, iters, [&] {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv<T>(handle,
+                                                     rocsparse_direction_row,
+                                                     trans,
+                                                     mb,
+                                                     nb,
+                                                     nnzb,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dbsr_val,
+                                                     dbsr_row_ptr,
+                                                     dbsr_col_ind,
+                                                     block_dim,
+                                                     dx_pad,
+                                                     &h_beta,
+                                                     dy_pad));
+        });
+
+        finish(c, bsrmv_gbyte_count<T>(mb, nb, nnzb, block_dim, beta_nz));
+    }
+
+    rocsparse_autotune_report("spmv", rocsparse_datatype2string(ttype), M, N, nnz, candidates);
+}
+
+#define INSTANTIATE(TYPE) template void testing_spmv_autotune<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
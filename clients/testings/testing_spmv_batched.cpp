@@ -0,0 +1,374 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched_bad_arg(const Arguments& arg)
+{
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle  = local_handle;
+    rocsparse_operation trans   = rocsparse_operation_none;
+    const void*         p_alpha = (const void*)&alpha;
+    const void*         p_beta  = (const void*)&beta;
+    rocsparse_spmv_alg  alg     = rocsparse_spmv_alg_default;
+    size_t              buffer_size;
+    size_t*             p_buffer_size = &buffer_size;
+    void*               temp_buffer   = (void*)0x4;
+    rocsparse_datatype  ttype         = get_datatype<T>();
+
+#define PARAMS                                                                                  \
+    handle, trans, p_alpha, (const rocsparse_spmat_descr&)mat, (const rocsparse_dnvec_descr&)x, \
+        p_beta, (rocsparse_dnvec_descr&)y, ttype, alg, p_buffer_size, temp_buffer
+
+    {
+        device_csr_matrix<T, I, J> dA;
+        device_dense_matrix<T>     dx, dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        //
+        // INVALID BATCHES
+        //
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(mat, 0, 0),
+                                rocsparse_status_invalid_size);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 0, 0),
+                                rocsparse_status_invalid_size);
+
+        //
+        // BATCH COUNT OF Y HAS TO MATCH THE MATRIX
+        //
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(mat, 4, 0));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_size);
+
+        //
+        // X IS EITHER SHARED OR HOLDS THE SAME BATCH COUNT
+        //
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y, 4, 0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, 3, 0));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_size);
+
+        //
+        // NOT IMPLEMENTED CASES
+        //
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, 1, 0));
+        trans = rocsparse_operation_transpose;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+        trans = rocsparse_operation_none;
+    }
+
+    {
+        //
+        // BATCHES ARE ONLY AVAILABLE FOR CSR
+        //
+        device_coo_matrix<T, I> dA;
+        rocsparse_local_spmat   mat(dA);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(mat, 4, 0),
+                                rocsparse_status_invalid_value);
+    }
+
+    //
+    // AUTOMATIC BAD ARGS.
+    //
+    {
+        device_csr_matrix<T, I, J> dA;
+        device_dense_matrix<T>     dx, dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(mat, 4, 0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y, 4, 0));
+
+        //
+        // WITH 2 ARGUMENTS BEING SKIPPED DURING THE CHECK.
+        //
+        static const int nex   = 2;
+        static const int ex[2] = {9, 10};
+        auto_testing_bad_arg(rocsparse_spmv, nex, ex, PARAMS);
+
+        p_buffer_size = nullptr;
+        temp_buffer   = nullptr;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_pointer);
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched(const Arguments& arg)
+{
+    J                    M           = arg.M;
+    J                    N           = arg.N;
+    int                  batch_count = arg.K;
+    rocsparse_operation  trans       = arg.transA;
+    rocsparse_index_base base        = arg.baseA;
+    rocsparse_spmv_alg   alg         = arg.spmv_alg;
+    rocsparse_datatype   ttype       = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS(alpha_, A_, x_, beta_, y_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+    {
+        if(M == 0 || N == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_csr_matrix<T, I, J> dA;
+            device_dense_matrix<T>     dx, dy;
+
+            rocsparse_local_spmat mat(dA);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(mat, batch_count, 0));
+            CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, batch_count, 0));
+            CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y, batch_count, 0));
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    //
+    // INITIALIZATE THE SPARSITY PATTERN SHARED BY ALL BATCHES
+    //
+    host_csr_matrix<T, I, J> hA;
+    {
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, !arg.timing);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    device_csr_matrix<T, I, J> dA(hA);
+
+    //
+    // EACH BATCH HOLDS ITS OWN VALUES, ONE BATCH PER COLUMN
+    //
+    host_dense_matrix<T> hval(hA.nnz, batch_count);
+    rocsparse_matrix_utils::init_exact(hval);
+    device_dense_matrix<T> dval(hval);
+
+    host_dense_matrix<T> hx(N, batch_count);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, batch_count);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat mat(hA.m,
+                              hA.n,
+                              hA.nnz,
+                              dA.ptr,
+                              dA.ind,
+                              dval.val,
+                              get_indextype<I>(),
+                              get_indextype<J>(),
+                              hA.base,
+                              ttype,
+                              rocsparse_format_csr);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(mat, batch_count, hval.ld));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, batch_count, hx.ld));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y, batch_count, hy.ld));
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+
+        // CPU batched csrmv
+        {
+            host_dense_matrix<T> hy_copy(hy);
+            host_csrmv_strided_batched<I, J, T>(hA.m,
+                                                hA.nnz,
+                                                batch_count,
+                                                *h_alpha,
+                                                hA.ptr,
+                                                hA.ind,
+                                                hval,
+                                                hval.ld,
+                                                hx,
+                                                hx.ld,
+                                                *h_beta,
+                                                hy,
+                                                hy.ld,
+                                                hA.base);
+            hy.near_check(dy);
+            dy.transfer_from(hy_copy);
+            hy.transfer_from(hy_copy);
+        }
+
+        // Pointer mode device
+        {
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(d_alpha, mat, x, d_beta, y)));
+        }
+
+        // A single vector x shared by all batches
+        {
+            rocsparse_local_dnvec x_shared(dx);
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x_shared, h_beta, y)));
+        }
+
+        // CPU batched csrmv, first with the batched x and then with the shared x
+        host_csrmv_strided_batched<I, J, T>(hA.m,
+                                            hA.nnz,
+                                            batch_count,
+                                            *h_alpha,
+                                            hA.ptr,
+                                            hA.ind,
+                                            hval,
+                                            hval.ld,
+                                            hx,
+                                            hx.ld,
+                                            *h_beta,
+                                            hy,
+                                            hy.ld,
+                                            hA.base);
+        host_csrmv_strided_batched<I, J, T>(hA.m,
+                                            hA.nnz,
+                                            batch_count,
+                                            *h_alpha,
+                                            hA.ptr,
+                                            hA.ind,
+                                            hval,
+                                            hval.ld,
+                                            hx,
+                                            0,
+                                            *h_beta,
+                                            hy,
+                                            hy.ld,
+                                            hA.base);
+
+        hy.near_check(dy);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        bool   nonzero_beta = *h_beta != static_cast<T>(0);
+        double gflop_count  = batch_count * spmv_gflop_count(M, hA.nnz, nonzero_beta);
+        double gbyte_count  = csrmv_strided_batched_gbyte_count<T>(
+            M, N, hA.nnz, batch_count, true, nonzero_beta);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            hA.nnz,
+                            "batch_count",
+                            batch_count,
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                    \
+    template void testing_spmv_batched_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_batched<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,402 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused_bad_arg(const Arguments& arg)
+{
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle  = local_handle;
+    rocsparse_operation trans   = rocsparse_operation_none;
+    const void*         p_alpha = (const void*)&alpha;
+    const void*         p_beta  = (const void*)&beta;
+    T                   dot_result;
+    T                   nrm2_result;
+    void*               p_dot_result  = (void*)&dot_result;
+    void*               p_nrm2_result = (void*)&nrm2_result;
+    size_t              buffer_size;
+    size_t*             p_buffer_size = &buffer_size;
+    void*               temp_buffer   = (void*)0x4;
+    rocsparse_datatype  ttype         = get_datatype<T>();
+
+#define PARAMS_DOT                                                                              \
+    handle, trans, p_alpha, (const rocsparse_spmat_descr&)mat, (const rocsparse_dnvec_descr&)x, \
+        p_beta, (rocsparse_dnvec_descr&)y, p_dot_result, p_nrm2_result, ttype, p_buffer_size,   \
+        temp_buffer
+
+#define PARAMS_RESIDUAL                                                                      \
+    handle, trans, (const rocsparse_spmat_descr&)mat, (const rocsparse_dnvec_descr&)x,       \
+        (const rocsparse_dnvec_descr&)y, (rocsparse_dnvec_descr&)y, p_nrm2_result, ttype, \
+        p_buffer_size, temp_buffer
+
+    {
+        device_csr_matrix<T, I, J> dA;
+        device_dense_matrix<T>     dx, dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        //
+        // NOT IMPLEMENTED CASES
+        //
+        trans = rocsparse_operation_transpose;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_dot(PARAMS_DOT), rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL),
+                                rocsparse_status_not_implemented);
+        trans = rocsparse_operation_none;
+
+        //
+        // BATCHES ARE NOT SUPPORTED
+        //
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(mat, 4, 0));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_dot(PARAMS_DOT), rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL),
+                                rocsparse_status_not_implemented);
+    }
+
+    {
+        //
+        // THE DOT PRODUCT REQUIRES A SQUARE MATRIX
+        //
+        device_csr_matrix<T, I, J> dA(2, 3, 0, rocsparse_index_base_zero);
+        device_dense_matrix<T>     dx(3, 1), dy(2, 1);
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_dot(PARAMS_DOT), rocsparse_status_invalid_size);
+    }
+
+    {
+        //
+        // ONLY CSR IS SUPPORTED
+        //
+        device_coo_matrix<T, I> dA;
+        device_dense_matrix<T>  dx, dy;
+        rocsparse_local_spmat   mat(dA);
+        rocsparse_local_dnvec   x(dx);
+        rocsparse_local_dnvec   y(dy);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_dot(PARAMS_DOT), rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL),
+                                rocsparse_status_not_implemented);
+    }
+
+    //
+    // AUTOMATIC BAD ARGS.
+    //
+    {
+        device_csr_matrix<T, I, J> dA;
+        device_dense_matrix<T>     dx, dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        //
+        // THE RESULTS AND THE BUFFER ARGUMENTS ARE SKIPPED DURING THE CHECK.
+        //
+        {
+            static const int nex   = 4;
+            static const int ex[4] = {7, 8, 10, 11};
+            auto_testing_bad_arg(rocsparse_spmv_dot, nex, ex, PARAMS_DOT);
+        }
+
+        {
+            static const int nex   = 3;
+            static const int ex[3] = {6, 8, 9};
+            auto_testing_bad_arg(rocsparse_spmv_residual, nex, ex, PARAMS_RESIDUAL);
+        }
+
+        p_buffer_size = nullptr;
+        temp_buffer   = nullptr;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_dot(PARAMS_DOT), rocsparse_status_invalid_pointer);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL),
+                                rocsparse_status_invalid_pointer);
+    }
+
+#undef PARAMS_RESIDUAL
+#undef PARAMS_DOT
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_datatype   ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS_DOT(alpha_, A_, x_, beta_, y_, dot_, nrm2_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, dot_, nrm2_, ttype, &buffer_size, dbuffer
+
+#define PARAMS_RESIDUAL(A_, x_, b_, r_, nrm2_) \
+    handle, trans, A_, x_, b_, r_, nrm2_, ttype, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        if(M == 0 || N == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_csr_matrix<T, I, J> dA;
+            device_dense_matrix<T>     dx, dy;
+
+            rocsparse_local_spmat mat(dA);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            host_scalar<T> h_nrm2;
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_spmv_dot(PARAMS_DOT(h_alpha, mat, x, h_beta, y, nullptr, h_nrm2)),
+                rocsparse_status_success);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL(mat, x, y, y, h_nrm2)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_spmv_dot(PARAMS_DOT(h_alpha, mat, x, h_beta, y, nullptr, h_nrm2)),
+                rocsparse_status_success);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_residual(PARAMS_RESIDUAL(mat, x, y, y, h_nrm2)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    //
+    // INITIALIZATE THE MATRIX
+    //
+    host_csr_matrix<T, I, J> hA;
+    {
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, !arg.timing);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    device_csr_matrix<T, I, J> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    host_dense_matrix<T> hb(M, 1);
+    rocsparse_matrix_utils::init_exact(hb);
+    device_dense_matrix<T> db(hb);
+
+    host_dense_matrix<T>   hr(M, 1);
+    device_dense_matrix<T> dr(M, 1);
+
+    rocsparse_local_spmat mat(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+    rocsparse_local_dnvec b(db);
+    rocsparse_local_dnvec r(dr);
+
+    // The dot product is only defined for square matrices
+    bool with_dot = (M == N);
+
+    host_scalar<T> h_dot, h_nrm2, h_res_nrm2;
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv_dot(
+        PARAMS_DOT(h_alpha, mat, x, h_beta, y, (with_dot ? (T*)h_dot : nullptr), h_nrm2)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        host_dense_matrix<T> hy_copy(hy);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv_dot(
+            PARAMS_DOT(h_alpha, mat, x, h_beta, y, (with_dot ? (T*)h_dot : nullptr), h_nrm2)));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_spmv_residual(PARAMS_RESIDUAL(mat, x, b, r, (T*)h_res_nrm2)));
+
+        // CPU fused csrmv
+        host_scalar<T> h_dot_gold, h_nrm2_gold, h_res_nrm2_gold;
+        host_csrmv_fused<I, J, T>(hA.m,
+                                  hA.nnz,
+                                  *h_alpha,
+                                  hA.ptr,
+                                  hA.ind,
+                                  hA.val,
+                                  hx,
+                                  *h_beta,
+                                  hy,
+                                  hy,
+                                  (with_dot ? (T*)h_dot_gold : nullptr),
+                                  h_nrm2_gold,
+                                  hA.base);
+        host_csrmv_fused<I, J, T>(hA.m,
+                                  hA.nnz,
+                                  static_cast<T>(-1),
+                                  hA.ptr,
+                                  hA.ind,
+                                  hA.val,
+                                  hx,
+                                  static_cast<T>(1),
+                                  hb,
+                                  hr,
+                                  nullptr,
+                                  h_res_nrm2_gold,
+                                  hA.base);
+
+        hy.near_check(dy);
+        hr.near_check(dr);
+        h_nrm2_gold.near_check(h_nrm2);
+        h_res_nrm2_gold.near_check(h_res_nrm2);
+
+        if(with_dot)
+        {
+            h_dot_gold.near_check(h_dot);
+        }
+
+        // Pointer mode device, with y restored to its initial values
+        {
+            dy.transfer_from(hy_copy);
+
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            device_scalar<T> d_dot, d_nrm2, d_res_nrm2;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_dot(
+                PARAMS_DOT(d_alpha, mat, x, d_beta, y, (with_dot ? (T*)d_dot : nullptr), d_nrm2)));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_spmv_residual(PARAMS_RESIDUAL(mat, x, b, r, (T*)d_res_nrm2)));
+
+            hy.near_check(dy);
+            hr.near_check(dr);
+
+            // The reductions are deterministic, thus both pointer modes match bitwise
+            h_nrm2.unit_check(d_nrm2);
+            h_res_nrm2.unit_check(d_res_nrm2);
+
+            if(with_dot)
+            {
+                h_dot.unit_check(d_dot);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Results are kept on the device, as they would be within an iterative solver
+        device_scalar<T> d_alpha(h_alpha), d_beta(h_beta), d_dot, d_nrm2;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_dot(
+                PARAMS_DOT(d_alpha, mat, x, d_beta, y, (with_dot ? (T*)d_dot : nullptr), d_nrm2)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_dot(
+                PARAMS_DOT(d_alpha, mat, x, d_beta, y, (with_dot ? (T*)d_dot : nullptr), d_nrm2)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        bool   nonzero_beta = *h_beta != static_cast<T>(0);
+        double gflop_count  = spmv_gflop_count(M, hA.nnz, nonzero_beta)
+                             + (with_dot ? 2 : 1) * doti_gflop_count(M);
+        double gbyte_count = csrmv_gbyte_count<T>(M, N, hA.nnz, nonzero_beta);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            hA.nnz,
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS_RESIDUAL
+#undef PARAMS_DOT
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                  \
+    template void testing_spmv_fused_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_fused<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
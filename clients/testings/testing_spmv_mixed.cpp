@@ -0,0 +1,379 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+//
+// Storage precision of the matrix values for a given compute precision.
+//
+template <typename T>
+struct testing_spmv_mixed_storage;
+
+template <>
+struct testing_spmv_mixed_storage<double>
+{
+    using type = float;
+};
+
+template <>
+struct testing_spmv_mixed_storage<rocsparse_double_complex>
+{
+    using type = rocsparse_float_complex;
+};
+
+template <typename I, typename J, typename T>
+void testing_spmv_mixed_bad_arg(const Arguments& arg)
+{
+    using A = typename testing_spmv_mixed_storage<T>::type;
+
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle  = local_handle;
+    rocsparse_operation trans   = rocsparse_operation_none;
+    const void*         p_alpha = (const void*)&alpha;
+    const void*         p_beta  = (const void*)&beta;
+    rocsparse_spmv_alg  alg     = rocsparse_spmv_alg_default;
+    size_t              buffer_size;
+    size_t*             p_buffer_size = &buffer_size;
+    void*               temp_buffer   = (void*)0x4;
+    rocsparse_datatype  ttype         = get_datatype<T>();
+
+#define PARAMS                                                                                  \
+    handle, trans, p_alpha, (const rocsparse_spmat_descr&)mat, (const rocsparse_dnvec_descr&)x, \
+        p_beta, (rocsparse_dnvec_descr&)y, ttype, alg, p_buffer_size, temp_buffer
+
+    //
+    // NOT IMPLEMENTED CASES
+    //
+    {
+        //
+        // VECTORS IN THE STORAGE PRECISION
+        //
+        device_csr_matrix<A, I, J> dA;
+        device_dense_matrix<A>     dx;
+        device_dense_matrix<T>     dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    {
+        //
+        // MIXED PRECISION IS ONLY AVAILABLE FOR CSR
+        //
+        device_coo_matrix<A, I> dA;
+        device_dense_matrix<T>  dx, dy;
+        rocsparse_local_spmat   mat(dA);
+        rocsparse_local_dnvec   x(dx);
+        rocsparse_local_dnvec   y(dy);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    //
+    // AUTOMATIC BAD ARGS.
+    //
+    {
+        device_csr_matrix<A, I, J> dA;
+        device_dense_matrix<T>     dx, dy;
+        rocsparse_local_spmat      mat(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+
+        //
+        // WITH 2 ARGUMENTS BEING SKIPPED DURING THE CHECK.
+        //
+        static const int nex   = 2;
+        static const int ex[2] = {9, 10};
+        auto_testing_bad_arg(rocsparse_spmv, nex, ex, PARAMS);
+
+        p_buffer_size = nullptr;
+        temp_buffer   = nullptr;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_pointer);
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_mixed(const Arguments& arg)
+{
+    using A = typename testing_spmv_mixed_storage<T>::type;
+
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+    rocsparse_datatype   ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS(alpha_, A_, x_, beta_, y_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        if(M == 0 || N == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_csr_matrix<A, I, J> dA;
+            device_dense_matrix<T>     dx, dy;
+
+            rocsparse_local_spmat mat(dA);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    //
+    // INITIALIZATE THE SPARSE MATRIX IN THE COMPUTE PRECISION
+    //
+    host_csr_matrix<T, I, J> hA;
+    {
+        // Integer values are exact in both precisions for the unit check
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, !arg.timing);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    //
+    // ROUND THE VALUES TO THE STORAGE PRECISION
+    //
+    host_csr_matrix<A, I, J> hA_low(hA.m, hA.n, hA.nnz, hA.base);
+    hA_low.ptr.transfer_from(hA.ptr);
+    hA_low.ind.transfer_from(hA.ind);
+    for(I i = 0; i < hA.nnz; ++i)
+    {
+        hA_low.val[i] = host_convert_value<A>(hA.val[i]);
+    }
+
+    device_csr_matrix<A, I, J> dA_low(hA_low);
+
+    host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat mat(dA_low);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+
+        // CPU csrmv, values of the storage precision accumulated in the compute precision
+        {
+            host_dense_matrix<T> hy_copy(hy);
+            host_csrmv_mixed<I, J, A, T>(trans,
+                                         hA_low.m,
+                                         hA_low.n,
+                                         hA_low.nnz,
+                                         *h_alpha,
+                                         hA_low.ptr,
+                                         hA_low.ind,
+                                         hA_low.val,
+                                         hx,
+                                         *h_beta,
+                                         hy,
+                                         hA_low.base);
+            hy.near_check(dy);
+            dy.transfer_from(hy_copy);
+        }
+
+        // Pointer mode device
+        {
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(d_alpha, mat, x, d_beta, y)));
+        }
+
+        hy.near_check(dy);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        //
+        // THE SAME MATRIX IN THE COMPUTE PRECISION SERVES AS ACCURACY AND SPEED BASELINE
+        //
+        device_csr_matrix<T, I, J> dA(hA);
+        device_dense_matrix<T>     dy_full(hy);
+        rocsparse_local_spmat      mat_full(dA);
+        rocsparse_local_dnvec      y_full(dy_full);
+
+        void*  dbuffer_full = nullptr;
+        size_t buffer_size_full;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                             trans,
+                                             h_alpha,
+                                             mat_full,
+                                             x,
+                                             h_beta,
+                                             y_full,
+                                             ttype,
+                                             alg,
+                                             &buffer_size_full,
+                                             nullptr));
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer_full, buffer_size_full));
+
+#define PARAMS_FULL                                                                     \
+    handle, trans, h_alpha, mat_full, x, h_beta, y_full, ttype, alg, &buffer_size_full, \
+        dbuffer_full
+
+        // Single product from the same initial y to measure the error
+        dy.transfer_from(hy);
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS_FULL));
+
+        host_dense_matrix<T> hy_mixed(dy);
+        host_dense_matrix<T> hy_full(dy_full);
+
+        // Maximum error relative to the largest entry of the full precision result
+        double max_err = 0.0;
+        double max_ref = 0.0;
+        for(rocsparse_int i = 0; i < hy_full.m; ++i)
+        {
+            max_err = std::max(max_err, (double)std::abs(hy_mixed[i] - hy_full[i]));
+            max_ref = std::max(max_ref, (double)std::abs(hy_full[i]));
+        }
+        double rel_err = (max_ref > 0.0) ? max_err / max_ref : max_err;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS_FULL));
+        }
+
+        // Performance run in mixed precision
+        double gpu_time_used = get_time_us();
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, mat, x, h_beta, y)));
+        }
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // Performance run in full precision
+        double gpu_time_full = get_time_us();
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS_FULL));
+        }
+        gpu_time_full = (get_time_us() - gpu_time_full) / number_hot_calls;
+
+#undef PARAMS_FULL
+
+        bool   nonzero_beta = *h_beta != static_cast<T>(0);
+        double gflop_count  = spmv_gflop_count(M, hA.nnz, nonzero_beta);
+        double gbyte_count  = csrmv_mixed_gbyte_count<A, T>(M, N, hA.nnz, nonzero_beta);
+        double gbyte_full   = csrmv_gbyte_count<T>(M, N, hA.nnz, nonzero_beta);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            hA.nnz,
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "matrix",
+                            rocsparse_datatype2string(get_datatype<A>()),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "full GB/s",
+                            get_gpu_gbyte(gpu_time_full, gbyte_full),
+                            "full msec",
+                            get_gpu_time_msec(gpu_time_full),
+                            "speedup",
+                            gpu_time_full / gpu_time_used,
+                            "rel error",
+                            rel_err,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+
+        CHECK_HIP_ERROR(hipFree(dbuffer_full));
+    }
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                  \
+    template void testing_spmv_mixed_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_mixed<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,251 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <algorithm>
+
+template <typename T>
+void testing_workspace_plan_bad_arg(const Arguments& arg)
+{
+    rocsparse_workspace_plan plan;
+    rocsparse_int            step;
+    size_t                   size;
+
+    // Invalid pointers
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_workspace_plan(nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_workspace_plan(nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(nullptr, 0, -1, &step),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_size(nullptr, &size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_offset(nullptr, 0, &size),
+                            rocsparse_status_invalid_pointer);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_workspace_plan(&plan));
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(plan, 0, -1, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_size(plan, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Shared step must be an earlier step
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(plan, 0, 0, &step),
+                            rocsparse_status_invalid_value);
+    CHECK_ROCSPARSE_ERROR(rocsparse_workspace_plan_add_step(plan, 0, -1, &step));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(plan, 0, -2, &step),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(plan, 0, 1, &step),
+                            rocsparse_status_invalid_value);
+
+    // Invalid buffer size
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_add_step(plan, ~size_t(0), -1, &step),
+                            rocsparse_status_invalid_size);
+
+    // Invalid step
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_offset(plan, 0, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_offset(plan, -1, &size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_plan_get_offset(plan, 1, &size),
+                            rocsparse_status_invalid_value);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_workspace_plan(plan));
+}
+
+template <typename T>
+void testing_workspace_plan(const Arguments& arg)
+{
+    static constexpr size_t alignment = 256;
+
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    if(M <= 0 || N < 0)
+    {
+        return;
+    }
+
+    // Random sequence of M steps with buffers of up to N bytes, a third of the
+    // steps share the buffer of an earlier step
+    host_vector<size_t>        sizes(M);
+    host_vector<rocsparse_int> shared(M);
+
+    rocsparse_seedrand();
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        sizes[i]  = random_generator<rocsparse_int>(0, N);
+        shared[i] = (i > 0 && random_generator<rocsparse_int>(0, 2) == 0)
+                        ? random_generator<rocsparse_int>(0, i - 1)
+                        : -1;
+    }
+
+    rocsparse_workspace_plan plan;
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_workspace_plan(&plan));
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int step;
+        CHECK_ROCSPARSE_ERROR(rocsparse_workspace_plan_add_step(plan, sizes[i], shared[i], &step));
+        unit_check_general<rocsparse_int>(1, 1, 1, &i, &step);
+    }
+
+    size_t              workspace_size;
+    host_vector<size_t> offsets(M);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_workspace_plan_get_size(plan, &workspace_size));
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_workspace_plan_get_offset(plan, i, &offsets[i]));
+    }
+
+    if(arg.unit_check)
+    {
+        // Lifetime and size of the buffer of each owning step
+        host_vector<rocsparse_int> owner(M);
+        host_vector<rocsparse_int> last(M);
+        host_vector<size_t>        size(M, 0);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            owner[i] = (shared[i] == -1) ? i : owner[shared[i]];
+            last[i]  = i;
+
+            last[owner[i]] = i;
+            size[owner[i]] = std::max(size[owner[i]], sizes[i]);
+        }
+
+        size_t total = 0;
+        size_t peak  = 0;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            // Steps share the offset of the buffer they use
+            unit_check_general<size_t>(1, 1, 1, &offsets[owner[i]], &offsets[i]);
+
+            // Offsets are aligned and buffers fit into the workspace
+            size_t misalignment = offsets[i] % alignment;
+            size_t zero         = 0;
+            unit_check_general<size_t>(1, 1, 1, &zero, &misalignment);
+
+            EXPECT_ROCSPARSE_STATUS((offsets[i] + sizes[i] <= workspace_size)
+                                        ? rocsparse_status_success
+                                        : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+
+            if(owner[i] != i)
+            {
+                continue;
+            }
+
+            total += (size[i] + alignment - 1) / alignment * alignment;
+
+            // Buffers that are live at the same time must not overlap
+            for(rocsparse_int j = 0; j < i; ++j)
+            {
+                if(owner[j] != j || size[i] == 0 || size[j] == 0 || last[j] < i)
+                {
+                    continue;
+                }
+
+                bool overlap
+                    = offsets[i] < offsets[j] + size[j] && offsets[j] < offsets[i] + size[i];
+
+                EXPECT_ROCSPARSE_STATUS(overlap ? rocsparse_status_internal_error
+                                                : rocsparse_status_success,
+                                        rocsparse_status_success);
+            }
+        }
+
+        // The workspace is bounded by the peak of the live bytes and the sum of all buffers
+        for(rocsparse_int s = 0; s < M; ++s)
+        {
+            size_t live = 0;
+            for(rocsparse_int i = 0; i <= s; ++i)
+            {
+                if(owner[i] == i && last[i] >= s)
+                {
+                    live += size[i];
+                }
+            }
+
+            peak = std::max(peak, live);
+        }
+
+        EXPECT_ROCSPARSE_STATUS((peak <= workspace_size && workspace_size <= total)
+                                    ? rocsparse_status_success
+                                    : rocsparse_status_internal_error,
+                                rocsparse_status_success);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_workspace_plan(plan));
+
+    if(arg.timing)
+    {
+        int number_hot_calls = arg.iters;
+
+        double cpu_time_used = get_time_us();
+
+        // Plan construction and packing
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_workspace_plan(&plan));
+
+            for(rocsparse_int i = 0; i < M; ++i)
+            {
+                rocsparse_int step;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_workspace_plan_add_step(plan, sizes[i], shared[i], &step));
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_workspace_plan_get_size(plan, &workspace_size));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_workspace_plan(plan));
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / number_hot_calls;
+
+        display_timing_info("steps",
+                            M,
+                            "max bytes",
+                            N,
+                            "workspace bytes",
+                            workspace_size,
+                            "plan usec",
+                            cpu_time_used,
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_workspace_plan_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_workspace_plan<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
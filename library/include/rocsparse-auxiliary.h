@@ -57,6 +57,43 @@ extern "C" {
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_create_handle(rocsparse_handle* handle);
 
+/*! \ingroup aux_module
+ *  \brief Create a rocsparse handle with flags
+ *
+ *  \details
+ *  \p rocsparse_create_handle_with_flags creates the rocSPARSE library context, like
+ *  rocsparse_create_handle(). \p flags is a bitwise combination of
+ *  \ref rocsparse_handle_flags.
+ *
+ *  If \ref rocsparse_handle_flags_lazy is set, the device scratch buffer and the device
+ *  constants of the handle are allocated by the first function that requires them,
+ *  instead of on creation.
+ *
+ *  If \ref rocsparse_handle_flags_pooled is set, the handle is taken from a process-wide
+ *  pool of previously destroyed handles of the active device, if available. A pooled
+ *  handle is returned to the pool by rocsparse_destroy_handle(), with its stream and
+ *  pointer mode reset to their defaults. The pool holds up to
+ *  \p ROCSPARSE_HANDLE_POOL_SIZE handles, 16 by default. Handles with asynchronous
+ *  logging or profiling enabled are never returned to the pool, such that all their log
+ *  records are written when they are destroyed.
+ *
+ *  \note
+ *  Lazy handles perform the allocations within the first function call that requires
+ *  them, which is not allowed during stream capture.
+ *
+ *  @param[out]
+ *  handle  the pointer to the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  flags   bitwise combination of \ref rocsparse_handle_flags.
+ *
+ *  \retval rocsparse_status_success the initialization succeeded.
+ *  \retval rocsparse_status_invalid_handle \p handle pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p flags contains unknown bits.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_handle_with_flags(rocsparse_handle* handle, unsigned int flags);
+
 /*! \ingroup aux_module
  *  \brief Destroy a rocsparse handle
  *
@@ -468,6 +505,359 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Serialize a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_serialize writes the meta data that has been gathered by
+ *  rocsparse_csrmv_analysis() and the triangular analysis routines (e.g.
+ *  rocsparse_csrsv_analysis(), rocsparse_csrsm_analysis(), rocsparse_csrilu0_analysis(),
+ *  rocsparse_csric0_analysis() and rocsparse_bsrsv_analysis()) into a host buffer,
+ *  together with a fingerprint of the sparsity pattern the analysis has been performed
+ *  on. The buffer can be stored and passed to rocsparse_mat_info_deserialize() in a
+ *  later process, to skip the analysis of the same sparsity pattern.
+ *
+ *  If \p buffer is \p nullptr, the required buffer size is returned in \p buffer_size.
+ *  Otherwise, the meta data is written to \p buffer and the number of bytes written is
+ *  returned in \p buffer_size.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              matrix.
+ *  @param[in]
+ *  info        structure that holds the meta data gathered by the analysis routines.
+ *  @param[inout]
+ *  buffer_size size of \p buffer in bytes on input, number of bytes required or
+ *              written on output.
+ *  @param[out]
+ *  buffer      host buffer of \p buffer_size bytes, or \p nullptr.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+ *              \p buffer_size is too small.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+ *              \p info or \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const rocsparse_mat_info  info,
+                                              size_t*                   buffer_size,
+                                              void*                     buffer);
+
+/*! \ingroup aux_module
+ *  \brief Deserialize a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_deserialize restores the meta data that has been written by
+ *  rocsparse_mat_info_serialize(). The fingerprint of the given sparsity pattern is
+ *  validated against the fingerprint stored in \p buffer, such that the meta data is
+ *  only restored for the sparsity pattern it has been gathered for. \p info must not
+ *  hold any meta data, i.e. it must have been freshly created by
+ *  rocsparse_create_mat_info().
+ *
+ *  Subsequent analysis calls with \ref rocsparse_analysis_policy_reuse will re-use the
+ *  restored meta data, and rocsparse_csrmv() will use the restored meta data for the
+ *  given \p descr, \p csr_row_ptr and \p csr_col_ind.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              matrix.
+ *  @param[inout]
+ *  info        structure that receives the meta data.
+ *  @param[in]
+ *  buffer_size size of \p buffer in bytes.
+ *  @param[in]
+ *  buffer      host buffer written by rocsparse_mat_info_serialize().
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or does not
+ *              match the serialized meta data, or \p buffer is truncated.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+ *              \p info or \p buffer pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p buffer does not hold serialized meta
+ *              data of this library version, the index base or the fingerprint does
+ *              not match, or \p info already holds meta data.
+ *  \retval rocsparse_status_memory_error the buffer for the meta data could not be
+ *              allocated.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t                    buffer_size,
+                                                const void*               buffer);
+
+/*! \ingroup aux_module
+ *  \brief Save a matrix info structure to a file
+ *
+ *  \details
+ *  \p rocsparse_mat_info_save writes the output of rocsparse_mat_info_serialize() to
+ *  the file \p filename.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p filename pointer is invalid.
+ *  \retval rocsparse_status_internal_error the file could not be written.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_save(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_mat_info  info,
+                                         const char*               filename);
+
+/*! \ingroup aux_module
+ *  \brief Load a matrix info structure from a file
+ *
+ *  \details
+ *  \p rocsparse_mat_info_load passes the contents of the file \p filename, written by
+ *  rocsparse_mat_info_save(), to rocsparse_mat_info_deserialize().
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p filename pointer is invalid.
+ *  \retval rocsparse_status_invalid_value the file could not be read, or
+ *              rocsparse_mat_info_deserialize() rejected its contents.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_load(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         const char*               filename);
+
+/*! \ingroup aux_module
+ *  \brief Set the size of the analysis cache
+ *
+ *  \details
+ *  \p rocsparse_set_analysis_cache_size enables a cache of analysis meta data in the
+ *  rocSPARSE library context, holding at most \p size bytes of device memory. The meta
+ *  data is keyed by a hash of the sparsity pattern and the matrix descriptor, such that
+ *  analysis routines for a new \ref rocsparse_mat_info of an identical sparsity pattern,
+ *  e.g. rocsparse_scsrmv_analysis() or rocsparse_scsrsv_analysis(), copy the cached meta
+ *  data instead of recomputing it. Least recently used entries are released if the cache
+ *  is full. A \p size of 0 disables the cache and releases all of its memory. By default,
+ *  the cache is disabled, unless the environment variable
+ *  \p ROCSPARSE_ANALYSIS_CACHE_SIZE is set to a size in bytes.
+ *
+ *  \note
+ *  The cache only avoids recomputation of the analysis. The meta data of a cached
+ *  \ref rocsparse_mat_info is still owned by the info structure and must be
+ *  released with rocsparse_destroy_mat_info().
+ *
+ *  \note
+ *  Sparsity patterns are compared by two independent 64 bit hashes, not element by
+ *  element. Two different patterns of identical dimensions and descriptors only share
+ *  an entry if both hashes collide, which is extremely unlikely but not impossible.
+ *  The analysis of such a pattern would then restore the meta data of the other
+ *  pattern and subsequent calls would produce wrong results. Disable the cache if
+ *  this risk is not acceptable.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  size    maximum size of the cache in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t size);
+
+/*! \ingroup aux_module
+ *  \brief Get analysis cache statistics
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_cache_info gets the size and usage of the analysis cache
+ *  of the rocSPARSE library context, see rocsparse_set_analysis_cache_size().
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  size    maximum size of the cache in bytes, 0 if the cache is disabled.
+ *  @param[out]
+ *  used    device memory in bytes currently held by the cache.
+ *  @param[out]
+ *  hits    number of analysis calls that have been served by the cache.
+ *  @param[out]
+ *  misses  number of analysis calls that have not been found in the cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p size, \p used, \p hits or \p misses
+ *              pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_analysis_cache_info(
+    rocsparse_handle handle, size_t* size, size_t* used, int64_t* hits, int64_t* misses);
+
+/*! \ingroup aux_module
+ *  \brief Set the device memory allocator
+ *
+ *  \details
+ *  \p rocsparse_set_allocator sets the functions that are used to allocate and release
+ *  device memory in the rocSPARSE library context. They are used for all temporary
+ *  storage, as well as for the meta data of info structures that are created by
+ *  analysis routines, e.g. rocsparse_scsrmv_analysis(), or conversion routines, e.g.
+ *  rocsparse_scsr2hyb(), and for the entries of the analysis cache, see
+ *  rocsparse_set_analysis_cache_size(). Meta data and cache entries are always released
+ *  with the allocator that has been used to allocate them. Memory cached by the memory pool of the handle, see
+ *  rocsparse_set_memory_pool_size(), is released before the allocator is replaced.
+ *  Passing \p alloc and \p free as \p nullptr restores the default allocator, which
+ *  uses hipMalloc() and hipFree().
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  alloc       device memory allocation function.
+ *  @param[in]
+ *  free        device memory release function.
+ *  @param[in]
+ *  user_data   pointer that is passed to \p alloc and \p free.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer only one of \p alloc and \p free is
+ *              \p nullptr.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_allocator(rocsparse_handle     handle,
+                                         rocsparse_alloc_func alloc,
+                                         rocsparse_free_func  free,
+                                         void*                user_data);
+
+/*! \ingroup aux_module
+ *  \brief Set the size of the memory pool
+ *
+ *  \details
+ *  \p rocsparse_set_memory_pool_size sets the maximum number of bytes that the memory
+ *  pool of the rocSPARSE library context keeps cached. The pool serves the temporary
+ *  device memory of the library, such that repeated calls do not allocate and release
+ *  device memory each time. Requests are rounded up to one of four size classes per
+ *  power of two. A released block is reused right away on the stream it has been
+ *  released on, and on other streams once all work preceding its release has
+ *  completed. A \p size of 0 disables the pool and releases all cached memory. By
+ *  default, the pool is disabled, unless the environment variable
+ *  \p ROCSPARSE_MEMORY_POOL_SIZE is set to a size in bytes.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  size    maximum number of cached bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_memory_pool_size(rocsparse_handle handle, size_t size);
+
+/*! \ingroup aux_module
+ *  \brief Get memory pool statistics
+ *
+ *  \details
+ *  \p rocsparse_get_memory_pool_info gets the usage of the memory pool of the
+ *  rocSPARSE library context, see rocsparse_set_memory_pool_size().
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  used        bytes of the pool currently in use by the library.
+ *  @param[out]
+ *  cached      bytes currently cached by the pool.
+ *  @param[out]
+ *  high_water  peak number of bytes held by the pool.
+ *  @param[out]
+ *  hits        number of requests that have been served from the cache.
+ *  @param[out]
+ *  misses      number of requests that have been served by the allocator.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p used, \p cached, \p high_water,
+ *              \p hits or \p misses pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_memory_pool_info(rocsparse_handle handle,
+                                                size_t*          used,
+                                                size_t*          cached,
+                                                size_t*          high_water,
+                                                int64_t*         hits,
+                                                int64_t*         misses);
+
+/*! \ingroup aux_module
+ *  \brief Get the number of host synchronizations
+ *
+ *  \details
+ *  \p rocsparse_get_sync_count gets the number of times rocSPARSE routines have
+ *  blocked the host to wait for the stream of the rocSPARSE library context, e.g.
+ *  to read back a size that is computed on the device. The difference of the count
+ *  before and after a call gives the number of host synchronizations of that call.
+ *  Routines that return results in device memory, such as rocsparse_csrcolor() with
+ *  \ref rocsparse_pointer_mode_device, do not synchronize the host.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  count   number of host synchronizations since the handle has been created.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p count pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_sync_count(rocsparse_handle handle, int64_t* count);
+
 /*! \ingroup aux_module
  *  \brief Create a color info structure
  *
@@ -501,6 +891,120 @@ rocsparse_status rocsparse_create_color_info(rocsparse_color_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_color_info(rocsparse_color_info info);
 
+/*! \ingroup aux_module
+ *  \brief Create a workspace plan
+ *
+ *  \details
+ *  \p rocsparse_create_workspace_plan creates an empty workspace plan. A workspace
+ *  plan packs the temporary buffers of a sequence of operations into a single
+ *  workspace, where buffers that are not needed at the same time share memory. The
+ *  plan only operates on the host. It should be destroyed at the end using
+ *  rocsparse_destroy_workspace_plan().
+ *
+ *  @param[out]
+ *  plan    the pointer to the workspace plan.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p plan pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_workspace_plan(rocsparse_workspace_plan* plan);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a workspace plan
+ *
+ *  \details
+ *  \p rocsparse_destroy_workspace_plan destroys a workspace plan.
+ *
+ *  @param[in]
+ *  plan    the workspace plan.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p plan pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_workspace_plan(rocsparse_workspace_plan plan);
+
+/*! \ingroup aux_module
+ *  \brief Append a step to a workspace plan
+ *
+ *  \details
+ *  \p rocsparse_workspace_plan_add_step appends the next operation of the sequence
+ *  to the workspace plan. \p buffer_size is the temporary buffer size of the
+ *  operation, as obtained from the corresponding \p *_buffer_size routine. An
+ *  operation that requires the buffer of an earlier operation, e.g. a triangular
+ *  solve that uses the buffer of its analysis, passes the index of that step as
+ *  \p shared_step, which keeps the buffer alive up to this step. Otherwise,
+ *  \p shared_step is -1 and the buffer is only required during this step.
+ *
+ *  @param[in]
+ *  plan        the workspace plan.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary buffer of the step.
+ *  @param[in]
+ *  shared_step index of the earlier step whose buffer is used, or -1.
+ *  @param[out]
+ *  step        index of the appended step.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p plan or \p step pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p shared_step is not -1 or the index of
+ *              an earlier step.
+ *  \retval rocsparse_status_invalid_size \p buffer_size is too large.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_workspace_plan_add_step(rocsparse_workspace_plan plan,
+                                                   size_t                   buffer_size,
+                                                   rocsparse_int            shared_step,
+                                                   rocsparse_int*           step);
+
+/*! \ingroup aux_module
+ *  \brief Get the workspace size of a workspace plan
+ *
+ *  \details
+ *  \p rocsparse_workspace_plan_get_size returns the number of bytes of the single
+ *  workspace that holds the buffers of all steps of the plan. Buffers whose lifetimes
+ *  do not overlap are placed at overlapping offsets, such that the workspace size can
+ *  be considerably smaller than the sum of all buffer sizes.
+ *
+ *  @param[in]
+ *  plan            the workspace plan.
+ *  @param[out]
+ *  workspace_size  number of bytes of the workspace.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p plan or \p workspace_size pointer is
+ *              invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_workspace_plan_get_size(rocsparse_workspace_plan plan,
+                                                   size_t*                  workspace_size);
+
+/*! \ingroup aux_module
+ *  \brief Get the buffer offset of a step of a workspace plan
+ *
+ *  \details
+ *  \p rocsparse_workspace_plan_get_offset returns the offset in bytes of the buffer
+ *  of \p step within the workspace. The buffer of the step is the workspace pointer
+ *  advanced by \p offset bytes, and is aligned to 256 bytes relative to the
+ *  workspace pointer. Steps that share a buffer have the same offset.
+ *
+ *  @param[in]
+ *  plan    the workspace plan.
+ *  @param[in]
+ *  step    index of the step.
+ *  @param[out]
+ *  offset  offset of the buffer of \p step in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p plan or \p offset pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p step is not the index of a step.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_workspace_plan_get_offset(rocsparse_workspace_plan plan,
+                                                     rocsparse_int            step,
+                                                     size_t*                  offset);
+
 // Generic API
 
 // SpVec
@@ -598,6 +1102,54 @@ rocsparse_status rocsparse_create_ell_descr(rocsparse_spmat_descr* descr,
                                             rocsparse_index_base   idx_base,
                                             rocsparse_datatype     data_type);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_sell_descr(rocsparse_spmat_descr* descr,
+                                             int64_t                rows,
+                                             int64_t                cols,
+                                             int64_t                nnz,
+                                             int64_t                slice_size,
+                                             int64_t                sigma,
+                                             void*                  sell_slice_ptr,
+                                             void*                  sell_row_perm,
+                                             void*                  sell_col_ind,
+                                             void*                  sell_val,
+                                             rocsparse_indextype    idx_type,
+                                             rocsparse_index_base   idx_base,
+                                             rocsparse_datatype     data_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_bsr_descr(rocsparse_spmat_descr* descr,
+                                            int64_t                mb,
+                                            int64_t                nb,
+                                            int64_t                nnzb,
+                                            rocsparse_direction    block_dir,
+                                            int64_t                row_block_dim,
+                                            int64_t                col_block_dim,
+                                            void*                  bsr_row_ptr,
+                                            void*                  bsr_col_ind,
+                                            void*                  bsr_val,
+                                            rocsparse_indextype    row_ptr_type,
+                                            rocsparse_indextype    col_ind_type,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr16_descr(rocsparse_spmat_descr* descr,
+                                              int64_t                rows,
+                                              int64_t                cols,
+                                              int64_t                nnz,
+                                              int64_t                esc_nnz,
+                                              void*                  csr16_row_ptr,
+                                              void*                  csr16_row_base,
+                                              void*                  csr16_col_off,
+                                              void*                  csr16_val,
+                                              void*                  csr16_esc_row_ind,
+                                              void*                  csr16_esc_col_ind,
+                                              void*                  csr16_esc_val,
+                                              rocsparse_indextype    idx_type,
+                                              rocsparse_index_base   idx_base,
+                                              rocsparse_datatype     data_type);
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr);
 
@@ -648,6 +1200,54 @@ rocsparse_status rocsparse_ell_get(const rocsparse_spmat_descr descr,
                                    rocsparse_index_base*       idx_base,
                                    rocsparse_datatype*         data_type);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sell_get(const rocsparse_spmat_descr descr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    nnz,
+                                    int64_t*                    slice_size,
+                                    int64_t*                    sigma,
+                                    void**                      sell_slice_ptr,
+                                    void**                      sell_row_perm,
+                                    void**                      sell_col_ind,
+                                    void**                      sell_val,
+                                    rocsparse_indextype*        idx_type,
+                                    rocsparse_index_base*       idx_base,
+                                    rocsparse_datatype*         data_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsr_get(const rocsparse_spmat_descr descr,
+                                   int64_t*                    mb,
+                                   int64_t*                    nb,
+                                   int64_t*                    nnzb,
+                                   rocsparse_direction*        block_dir,
+                                   int64_t*                    row_block_dim,
+                                   int64_t*                    col_block_dim,
+                                   void**                      bsr_row_ptr,
+                                   void**                      bsr_col_ind,
+                                   void**                      bsr_val,
+                                   rocsparse_indextype*        row_ptr_type,
+                                   rocsparse_indextype*        col_ind_type,
+                                   rocsparse_index_base*       idx_base,
+                                   rocsparse_datatype*         data_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr16_get(const rocsparse_spmat_descr descr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     int64_t*                    esc_nnz,
+                                     void**                      csr16_row_ptr,
+                                     void**                      csr16_row_base,
+                                     void**                      csr16_col_off,
+                                     void**                      csr16_val,
+                                     void**                      csr16_esc_row_ind,
+                                     void**                      csr16_esc_col_ind,
+                                     void**                      csr16_esc_val,
+                                     rocsparse_indextype*        idx_type,
+                                     rocsparse_index_base*       idx_base,
+                                     rocsparse_datatype*         data_type);
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_coo_set_pointers(rocsparse_spmat_descr descr,
                                             void*                 coo_row_ind,
@@ -674,6 +1274,39 @@ ROCSPARSE_EXPORT
 rocsparse_status
     rocsparse_ell_set_pointers(rocsparse_spmat_descr descr, void* ell_col_ind, void* ell_val);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sell_set_pointers(rocsparse_spmat_descr descr,
+                                             void*                 sell_slice_ptr,
+                                             void*                 sell_row_perm,
+                                             void*                 sell_col_ind,
+                                             void*                 sell_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsr_set_pointers(rocsparse_spmat_descr descr,
+                                            void*                 bsr_row_ptr,
+                                            void*                 bsr_col_ind,
+                                            void*                 bsr_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr16_set_pointers(rocsparse_spmat_descr descr,
+                                              void*                 csr16_row_ptr,
+                                              void*                 csr16_row_base,
+                                              void*                 csr16_col_off,
+                                              void*                 csr16_val,
+                                              void*                 csr16_esc_row_ind,
+                                              void*                 csr16_esc_col_ind,
+                                              void*                 csr16_esc_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               values_batch_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_get_strided_batch(const rocsparse_spmat_descr descr,
+                                                 int*                        batch_count,
+                                                 int64_t*                    values_batch_stride);
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spmat_get_size(rocsparse_spmat_descr descr,
                                           int64_t*              rows,
@@ -694,6 +1327,18 @@ rocsparse_status rocsparse_spmat_get_values(rocsparse_spmat_descr descr, void**
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_get_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               void*                     data,
+                                               size_t                    data_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_set_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               const void*               data,
+                                               size_t                    data_size);
+
 // Dense vector
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_create_dnvec_descr(rocsparse_dnvec_descr* descr,
@@ -716,6 +1361,16 @@ rocsparse_status rocsparse_dnvec_get_values(const rocsparse_dnvec_descr descr, v
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnvec_set_values(rocsparse_dnvec_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_get_strided_batch(const rocsparse_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
 // Dense matrix
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_create_dnmat_descr(rocsparse_dnmat_descr* descr,
@@ -744,6 +1399,16 @@ rocsparse_status rocsparse_dnmat_get_values(const rocsparse_dnmat_descr descr, v
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnmat_set_values(rocsparse_dnmat_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnmat_set_strided_batch(rocsparse_dnmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnmat_get_strided_batch(const rocsparse_dnmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
 #ifdef __cplusplus
 }
 #endif
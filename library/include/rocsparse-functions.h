@@ -1321,7 +1321,14 @@ rocsparse_status rocsparse_zbsrsv_solve(rocsparse_handle                handle,
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported for
+*  \ref rocsparse_matrix_type_general.
+*
+*  \note
+*  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian,
+*  only the triangle of \f$A\f$ given by the \ref rocsparse_fill_mode of \p descr is
+*  read, including the diagonal. Entries of the other triangle are ignored. All
+*  operation types are supported and \p m has to be equal to \p n.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -1337,7 +1344,8 @@ rocsparse_status rocsparse_zbsrsv_solve(rocsparse_handle                handle,
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
 *  descr       descriptor of the sparse COO matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+*              and \ref rocsparse_matrix_type_hermitian are supported.
 *  @param[in]
 *  coo_val     array of \p nnz elements of the sparse COO matrix.
 *  @param[in]
@@ -1357,13 +1365,15 @@ rocsparse_status rocsparse_zbsrsv_solve(rocsparse_handle                handle,
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+*              \p m != \p n for symmetric and hermitian matrices.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
 *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \p trans != \ref rocsparse_operation_none for
+*              \ref rocsparse_matrix_type_general, or
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -1440,6 +1450,14 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
 *
 *  \note
+*  Symmetric and hermitian matrices do not require any analysis meta data.
+*
+*  \note
+*  For \p trans != \ref rocsparse_operation_none, the analysis gathers the CSC
+*  structure of the matrix and a permutation into the CSR value array. No values
+*  are copied, such that the analysis stays valid if only the values change.
+*
+*  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
@@ -1468,15 +1486,15 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+*              \p m != \p n for symmetric and hermitian matrices.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
 *              \p csr_col_ind or \p info pointer is invalid.
 *  \retval     rocsparse_status_memory_error the buffer for the gathered information
 *              could not be allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -1603,7 +1621,16 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  For \p trans != \ref rocsparse_operation_none and
+*  \ref rocsparse_matrix_type_general, the result is accumulated with atomic
+*  operations if no analysis meta data is available. The analysis meta data of the
+*  same operation type enables a deterministic computation without atomics.
+*
+*  \note
+*  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian,
+*  only the triangle of \f$A\f$ given by the \ref rocsparse_fill_mode of \p descr is
+*  read, including the diagonal. Entries of the other triangle are ignored. All
+*  operation types are supported and \p m has to be equal to \p n.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -1619,7 +1646,8 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+*              and \ref rocsparse_matrix_type_hermitian are supported.
 *  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
@@ -1644,14 +1672,14 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+*              \p m != \p n for symmetric and hermitian matrices.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
 *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
 *              invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 *
 *  \par Example
 *  This example performs a sparse matrix vector multiplication in CSR format
@@ -10540,15 +10568,19 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
 *
 *  \details
-*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
-*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
+*  \p rocsparse_csr2sell_nnz computes the row permutation and the slice pointers of the
+*  SELL-C-sigma matrix, as well as the total number of stored elements, including
+*  padding, for a given CSR matrix. Within each window of \p sigma rows, the rows are
+*  sorted by decreasing number of non-zero elements. The sorted rows are grouped into
+*  slices of \p slice_size rows, where the width of each slice is the maximum number
+*  of non-zero elements of its rows.
 *
 *  \note
-*  This function requires a significant amount of storage for the HYB matrix,
-*  depending on the matrix structure.
+*  Windows of up to 256 rows are sorted without temporary storage. Larger windows are
+*  sorted by a segmented radix sort, which allocates temporary device memory.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -10559,9 +10591,71 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 *  @param[in]
 *  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix.
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  descr           descriptor of the sparse CSR matrix. Currently, only
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL-C-sigma matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  slice_size      number of rows per slice of the sparse SELL-C-sigma matrix.
+*  @param[in]
+*  sigma           number of consecutive rows that are sorted by their length.
+*  @param[out]
+*  sell_slice_ptr  array of \p (m-1)/slice_size+2 elements that point to the start of
+*                  every slice of the sparse SELL-C-sigma matrix.
+*  @param[out]
+*  sell_row_perm   array of \p m elements containing the original row of every slice
+*                  row of the sparse SELL-C-sigma matrix.
+*  @param[out]
+*  sell_nnz        pointer to the number of stored elements of the sparse SELL-C-sigma
+*                  matrix, including padding.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p slice_size or \p sigma is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+*              \p sell_descr, \p sell_slice_ptr, \p sell_row_perm or \p sell_nnz
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2sell_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        const rocsparse_mat_descr csr_descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_mat_descr sell_descr,
+                                        rocsparse_int             slice_size,
+                                        rocsparse_int             sigma,
+                                        rocsparse_int*            sell_slice_ptr,
+                                        rocsparse_int*            sell_row_perm,
+                                        rocsparse_int*            sell_nnz);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
+*
+*  \details
+*  \p rocsparse_csr2sell converts a CSR matrix into a SELL-C-sigma matrix. It is
+*  assumed, that \p sell_val and \p sell_col_ind are allocated with \p sell_nnz
+*  elements, and that \p sell_slice_ptr and \p sell_row_perm have been filled by
+*  rocsparse_csr2sell_nnz(). Each slice is stored in column-major format, rows with
+*  less non-zero elements than the slice width are padded with zeros and \f$-1\f$
+*  column indices.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
 *  csr_val         array containing the values of the sparse CSR matrix.
@@ -10570,199 +10664,858 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 *                  sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
-*  @param[out]
-*  hyb             sparse matrix in HYB format.
 *  @param[in]
-*  user_ell_width  width of the ELL part of the HYB matrix (only required if
-*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  sell_descr      descriptor of the sparse SELL-C-sigma matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
-*                  \ref rocsparse_hyb_partition_user or
-*                  \ref rocsparse_hyb_partition_max.
+*  slice_size      number of rows per slice of the sparse SELL-C-sigma matrix.
+*  @param[in]
+*  sell_slice_ptr  array of \p (m-1)/slice_size+2 elements that point to the start of
+*                  every slice of the sparse SELL-C-sigma matrix.
+*  @param[in]
+*  sell_row_perm   array of \p m elements containing the original row of every slice
+*                  row of the sparse SELL-C-sigma matrix.
+*  @param[out]
+*  sell_val        array of \p sell_nnz elements of the sparse SELL-C-sigma matrix.
+*  @param[out]
+*  sell_col_ind    array of \p sell_nnz elements containing the column indices of the
+*                  sparse SELL-C-sigma matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
-*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
-*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
-*              allocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m or \p slice_size is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p sell_descr, \p sell_slice_ptr,
+*              \p sell_row_perm, \p sell_val or \p sell_col_ind pointer is invalid.
 *  \retval     rocsparse_status_not_implemented
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+*  This example converts a CSR matrix into a SELL-C-sigma matrix.
 *  \code{.c}
-*      // Create HYB matrix structure
-*      rocsparse_hyb_mat hyb;
-*      rocsparse_create_hyb_mat(&hyb);
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
 *
-*      // User defined ell width
-*      rocsparse_int user_ell_width = 5;
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
 *
-*      // Perform the conversion
-*      rocsparse_scsr2hyb(handle,
-*                         m,
-*                         n,
-*                         descr,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         hyb,
-*                         user_ell_width,
-*                         rocsparse_hyb_partition_user);
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
 *
-*      // Do some work
+*      // Create SELL matrix descriptor
+*      rocsparse_mat_descr sell_descr;
+*      rocsparse_create_mat_descr(&sell_descr);
 *
-*      // Clean up
-*      rocsparse_destroy_hyb_mat(hyb);
+*      // Slice size and sorting window
+*      rocsparse_int slice_size = 2;
+*      rocsparse_int sigma      = 4;
+*      rocsparse_int nslices    = (m - 1) / slice_size + 1;
+*
+*      // Allocate SELL slice pointer and row permutation arrays
+*      rocsparse_int* sell_slice_ptr;
+*      rocsparse_int* sell_row_perm;
+*      hipMalloc((void**)&sell_slice_ptr, sizeof(rocsparse_int) * (nslices + 1));
+*      hipMalloc((void**)&sell_row_perm, sizeof(rocsparse_int) * m);
+*
+*      // Obtain the SELL row permutation, slices and number of stored elements
+*      rocsparse_int sell_nnz;
+*      rocsparse_csr2sell_nnz(handle,
+*                             m,
+*                             csr_descr,
+*                             csr_row_ptr,
+*                             sell_descr,
+*                             slice_size,
+*                             sigma,
+*                             sell_slice_ptr,
+*                             sell_row_perm,
+*                             &sell_nnz);
+*
+*      // Allocate SELL column and value arrays
+*      rocsparse_int* sell_col_ind;
+*      hipMalloc((void**)&sell_col_ind, sizeof(rocsparse_int) * sell_nnz);
+*
+*      float* sell_val;
+*      hipMalloc((void**)&sell_val, sizeof(float) * sell_nnz);
+*
+*      // Format conversion
+*      rocsparse_scsr2sell(handle,
+*                          m,
+*                          csr_descr,
+*                          csr_val,
+*                          csr_row_ptr,
+*                          csr_col_ind,
+*                          sell_descr,
+*                          slice_size,
+*                          sell_slice_ptr,
+*                          sell_row_perm,
+*                          sell_val,
+*                          sell_col_ind);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
+rocsparse_status rocsparse_scsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_row_perm,
+                                     float*                    sell_val,
+                                     rocsparse_int*            sell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
+rocsparse_status rocsparse_dcsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_row_perm,
+                                     double*                   sell_val,
+                                     rocsparse_int*            sell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    const rocsparse_mat_descr      descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_hyb_mat              hyb,
-                                    rocsparse_int                  user_ell_width,
-                                    rocsparse_hyb_partition        partition_type);
+rocsparse_status rocsparse_ccsr2sell(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     const rocsparse_mat_descr      csr_descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     const rocsparse_mat_descr      sell_descr,
+                                     rocsparse_int                  slice_size,
+                                     const rocsparse_int*           sell_slice_ptr,
+                                     const rocsparse_int*           sell_row_perm,
+                                     rocsparse_float_complex*       sell_val,
+                                     rocsparse_int*                 sell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    const rocsparse_mat_descr       descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_hyb_mat               hyb,
-                                    rocsparse_int                   user_ell_width,
-                                    rocsparse_hyb_partition         partition_type);
+rocsparse_status rocsparse_zcsr2sell(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     const rocsparse_mat_descr       csr_descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const rocsparse_mat_descr       sell_descr,
+                                     rocsparse_int                   slice_size,
+                                     const rocsparse_int*            sell_slice_ptr,
+                                     const rocsparse_int*            sell_row_perm,
+                                     rocsparse_double_complex*       sell_val,
+                                     rocsparse_int*                  sell_col_ind);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
-*  BSR matrix given a sparse CSR matrix as input.
+*  \brief Convert a sparse CSR matrix into a sparse CSR16 matrix
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  \p rocsparse_csr2csr16_nnz computes the base column and the row pointers of the
+*  CSR16 matrix, as well as the number of escaped entries, for a given CSR matrix. The
+*  CSR16 format stores the column index of each entry as a 16 bit offset to the base
+*  column of its row. The base column of a row is chosen such that the window of
+*  \f$2^{16}\f$ columns starting at the base column covers most of the entries of the
+*  row. Entries outside of this window are escaped and stored in COO format.
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*
-*  @param[in]
-*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
-*              \ref rocsparse_direction_row.
+*  \note
+*  The column indices of each row are expected to be sorted. Unsorted rows result in
+*  a valid CSR16 matrix with possibly more escaped entries.
 *
-*  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  \note
+*  This function requires a host synchronization in host pointer mode, to obtain the
+*  number of escaped entries.
 *
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
-*
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
-*
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
-*
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  block_dim   the block dimension of the BSR matrix. Between 1 and min(m, n)
-*
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
 *  @param[in]
-*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  csr16_descr     descriptor of the sparse CSR16 matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the BSR matrix
-*
+*  csr16_row_ptr   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR16 matrix.
 *  @param[out]
-*  bsr_nnz     total number of nonzero elements in device or host memory.
+*  csr16_row_base  array of \p m elements containing the base column of every row of
+*                  the sparse CSR16 matrix.
+*  @param[out]
+*  csr16_esc_nnz   pointer to the number of escaped entries of the sparse CSR16 matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz
+*  \retval     rocsparse_status_invalid_size \p m is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+*              \p csr16_descr, \p csr16_row_ptr, \p csr16_row_base or \p csr16_esc_nnz
 *              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          handle,
-                                       rocsparse_direction       dir,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       const rocsparse_mat_descr csr_descr,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
-                                       rocsparse_int             block_dim,
-                                       const rocsparse_mat_descr bsr_descr,
-                                       rocsparse_int*            bsr_row_ptr,
-                                       rocsparse_int*            bsr_nnz);
+rocsparse_status rocsparse_csr2csr16_nnz(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_mat_descr csr16_descr,
+                                         rocsparse_int*            csr16_row_ptr,
+                                         rocsparse_int*            csr16_row_base,
+                                         rocsparse_int*            csr16_esc_nnz);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse BSR matrix
+*  \brief Convert a sparse CSR matrix into a sparse CSR16 matrix
 *
 *  \details
-*  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix. It is assumed,
-*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
-*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
-*  the BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
-*  \p csr2bsr_nnz() which also fills in \p bsr_row_ptr.
+*  \p rocsparse_csr2csr16 converts a CSR matrix into a CSR16 matrix. It is assumed,
+*  that \p csr16_row_ptr and \p csr16_row_base have been filled by
+*  rocsparse_csr2csr16_nnz(), that \p csr16_val and \p csr16_col_off are allocated
+*  with \p nnz - \p csr16_esc_nnz elements and that \p csr16_esc_val,
+*  \p csr16_esc_row_ind and \p csr16_esc_col_ind are allocated with
+*  \p csr16_esc_nnz elements. The escaped entries are sorted by row.
 *
-*  \p rocsparse_csr2bsr requires extra temporary storage that is allocated internally if \p block_dim>16
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle       handle to the rocsparse library context queue.
-*  @param[in]
-*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  handle              handle to the rocsparse library context queue.
 *  @param[in]
-*  m            number of rows in the sparse CSR matrix.
+*  m                   number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n            number of columns in the sparse CSR matrix.
+*  csr_descr           descriptor of the sparse CSR matrix. Currently, only
+*                      \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  csr_val             array containing the values of the sparse CSR matrix.
 *  @param[in]
-*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  csr_row_ptr         array of \p m+1 elements that point to the start of every row of
+*                      the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
-*               sparse CSR matrix.
+*  csr_col_ind         array containing the column indices of the sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  csr16_descr         descriptor of the sparse CSR16 matrix. Currently, only
+*                      \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  block_dim    size of the blocks in the sparse BSR matrix.
+*  csr16_row_ptr       array of \p m+1 elements that point to the start of every row of
+*                      the sparse CSR16 matrix.
+*  @param[in]
+*  csr16_row_base      array of \p m elements containing the base column of every row
+*                      of the sparse CSR16 matrix.
+*  @param[out]
+*  csr16_val           array containing the values of the non-escaped entries of the
+*                      sparse CSR16 matrix.
+*  @param[out]
+*  csr16_col_off       array containing the column offsets to the row base column of the
+*                      non-escaped entries of the sparse CSR16 matrix.
+*  @param[out]
+*  csr16_esc_val       array containing the values of the escaped entries.
+*  @param[out]
+*  csr16_esc_row_ind   array containing the row indices of the escaped entries.
+*  @param[out]
+*  csr16_esc_col_ind   array containing the column indices of the escaped entries.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p csr16_descr, \p csr16_row_ptr,
+*              \p csr16_row_base, \p csr16_val, \p csr16_col_off, \p csr16_esc_val,
+*              \p csr16_esc_row_ind or \p csr16_esc_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into a CSR16 matrix.
+*  \code{.c}
+*      //     1 0 2 0 ... 0 3
+*      // A = 0 4 0 0 ... 0 0
+*      //     5 0 0 6 ... 0 0
+*
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 100000;
+*      rocsparse_int nnz = 6;
+*
+*      csr_row_ptr[m+1] = {0, 3, 4, 6};                // device memory
+*      csr_col_ind[nnz] = {0, 2, 99999, 1, 0, 3};      // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6};          // device memory
+*
+*      // Create CSR16 matrix descriptor
+*      rocsparse_mat_descr csr16_descr;
+*      rocsparse_create_mat_descr(&csr16_descr);
+*
+*      // Allocate CSR16 row pointer and base column arrays
+*      rocsparse_int* csr16_row_ptr;
+*      rocsparse_int* csr16_row_base;
+*      hipMalloc((void**)&csr16_row_ptr, sizeof(rocsparse_int) * (m + 1));
+*      hipMalloc((void**)&csr16_row_base, sizeof(rocsparse_int) * m);
+*
+*      // Obtain the CSR16 row pointers, base columns and number of escaped entries
+*      rocsparse_int esc_nnz;
+*      rocsparse_csr2csr16_nnz(handle,
+*                              m,
+*                              csr_descr,
+*                              csr_row_ptr,
+*                              csr_col_ind,
+*                              csr16_descr,
+*                              csr16_row_ptr,
+*                              csr16_row_base,
+*                              &esc_nnz);
+*
+*      // Allocate CSR16 offset and value arrays, and the escaped entries
+*      uint16_t* csr16_col_off;
+*      float*    csr16_val;
+*      hipMalloc((void**)&csr16_col_off, sizeof(uint16_t) * (nnz - esc_nnz));
+*      hipMalloc((void**)&csr16_val, sizeof(float) * (nnz - esc_nnz));
+*
+*      rocsparse_int* csr16_esc_row_ind;
+*      rocsparse_int* csr16_esc_col_ind;
+*      float*         csr16_esc_val;
+*      hipMalloc((void**)&csr16_esc_row_ind, sizeof(rocsparse_int) * esc_nnz);
+*      hipMalloc((void**)&csr16_esc_col_ind, sizeof(rocsparse_int) * esc_nnz);
+*      hipMalloc((void**)&csr16_esc_val, sizeof(float) * esc_nnz);
+*
+*      // Format conversion
+*      rocsparse_scsr2csr16(handle,
+*                           m,
+*                           csr_descr,
+*                           csr_val,
+*                           csr_row_ptr,
+*                           csr_col_ind,
+*                           csr16_descr,
+*                           csr16_row_ptr,
+*                           csr16_row_base,
+*                           csr16_val,
+*                           csr16_col_off,
+*                           csr16_esc_val,
+*                           csr16_esc_row_ind,
+*                           csr16_esc_col_ind);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csr16(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      const rocsparse_mat_descr csr_descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const rocsparse_mat_descr csr16_descr,
+                                      const rocsparse_int*      csr16_row_ptr,
+                                      const rocsparse_int*      csr16_row_base,
+                                      float*                    csr16_val,
+                                      uint16_t*                 csr16_col_off,
+                                      float*                    csr16_esc_val,
+                                      rocsparse_int*            csr16_esc_row_ind,
+                                      rocsparse_int*            csr16_esc_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csr16(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      const rocsparse_mat_descr csr_descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const rocsparse_mat_descr csr16_descr,
+                                      const rocsparse_int*      csr16_row_ptr,
+                                      const rocsparse_int*      csr16_row_base,
+                                      double*                   csr16_val,
+                                      uint16_t*                 csr16_col_off,
+                                      double*                   csr16_esc_val,
+                                      rocsparse_int*            csr16_esc_row_ind,
+                                      rocsparse_int*            csr16_esc_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csr16(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      const rocsparse_mat_descr      csr_descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      const rocsparse_int*           csr_col_ind,
+                                      const rocsparse_mat_descr      csr16_descr,
+                                      const rocsparse_int*           csr16_row_ptr,
+                                      const rocsparse_int*           csr16_row_base,
+                                      rocsparse_float_complex*       csr16_val,
+                                      uint16_t*                      csr16_col_off,
+                                      rocsparse_float_complex*       csr16_esc_val,
+                                      rocsparse_int*                 csr16_esc_row_ind,
+                                      rocsparse_int*                 csr16_esc_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csr16(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      const rocsparse_mat_descr       csr_descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      const rocsparse_int*            csr_col_ind,
+                                      const rocsparse_mat_descr       csr16_descr,
+                                      const rocsparse_int*            csr16_row_ptr,
+                                      const rocsparse_int*            csr16_row_base,
+                                      rocsparse_double_complex*       csr16_val,
+                                      uint16_t*                       csr16_col_off,
+                                      rocsparse_double_complex*       csr16_esc_val,
+                                      rocsparse_int*                  csr16_esc_row_ind,
+                                      rocsparse_int*                  csr16_esc_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+*
+*  \details
+*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
+*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
+*
+*  \note
+*  This function requires a significant amount of storage for the HYB matrix,
+*  depending on the matrix structure.
+*
+*  \note
+*  This function synchronizes the host once, to obtain the sizes of the ELL and COO
+*  parts of the HYB matrix before they are allocated. The conversion itself is
+*  executed asynchronously with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+*  @param[out]
+*  hyb             sparse matrix in HYB format.
+*  @param[in]
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  @param[in]
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+*              allocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+*  \code{.c}
+*      // Create HYB matrix structure
+*      rocsparse_hyb_mat hyb;
+*      rocsparse_create_hyb_mat(&hyb);
+*
+*      // User defined ell width
+*      rocsparse_int user_ell_width = 5;
+*
+*      // Perform the conversion
+*      rocsparse_scsr2hyb(handle,
+*                         m,
+*                         n,
+*                         descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         hyb,
+*                         user_ell_width,
+*                         rocsparse_hyb_partition_user);
+*
+*      // Do some work
+*
+*      // Clean up
+*      rocsparse_destroy_hyb_mat(hyb);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_hyb_mat              hyb,
+                                    rocsparse_int                  user_ell_width,
+                                    rocsparse_hyb_partition        partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_hyb_mat               hyb,
+                                    rocsparse_int                   user_ell_width,
+                                    rocsparse_hyb_partition         partition_type);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Upper bounds of the HYB matrix sizes and buffer size of the bounded CSR to
+*  HYB conversion
+*
+*  \details
+*  \p rocsparse_csr2hyb_bounded_buffer_size returns upper bounds of the ELL width and
+*  the number of COO non-zero entries of the HYB matrix that is computed by
+*  rocsparse_scsr2hyb_bounded(), rocsparse_dcsr2hyb_bounded(),
+*  rocsparse_ccsr2hyb_bounded() and rocsparse_zcsr2hyb_bounded(), as well as the size
+*  of the temporary storage buffer that is required by these functions. The bounds
+*  only depend on the sizes of the CSR matrix and on the partitioning, such that the
+*  device is not accessed.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  @param[in]
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
+*  @param[out]
+*  ell_width_bound upper bound of the ELL width.
+*  @param[out]
+*  coo_nnz_bound   upper bound of the number of COO non-zero entries.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type or \p user_ell_width is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ell_width_bound, \p coo_nnz_bound or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2hyb_bounded_buffer_size(rocsparse_handle        handle,
+                                                       rocsparse_int           m,
+                                                       rocsparse_int           n,
+                                                       rocsparse_int           nnz,
+                                                       rocsparse_int           user_ell_width,
+                                                       rocsparse_hyb_partition partition_type,
+                                                       rocsparse_int*          ell_width_bound,
+                                                       rocsparse_int*          coo_nnz_bound,
+                                                       size_t*                 buffer_size);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into the ELL and COO parts of a sparse HYB matrix
+*  without synchronizing the host
+*
+*  \details
+*  \p rocsparse_csr2hyb_bounded converts a CSR matrix into the ELL and COO parts of a
+*  HYB matrix, following rocsparse_scsr2hyb(). Instead of allocating the HYB matrix
+*  from its exact sizes, which have to be copied to the host, the ELL and COO arrays
+*  are provided by the user and sized by the upper bounds that are obtained by
+*  rocsparse_csr2hyb_bounded_buffer_size(). The ELL width and the number of COO
+*  non-zero entries are written to device memory, such that the conversion is
+*  executed asynchronously with respect to the host and can be captured into a graph.
+*
+*  The ELL part is stored in \p ell_val and \p ell_col_ind with leading dimension
+*  \p m, using the ELL width that is written to \p ell_width, see rocsparse_scsr2ell().
+*  The COO part is stored in the first \p coo_nnz entries of \p coo_val,
+*  \p coo_row_ind and \p coo_col_ind.
+*
+*  \note
+*  With \ref rocsparse_hyb_partition_max, rows that exceed the ELL width bound
+*  \f$2 \cdot (nnz - 1) / m + 1\f$ are continued in the COO part, whereas
+*  rocsparse_scsr2hyb() returns \ref rocsparse_status_invalid_value in this case.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  @param[in]
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
+*  @param[out]
+*  ell_width       device pointer to the ELL width.
+*  @param[out]
+*  ell_val         array of \p m times \p ell_width_bound elements containing the
+*                  values of the ELL part.
+*  @param[out]
+*  ell_col_ind     array of \p m times \p ell_width_bound elements containing the
+*                  column indices of the ELL part.
+*  @param[out]
+*  coo_nnz         device pointer to the number of non-zero entries of the COO part.
+*  @param[out]
+*  coo_val         array of \p coo_nnz_bound elements containing the values of the
+*                  COO part.
+*  @param[out]
+*  coo_row_ind     array of \p coo_nnz_bound elements containing the row indices of
+*                  the COO part.
+*  @param[out]
+*  coo_col_ind     array of \p coo_nnz_bound elements containing the column indices
+*                  of the COO part.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csr2hyb_bounded_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type or \p user_ell_width is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p ell_width, \p ell_val, \p ell_col_ind, \p coo_nnz,
+*              \p coo_val, \p coo_row_ind, \p coo_col_ind or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb_bounded(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             user_ell_width,
+                                            rocsparse_hyb_partition   partition_type,
+                                            rocsparse_int*            ell_width,
+                                            float*                    ell_val,
+                                            rocsparse_int*            ell_col_ind,
+                                            rocsparse_int*            coo_nnz,
+                                            float*                    coo_val,
+                                            rocsparse_int*            coo_row_ind,
+                                            rocsparse_int*            coo_col_ind,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb_bounded(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             user_ell_width,
+                                            rocsparse_hyb_partition   partition_type,
+                                            rocsparse_int*            ell_width,
+                                            double*                   ell_val,
+                                            rocsparse_int*            ell_col_ind,
+                                            rocsparse_int*            coo_nnz,
+                                            double*                   coo_val,
+                                            rocsparse_int*            coo_row_ind,
+                                            rocsparse_int*            coo_col_ind,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb_bounded(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  n,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_int                  user_ell_width,
+                                            rocsparse_hyb_partition        partition_type,
+                                            rocsparse_int*                 ell_width,
+                                            rocsparse_float_complex*       ell_val,
+                                            rocsparse_int*                 ell_col_ind,
+                                            rocsparse_int*                 coo_nnz,
+                                            rocsparse_float_complex*       coo_val,
+                                            rocsparse_int*                 coo_row_ind,
+                                            rocsparse_int*                 coo_col_ind,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb_bounded(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   n,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_int                   user_ell_width,
+                                            rocsparse_hyb_partition         partition_type,
+                                            rocsparse_int*                  ell_width,
+                                            rocsparse_double_complex*       ell_val,
+                                            rocsparse_int*                  ell_col_ind,
+                                            rocsparse_int*                  coo_nnz,
+                                            rocsparse_double_complex*       coo_val,
+                                            rocsparse_int*                  coo_row_ind,
+                                            rocsparse_int*                  coo_col_ind,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
+*  BSR matrix given a sparse CSR matrix as input.
+*
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+*              \ref rocsparse_direction_row.
+*
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*
+*  @param[in]
+*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*
+*  @param[in]
+*  block_dim   the block dimension of the BSR matrix. Between 1 and min(m, n)
+*
+*  @param[in]
+*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the BSR matrix
+*
+*  @param[out]
+*  bsr_nnz     total number of nonzero elements in device or host memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz
+*              pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr csr_descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_mat_descr bsr_descr,
+                                       rocsparse_int*            bsr_row_ptr,
+                                       rocsparse_int*            bsr_nnz);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse BSR matrix
+*
+*  \details
+*  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix. It is assumed,
+*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
+*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
+*  the BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
+*  \p csr2bsr_nnz() which also fills in \p bsr_row_ptr.
+*
+*  \p rocsparse_csr2bsr requires extra temporary storage that is allocated internally if \p block_dim>16
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  @param[in]
+*  m            number of rows in the sparse CSR matrix.
+*  @param[in]
+*  n            number of columns in the sparse CSR matrix.
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*               sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  block_dim    size of the blocks in the sparse BSR matrix.
 *  @param[in]
 *  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
 *               \ref rocsparse_matrix_type_general is supported.
@@ -13882,7 +14635,7 @@ rocsparse_status rocsparse_rot(rocsparse_handle      handle,
 *
 *  \details
 *  \p rocsparse_sparse_to_dense
-*  \p rocsparse_sparse_to_dense performs the conversion of a sparse matrix in CSR, CSC, or COO format to
+*  \p rocsparse_sparse_to_dense performs the conversion of a sparse matrix in CSR, CSC, COO or BSR format to
 *     a dense matrix
 *  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
@@ -14071,20 +14824,76 @@ rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported for
+*  general matrices in formats other than CSR and CSC.
+*
+*  \note
+*  CSC matrices are processed as the transpose of a CSR matrix. For
+*  \p trans == \ref rocsparse_operation_none, rocsparse_spmv_alg_default and
+*  rocsparse_spmv_alg_csr_adaptive run an analysis step during the buffer size query, such
+*  that the result is computed deterministically without atomics, while
+*  rocsparse_spmv_alg_csr_stream accumulates the result atomically without analysis.
+*
+*  \note
+*  For CSR matrices, rocsparse_spmv_alg_csr_merge splits the merge path of row ends and
+*  non-zero entries into tiles of equal work, such that rows of very different lengths
+*  are processed without load imbalance. The tile boundaries are computed on the device
+*  during the buffer size query. Rows spanning multiple tiles are combined
+*  deterministically without atomics. Transposed operations, symmetric and hermitian
+*  matrices, batches, mixed precision and CSC matrices run
+*  rocsparse_spmv_alg_csr_stream instead.
+*
+*  \note
+*  SELL-C-sigma matrices are processed slice by slice, where each row of a slice is
+*  computed by a single thread. The result is scattered back through the row
+*  permutation of the matrix.
+*
+*  \note
+*  For BSR matrices, the sizes of the descriptor are given in blocks, such that \p x and
+*  \p y hold \p nb*col_block_dim and \p mb*row_block_dim elements, respectively. BSR
+*  matrices with 32 bit indices are processed by the block size specialized kernels of
+*  rocsparse_Xgebsrmv(), 64 bit indices are processed by a general block kernel.
+*
+*  \note
+*  CSR and COO matrices can be declared symmetric or hermitian by setting the
+*  \ref rocsparse_spmat_matrix_type and \ref rocsparse_spmat_fill_mode attributes
+*  with rocsparse_spmat_set_attribute(). Only the triangle given by the fill mode
+*  is read then, and all operation types are supported.
+*
+*  \note
+*  The vectors \p x and \p y have to match \p compute_type. For general CSR matrices,
+*  the matrix values may be stored in a lower precision than \p compute_type. Each
+*  value is converted to \p compute_type when it is read, and all products and sums
+*  are accumulated in \p compute_type. The supported combinations are
+*  | matrix data type         | x, y and compute_type    |
+*  |--------------------------|--------------------------|
+*  | rocsparse_datatype_f32_r | rocsparse_datatype_f64_r |
+*  | rocsparse_datatype_f32_c | rocsparse_datatype_f64_c |
+*  Mixed precision always runs the stream kernels, \p alg does not trigger an analysis
+*  step then.
+*
+*  \note
+*  A strided batch of CSR matrices sharing one sparsity pattern can be set up with
+*  rocsparse_csr_set_strided_batch(), such that \f$y_i := \alpha \cdot A_i \cdot x_i +
+*  \beta \cdot y_i\f$ is computed for each batch \f$i\f$ in a single launch. Row offsets
+*  and column indices are loaded once for several batches. \p y has to hold the same
+*  batch count, set with rocsparse_dnvec_set_strided_batch(), while \p x either holds the
+*  same batch count or a single vector that is used by all batches. Batches are only
+*  supported for general matrices with \p trans == \ref rocsparse_operation_none and
+*  matching precisions, and always run the stream kernel.
 *
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
 *  trans        matrix operation type.
 *  @param[in]
-*  alpha        scalar \f$\alpha\f$.
+*  alpha        scalar \f$\alpha\f$ of type \p compute_type.
 *  @param[in]
 *  mat          matrix descriptor.
 *  @param[in]
 *  x            vector descriptor.
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
+*  beta         scalar \f$\beta\f$ of type \p compute_type.
 *  @param[inout]
 *  y            vector descriptor.
 *  @param[in]
@@ -14119,6 +14928,170 @@ rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
                                 size_t*                     buffer_size,
                                 void*                       temp_buffer);
 
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector multiplication fused with dot product and norm
+*
+*  \details
+*  \ref rocsparse_spmv_dot multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix and the dense vector \f$x\f$ and adds the result to the dense vector \f$y\f$
+*  that is multiplied by the scalar \f$\beta\f$. The dot product of \f$x\f$ and the
+*  updated vector \f$y\f$ and the squared norm of the updated vector \f$y\f$ are computed
+*  in the same pass, such that
+*  \f[
+*    y := \alpha \cdot A \cdot x + \beta \cdot y, \quad
+*    \text{dot_result} := x^H \cdot y, \quad
+*    \text{nrm2_result} := y^H \cdot y.
+*  \f]
+*
+*  \note
+*  \p dot_result and \p nrm2_result are optional and can be nullptr. Both are stored in
+*  host or device memory, depending on the pointer mode of the handle. The dot product
+*  requires \f$m = n\f$.
+*
+*  \note
+*  The partial sums of each block are reduced in a fixed order, such that the results are
+*  bitwise reproducible between runs on the same device.
+*
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the operation, when a nullptr is passed for
+*  \p temp_buffer.
+*
+*  \note
+*  This function is blocking with respect to the host, if the results are stored in host
+*  memory.
+*
+*  \note
+*  Currently, only general CSR matrices with \p trans == \ref rocsparse_operation_none
+*  and matching precisions are supported.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans        matrix operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$ of type \p compute_type.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$ of type \p compute_type.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[out]
+*  dot_result   dot product \f$x^H \cdot y\f$ of type \p compute_type, or nullptr.
+*  @param[out]
+*  nrm2_result  squared norm \f$y^H \cdot y\f$ of type \p compute_type, or nullptr.
+*  @param[in]
+*  compute_type floating point precision for the computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the operation.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_size \p dot_result is requested and \f$m \neq n\f$.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type or the format
+*               of \p mat is currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_dot(rocsparse_handle            handle,
+                                    rocsparse_operation         trans,
+                                    const void*                 alpha,
+                                    const rocsparse_spmat_descr mat,
+                                    const rocsparse_dnvec_descr x,
+                                    const void*                 beta,
+                                    const rocsparse_dnvec_descr y,
+                                    void*                       dot_result,
+                                    void*                       nrm2_result,
+                                    rocsparse_datatype          compute_type,
+                                    size_t*                     buffer_size,
+                                    void*                       temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector residual fused with norm
+*
+*  \details
+*  \ref rocsparse_spmv_residual computes the residual of a sparse \f$m \times n\f$ matrix
+*  and the dense vectors \f$x\f$ and \f$b\f$, together with its squared norm, such that
+*  \f[
+*    r := b - A \cdot x, \quad
+*    \text{nrm2_result} := r^H \cdot r.
+*  \f]
+*  The product \f$A \cdot x\f$ is never written to memory.
+*
+*  \note
+*  \p nrm2_result is optional and can be nullptr. It is stored in host or device memory,
+*  depending on the pointer mode of the handle. The partial sums of each block are
+*  reduced in a fixed order, such that the result is bitwise reproducible between runs
+*  on the same device.
+*
+*  \note
+*  \p b and \p r may refer to the same vector.
+*
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the operation, when a nullptr is passed for
+*  \p temp_buffer.
+*
+*  \note
+*  This function is blocking with respect to the host, if the result is stored in host
+*  memory.
+*
+*  \note
+*  Currently, only general CSR matrices with \p trans == \ref rocsparse_operation_none
+*  and matching precisions are supported.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans        matrix operation type.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  b            vector descriptor.
+*  @param[out]
+*  r            vector descriptor.
+*  @param[out]
+*  nrm2_result  squared norm \f$r^H \cdot r\f$ of type \p compute_type, or nullptr.
+*  @param[in]
+*  compute_type floating point precision for the computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the operation.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p mat, \p x, \p b, \p r or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type or the format
+*               of \p mat is currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_residual(rocsparse_handle            handle,
+                                         rocsparse_operation         trans,
+                                         const rocsparse_spmat_descr mat,
+                                         const rocsparse_dnvec_descr x,
+                                         const rocsparse_dnvec_descr b,
+                                         const rocsparse_dnvec_descr r,
+                                         void*                       nrm2_result,
+                                         rocsparse_datatype          compute_type,
+                                         size_t*                     buffer_size,
+                                         void*                       temp_buffer);
+
 /*! \ingroup generic_module
 *  \brief Sparse matrix dense matrix multiplication
 *
@@ -14159,7 +15132,10 @@ rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
 *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
 *
 *  \note
-*  Currently, only CSR and COO sparse formats are supported.
+*  Currently, only CSR, CSC, COO, SELL-C-sigma and BSR sparse formats are supported.
+*  SELL-C-sigma and BSR matrices only support \p trans_A == \ref rocsparse_operation_none.
+*  BSR matrices additionally require column ordered dense matrices and do not support
+*  \p trans_B == \ref rocsparse_operation_conjugate_transpose.
 *
 *  \note
 *  Different algorithms are available which can provide better performance for different matrices.
@@ -14170,6 +15146,20 @@ rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
 *  rocsparse_spmm_alg_coo_atomic.
 *
 *  \note
+*  CSC matrices are processed as the transpose of a CSR matrix. For
+*  \p trans_A == \ref rocsparse_operation_none, rocsparse_spmm_alg_csr (and
+*  rocsparse_spmm_alg_default) run an analysis step during the buffer size query, such that the
+*  rows of \f$A\f$ are computed without atomics. Any other algorithm accumulates the
+*  result atomically without analysis.
+*
+*  \note
+*  A strided batch of CSR matrices sharing one sparsity pattern can be set up with
+*  rocsparse_csr_set_strided_batch(), such that \f$C_i := \alpha \cdot op(A_i) \cdot
+*  op(B_i) + \beta \cdot C_i\f$ is computed for each batch \f$i\f$. \p mat_C has to hold
+*  the same batch count, set with rocsparse_dnmat_set_strided_batch(), while \p mat_B
+*  either holds the same batch count or a single matrix that is used by all batches.
+*
+*  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
 *  returns without performing the SpMM operation, when a nullptr is passed for
 *  \p temp_buffer.
@@ -14536,6 +15526,15 @@ rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle            handle,
 *
 *  \details
 *  \p rocsparse_csrcolor performs the coloring of the undirected graph represented by the (symmetric) sparsity pattern of the matrix \f$A\f$ stored in CSR format. Graph coloring is a way of coloring the nodes of a graph such that no two adjacent nodes are of the same color. The \p fraction_to_color is a parameter to only color a given percentage of the graph nodes, the remaining uncolored nodes receive distinct new colors. The optional \p reordering array is a permutation array such that unknowns of the same color are grouped. The matrix \f$A\f$ must be stored as a general matrix with a symmetric sparsity pattern, and if the matrix \f$A\f$ is non-symmetric then the user is responsible to provide the symmetric part \f$\frac{A+A^T}{2}\f$.
+*
+*  \note
+*  \p fraction_to_color and \p ncolors are host pointers, independently of the pointer
+*  mode. The host is synchronized in every round of the coloring algorithm, see
+*  rocsparse_scsrcolor_async() for a variant that does not synchronize the host.
+*  Unless \p reordering is requested, the temporary storage is taken from the device
+*  buffer of the handle whenever it fits, such that no device memory is allocated or
+*  released.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
@@ -14627,6 +15626,116 @@ rocsparse_status rocsparse_zcsrcolor(rocsparse_handle                handle,
 
 /**@}*/
 
+/*! \ingroup reordering_module
+*  \brief Coloring of the adjacency graph of the matrix \f$A\f$ stored in the CSR format,
+*  without synchronizing the host
+*
+*  \details
+*  \p rocsparse_csrcolor_async computes the same coloring as rocsparse_scsrcolor(), but
+*  \p fraction_to_color and \p ncolors are device pointers, independently of the pointer
+*  mode. The coloring rounds are executed by a single cooperative kernel that decides on
+*  the device when the desired fraction of nodes is colored, such that the routine is
+*  executed asynchronously with respect to the host and can be captured into a graph.
+*  The remaining uncolored nodes receive distinct new colors.
+*
+*  \note
+*  On devices that do not support cooperative kernel launches, the coloring rounds are
+*  driven by the host, which is synchronized in every round.
+*
+*  \note
+*  The temporary storage is taken from the device buffer of the handle whenever it fits,
+*  such that no device memory is allocated or released.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of sparse matrix \f$A\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of sparse matrix \f$A\f$.
+*  @param[in]
+*  descr       sparse matrix descriptor.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  fraction_to_color  device pointer to the fraction of nodes to be colored, which
+*                     should be in the interval [0.0,1.0].
+*  @param[out]
+*  ncolors     device pointer to the resulting number of distinct colors.
+*  @param[out]
+*  coloring    resulting mapping of colors.
+*  @param[inout]
+*  info        structure that holds the information collected during the coloring
+*              algorithm.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*          \p csr_col_ind, \p fraction_to_color, \p ncolors, \p coloring or \p info
+*          pointer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrcolor_async(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              fraction_to_color,
+                                           rocsparse_int*            ncolors,
+                                           rocsparse_int*            coloring,
+                                           rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcolor_async(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             fraction_to_color,
+                                           rocsparse_int*            ncolors,
+                                           rocsparse_int*            coloring,
+                                           rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrcolor_async(rocsparse_handle               handle,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           csr_row_ptr,
+                                           const rocsparse_int*           csr_col_ind,
+                                           const float*                   fraction_to_color,
+                                           rocsparse_int*                 ncolors,
+                                           rocsparse_int*                 coloring,
+                                           rocsparse_mat_info             info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrcolor_async(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            csr_row_ptr,
+                                           const rocsparse_int*            csr_col_ind,
+                                           const double*                   fraction_to_color,
+                                           rocsparse_int*                  ncolors,
+                                           rocsparse_int*                  coloring,
+                                           rocsparse_mat_info              info);
+/**@}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -99,6 +99,18 @@ typedef struct _rocsparse_dnmat_descr* rocsparse_dnmat_descr;
 
 typedef struct _rocsparse_color_info* rocsparse_color_info;
 
+/*! \ingroup types_module
+ *  \brief Workspace plan structure to hold the buffer requirements of a sequence of
+ *  operations.
+ *
+ *  \details
+ *  The rocSPARSE workspace plan is a structure holding the temporary buffer sizes of
+ *  a sequence of operations, and packs them into a single workspace. It must be
+ *  initialized using rocsparse_create_workspace_plan(). It should be destroyed at the
+ *  end using rocsparse_destroy_workspace_plan().
+ */
+typedef struct _rocsparse_workspace_plan* rocsparse_workspace_plan;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -270,11 +282,28 @@ typedef enum rocsparse_pointer_mode_
  */
 typedef enum rocsparse_layer_mode
 {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2 /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_none        = 0x0, /**< layer is not active. */
+    rocsparse_layer_mode_log_trace   = 0x1, /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench   = 0x2, /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_log_profile = 0x4, /**< layer is in profiling mode. */
+    rocsparse_layer_mode_log_capture = 0x8 /**< layer is in capture mode. */
 } rocsparse_layer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates how a handle is created, with bitmask.
+ *
+ *  \details
+ *  The \ref rocsparse_handle_flags bit mask is passed to
+ *  rocsparse_create_handle_with_flags() and selects how the device resources of the
+ *  handle are allocated.
+ */
+typedef enum rocsparse_handle_flags_
+{
+    rocsparse_handle_flags_none   = 0x0, /**< allocate all resources on creation. */
+    rocsparse_handle_flags_lazy   = 0x1, /**< allocate resources on first use. */
+    rocsparse_handle_flags_pooled = 0x2 /**< reuse handles of a process-wide pool. */
+} rocsparse_handle_flags;
+
 /*! \ingroup types_module
  *  \brief List of rocsparse status codes definition.
  *
@@ -298,6 +327,30 @@ typedef enum rocsparse_status_
     rocsparse_status_type_mismatch   = 11 /**< index types do not match. */
 } rocsparse_status;
 
+/*! \ingroup types_module
+ *  \brief Device memory allocation function.
+ *
+ *  \details
+ *  A \ref rocsparse_alloc_func allocates \p size bytes of device memory that are used
+ *  on \p stream and returns them in \p ptr. \p user_data is the pointer that has been
+ *  passed to rocsparse_set_allocator(). It returns rocsparse_status_success on success
+ *  and rocsparse_status_memory_error if the memory could not be allocated.
+ */
+typedef rocsparse_status (*rocsparse_alloc_func)(void**      ptr,
+                                                 size_t      size,
+                                                 hipStream_t stream,
+                                                 void*       user_data);
+
+/*! \ingroup types_module
+ *  \brief Device memory release function.
+ *
+ *  \details
+ *  A \ref rocsparse_free_func releases device memory that has been allocated by the
+ *  corresponding \ref rocsparse_alloc_func, once all previous work on \p stream has
+ *  completed.
+ */
+typedef rocsparse_status (*rocsparse_free_func)(void* ptr, hipStream_t stream, void* user_data);
+
 /*! \ingroup types_module
  *  \brief List of rocsparse index types.
  *
@@ -338,9 +391,26 @@ typedef enum rocsparse_format_
     rocsparse_format_coo_aos = 1, /**< COO AoS sparse matrix format. */
     rocsparse_format_csr     = 2, /**< CSR sparse matrix format. */
     rocsparse_format_csc     = 3, /**< CSC sparse matrix format. */
-    rocsparse_format_ell     = 4 /**< ELL sparse matrix format. */
+    rocsparse_format_ell     = 4, /**< ELL sparse matrix format. */
+    rocsparse_format_sell    = 5, /**< SELL-C-sigma sparse matrix format. */
+    rocsparse_format_bsr     = 6, /**< BSR sparse matrix format. */
+    rocsparse_format_csr16   = 7 /**< CSR sparse matrix format with 16 bit column offsets. */
 } rocsparse_format;
 
+/*! \ingroup types_module
+ *  \brief List of sparse matrix attributes.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_spmat_attribute types that are used to
+ *  describe the structure of a sparse matrix, see rocsparse_spmat_set_attribute().
+ */
+typedef enum rocsparse_spmat_attribute_
+{
+    rocsparse_spmat_fill_mode   = 0, /**< Fill mode, type \ref rocsparse_fill_mode. */
+    rocsparse_spmat_diag_type   = 1, /**< Diagonal type, type \ref rocsparse_diag_type. */
+    rocsparse_spmat_matrix_type = 2 /**< Matrix type, type \ref rocsparse_matrix_type. */
+} rocsparse_spmat_attribute;
+
 /*! \ingroup types_module
  *  \brief List of dense matrix ordering.
  *
@@ -367,7 +437,8 @@ typedef enum rocsparse_spmv_alg_
     rocsparse_spmv_alg_coo          = 1, /**< COO SpMV algorithm for COO matrices. */
     rocsparse_spmv_alg_csr_adaptive = 2, /**< CSR SpMV algorithm 1 (adaptive) for CSR matrices. */
     rocsparse_spmv_alg_csr_stream   = 3, /**< CSR SpMV algorithm 2 (stream) for CSR matrices. */
-    rocsparse_spmv_alg_ell          = 4 /**< ELL SpMV algorithm for ELL matrices. */
+    rocsparse_spmv_alg_ell          = 4, /**< ELL SpMV algorithm for ELL matrices. */
+    rocsparse_spmv_alg_csr_merge    = 5 /**< CSR SpMV algorithm 3 (merge path) for CSR matrices. */
 } rocsparse_spmv_alg;
 
 /*! \ingroup types_module
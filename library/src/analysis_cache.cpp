@@ -0,0 +1,205 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "analysis_cache.h"
+#include "definitions.h"
+
+rocsparse_analysis_cache::rocsparse_analysis_cache(size_t capacity)
+    : capacity_(capacity)
+{
+}
+
+rocsparse_analysis_cache::~rocsparse_analysis_cache()
+{
+    for(auto& e : entries_)
+    {
+        for(void* ptr : e.data)
+        {
+            PRINT_IF_ROCSPARSE_ERROR(e.allocator.deallocate(ptr, 0));
+        }
+    }
+}
+
+rocsparse_status rocsparse_analysis_cache::fetch(const rocsparse_analysis_key&     key,
+                                                 int64_t*                          scalar,
+                                                 std::initializer_list<void**>     arrays,
+                                                 const rocsparse_device_allocator& allocator,
+                                                 hipStream_t                       stream,
+                                                 bool*                             found)
+{
+    auto it = index_.find(key);
+
+    if(it == index_.end())
+    {
+        ++misses_;
+        *found = false;
+        return rocsparse_status_success;
+    }
+
+    // Mark entry as most recently used
+    entries_.splice(entries_.begin(), entries_, it->second);
+
+    const entry& e = *it->second;
+
+    // LCOV_EXCL_START
+    if(arrays.size() != e.data.size())
+    {
+        return rocsparse_status_internal_error;
+    }
+    // LCOV_EXCL_STOP
+
+    size_t i = 0;
+    for(void** ptr : arrays)
+    {
+        *ptr = nullptr;
+
+        if(e.bytes[i] > 0)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(ptr, e.bytes[i], stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(*ptr, e.data[i], e.bytes[i], hipMemcpyDeviceToDevice, stream));
+        }
+
+        ++i;
+    }
+
+    ++hits_;
+    *scalar = e.scalar;
+    *found  = true;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status
+    rocsparse_analysis_cache::insert(const rocsparse_analysis_key&                   key,
+                                     int64_t                                         scalar,
+                                     std::initializer_list<rocsparse_analysis_array> arrays,
+                                     const rocsparse_device_allocator&               allocator,
+                                     hipStream_t                                     stream)
+{
+    if(index_.find(key) != index_.end())
+    {
+        return rocsparse_status_success;
+    }
+
+    size_t required = 0;
+    for(const auto& a : arrays)
+    {
+        required += a.bytes;
+    }
+
+    // Entries that exceed the capacity are not cached
+    if(required > capacity_)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(evict(required, stream));
+
+    entry e;
+    e.key       = key;
+    e.scalar    = scalar;
+    e.size      = required;
+    e.allocator = allocator;
+
+    for(const auto& a : arrays)
+    {
+        void* ptr = nullptr;
+
+        if(a.bytes > 0)
+        {
+            // Caching is best effort, the analysis must not fail if the device
+            // is out of memory
+            if(e.allocator.allocate(&ptr, a.bytes, stream) != rocsparse_status_success)
+            {
+                // LCOV_EXCL_START
+                (void)hipGetLastError();
+                return release(e, stream);
+                // LCOV_EXCL_STOP
+            }
+
+            e.data.push_back(ptr);
+            e.bytes.push_back(a.bytes);
+
+            // Release the arrays of the incomplete entry if the copy fails
+            if(hipMemcpyAsync(ptr, a.data, a.bytes, hipMemcpyDeviceToDevice, stream)
+               != hipSuccess)
+            {
+                // LCOV_EXCL_START
+                (void)hipGetLastError();
+                return release(e, stream);
+                // LCOV_EXCL_STOP
+            }
+        }
+        else
+        {
+            e.data.push_back(nullptr);
+            e.bytes.push_back(0);
+        }
+    }
+
+    entries_.push_front(std::move(e));
+    index_[key] = entries_.begin();
+    size_ += required;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_analysis_cache::resize(size_t capacity, hipStream_t stream)
+{
+    capacity_ = capacity;
+
+    return evict(0, stream);
+}
+
+rocsparse_status rocsparse_analysis_cache::evict(size_t required, hipStream_t stream)
+{
+    while(!entries_.empty() && size_ + required > capacity_)
+    {
+        entry& e = entries_.back();
+
+        size_ -= e.size;
+        index_.erase(e.key);
+
+        rocsparse_status status = release(e, stream);
+        entries_.pop_back();
+
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_analysis_cache::release(entry& e, hipStream_t stream)
+{
+    for(void* ptr : e.data)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(e.allocator.deallocate(ptr, stream));
+    }
+
+    e.data.clear();
+    e.bytes.clear();
+
+    return rocsparse_status_success;
+}
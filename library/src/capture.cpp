@@ -0,0 +1,129 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "capture.h"
+#include "fingerprint.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// Log file is shared by all handles
+static std::mutex& rocsparse_capture_log_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*******************************************************************************
+ * rocsparse_capture
+ ******************************************************************************/
+rocsparse_capture::rocsparse_capture()
+{
+    char* str_path = getenv("ROCSPARSE_LOG_CAPTURE_PATH");
+    this->path     = (str_path != NULL) ? str_path : ".";
+
+    std::lock_guard<std::mutex> lock(rocsparse_capture_log_mutex());
+
+    // Write the header if the log is new
+    std::string   log = this->path + "/capture.log";
+    std::ifstream ifs(log);
+    if(!ifs.good())
+    {
+        std::ofstream ofs(log);
+        ofs << "# rocsparse capture, replay with rocsparse-replay --capture " << this->path
+            << std::endl;
+        ofs << "# csrmv precision trans type fill_mode m n nnz alpha_re alpha_im beta_re "
+               "beta_im adaptive|stream file"
+            << std::endl;
+    }
+}
+
+std::string rocsparse_capture::store_csr(int64_t              m,
+                                         int64_t              n,
+                                         int64_t              nnz,
+                                         rocsparse_index_base base,
+                                         char                 precision,
+                                         uint64_t             pattern,
+                                         const int64_t*       csr_row_ptr,
+                                         const int64_t*       csr_col_ind,
+                                         const void*          csr_val,
+                                         size_t               val_size)
+{
+    int64_t header[5] = {m, n, nnz, base, precision};
+
+    // Hash of the values
+    uint64_t values = rocsparse_hash_fnv1a_init;
+    values          = rocsparse_hash_fnv1a(values, &precision, sizeof(char));
+    values          = rocsparse_hash_fnv1a(values, csr_val, val_size);
+
+    std::ostringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << pattern << "_" << std::setw(16)
+         << values << ".csr";
+
+    std::string file = name.str();
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if(this->stored.count(file) != 0)
+    {
+        return file;
+    }
+
+    std::string full = this->path + "/" + file;
+
+    // Operand might have been stored by another handle or process
+    std::ifstream ifs(full, std::ios::binary);
+    if(!ifs.good())
+    {
+        // Write to a temporary file first, such that partial files are never read
+        std::string   tmp = full + ".tmp";
+        std::ofstream ofs(tmp, std::ios::binary);
+
+        ofs.write(reinterpret_cast<const char*>(header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(csr_row_ptr), sizeof(int64_t) * (m + 1));
+        ofs.write(reinterpret_cast<const char*>(csr_col_ind), sizeof(int64_t) * nnz);
+        ofs.write(reinterpret_cast<const char*>(csr_val), val_size);
+        ofs.close();
+
+        if(!ofs.good() || std::rename(tmp.c_str(), full.c_str()) != 0)
+        {
+            std::remove(tmp.c_str());
+            std::cerr << "rocsparse capture: failed to write " << full << std::endl;
+        }
+    }
+
+    this->stored.insert(file);
+
+    return file;
+}
+
+void rocsparse_capture::record(const std::string& line)
+{
+    std::lock_guard<std::mutex> lock(rocsparse_capture_log_mutex());
+
+    std::ofstream ofs(this->path + "/capture.log", std::ios::app);
+    ofs << line << std::endl;
+}
@@ -0,0 +1,167 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2CSR16_DEVICE_H
+#define CSR2CSR16_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// Largest column offset that can be stored in a CSR16 column offset
+static constexpr rocsparse_int csr16_max_offset = 0xFFFF;
+
+// Compute the base column and the number of non-escaped entries of each row. A window
+// of csr16_max_offset + 1 columns is moved over the sorted column indices of the row,
+// the base column is the start of the first window that covers most of the entries.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csr16_nnz_kernel(rocsparse_int        m,
+                              const rocsparse_int* csr_row_ptr,
+                              const rocsparse_int* csr_col_ind,
+                              rocsparse_index_base csr_idx_base,
+                              rocsparse_int*       csr16_row_ptr,
+                              rocsparse_int*       csr16_row_base,
+                              rocsparse_index_base csr16_idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row == 0)
+    {
+        csr16_row_ptr[0] = csr16_idx_base;
+    }
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - csr_idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_idx_base;
+
+    rocsparse_int base  = 0;
+    rocsparse_int width = 0;
+    rocsparse_int lo    = row_begin;
+
+    for(rocsparse_int hi = row_begin; hi < row_end; ++hi)
+    {
+        rocsparse_int col = csr_col_ind[hi];
+
+        while(col - csr_col_ind[lo] > csr16_max_offset)
+        {
+            ++lo;
+        }
+
+        if(hi - lo + 1 > width)
+        {
+            width = hi - lo + 1;
+            base  = csr_col_ind[lo] - csr_idx_base;
+        }
+    }
+
+    // Count the entries that are covered by the base column explicitly, such that
+    // unsorted rows still result in a valid, but less compressed, matrix
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int off = csr_col_ind[j] - csr_idx_base - base;
+
+        if(off >= 0 && off <= csr16_max_offset)
+        {
+            ++nnz;
+        }
+    }
+
+    csr16_row_base[row]    = base + csr16_idx_base;
+    csr16_row_ptr[row + 1] = nnz;
+}
+
+// Number of escaped entries, the difference between the CSR and CSR16 entries
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csr16_esc_nnz_kernel(rocsparse_int        m,
+                                  const rocsparse_int* csr_row_ptr,
+                                  rocsparse_index_base csr_idx_base,
+                                  const rocsparse_int* csr16_row_ptr,
+                                  rocsparse_index_base csr16_idx_base,
+                                  rocsparse_int* __restrict__ esc_nnz)
+{
+    *esc_nnz = (csr_row_ptr[m] - csr_idx_base) - (csr16_row_ptr[m] - csr16_idx_base);
+}
+
+// CSR to CSR16 format conversion kernel, each thread converts one row. The escaped
+// entries of all previous rows are the difference of the CSR and CSR16 row pointers.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csr16_kernel(rocsparse_int        m,
+                          const T*             csr_val,
+                          const rocsparse_int* csr_row_ptr,
+                          const rocsparse_int* csr_col_ind,
+                          rocsparse_index_base csr_idx_base,
+                          const rocsparse_int* csr16_row_ptr,
+                          const rocsparse_int* csr16_row_base,
+                          uint16_t*            csr16_col_off,
+                          T*                   csr16_val,
+                          rocsparse_int*       csr16_esc_row_ind,
+                          rocsparse_int*       csr16_esc_col_ind,
+                          T*                   csr16_esc_val,
+                          rocsparse_index_base csr16_idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - csr_idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_idx_base;
+
+    rocsparse_int idx  = csr16_row_ptr[row] - csr16_idx_base;
+    rocsparse_int esc  = row_begin - idx;
+    rocsparse_int base = csr16_row_base[row] - csr16_idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - csr_idx_base;
+        rocsparse_int off = col - base;
+
+        if(off >= 0 && off <= csr16_max_offset)
+        {
+            csr16_col_off[idx] = static_cast<uint16_t>(off);
+            csr16_val[idx]     = csr_val[j];
+            ++idx;
+        }
+        else
+        {
+            csr16_esc_row_ind[esc] = row + csr16_idx_base;
+            csr16_esc_col_ind[esc] = col + csr16_idx_base;
+            csr16_esc_val[esc]     = csr_val[j];
+            ++esc;
+        }
+    }
+}
+
+#endif // CSR2CSR16_DEVICE_H
@@ -30,11 +30,11 @@
 
 // Compute non-zero entries per CSR row to obtain the COO nnz per row.
 template <unsigned int BLOCKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
-                                                         rocsparse_int        ell_width,
-                                                         const rocsparse_int* csr_row_ptr,
-                                                         rocsparse_int*       coo_row_nnz,
-                                                         rocsparse_index_base idx_base)
+__device__ void hyb_coo_nnz_device(rocsparse_int        m,
+                                   rocsparse_int        ell_width,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int*       coo_row_nnz,
+                                   rocsparse_index_base idx_base)
 {
     rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
 
@@ -59,20 +59,84 @@ __launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
     }
 }
 
-// CSR to HYB format conversion kernel
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
+                                                         rocsparse_int        ell_width,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         rocsparse_int*       coo_row_nnz,
+                                                         rocsparse_index_base idx_base)
+{
+    hyb_coo_nnz_device<BLOCKSIZE>(m, ell_width, csr_row_ptr, coo_row_nnz, idx_base);
+}
+
+// Compute the COO nnz per row, where the ELL width is stored on the device.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz_bounded(rocsparse_int        m,
+                                                                 const rocsparse_int* ell_width,
+                                                                 const rocsparse_int* csr_row_ptr,
+                                                                 rocsparse_int*       coo_row_nnz,
+                                                                 rocsparse_index_base idx_base)
+{
+    hyb_coo_nnz_device<BLOCKSIZE>(m, *ell_width, csr_row_ptr, coo_row_nnz, idx_base);
+}
+
+// Store the ELL width of the bounded conversion. The maximum row length of the max
+// partition is limited to ell_width_bound, the ELL width of the other partitions
+// equals ell_width_bound.
+__global__ void hyb_ell_width_bounded(const rocsparse_int* max_row_nnz,
+                                      rocsparse_int        ell_width_bound,
+                                      rocsparse_int*       ell_width)
+{
+    *ell_width = (max_row_nnz != nullptr) ? min(*max_row_nnz, ell_width_bound) : ell_width_bound;
+}
+
+// Store the COO nnz of the bounded conversion from the COO row offsets.
+__global__ void hyb_coo_nnz_bounded_finalize(rocsparse_int        m,
+                                             const rocsparse_int* coo_row_ptr,
+                                             rocsparse_int*       coo_nnz,
+                                             rocsparse_index_base idx_base)
+{
+    *coo_nnz = coo_row_ptr[m] - idx_base;
+}
+
+// Compute the COO nnz per row of the auto partition, where the ELL width is the
+// average number of non-zero entries per CSR row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz_auto(rocsparse_int        m,
+                                                              const rocsparse_int* csr_row_ptr,
+                                                              rocsparse_int*       coo_row_nnz,
+                                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        rocsparse_int ell_width = (csr_row_ptr[m] - idx_base - 1) / m + 1;
+        rocsparse_int row_nnz   = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+
+        coo_row_nnz[gid + 1] = (row_nnz > ell_width) ? row_nnz - ell_width : 0;
+    }
+
+    if(gid == 0)
+    {
+        coo_row_nnz[0] = idx_base;
+    }
+}
+
+// CSR to HYB format conversion
 template <unsigned int BLOCKSIZE, typename T>
-__launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int        m,
-                                                            const T*             csr_val,
-                                                            const rocsparse_int* csr_row_ptr,
-                                                            const rocsparse_int* csr_col_ind,
-                                                            rocsparse_int        ell_width,
-                                                            rocsparse_int*       ell_col_ind,
-                                                            T*                   ell_val,
-                                                            rocsparse_int*       coo_row_ind,
-                                                            rocsparse_int*       coo_col_ind,
-                                                            T*                   coo_val,
-                                                            rocsparse_int*       workspace,
-                                                            rocsparse_index_base idx_base)
+__device__ void csr2hyb_device(rocsparse_int        m,
+                               const T*             csr_val,
+                               const rocsparse_int* csr_row_ptr,
+                               const rocsparse_int* csr_col_ind,
+                               rocsparse_int        ell_width,
+                               rocsparse_int*       ell_col_ind,
+                               T*                   ell_val,
+                               rocsparse_int*       coo_row_ind,
+                               rocsparse_int*       coo_col_ind,
+                               T*                   coo_val,
+                               const rocsparse_int* workspace,
+                               rocsparse_index_base idx_base)
 {
     rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
 
@@ -116,4 +180,63 @@ __launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int
     }
 }
 
+// CSR to HYB format conversion kernel
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int        m,
+                                                            const T*             csr_val,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind,
+                                                            rocsparse_int        ell_width,
+                                                            rocsparse_int*       ell_col_ind,
+                                                            T*                   ell_val,
+                                                            rocsparse_int*       coo_row_ind,
+                                                            rocsparse_int*       coo_col_ind,
+                                                            T*                   coo_val,
+                                                            rocsparse_int*       workspace,
+                                                            rocsparse_index_base idx_base)
+{
+    csr2hyb_device<BLOCKSIZE>(m,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_width,
+                              ell_col_ind,
+                              ell_val,
+                              coo_row_ind,
+                              coo_col_ind,
+                              coo_val,
+                              workspace,
+                              idx_base);
+}
+
+// CSR to HYB format conversion kernel, where the ELL width is stored on the device
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2hyb_bounded_kernel(rocsparse_int        m,
+                                const T*             csr_val,
+                                const rocsparse_int* csr_row_ptr,
+                                const rocsparse_int* csr_col_ind,
+                                const rocsparse_int* ell_width,
+                                rocsparse_int*       ell_col_ind,
+                                T*                   ell_val,
+                                rocsparse_int*       coo_row_ind,
+                                rocsparse_int*       coo_col_ind,
+                                T*                   coo_val,
+                                const rocsparse_int* workspace,
+                                rocsparse_index_base idx_base)
+{
+    csr2hyb_device<BLOCKSIZE>(m,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              *ell_width,
+                              ell_col_ind,
+                              ell_val,
+                              coo_row_ind,
+                              coo_col_ind,
+                              coo_val,
+                              workspace,
+                              idx_base);
+}
+
 #endif // CSR2HYB_DEVICE_H
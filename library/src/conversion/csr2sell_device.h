@@ -0,0 +1,209 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2SELL_DEVICE_H
+#define CSR2SELL_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// Sort the rows within their window of sigma rows by decreasing number of non-zero
+// entries. Each row determines its rank by comparing against all rows of its window,
+// ties are resolved by the row index, such that the sort is stable. The cost grows with
+// sigma, such that it is only used for short windows.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sell_row_perm_kernel(rocsparse_int        m,
+                                  rocsparse_int        sigma,
+                                  const rocsparse_int* csr_row_ptr,
+                                  rocsparse_int*       sell_row_perm,
+                                  rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int window_begin = (ai / sigma) * sigma;
+    rocsparse_int window_end   = min(window_begin + sigma, m);
+
+    rocsparse_int row_nnz = csr_row_ptr[ai + 1] - csr_row_ptr[ai];
+    rocsparse_int rank    = 0;
+
+    for(rocsparse_int j = window_begin; j < window_end; ++j)
+    {
+        rocsparse_int nnz_j = csr_row_ptr[j + 1] - csr_row_ptr[j];
+
+        if(nnz_j > row_nnz || (nnz_j == row_nnz && j < ai))
+        {
+            ++rank;
+        }
+    }
+
+    sell_row_perm[window_begin + rank] = ai + sell_idx_base;
+}
+
+// Number of non-zero entries and shifted index of each row, the keys and values of the
+// segmented sort that is used for long windows
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sell_row_nnz_kernel(rocsparse_int        m,
+                                 const rocsparse_int* csr_row_ptr,
+                                 rocsparse_int*       row_nnz,
+                                 rocsparse_int*       rows,
+                                 rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    row_nnz[ai] = csr_row_ptr[ai + 1] - csr_row_ptr[ai];
+    rows[ai]    = ai + sell_idx_base;
+}
+
+// Offsets of the windows of sigma rows, the segments of the segmented sort
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sell_window_ptr_kernel(rocsparse_int  m,
+                                                                        rocsparse_int  nwindows,
+                                                                        rocsparse_int  sigma,
+                                                                        rocsparse_int* window_ptr)
+{
+    rocsparse_int window = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(window > nwindows)
+    {
+        return;
+    }
+
+    window_ptr[window] = min(static_cast<int64_t>(window) * sigma, static_cast<int64_t>(m));
+}
+
+// Compute the number of stored entries per slice, which is the maximum number of
+// non-zero entries of its rows times the slice size
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sell_slice_nnz_kernel(rocsparse_int        m,
+                                   rocsparse_int        nslices,
+                                   rocsparse_int        slice_size,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* sell_row_perm,
+                                   rocsparse_int*       sell_slice_ptr,
+                                   rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int slice = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(slice == 0)
+    {
+        sell_slice_ptr[0] = sell_idx_base;
+    }
+
+    if(slice >= nslices)
+    {
+        return;
+    }
+
+    rocsparse_int slice_begin = slice * slice_size;
+    rocsparse_int slice_end   = min(slice_begin + slice_size, m);
+
+    rocsparse_int width = 0;
+
+    for(rocsparse_int i = slice_begin; i < slice_end; ++i)
+    {
+        rocsparse_int row = sell_row_perm[i] - sell_idx_base;
+
+        width = max(width, csr_row_ptr[row + 1] - csr_row_ptr[row]);
+    }
+
+    sell_slice_ptr[slice + 1] = width * slice_size;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sell_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// CSR to SELL format conversion kernel, each thread fills one row of a slice. Slice rows
+// beyond m only hold padding.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sell_kernel(rocsparse_int        m,
+                                                             rocsparse_int        nslices,
+                                                             rocsparse_int        slice_size,
+                                                             const T*             csr_val,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             rocsparse_index_base csr_idx_base,
+                                                             const rocsparse_int* sell_slice_ptr,
+                                                             const rocsparse_int* sell_row_perm,
+                                                             rocsparse_int*       sell_col_ind,
+                                                             T*                   sell_val,
+                                                             rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= nslices * slice_size)
+    {
+        return;
+    }
+
+    rocsparse_int slice = ai / slice_size;
+    rocsparse_int lane  = ai % slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[slice] - sell_idx_base;
+    rocsparse_int width       = (sell_slice_ptr[slice + 1] - sell_slice_ptr[slice]) / slice_size;
+
+    rocsparse_int p = 0;
+
+    if(ai < m)
+    {
+        rocsparse_int row = sell_row_perm[ai] - sell_idx_base;
+
+        rocsparse_int row_begin = csr_row_ptr[row] - csr_idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_idx_base;
+
+        // Fill SELL slice
+        for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+        {
+            rocsparse_int idx = slice_begin + p++ * slice_size + lane;
+            sell_col_ind[idx] = csr_col_ind[aj] - csr_idx_base + sell_idx_base;
+            sell_val[idx]     = csr_val[aj];
+        }
+    }
+
+    // Pad remaining SELL slice row
+    for(; p < width; ++p)
+    {
+        rocsparse_int idx = slice_begin + p * slice_size + lane;
+        sell_col_ind[idx] = -1;
+        sell_val[idx]     = static_cast<T>(0);
+    }
+}
+
+#endif // CSR2SELL_DEVICE_H
@@ -0,0 +1,80 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEBSR2DENSE_DEVICE_H
+#define GEBSR2DENSE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// One thread block per block row, each thread writes entries of the block row
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void gebsr2dense_kernel(rocsparse_direction  dir,
+                                                                J                    mb,
+                                                                J                    row_block_dim,
+                                                                J                    col_block_dim,
+                                                                I                    lda,
+                                                                rocsparse_index_base base,
+                                                                const T*             bsr_val,
+                                                                const I*             bsr_row_ptr,
+                                                                const J*             bsr_col_ind,
+                                                                T*                   A,
+                                                                rocsparse_order      order)
+{
+    J mbrow = hipBlockIdx_x;
+
+    if(mbrow >= mb)
+    {
+        return;
+    }
+
+    I block_size = static_cast<I>(row_block_dim) * col_block_dim;
+
+    I start = (bsr_row_ptr[mbrow] - base) * block_size;
+    I end   = (bsr_row_ptr[mbrow + 1] - base) * block_size;
+
+    for(I k = start + hipThreadIdx_x; k < end; k += BLOCKSIZE)
+    {
+        I j = k / block_size;
+        I l = k % block_size;
+
+        // Position of the entry inside its block
+        J bi = (dir == rocsparse_direction_row) ? l / col_block_dim : l % row_block_dim;
+        J bj = (dir == rocsparse_direction_row) ? l % col_block_dim : l / row_block_dim;
+
+        I row = static_cast<I>(mbrow) * row_block_dim + bi;
+        I col = static_cast<I>(bsr_col_ind[j] - base) * col_block_dim + bj;
+
+        if(order == rocsparse_order_column)
+        {
+            A[lda * col + row] = bsr_val[k];
+        }
+        else
+        {
+            A[lda * row + col] = bsr_val[k];
+        }
+    }
+}
+
+#endif // GEBSR2DENSE_DEVICE_H
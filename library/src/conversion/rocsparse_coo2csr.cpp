@@ -39,6 +39,9 @@ extern "C" rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_coo2csr",
@@ -49,6 +49,9 @@ rocsparse_status rocsparse_coo2dense_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcoo2dense"),
@@ -41,6 +41,9 @@ extern "C" rocsparse_status rocsparse_coosort_buffer_size(rocsparse_handle     h
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_coosort_buffer_size",
@@ -141,6 +144,9 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_coosort_by_row",
@@ -250,7 +256,7 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
             hipMemcpyAsync(&nsegm, work3, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             nullptr, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
@@ -406,7 +412,7 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
             hipMemcpyAsync(&nsegm, work3, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             nullptr, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
@@ -97,6 +97,9 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsr2bsr"),
@@ -167,10 +170,9 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
 
     rocsparse_int hstart = 0;
     rocsparse_int hend   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
 
     hipMemset(bsr_val, 0, (hend - hstart) * block_dim * block_dim * sizeof(T));
 
@@ -310,12 +312,12 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, buffer_size));
             temp_alloc = true;
         }
 
@@ -350,7 +352,7 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
     }
 
@@ -421,6 +423,9 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csr2bsr_nnz",
@@ -523,10 +528,10 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
 
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
             *bsr_nnz = hend - hstart;
         }
 
@@ -604,12 +609,12 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, buffer_size));
             temp_alloc = true;
         }
 
@@ -635,7 +640,7 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
     }
 
@@ -649,12 +654,12 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -668,7 +673,7 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
 
     if(temp_alloc)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     // Compute bsr_nnz
@@ -687,10 +692,10 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
     {
         rocsparse_int hstart = 0;
         rocsparse_int hend   = 0;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
         *bsr_nnz = hend - hstart;
     }
 
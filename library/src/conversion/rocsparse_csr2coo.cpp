@@ -41,6 +41,9 @@ rocsparse_status rocsparse_csr2coo_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging TODO bench logging
     log_trace(handle,
               "rocsparse_csr2coo",
@@ -50,6 +50,9 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsr2csc"),
@@ -245,6 +248,9 @@ extern "C" rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     h
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csr2csc_buffer_size",
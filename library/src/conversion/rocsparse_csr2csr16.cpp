@@ -0,0 +1,432 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csr2csr16.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csr2csr16_device.h"
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_csr2csr16_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              const rocsparse_mat_descr csr_descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const rocsparse_mat_descr csr16_descr,
+                                              const rocsparse_int*      csr16_row_ptr,
+                                              const rocsparse_int*      csr16_row_base,
+                                              T*                        csr16_val,
+                                              uint16_t*                 csr16_col_off,
+                                              T*                        csr16_esc_val,
+                                              rocsparse_int*            csr16_esc_row_ind,
+                                              rocsparse_int*            csr16_esc_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csr16"),
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csr16_descr,
+              (const void*&)csr16_row_ptr,
+              (const void*&)csr16_row_base,
+              (const void*&)csr16_val,
+              (const void*&)csr16_col_off,
+              (const void*&)csr16_esc_val,
+              (const void*&)csr16_esc_row_ind,
+              (const void*&)csr16_esc_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f csr2csr16 -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr16_descr->base != rocsparse_index_base_zero
+       && csr16_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr16_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_row_base == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All other arrays might be empty, if the matrix has no non-zero entries or
+    // if no entry has to be escaped
+    if(csr_val == nullptr && csr_col_ind != nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val != nullptr && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_val == nullptr && csr16_col_off != nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_val != nullptr && csr16_col_off == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_esc_val == nullptr
+            && (csr16_esc_row_ind != nullptr || csr16_esc_col_ind != nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_esc_val != nullptr
+            && (csr16_esc_row_ind == nullptr || csr16_esc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR2CSR16_DIM 512
+    dim3 csr2csr16_blocks((m - 1) / CSR2CSR16_DIM + 1);
+    dim3 csr2csr16_threads(CSR2CSR16_DIM);
+
+    hipLaunchKernelGGL((csr2csr16_kernel<CSR2CSR16_DIM>),
+                       csr2csr16_blocks,
+                       csr2csr16_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       csr16_row_ptr,
+                       csr16_row_base,
+                       csr16_col_off,
+                       csr16_val,
+                       csr16_esc_row_ind,
+                       csr16_esc_col_ind,
+                       csr16_esc_val,
+                       csr16_descr->base);
+#undef CSR2CSR16_DIM
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2csr16_nnz(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const rocsparse_mat_descr csr16_descr,
+                                                    rocsparse_int*            csr16_row_ptr,
+                                                    rocsparse_int*            csr16_row_base,
+                                                    rocsparse_int*            csr16_esc_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csr16_nnz",
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csr16_descr,
+              (const void*&)csr16_row_ptr,
+              (const void*&)csr16_row_base,
+              (const void*&)csr16_esc_nnz);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr16_descr->base != rocsparse_index_base_zero
+       && csr16_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr16_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check csr16_esc_nnz pointer argument before setting
+    if(csr16_esc_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csr16_esc_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *csr16_esc_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr16_row_base == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // csr_col_ind might be nullptr, if the matrix has no non-zero entries
+
+#define CSR2CSR16_DIM 256
+    // Determine the base column and the number of non-escaped entries per row
+    hipLaunchKernelGGL((csr2csr16_nnz_kernel<CSR2CSR16_DIM>),
+                       dim3(m / CSR2CSR16_DIM + 1),
+                       dim3(CSR2CSR16_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       csr16_row_ptr,
+                       csr16_row_base,
+                       csr16_descr->base);
+
+    // Inclusive sum to obtain csr16_row_ptr array
+    size_t temp_storage_bytes = 0;
+
+    // Obtain rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_bytes,
+                                                csr16_row_ptr,
+                                                csr16_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // The buffer also holds the number of escaped entries in host pointer mode
+    temp_storage_bytes = std::max(temp_storage_bytes, sizeof(rocsparse_int));
+
+    // Get rocprim buffer
+    bool  d_temp_alloc;
+    void* d_temp_storage;
+
+    // Device buffer should be sufficient for rocprim in most cases
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_temp_storage));
+        d_temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    // Perform actual inclusive sum
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                csr16_row_ptr,
+                                                csr16_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Number of escaped entries
+    rocsparse_int* d_esc_nnz = (handle->pointer_mode == rocsparse_pointer_mode_device)
+                                   ? csr16_esc_nnz
+                                   : (rocsparse_int*)d_temp_storage;
+
+    hipLaunchKernelGGL((csr2csr16_esc_nnz_kernel<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_descr->base,
+                       csr16_row_ptr,
+                       csr16_descr->base,
+                       d_esc_nnz);
+#undef CSR2CSR16_DIM
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(csr16_esc_nnz, d_esc_nnz, sizeof(rocsparse_int)));
+    }
+
+    // Free rocprim buffer, if allocated
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,            \
+                                     rocsparse_int             m,                 \
+                                     const rocsparse_mat_descr csr_descr,         \
+                                     const TYPE*               csr_val,           \
+                                     const rocsparse_int*      csr_row_ptr,       \
+                                     const rocsparse_int*      csr_col_ind,       \
+                                     const rocsparse_mat_descr csr16_descr,       \
+                                     const rocsparse_int*      csr16_row_ptr,     \
+                                     const rocsparse_int*      csr16_row_base,    \
+                                     TYPE*                     csr16_val,         \
+                                     uint16_t*                 csr16_col_off,     \
+                                     TYPE*                     csr16_esc_val,     \
+                                     rocsparse_int*            csr16_esc_row_ind, \
+                                     rocsparse_int*            csr16_esc_col_ind) \
+    {                                                                             \
+        return rocsparse_csr2csr16_template(handle,                               \
+                                            m,                                    \
+                                            csr_descr,                            \
+                                            csr_val,                              \
+                                            csr_row_ptr,                          \
+                                            csr_col_ind,                          \
+                                            csr16_descr,                          \
+                                            csr16_row_ptr,                        \
+                                            csr16_row_base,                       \
+                                            csr16_val,                            \
+                                            csr16_col_off,                        \
+                                            csr16_esc_val,                        \
+                                            csr16_esc_row_ind,                    \
+                                            csr16_esc_col_ind);                   \
+    }
+
+C_IMPL(rocsparse_scsr2csr16, float);
+C_IMPL(rocsparse_dcsr2csr16, double);
+C_IMPL(rocsparse_ccsr2csr16, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsr2csr16, rocsparse_double_complex);
+#undef C_IMPL
@@ -83,6 +83,9 @@ rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          h
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsr2csr_compress"),
@@ -161,12 +164,12 @@ rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          h
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -180,7 +183,7 @@ rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          h
 
     if(temp_alloc)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     // Mean number of elements per row in the input CSR matrix
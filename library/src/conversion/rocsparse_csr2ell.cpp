@@ -54,6 +54,9 @@ rocsparse_status rocsparse_csr2ell_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsr2ell"),
@@ -176,6 +179,9 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csr2ell_width",
@@ -248,7 +254,8 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
     rocsparse_int nblocks = CSR2ELL_DIM;
 
     // Get workspace from handle device buffer
-    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->buffer);
+    rocsparse_int* workspace;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&workspace));
 
     dim3 csr2ell_blocks(nblocks);
     dim3 csr2ell_threads(CSR2ELL_DIM);
@@ -279,8 +286,8 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
     }
     else
     {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(ell_width, workspace, sizeof(rocsparse_int)));
     }
 
     return rocsparse_status_success;
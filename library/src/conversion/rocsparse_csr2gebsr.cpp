@@ -79,6 +79,9 @@ rocsparse_status rocsparse_csr2gebsr_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Logging
     //
@@ -204,6 +207,9 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Logging
     //
@@ -268,10 +274,9 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
     //
     rocsparse_int hstart = 0;
     rocsparse_int hend   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
 
     //
     // Set bsr val to zero.
@@ -514,12 +519,12 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, buffer_size));
             temp_alloc = true;
         }
 
@@ -555,7 +560,7 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
     }
 
@@ -606,6 +611,9 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csr2gebsr_nnz",
@@ -707,10 +715,10 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
 
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
             *bsr_nnz_devhost = hend - hstart;
         }
 
@@ -749,12 +757,12 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
             temp_alloc = true;
         }
 
@@ -768,7 +776,7 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
@@ -785,10 +793,10 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
         {
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
             *bsr_nnz_devhost = hend - hstart;
         }
 
@@ -913,12 +921,12 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, buffer_size));
             temp_alloc = true;
         }
 
@@ -945,7 +953,7 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
     }
 
@@ -959,12 +967,12 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -978,7 +986,7 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
 
     if(temp_alloc)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     // Compute bsr_nnz
@@ -997,10 +1005,10 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
     {
         rocsparse_int hstart = 0;
         rocsparse_int hend   = 0;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int)));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int)));
         *bsr_nnz_devhost = hend - hstart;
     }
 
@@ -57,6 +57,9 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsr2hyb"),
@@ -124,87 +127,22 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Get number of CSR non-zeros
-    rocsparse_int csr_nnz;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Correct by index base
-    csr_nnz -= descr->base;
-
-    // Maximum ELL row width allowed
-    rocsparse_int max_row_nnz = 2 * (csr_nnz - 1) / m + 1;
-
-    // Check user_ell_width
-    if(partition_type == rocsparse_hyb_partition_user)
-    {
-        // ELL width cannot be 0 or negative
-        if(user_ell_width < 0)
-        {
-            return rocsparse_status_invalid_value;
-        }
-
-        if(user_ell_width > max_row_nnz)
-        {
-            return rocsparse_status_invalid_value;
-        }
-    }
-
-    // Clear HYB structure if already allocated
-    hyb->m         = m;
-    hyb->n         = n;
-    hyb->partition = partition_type;
-    hyb->ell_nnz   = 0;
-    hyb->ell_width = 0;
-    hyb->coo_nnz   = 0;
-
-    if(hyb->ell_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-    }
-    if(hyb->ell_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-    }
-    if(hyb->coo_row_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-    }
-    if(hyb->coo_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-    }
-    if(hyb->coo_val)
+    // ELL width cannot be negative
+    if(partition_type == rocsparse_hyb_partition_user && user_ell_width < 0)
     {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+        return rocsparse_status_invalid_value;
     }
 
-    // Determine ELL width
-
 #define CSR2ELL_DIM 512
-    // Workspace size
-    rocsparse_int blocks = (m - 1) / CSR2ELL_DIM + 1;
+    // Workspace holds the COO row offsets, or the partial maxima of the row lengths
+    rocsparse_int* workspace = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&workspace, sizeof(rocsparse_int) * (m + 1)));
 
-    if(partition_type == rocsparse_hyb_partition_user)
+    if(partition_type == rocsparse_hyb_partition_max)
     {
-        // ELL width given by user
-        hyb->ell_width = user_ell_width;
-    }
-    else if(partition_type == rocsparse_hyb_partition_auto)
-    {
-        // ELL width determined by average nnz per row
-        hyb->ell_width = (csr_nnz - 1) / m + 1;
-    }
-    else
-    {
-        // Allocate workspace
-        rocsparse_int* workspace = nullptr;
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * blocks));
-
         // HYB == ELL - no COO part - compute maximum nnz per row
+        rocsparse_int blocks = (m - 1) / CSR2ELL_DIM + 1;
+
         hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
                            dim3(blocks),
                            dim3(CSR2ELL_DIM),
@@ -221,113 +159,163 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                            stream,
                            blocks,
                            workspace);
-        // Copy ell width back to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            &hyb->ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-        RETURN_IF_HIP_ERROR(hipFree(workspace));
     }
-
-    // Re-check ELL width
-    if(hyb->ell_width > max_row_nnz)
+    else if(partition_type == rocsparse_hyb_partition_user && user_ell_width == 0)
     {
-        return rocsparse_status_invalid_value;
-    }
-
-    // Compute ELL non-zeros
-    hyb->ell_nnz = hyb->ell_width * m;
-
-    // Allocate ELL part
-    if(hyb->ell_nnz > 0)
-    {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->ell_val, sizeof(T) * hyb->ell_nnz));
+        // If there is no ELL part, its easy...
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(workspace,
+                                           csr_row_ptr,
+                                           sizeof(rocsparse_int) * (m + 1),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
-
-    // Allocate workspace
-    rocsparse_int* workspace = NULL;
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
-
-    // If there is a COO part, compute the COO non-zero elements per row
-    if(partition_type != rocsparse_hyb_partition_max)
+    else
     {
-        // If there is no ELL part, its easy...
-        if(hyb->ell_nnz == 0)
+        // Compute the COO non-zero elements per row, the ELL width of the auto
+        // partition is obtained from the CSR non-zeros on the device
+        if(partition_type == rocsparse_hyb_partition_user)
         {
-            hyb->coo_nnz = csr_nnz;
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(workspace,
-                                               csr_row_ptr,
-                                               sizeof(rocsparse_int) * (m + 1),
-                                               hipMemcpyDeviceToDevice,
-                                               stream));
+            hipLaunchKernelGGL((hyb_coo_nnz<CSR2ELL_DIM>),
+                               dim3((m - 1) / CSR2ELL_DIM + 1),
+                               dim3(CSR2ELL_DIM),
+                               0,
+                               stream,
+                               m,
+                               user_ell_width,
+                               csr_row_ptr,
+                               workspace,
+                               descr->base);
         }
         else
         {
-            hipLaunchKernelGGL((hyb_coo_nnz<CSR2ELL_DIM>),
+            hipLaunchKernelGGL((hyb_coo_nnz_auto<CSR2ELL_DIM>),
                                dim3((m - 1) / CSR2ELL_DIM + 1),
                                dim3(CSR2ELL_DIM),
                                0,
                                stream,
                                m,
-                               hyb->ell_width,
                                csr_row_ptr,
                                workspace,
                                descr->base);
-
-            // Inclusive sum on workspace
-            void*  d_temp_storage     = nullptr;
-            size_t temp_storage_bytes = 0;
-
-            // Obtain rocprim buffer size
-            RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        workspace,
-                                                        workspace,
-                                                        m + 1,
-                                                        rocprim::plus<rocsparse_int>(),
-                                                        stream));
-
-            // Allocate rocprim buffer
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
-
-            // Do inclusive sum
-            RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        workspace,
-                                                        workspace,
-                                                        m + 1,
-                                                        rocprim::plus<rocsparse_int>(),
-                                                        stream));
-
-            // Clear rocprim buffer
-            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
-
-            // Obtain coo nnz from workspace
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hyb->coo_nnz,
-                                               workspace + m,
-                                               sizeof(rocsparse_int),
-                                               hipMemcpyDeviceToHost,
-                                               stream));
-
-            // Wait for host transfer to finish
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-            hyb->coo_nnz -= descr->base;
         }
+
+        // Inclusive sum on workspace
+        void*  d_temp_storage     = nullptr;
+        size_t temp_storage_bytes = 0;
+
+        // Obtain rocprim buffer size
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    workspace,
+                                                    workspace,
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+
+        // Allocate rocprim buffer
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+
+        // Do inclusive sum
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    workspace,
+                                                    workspace,
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+
+        // Clear rocprim buffer
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
+    }
+
+    // Obtain the number of CSR non-zeros, together with the ELL width or the COO
+    // non-zeros from the workspace, with a single host synchronization
+    RETURN_IF_ROCSPARSE_ERROR(handle->reserve_host_buffer(sizeof(rocsparse_int) * 2));
+    rocsparse_int* sizes = reinterpret_cast<rocsparse_int*>(handle->host_buffer);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &sizes[0], csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&sizes[1],
+                                       (partition_type == rocsparse_hyb_partition_max)
+                                           ? workspace
+                                           : workspace + m,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+
+    // Correct by index base
+    rocsparse_int csr_nnz = sizes[0] - descr->base;
+
+    // Maximum ELL row width allowed
+    rocsparse_int max_row_nnz = 2 * (csr_nnz - 1) / m + 1;
+
+    // Determine ELL width and COO non-zeros
+    rocsparse_int ell_width;
+    rocsparse_int coo_nnz;
+
+    if(partition_type == rocsparse_hyb_partition_max)
+    {
+        ell_width = sizes[1];
+        coo_nnz   = 0;
+    }
+    else
+    {
+        // ELL width given by user, or determined by average nnz per row
+        ell_width = (partition_type == rocsparse_hyb_partition_user) ? user_ell_width
+                                                                     : (csr_nnz - 1) / m + 1;
+        coo_nnz   = sizes[1] - descr->base;
+    }
+
+    // Check ELL width
+    if(ell_width > max_row_nnz)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(workspace));
+        return rocsparse_status_invalid_value;
+    }
+
+    // Clear HYB structure if already allocated
+    hyb->m         = m;
+    hyb->n         = n;
+    hyb->partition = partition_type;
+    hyb->ell_width = ell_width;
+    hyb->ell_nnz   = ell_width * m;
+    hyb->coo_nnz   = coo_nnz;
+
+    // Release previous arrays with the allocator they have been allocated with
+    RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->ell_col_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->ell_val, stream));
+    RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_row_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_col_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_val, stream));
+
+    hyb->ell_col_ind = nullptr;
+    hyb->ell_val     = nullptr;
+    hyb->coo_row_ind = nullptr;
+    hyb->coo_col_ind = nullptr;
+    hyb->coo_val     = nullptr;
+    hyb->allocator   = handle->allocator;
+
+    // Allocate ELL part
+    if(hyb->ell_nnz > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.allocate(
+            (void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz, stream));
+        RETURN_IF_ROCSPARSE_ERROR(
+            hyb->allocator.allocate(&hyb->ell_val, sizeof(T) * hyb->ell_nnz, stream));
     }
 
     // Allocate COO part
     if(hyb->coo_nnz > 0)
     {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->coo_val, sizeof(T) * hyb->coo_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.allocate(
+            (void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz, stream));
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.allocate(
+            (void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz, stream));
+        RETURN_IF_ROCSPARSE_ERROR(
+            hyb->allocator.allocate(&hyb->coo_val, sizeof(T) * hyb->coo_nnz, stream));
     }
 
     dim3 csr2ell_blocks((m - 1) / CSR2ELL_DIM + 1);
@@ -351,7 +339,297 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                        workspace,
                        descr->base);
 
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(workspace));
+#undef CSR2ELL_DIM
+
+    return rocsparse_status_success;
+}
+
+// Upper bounds of the ELL width and the COO nnz of the bounded conversion
+static rocsparse_status rocsparse_csr2hyb_bounds(rocsparse_int           m,
+                                                 rocsparse_int           nnz,
+                                                 rocsparse_int           user_ell_width,
+                                                 rocsparse_hyb_partition partition_type,
+                                                 rocsparse_int*          ell_width_bound,
+                                                 rocsparse_int*          coo_nnz_bound)
+{
+    // ELL width cannot be negative
+    if(partition_type == rocsparse_hyb_partition_user && user_ell_width < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(m == 0 || nnz == 0)
+    {
+        *ell_width_bound = 0;
+        *coo_nnz_bound   = 0;
+
+        return rocsparse_status_success;
+    }
+
+    // Maximum ELL row width allowed
+    rocsparse_int max_row_nnz = 2 * (nnz - 1) / m + 1;
+
+    if(partition_type == rocsparse_hyb_partition_max)
+    {
+        // Rows that exceed the maximum ELL row width are continued in the COO part
+        *ell_width_bound = max_row_nnz;
+    }
+    else if(partition_type == rocsparse_hyb_partition_user)
+    {
+        if(user_ell_width > max_row_nnz)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        *ell_width_bound = user_ell_width;
+    }
+    else
+    {
+        // ELL width determined by average nnz per row
+        *ell_width_bound = (nnz - 1) / m + 1;
+    }
+
+    *coo_nnz_bound = nnz;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_bounded_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_int             user_ell_width,
+                                                    rocsparse_hyb_partition   partition_type,
+                                                    rocsparse_int*            ell_width,
+                                                    T*                        ell_val,
+                                                    rocsparse_int*            ell_col_ind,
+                                                    rocsparse_int*            coo_nnz,
+                                                    T*                        coo_val,
+                                                    rocsparse_int*            coo_row_ind,
+                                                    rocsparse_int*            coo_col_ind,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_bounded"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              user_ell_width,
+              partition_type,
+              (const void*&)ell_width,
+              (const void*&)ell_val,
+              (const void*&)ell_col_ind,
+              (const void*&)coo_nnz,
+              (const void*&)coo_val,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    // Check partition type
+    if(partition_type != rocsparse_hyb_partition_max
+       && partition_type != rocsparse_hyb_partition_user
+       && partition_type != rocsparse_hyb_partition_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output size arguments
+    if(ell_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(ell_width, 0, sizeof(rocsparse_int), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(coo_nnz, 0, sizeof(rocsparse_int), stream));
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int ell_width_bound;
+    rocsparse_int coo_nnz_bound;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_bounds(
+        m, nnz, user_ell_width, partition_type, &ell_width_bound, &coo_nnz_bound));
+
+    if(ell_width_bound > 0 && (ell_val == nullptr || ell_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_val == nullptr || coo_row_ind == nullptr || coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Workspace holds the COO row offsets, or the partial maxima of the row lengths,
+    // followed by the rocprim buffer
+    char*          ptr       = reinterpret_cast<char*>(temp_buffer);
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+#define CSR2ELL_DIM 512
+    if(partition_type == rocsparse_hyb_partition_max)
+    {
+        // Compute maximum nnz per row
+        rocsparse_int blocks = (m - 1) / CSR2ELL_DIM + 1;
+
+        hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           workspace);
+
+        hipLaunchKernelGGL((ell_width_kernel_part2<CSR2ELL_DIM>),
+                           dim3(1),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           blocks,
+                           workspace);
+    }
+
+    hipLaunchKernelGGL((hyb_ell_width_bounded),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       (partition_type == rocsparse_hyb_partition_max) ? workspace : nullptr,
+                       ell_width_bound,
+                       ell_width);
+
+    // Compute the COO non-zero elements per row
+    hipLaunchKernelGGL((hyb_coo_nnz_bounded<CSR2ELL_DIM>),
+                       dim3((m - 1) / CSR2ELL_DIM + 1),
+                       dim3(CSR2ELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       ell_width,
+                       csr_row_ptr,
+                       workspace,
+                       descr->base);
+
+    // Inclusive sum on workspace
+    size_t temp_storage_bytes = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_bytes,
+                                                workspace,
+                                                workspace,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(ptr,
+                                                temp_storage_bytes,
+                                                workspace,
+                                                workspace,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    hipLaunchKernelGGL((hyb_coo_nnz_bounded_finalize),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       m,
+                       workspace,
+                       coo_nnz,
+                       descr->base);
+
+    hipLaunchKernelGGL((csr2hyb_bounded_kernel<CSR2ELL_DIM>),
+                       dim3((m - 1) / CSR2ELL_DIM + 1),
+                       dim3(CSR2ELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       ell_width,
+                       ell_col_ind,
+                       ell_val,
+                       coo_row_ind,
+                       coo_col_ind,
+                       coo_val,
+                       workspace,
+                       descr->base);
 #undef CSR2ELL_DIM
 
     return rocsparse_status_success;
@@ -454,3 +732,257 @@ extern "C" rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                h
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status
+    rocsparse_csr2hyb_bounded_buffer_size(rocsparse_handle        handle,
+                                          rocsparse_int           m,
+                                          rocsparse_int           n,
+                                          rocsparse_int           nnz,
+                                          rocsparse_int           user_ell_width,
+                                          rocsparse_hyb_partition partition_type,
+                                          rocsparse_int*          ell_width_bound,
+                                          rocsparse_int*          coo_nnz_bound,
+                                          size_t*                 buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2hyb_bounded_buffer_size",
+              m,
+              n,
+              nnz,
+              user_ell_width,
+              partition_type,
+              (const void*&)ell_width_bound,
+              (const void*&)coo_nnz_bound,
+              (const void*&)buffer_size);
+
+    // Check partition type
+    if(partition_type != rocsparse_hyb_partition_max
+       && partition_type != rocsparse_hyb_partition_user
+       && partition_type != rocsparse_hyb_partition_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(ell_width_bound == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_nnz_bound == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        *ell_width_bound = 0;
+        *coo_nnz_bound   = 0;
+
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_bounds(
+        m, nnz, user_ell_width, partition_type, ell_width_bound, coo_nnz_bound));
+
+    // Determine rocprim buffer size
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), handle->stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // COO row offsets, or partial maxima of the row lengths
+    *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2hyb_bounded(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             user_ell_width,
+                                                       rocsparse_hyb_partition   partition_type,
+                                                       rocsparse_int*            ell_width,
+                                                       float*                    ell_val,
+                                                       rocsparse_int*            ell_col_ind,
+                                                       rocsparse_int*            coo_nnz,
+                                                       float*                    coo_val,
+                                                       rocsparse_int*            coo_row_ind,
+                                                       rocsparse_int*            coo_col_ind,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csr2hyb_bounded_template(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              user_ell_width,
+                                              partition_type,
+                                              ell_width,
+                                              ell_val,
+                                              ell_col_ind,
+                                              coo_nnz,
+                                              coo_val,
+                                              coo_row_ind,
+                                              coo_col_ind,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2hyb_bounded(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             user_ell_width,
+                                                       rocsparse_hyb_partition   partition_type,
+                                                       rocsparse_int*            ell_width,
+                                                       double*                   ell_val,
+                                                       rocsparse_int*            ell_col_ind,
+                                                       rocsparse_int*            coo_nnz,
+                                                       double*                   coo_val,
+                                                       rocsparse_int*            coo_row_ind,
+                                                       rocsparse_int*            coo_col_ind,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csr2hyb_bounded_template(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              user_ell_width,
+                                              partition_type,
+                                              ell_width,
+                                              ell_val,
+                                              ell_col_ind,
+                                              coo_nnz,
+                                              coo_val,
+                                              coo_row_ind,
+                                              coo_col_ind,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsr2hyb_bounded(rocsparse_handle               handle,
+                               rocsparse_int                  m,
+                               rocsparse_int                  n,
+                               rocsparse_int                  nnz,
+                               const rocsparse_mat_descr      descr,
+                               const rocsparse_float_complex* csr_val,
+                               const rocsparse_int*           csr_row_ptr,
+                               const rocsparse_int*           csr_col_ind,
+                               rocsparse_int                  user_ell_width,
+                               rocsparse_hyb_partition        partition_type,
+                               rocsparse_int*                 ell_width,
+                               rocsparse_float_complex*       ell_val,
+                               rocsparse_int*                 ell_col_ind,
+                               rocsparse_int*                 coo_nnz,
+                               rocsparse_float_complex*       coo_val,
+                               rocsparse_int*                 coo_row_ind,
+                               rocsparse_int*                 coo_col_ind,
+                               void*                          temp_buffer)
+{
+    return rocsparse_csr2hyb_bounded_template(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              user_ell_width,
+                                              partition_type,
+                                              ell_width,
+                                              ell_val,
+                                              ell_col_ind,
+                                              coo_nnz,
+                                              coo_val,
+                                              coo_row_ind,
+                                              coo_col_ind,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsr2hyb_bounded(rocsparse_handle                handle,
+                               rocsparse_int                   m,
+                               rocsparse_int                   n,
+                               rocsparse_int                   nnz,
+                               const rocsparse_mat_descr       descr,
+                               const rocsparse_double_complex* csr_val,
+                               const rocsparse_int*            csr_row_ptr,
+                               const rocsparse_int*            csr_col_ind,
+                               rocsparse_int                   user_ell_width,
+                               rocsparse_hyb_partition         partition_type,
+                               rocsparse_int*                  ell_width,
+                               rocsparse_double_complex*       ell_val,
+                               rocsparse_int*                  ell_col_ind,
+                               rocsparse_int*                  coo_nnz,
+                               rocsparse_double_complex*       coo_val,
+                               rocsparse_int*                  coo_row_ind,
+                               rocsparse_int*                  coo_col_ind,
+                               void*                           temp_buffer)
+{
+    return rocsparse_csr2hyb_bounded_template(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              user_ell_width,
+                                              partition_type,
+                                              ell_width,
+                                              ell_val,
+                                              ell_col_ind,
+                                              coo_nnz,
+                                              coo_val,
+                                              coo_row_ind,
+                                              coo_col_ind,
+                                              temp_buffer);
+}
@@ -40,4 +40,24 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                                             rocsparse_int             user_ell_width,
                                             rocsparse_hyb_partition   partition_type);
 
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_bounded_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_int             user_ell_width,
+                                                    rocsparse_hyb_partition   partition_type,
+                                                    rocsparse_int*            ell_width,
+                                                    T*                        ell_val,
+                                                    rocsparse_int*            ell_col_ind,
+                                                    rocsparse_int*            coo_nnz,
+                                                    T*                        coo_val,
+                                                    rocsparse_int*            coo_row_ind,
+                                                    rocsparse_int*            coo_col_ind,
+                                                    void*                     temp_buffer);
+
 #endif // ROCSPARSE_CSR2HYB_HPP
@@ -0,0 +1,506 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csr2sell.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csr2sell_device.h"
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_csr2sell_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr csr_descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             const rocsparse_mat_descr sell_descr,
+                                             rocsparse_int             slice_size,
+                                             const rocsparse_int*      sell_slice_ptr,
+                                             const rocsparse_int*      sell_row_perm,
+                                             T*                        sell_val,
+                                             rocsparse_int*            sell_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sell"),
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)sell_descr,
+              slice_size,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_row_perm,
+              (const void*&)sell_val,
+              (const void*&)sell_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f csr2sell -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_row_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All other arrays might be empty, if the matrix has no non-zero entries
+    if(csr_val == nullptr && csr_col_ind != nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val != nullptr && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_val == nullptr && sell_col_ind != nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_val != nullptr && sell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(sell_val == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of slices
+    rocsparse_int nslices = (m - 1) / slice_size + 1;
+
+#define CSR2SELL_DIM 512
+    dim3 csr2sell_blocks((nslices * slice_size - 1) / CSR2SELL_DIM + 1);
+    dim3 csr2sell_threads(CSR2SELL_DIM);
+
+    hipLaunchKernelGGL((csr2sell_kernel<CSR2SELL_DIM>),
+                       csr2sell_blocks,
+                       csr2sell_threads,
+                       0,
+                       stream,
+                       m,
+                       nslices,
+                       slice_size,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       sell_slice_ptr,
+                       sell_row_perm,
+                       sell_col_ind,
+                       sell_val,
+                       sell_descr->base);
+#undef CSR2SELL_DIM
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2sell_nnz(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_mat_descr sell_descr,
+                                                   rocsparse_int             slice_size,
+                                                   rocsparse_int             sigma,
+                                                   rocsparse_int*            sell_slice_ptr,
+                                                   rocsparse_int*            sell_row_perm,
+                                                   rocsparse_int*            sell_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2sell_nnz",
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)sell_descr,
+              slice_size,
+              sigma,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_row_perm,
+              (const void*&)sell_nnz);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || slice_size <= 0 || sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sell_nnz pointer argument before setting
+    if(sell_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(sell_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *sell_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_row_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Number of slices
+    rocsparse_int nslices = (m - 1) / slice_size + 1;
+
+#define CSR2SELL_DIM 256
+    // Sort rows within their sigma window by their number of non-zero entries
+    if(sigma <= CSR2SELL_DIM)
+    {
+        hipLaunchKernelGGL((csr2sell_row_perm_kernel<CSR2SELL_DIM>),
+                           dim3((m - 1) / CSR2SELL_DIM + 1),
+                           dim3(CSR2SELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           sigma,
+                           csr_row_ptr,
+                           sell_row_perm,
+                           sell_descr->base);
+    }
+    else
+    {
+        // Long windows are sorted by a stable segmented radix sort, one segment per
+        // window
+        rocsparse_int nwindows = (m - 1) / sigma + 1;
+
+        rocsparse_int* row_nnz;
+        rocsparse_int* row_nnz_sorted;
+        rocsparse_int* rows;
+        rocsparse_int* window_ptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&row_nnz, sizeof(rocsparse_int) * m));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&row_nnz_sorted, sizeof(rocsparse_int) * m));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&rows, sizeof(rocsparse_int) * m));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->allocate(&window_ptr, sizeof(rocsparse_int) * (nwindows + 1)));
+
+        hipLaunchKernelGGL((csr2sell_row_nnz_kernel<CSR2SELL_DIM>),
+                           dim3((m - 1) / CSR2SELL_DIM + 1),
+                           dim3(CSR2SELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           row_nnz,
+                           rows,
+                           sell_descr->base);
+
+        hipLaunchKernelGGL((csr2sell_window_ptr_kernel<CSR2SELL_DIM>),
+                           dim3(nwindows / CSR2SELL_DIM + 1),
+                           dim3(CSR2SELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           nwindows,
+                           sigma,
+                           window_ptr);
+
+        size_t sort_storage_bytes = 0;
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(nullptr,
+                                                                     sort_storage_bytes,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     rows,
+                                                                     sell_row_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     window_ptr,
+                                                                     window_ptr + 1,
+                                                                     0,
+                                                                     32,
+                                                                     stream));
+
+        void* sort_storage;
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&sort_storage, sort_storage_bytes));
+
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(sort_storage,
+                                                                     sort_storage_bytes,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     rows,
+                                                                     sell_row_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     window_ptr,
+                                                                     window_ptr + 1,
+                                                                     0,
+                                                                     32,
+                                                                     stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(sort_storage));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(window_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(rows));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(row_nnz_sorted));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(row_nnz));
+    }
+
+    // Count stored entries per slice
+    hipLaunchKernelGGL((csr2sell_slice_nnz_kernel<CSR2SELL_DIM>),
+                       dim3(nslices / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       nslices,
+                       slice_size,
+                       csr_row_ptr,
+                       sell_row_perm,
+                       sell_slice_ptr,
+                       sell_descr->base);
+#undef CSR2SELL_DIM
+
+    // Inclusive sum to obtain sell_slice_ptr array and number of stored entries
+    size_t temp_storage_bytes = 0;
+
+    // Obtain rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_bytes,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Get rocprim buffer
+    bool  d_temp_alloc;
+    void* d_temp_storage;
+
+    // Device buffer should be sufficient for rocprim in most cases
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_temp_storage));
+        d_temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    // Perform actual inclusive sum
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(sell_nnz,
+                                           sell_slice_ptr + nslices,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz according to index base
+        if(sell_descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csr2sell_index_base<1>), dim3(1), dim3(1), 0, stream, sell_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(sell_nnz, sell_slice_ptr + nslices, sizeof(rocsparse_int)));
+
+        // Adjust nnz according to index base
+        *sell_nnz -= sell_descr->base;
+    }
+
+    // Free rocprim buffer, if allocated
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                     \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     const rocsparse_mat_descr csr_descr,      \
+                                     const TYPE*               csr_val,        \
+                                     const rocsparse_int*      csr_row_ptr,    \
+                                     const rocsparse_int*      csr_col_ind,    \
+                                     const rocsparse_mat_descr sell_descr,     \
+                                     rocsparse_int             slice_size,     \
+                                     const rocsparse_int*      sell_slice_ptr, \
+                                     const rocsparse_int*      sell_row_perm,  \
+                                     TYPE*                     sell_val,       \
+                                     rocsparse_int*            sell_col_ind)   \
+    {                                                                          \
+        return rocsparse_csr2sell_template(handle,                             \
+                                           m,                                  \
+                                           csr_descr,                          \
+                                           csr_val,                            \
+                                           csr_row_ptr,                        \
+                                           csr_col_ind,                        \
+                                           sell_descr,                         \
+                                           slice_size,                         \
+                                           sell_slice_ptr,                     \
+                                           sell_row_perm,                      \
+                                           sell_val,                           \
+                                           sell_col_ind);                      \
+    }
+
+C_IMPL(rocsparse_scsr2sell, float);
+C_IMPL(rocsparse_dcsr2sell, double);
+C_IMPL(rocsparse_ccsr2sell, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsr2sell, rocsparse_double_complex);
+#undef C_IMPL
@@ -42,6 +42,9 @@ extern "C" rocsparse_status rocsparse_csrsort_buffer_size(rocsparse_handle     h
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csrsort_buffer_size",
@@ -131,6 +134,9 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csrsort",
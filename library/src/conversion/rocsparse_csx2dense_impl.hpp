@@ -57,6 +57,9 @@ rocsparse_status rocsparse_csx2dense_impl(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Loggings
     //
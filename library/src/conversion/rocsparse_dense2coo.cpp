@@ -50,6 +50,9 @@ rocsparse_status rocsparse_dense2coo_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xdense2coo"),
@@ -92,21 +95,21 @@ rocsparse_status rocsparse_dense2coo_template(rocsparse_handle          handle,
     }
 
     I* row_ptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&row_ptr, (m + 1) * sizeof(I)));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&row_ptr, (m + 1) * sizeof(I)));
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dense2csx_impl<rocsparse_direction_row>(
         handle, order, m, n, descr, A, ld, nnz_per_rows, coo_val, row_ptr, coo_col_ind));
 
     I start;
     I end;
-    RETURN_IF_HIP_ERROR(hipMemcpy(&start, &row_ptr[0], sizeof(I), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(hipMemcpy(&end, &row_ptr[m], sizeof(I), hipMemcpyDeviceToHost));
+    RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&start, &row_ptr[0], sizeof(I)));
+    RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&end, &row_ptr[m], sizeof(I)));
 
     I nnz = end - start;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_csr2coo_template(handle, row_ptr, nnz, m, coo_row_ind, descr->base));
 
-    RETURN_IF_HIP_ERROR(hipFree(row_ptr));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(row_ptr));
 
     return rocsparse_status_success;
 }
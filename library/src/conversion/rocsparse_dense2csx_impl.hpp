@@ -58,6 +58,9 @@ rocsparse_status rocsparse_dense2csx_impl(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Loggings
     //
@@ -152,12 +155,12 @@ rocsparse_status rocsparse_dense2csx_impl(rocsparse_handle          handle,
         // Device buffer should be sufficient for rocprim in most cases
         if(handle->buffer_size >= temp_storage_bytes)
         {
-            d_temp_storage = handle->buffer;
-            d_temp_alloc   = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_temp_storage));
+            d_temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
             d_temp_alloc = true;
         }
 
@@ -172,7 +175,7 @@ rocsparse_status rocsparse_dense2csx_impl(rocsparse_handle          handle,
         // Free rocprim buffer, if allocated
         if(d_temp_alloc == true)
         {
-            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
         }
     }
 
@@ -219,6 +219,9 @@ extern "C" rocsparse_status rocsparse_dense_to_sparse(rocsparse_handle
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_dense_sparse",
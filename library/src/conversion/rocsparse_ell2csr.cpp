@@ -56,6 +56,9 @@ rocsparse_status rocsparse_ell2csr_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xell2csr"),
@@ -184,6 +187,9 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_ell2csr_nnz",
@@ -295,12 +301,12 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
     // Device buffer should be sufficient for rocprim in most cases
     if(handle->buffer_size >= temp_storage_bytes)
     {
-        d_temp_storage = handle->buffer;
-        d_temp_alloc   = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_temp_storage));
+        d_temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
         d_temp_alloc = true;
     }
 
@@ -326,8 +332,8 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
         }
         else
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int)));
 
             // Adjust nnz according to index base
             *csr_nnz -= csr_descr->base;
@@ -342,15 +348,15 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
         }
         else
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int)));
         }
     }
 
     // Free rocprim buffer, if allocated
     if(d_temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
     }
 
     return rocsparse_status_success;
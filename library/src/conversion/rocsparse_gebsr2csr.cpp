@@ -56,6 +56,9 @@ rocsparse_status rocsparse_gebsr2csr_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgebsr2csr"),
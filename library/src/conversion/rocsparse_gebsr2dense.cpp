@@ -0,0 +1,181 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "rocsparse_gebsr2dense.hpp"
+
+#include "gebsr2dense_device.h"
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_gebsr2dense_template(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                J                         mb,
+                                                J                         nb,
+                                                I                         nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  bsr_val,
+                                                const I*                  bsr_row_ptr,
+                                                const J*                  bsr_col_ind,
+                                                J                         row_block_dim,
+                                                J                         col_block_dim,
+                                                T*                        A,
+                                                I                         lda,
+                                                rocsparse_order           order)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgebsr2dense"),
+              dir,
+              mb,
+              nb,
+              nnzb,
+              descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              row_block_dim,
+              col_block_dim,
+              (const void*&)A,
+              lda);
+
+    // Check matrix descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || nnzb < 0 || row_block_dim <= 0 || col_block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    I m = static_cast<I>(mb) * row_block_dim;
+    I n = static_cast<I>(nb) * col_block_dim;
+
+    if(lda < (order == rocsparse_order_column ? m : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr || A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnzb > 0 && (bsr_val == nullptr || bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    I mn = order == rocsparse_order_column ? m : n;
+    I nm = order == rocsparse_order_column ? n : m;
+
+    // Set memory to zero.
+    RETURN_IF_HIP_ERROR(hipMemset2DAsync(A, lda * sizeof(T), 0, mn * sizeof(T), nm, stream));
+
+    if(nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+#define GEBSR2DENSE_DIM 256
+    hipLaunchKernelGGL((gebsr2dense_kernel<GEBSR2DENSE_DIM>),
+                       dim3(mb),
+                       dim3(GEBSR2DENSE_DIM),
+                       0,
+                       stream,
+                       dir,
+                       mb,
+                       row_block_dim,
+                       col_block_dim,
+                       lda,
+                       descr->base,
+                       bsr_val,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       A,
+                       order);
+#undef GEBSR2DENSE_DIM
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                           \
+    template rocsparse_status rocsparse_gebsr2dense_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                          \
+        rocsparse_direction       dir,                                             \
+        JTYPE                     mb,                                              \
+        JTYPE                     nb,                                              \
+        ITYPE                     nnzb,                                            \
+        const rocsparse_mat_descr descr,                                           \
+        const TTYPE*              bsr_val,                                         \
+        const ITYPE*              bsr_row_ptr,                                     \
+        const JTYPE*              bsr_col_ind,                                     \
+        JTYPE                     row_block_dim,                                   \
+        JTYPE                     col_block_dim,                                   \
+        TTYPE*                    A,                                               \
+        ITYPE                     lda,                                             \
+        rocsparse_order           order);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
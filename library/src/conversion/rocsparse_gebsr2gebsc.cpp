@@ -52,6 +52,9 @@ rocsparse_status rocsparse_gebsr2gebsc_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgebsr2gebsc"),
@@ -232,6 +235,9 @@ rocsparse_status rocsparse_gebsr2gebsc_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_gebsr2gebsc_buffer_size",
@@ -84,6 +84,9 @@ rocsparse_status rocsparse_gebsr2gebsr_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgebsr2csr_buffer_size"),
@@ -185,6 +188,9 @@ rocsparse_status rocsparse_gebsr2gebsr_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgebsr2gebsr"),
@@ -257,10 +263,10 @@ rocsparse_status rocsparse_gebsr2gebsr_template(rocsparse_handle          handle
 
     rocsparse_int hstart = 0;
     rocsparse_int hend   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hend, &bsr_row_ptr_C[mb_c], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hstart, &bsr_row_ptr_C[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->copy_to_host(&hend, &bsr_row_ptr_C[mb_c], sizeof(rocsparse_int)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->copy_to_host(&hstart, &bsr_row_ptr_C[0], sizeof(rocsparse_int)));
 
     hipMemset(bsr_val_C, 0, (hend - hstart) * row_block_dim_C * col_block_dim_C * sizeof(T));
 
@@ -630,6 +636,9 @@ extern "C" rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_gebsr2gebsr_nnz",
@@ -794,12 +803,12 @@ extern "C" rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
             temp_alloc = true;
         }
 
@@ -813,7 +822,7 @@ extern "C" rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
 
         // Compute nnz_total_dev_host_ptr
@@ -832,10 +841,10 @@ extern "C" rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle
         {
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                &hend, &bsr_row_ptr_C[mb_c], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                &hstart, &bsr_row_ptr_C[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hend, &bsr_row_ptr_C[mb_c], sizeof(rocsparse_int)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&hstart, &bsr_row_ptr_C[0], sizeof(rocsparse_int)));
             *nnz_total_dev_host_ptr = hend - hstart;
         }
     }
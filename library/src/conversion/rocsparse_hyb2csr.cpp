@@ -52,6 +52,9 @@ rocsparse_status rocsparse_hyb2csr_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xhyb2csr"),
@@ -217,6 +220,9 @@ extern "C" rocsparse_status rocsparse_hyb2csr_buffer_size(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_hyb2csr_buffer_size",
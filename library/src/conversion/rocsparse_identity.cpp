@@ -34,6 +34,9 @@ rocsparse_status rocsparse_create_identity_permutation_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_create_identity_permutation", n, (const void*&)p);
 
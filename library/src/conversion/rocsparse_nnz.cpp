@@ -139,6 +139,9 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Loggings
     //
@@ -256,13 +259,13 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         I* d_nnz;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
-            d_nnz            = (I*)handle->buffer;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_nnz));
             temp_storage_ptr = d_nnz + 1;
             temp_alloc       = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_nnz, temp_storage_size_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_nnz, temp_storage_size_bytes));
             temp_storage_ptr = d_nnz + 1;
             temp_alloc       = true;
         }
@@ -289,8 +292,8 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         }
         else
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(nnz_total_dev_host_ptr, d_nnz, sizeof(I), hipMemcpyDeviceToHost));
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(nnz_total_dev_host_ptr, d_nnz, sizeof(I)));
         }
 
         //
@@ -298,7 +301,7 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         //
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(d_nnz));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_nnz));
         }
     }
 
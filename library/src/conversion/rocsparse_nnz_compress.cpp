@@ -62,6 +62,9 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xnnz_compress"),
@@ -126,8 +129,8 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
 
     // Find number of non-zeros in input CSR matrix on host
     rocsparse_int nnz_A;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&nnz_A, &csr_row_ptr_A[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->copy_to_host(&nnz_A, &csr_row_ptr_A[m], sizeof(rocsparse_int)));
 
     // Mean number of elements per row in the input CSR matrix
     rocsparse_int mean_nnz_per_row = nnz_A / m;
@@ -336,7 +339,7 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     rocsparse_int* dnnz_C;
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&dnnz_C, sizeof(rocsparse_int)));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&dnnz_C, sizeof(rocsparse_int)));
     }
     else
     {
@@ -353,12 +356,12 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -367,13 +370,13 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
 
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_C, dnnz_C, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(hipFree(dnnz_C));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(nnz_C, dnnz_C, sizeof(rocsparse_int)));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(dnnz_C));
     }
 
     if(temp_alloc)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     return rocsparse_status_success;
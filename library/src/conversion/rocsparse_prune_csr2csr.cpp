@@ -212,6 +212,9 @@ rocsparse_status rocsparse_prune_csr2csr_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr_buffer_size"),
@@ -278,6 +281,9 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr_nnz"),
@@ -502,12 +508,12 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -533,17 +539,15 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_total_dev_host_ptr,
-                                      &csr_row_ptr_C[m],
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(nnz_total_dev_host_ptr, &csr_row_ptr_C[m], sizeof(rocsparse_int)));
 
         *nnz_total_dev_host_ptr -= csr_descr_C->base;
     }
 
     if(temp_alloc)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     return rocsparse_status_success;
@@ -571,6 +575,9 @@ rocsparse_status rocsparse_prune_csr2csr_template(rocsparse_handle          hand
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr"),
@@ -215,6 +215,9 @@ rocsparse_status rocsparse_prune_csr2csr_by_percentage_buffer_size_template(
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr_by_percentage_buffer_size"),
@@ -278,6 +281,9 @@ rocsparse_status
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr_nnz_by_percentage"),
@@ -398,12 +404,12 @@ rocsparse_status
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -420,8 +426,8 @@ rocsparse_status
     }
     else
     {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&h_threshold, &output[nnz_A + pos], sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&h_threshold, &output[nnz_A + pos], sizeof(T)));
 
         threshold = &h_threshold;
     }
@@ -575,7 +581,7 @@ rocsparse_status
     // Free rocprim buffer, if allocated
     if(temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     // compute nnz_total_dev_host_ptr
@@ -592,10 +598,8 @@ rocsparse_status
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_total_dev_host_ptr,
-                                      &csr_row_ptr_C[m],
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(nnz_total_dev_host_ptr, &csr_row_ptr_C[m], sizeof(rocsparse_int)));
 
         *nnz_total_dev_host_ptr -= csr_descr_C->base;
     }
@@ -627,6 +631,9 @@ rocsparse_status
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_csr2csr_by_percentage"),
@@ -686,10 +693,8 @@ rocsparse_status
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_threshold,
-                                      &(reinterpret_cast<T*>(temp_buffer))[0],
-                                      sizeof(T),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&h_threshold, &(reinterpret_cast<T*>(temp_buffer))[0], sizeof(T)));
 
         threshold = &h_threshold;
     }
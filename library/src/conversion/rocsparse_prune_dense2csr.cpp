@@ -79,6 +79,9 @@ rocsparse_status rocsparse_prune_dense2csr_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr_buffer_size"),
@@ -126,6 +129,9 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr_nnz"),
@@ -260,12 +266,12 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
     // Device buffer should be sufficient for rocprim in most cases
     if(handle->buffer_size >= temp_storage_bytes)
     {
-        d_temp_storage = handle->buffer;
-        d_temp_alloc   = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&d_temp_storage));
+        d_temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
         d_temp_alloc = true;
     }
 
@@ -280,7 +286,7 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
     // Free rocprim buffer, if allocated
     if(d_temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
     }
 
     // Extract nnz_total_dev_host_ptr
@@ -325,6 +331,9 @@ rocsparse_status rocsparse_prune_dense2csr_template(rocsparse_handle          ha
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr"),
@@ -81,6 +81,9 @@ rocsparse_status
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr_by_percentage_buffer_size"),
@@ -131,6 +134,9 @@ rocsparse_status
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr_nnz_by_percentage"),
@@ -247,12 +253,12 @@ rocsparse_status
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+        temp_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, temp_storage_size_bytes));
         temp_alloc = true;
     }
 
@@ -285,7 +291,7 @@ rocsparse_status
     else
     {
         T h_threshold = static_cast<T>(0);
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_threshold, d_threshold, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&h_threshold, d_threshold, sizeof(T)));
         hipLaunchKernelGGL((prune_dense2csr_nnz_kernel<NNZ_DIM_X, NNZ_DIM_Y>),
                            grid,
                            threads,
@@ -318,7 +324,7 @@ rocsparse_status
     // Free rocprim buffer, if allocated
     if(temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
     }
 
     // Extract nnz_total_dev_host_ptr
@@ -366,6 +372,9 @@ rocsparse_status rocsparse_prune_dense2csr_by_percentage_template(rocsparse_hand
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xprune_dense2csr_by_percentage"),
@@ -28,6 +28,7 @@
 
 #include "rocsparse_coo2dense.hpp"
 #include "rocsparse_csx2dense_impl.hpp"
+#include "rocsparse_gebsr2dense.hpp"
 
 #define RETURN_SPARSETODENSE(itype, jtype, ctype, ...)                                             \
     {                                                                                              \
@@ -143,6 +144,25 @@ rocsparse_status rocsparse_sparse_to_dense_template(rocsparse_handle
                                                                     mat_B->order);
     }
 
+    // BSR
+    if(mat_A->format == rocsparse_format_bsr)
+    {
+        return rocsparse_gebsr2dense_template(handle,
+                                              mat_A->block_dir,
+                                              (J)mat_A->rows,
+                                              (J)mat_A->cols,
+                                              (I)mat_A->nnz,
+                                              mat_A->descr,
+                                              (const T*)mat_A->val_data,
+                                              (const I*)mat_A->row_data,
+                                              (const J*)mat_A->col_data,
+                                              (J)mat_A->row_block_dim,
+                                              (J)mat_A->col_block_dim,
+                                              (T*)mat_B->values,
+                                              (I)mat_B->ld,
+                                              mat_B->order);
+    }
+
     return rocsparse_status_not_implemented;
 }
 
@@ -162,6 +182,9 @@ extern "C" rocsparse_status rocsparse_sparse_to_dense(rocsparse_handle
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_sparse_dense",
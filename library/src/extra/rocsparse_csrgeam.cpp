@@ -180,6 +180,9 @@ rocsparse_status rocsparse_csrgeam_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
@@ -350,6 +353,9 @@ extern "C" rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          hand
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csrgeam_nnz",
@@ -485,12 +491,12 @@ extern "C" rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          hand
 
     if(handle->buffer_size >= rocprim_size)
     {
-        rocprim_buffer = handle->buffer;
-        rocprim_alloc  = false;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&rocprim_buffer));
+        rocprim_alloc = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&rocprim_buffer, rocprim_size));
         rocprim_alloc = true;
     }
 
@@ -505,15 +511,15 @@ extern "C" rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          hand
 
     if(rocprim_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(rocprim_buffer));
     }
 
     // Extract the number of non-zero elements of C
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         // Blocking mode
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int)));
 
         // Adjust index base of nnz_C
         *nnz_C -= descr_C->base;
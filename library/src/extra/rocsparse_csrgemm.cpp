@@ -621,7 +621,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
@@ -705,7 +705,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                            stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         // Create identity permutation for group access
         RETURN_IF_ROCSPARSE_ERROR(
@@ -1040,7 +1040,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             if(info_C->csrgemm_info->mul == true)
             {
                 // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
+                RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&workspace_B, sizeof(I) * nnz_A));
             }
 
             hipLaunchKernelGGL(
@@ -1078,7 +1078,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
             if(info_C->csrgemm_info->mul == true)
             {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
+                RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(workspace_B));
             }
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
@@ -1386,7 +1386,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             if(info_C->csrgemm_info->mul == true)
             {
                 // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
+                RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&workspace_B, sizeof(I) * nnz_A));
             }
 
             hipLaunchKernelGGL(
@@ -1424,7 +1424,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
             if(info_C->csrgemm_info->mul == true)
             {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
+                RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(workspace_B));
             }
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
@@ -1893,6 +1893,9 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrgemm"),
@@ -393,6 +393,9 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrgemm_buffer_size"),
@@ -684,7 +687,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
         hipMemcpyAsync(&int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
@@ -753,7 +756,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                            stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         // Permutation temporary arrays
         J* tmp_vals = reinterpret_cast<J*>(buffer);
@@ -1033,7 +1036,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
         if(info_C->csrgemm_info->mul == true)
         {
             // Allocate additional buffer for C = alpha * A * B
-            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&workspace_B, sizeof(I) * nnz_A));
         }
 
         hipLaunchKernelGGL(
@@ -1061,7 +1064,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 
         if(info_C->csrgemm_info->mul == true)
         {
-            RETURN_IF_HIP_ERROR(hipFree(workspace_B));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(workspace_B));
         }
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
@@ -1101,7 +1104,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(nnz_C, csr_row_ptr_C + m, sizeof(I)));
 
         // Adjust nnz by index base
         *nnz_C -= descr_C->base;
@@ -1425,6 +1428,9 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csrgemm_nnz",
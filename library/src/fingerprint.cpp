@@ -0,0 +1,208 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "fingerprint.h"
+#include "common.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#define FINGERPRINT_DIM 256
+
+// Seeds that separate the positions of row pointers and column indices
+#define FINGERPRINT_SEED_PTR 0x243f6a8885a308d3ULL
+#define FINGERPRINT_SEED_IND 0x13198a2e03707344ULL
+
+// Seeds of the independent check hash
+#define FINGERPRINT_CHECK_SEED_PTR 0xa4093822299f31d0ULL
+#define FINGERPRINT_CHECK_SEED_IND 0x082efa98ec4e6c89ULL
+
+// splitmix64 finalizer
+__host__ __device__ __forceinline__ uint64_t rocsparse_fingerprint_mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+// murmur3 finalizer, mixing of the check hash
+__host__ __device__ __forceinline__ uint64_t rocsparse_fingerprint_check_mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+
+    return x;
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr_fingerprint_kernel(int64_t size,
+                                const T* __restrict__ data,
+                                uint64_t seed,
+                                uint64_t check_seed,
+                                unsigned long long* __restrict__ hash)
+{
+    int     tid = hipThreadIdx_x;
+    int64_t gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + tid;
+    int64_t inc = static_cast<int64_t>(hipGridDim_x) * BLOCKSIZE;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+    __shared__ unsigned long long scheck[BLOCKSIZE];
+
+    // Sum of the mixed position and value of each entry, the check hash uses
+    // different seeds and a different mixing
+    unsigned long long sum   = 0;
+    unsigned long long check = 0;
+    for(int64_t i = gid; i < size; i += inc)
+    {
+        uint64_t value = static_cast<uint64_t>(data[i]);
+
+        sum += rocsparse_fingerprint_mix(rocsparse_fingerprint_mix(seed + i) + value);
+        check += rocsparse_fingerprint_check_mix(rocsparse_fingerprint_check_mix(check_seed + i)
+                                                 ^ value);
+    }
+
+    sdata[tid]  = sum;
+    scheck[tid] = check;
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, scheck);
+
+    if(tid == 0)
+    {
+        atomicAdd(&hash[0], sdata[0]);
+        atomicAdd(&hash[1], scheck[0]);
+    }
+}
+
+template <typename T>
+static rocsparse_status csr_fingerprint_launch(rocsparse_handle    handle,
+                                               int64_t             size,
+                                               const T*            data,
+                                               uint64_t            seed,
+                                               uint64_t            check_seed,
+                                               unsigned long long* hash)
+{
+    if(size == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Enough blocks to fill the device, each thread accumulates multiple entries
+    int64_t max_blocks = handle->properties.multiProcessorCount * 8;
+    int64_t nblocks    = std::min((size - 1) / FINGERPRINT_DIM + 1, max_blocks);
+
+    hipLaunchKernelGGL((csr_fingerprint_kernel<FINGERPRINT_DIM>),
+                       dim3(nblocks),
+                       dim3(FINGERPRINT_DIM),
+                       0,
+                       handle->stream,
+                       size,
+                       data,
+                       seed,
+                       check_seed,
+                       hash);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csr_fingerprint(rocsparse_handle     handle,
+                                           J                    m,
+                                           J                    n,
+                                           I                    nnz,
+                                           rocsparse_index_base base,
+                                           const I*             csr_row_ptr,
+                                           const J*             csr_col_ind,
+                                           uint64_t*            fingerprint,
+                                           uint64_t*            check)
+{
+    hipStream_t stream = handle->stream;
+
+    // Accumulate both hashes into the device buffer of the handle
+    unsigned long long* dhash;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&dhash));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(dhash, 0, sizeof(unsigned long long) * 2, stream));
+
+    // Arrays of empty matrices might be nullptr
+    if(m > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csr_fingerprint_launch(
+            handle, m + 1, csr_row_ptr, FINGERPRINT_SEED_PTR, FINGERPRINT_CHECK_SEED_PTR, dhash));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(csr_fingerprint_launch(
+        handle, nnz, csr_col_ind, FINGERPRINT_SEED_IND, FINGERPRINT_CHECK_SEED_IND, dhash));
+
+    unsigned long long hash[2];
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hash, dhash, sizeof(hash), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+
+    // Dimensions and index base are hashed on the host
+    int64_t  header[4]   = {m, n, nnz, base};
+    uint64_t header_hash = rocsparse_hash_fnv1a(rocsparse_hash_fnv1a_init, header, sizeof(header));
+
+    *fingerprint = rocsparse_fingerprint_mix(hash[0] + header_hash);
+
+    if(check != nullptr)
+    {
+        *check = rocsparse_fingerprint_check_mix(hash[1] ^ header_hash);
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                      \
+    template rocsparse_status rocsparse_csr_fingerprint<ITYPE, JTYPE>( \
+        rocsparse_handle     handle,                                   \
+        JTYPE                m,                                        \
+        JTYPE                n,                                        \
+        ITYPE                nnz,                                      \
+        rocsparse_index_base base,                                     \
+        const ITYPE*         csr_row_ptr,                              \
+        const JTYPE*         csr_col_ind,                              \
+        uint64_t*            fingerprint,                              \
+        uint64_t*            check);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
+
+#undef FINGERPRINT_CHECK_SEED_IND
+#undef FINGERPRINT_CHECK_SEED_PTR
+#undef FINGERPRINT_SEED_IND
+#undef FINGERPRINT_SEED_PTR
+#undef FINGERPRINT_DIM
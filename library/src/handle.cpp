@@ -22,21 +22,84 @@
  * ************************************************************************ */
 
 #include "handle.h"
+#include "analysis_cache.h"
 #include "definitions.h"
+#include "log_queue.h"
 #include "logging.h"
+#include "capture.h"
+#include "profile.h"
 
+#include <cstring>
 #include <hip/hip_runtime.h>
+#include <map>
+#include <mutex>
 
 __global__ void init_kernel(){};
 
+/*******************************************************************************
+ * Device properties are queried once per device and process
+ ******************************************************************************/
+static hipError_t get_device_properties(hipDeviceProp_t* properties, int device)
+{
+    static std::mutex                     mutex;
+    static std::map<int, hipDeviceProp_t> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = cache.find(device);
+    if(it == cache.end())
+    {
+        hipDeviceProp_t prop;
+        hipError_t      status = hipGetDeviceProperties(&prop, device);
+        if(status != hipSuccess)
+        {
+            return status;
+        }
+
+        it = cache.emplace(device, prop).first;
+    }
+
+    *properties = it->second;
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * HIP runtime of the handle resources
+ ******************************************************************************/
+rocsparse_status rocsparse_hip_runtime::malloc(void** ptr, size_t size)
+{
+    RETURN_IF_HIP_ERROR(hipMalloc(ptr, size));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_hip_runtime::free(void* ptr)
+{
+    RETURN_IF_HIP_ERROR(hipFree(ptr));
+    return rocsparse_status_success;
+}
+
+rocsparse_status
+    rocsparse_hip_runtime::upload(void* dst, const void* src, size_t size, hipStream_t stream)
+{
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst, src, size, hipMemcpyHostToDevice, stream));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_hip_runtime::synchronize(hipStream_t stream)
+{
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    return rocsparse_status_success;
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
-_rocsparse_handle::_rocsparse_handle()
+_rocsparse_handle::_rocsparse_handle(unsigned int flags)
+    : flags(flags)
 {
     // Default device is active device
     THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
+    THROW_IF_HIP_ERROR(get_device_properties(&properties, device));
 
     // Device wavefront size
     wavefront_size = properties.warpSize;
@@ -67,40 +130,18 @@ _rocsparse_handle::_rocsparse_handle()
 
     size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
 
-    // Allocate device buffer
+    // Device buffer size, the buffer itself is allocated on first use for lazy handles
     buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
-    THROW_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
-
-    // Device one
-    THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
-    THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
-    THROW_IF_HIP_ERROR(hipMalloc(&cone, sizeof(rocsparse_float_complex)));
-    THROW_IF_HIP_ERROR(hipMalloc(&zone, sizeof(rocsparse_double_complex)));
+    resources.set_buffer_size(buffer_size);
 
-    // Execute empty kernel for initialization
-    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
-
-    // Execute memset for initialization
-    THROW_IF_HIP_ERROR(hipMemsetAsync(sone, 0, sizeof(float), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(double), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(cone, 0, sizeof(rocsparse_float_complex), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(zone, 0, sizeof(rocsparse_double_complex), stream));
-
-    float  hsone = 1.0f;
-    double hdone = 1.0;
-
-    rocsparse_float_complex  hcone = rocsparse_float_complex(1.0f, 0.0f);
-    rocsparse_double_complex hzone = rocsparse_double_complex(1.0, 0.0);
-
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(sone, &hsone, sizeof(float), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(done, &hdone, sizeof(double), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice, stream));
+    if(!(flags & rocsparse_handle_flags_lazy))
+    {
+        // Execute empty kernel for initialization
+        hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
 
-    // Wait for device transfer to finish
-    THROW_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        // Allocate device buffer and device constants
+        THROW_IF_ROCSPARSE_ERROR(resources.initialize(stream));
+    }
 
     // Open log file
     if(layer_mode & rocsparse_layer_mode_log_trace)
@@ -113,6 +154,50 @@ _rocsparse_handle::_rocsparse_handle()
     {
         open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
     }
+
+    // Logging is asynchronous, unless ROCSPARSE_LOG_ASYNC is set to 0
+    if(layer_mode & (rocsparse_layer_mode_log_trace | rocsparse_layer_mode_log_bench))
+    {
+        char* str_log_async = getenv("ROCSPARSE_LOG_ASYNC");
+        if(str_log_async == NULL || atoi(str_log_async) != 0)
+        {
+            // Number of records the ring buffer can hold
+            char*  str_log_capacity = getenv("ROCSPARSE_LOG_ASYNC_CAPACITY");
+            size_t log_capacity     = 1024;
+            if(str_log_capacity != NULL && atoi(str_log_capacity) > 0)
+            {
+                log_capacity = atoi(str_log_capacity);
+            }
+
+            log_queue = new rocsparse_log_queue(log_capacity);
+        }
+    }
+
+    // Profile
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        profile = new rocsparse_profile();
+    }
+
+    // Capture
+    if(layer_mode & rocsparse_layer_mode_log_capture)
+    {
+        capture = new rocsparse_capture();
+    }
+
+    // Analysis cache, disabled unless ROCSPARSE_ANALYSIS_CACHE_SIZE is set
+    char* str_analysis_cache_size = getenv("ROCSPARSE_ANALYSIS_CACHE_SIZE");
+    if(str_analysis_cache_size != NULL && atoll(str_analysis_cache_size) > 0)
+    {
+        analysis_cache = new rocsparse_analysis_cache(atoll(str_analysis_cache_size));
+    }
+
+    // Memory pool, disabled unless ROCSPARSE_MEMORY_POOL_SIZE is set
+    char* str_memory_pool_size = getenv("ROCSPARSE_MEMORY_POOL_SIZE");
+    if(str_memory_pool_size != NULL && atoll(str_memory_pool_size) > 0)
+    {
+        memory_pool = new rocsparse_memory_pool(allocator, atoll(str_memory_pool_size));
+    }
 }
 
 /*******************************************************************************
@@ -120,11 +205,26 @@ _rocsparse_handle::_rocsparse_handle()
  ******************************************************************************/
 _rocsparse_handle::~_rocsparse_handle()
 {
-    PRINT_IF_HIP_ERROR(hipFree(buffer));
-    PRINT_IF_HIP_ERROR(hipFree(sone));
-    PRINT_IF_HIP_ERROR(hipFree(done));
-    PRINT_IF_HIP_ERROR(hipFree(cone));
-    PRINT_IF_HIP_ERROR(hipFree(zone));
+    PRINT_IF_ROCSPARSE_ERROR(resources.release());
+
+    if(host_buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipHostFree(host_buffer));
+    }
+
+    // Write remaining log records
+    delete log_queue;
+
+    // Write profile summary
+    delete profile;
+
+    delete capture;
+
+    // Release cached analysis meta data
+    delete analysis_cache;
+
+    // Release cached temporary storage
+    delete memory_pool;
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -162,6 +262,108 @@ rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
     return rocsparse_status_success;
 }
 
+/*******************************************************************************
+ * reset, before the handle is handed out again by the handle pool
+ ******************************************************************************/
+void _rocsparse_handle::reset()
+{
+    stream       = 0;
+    pointer_mode = rocsparse_pointer_mode_host;
+    sync_count   = 0;
+
+    // The user allocator might not outlive the handle
+    if(allocator.alloc != nullptr)
+    {
+        PRINT_IF_ROCSPARSE_ERROR(set_allocator(rocsparse_device_allocator()));
+    }
+}
+
+/*******************************************************************************
+ * allocate temporary device memory
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::allocate(void** ptr, size_t size)
+{
+    if(memory_pool != nullptr)
+    {
+        return memory_pool->allocate(ptr, size, stream);
+    }
+
+    return allocator.allocate(ptr, size, stream);
+}
+
+/*******************************************************************************
+ * deallocate temporary device memory
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::deallocate(void* ptr)
+{
+    if(memory_pool != nullptr)
+    {
+        return memory_pool->deallocate(ptr, stream);
+    }
+
+    return allocator.deallocate(ptr, stream);
+}
+
+/*******************************************************************************
+ * set device memory allocator
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::set_allocator(const rocsparse_device_allocator& alloc)
+{
+    // Cached blocks are returned to the allocator they came from
+    if(memory_pool != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(memory_pool->set_allocator(alloc));
+    }
+
+    allocator = alloc;
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * reserve host buffer
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::reserve_host_buffer(size_t size)
+{
+    if(size <= host_buffer_size)
+    {
+        return rocsparse_status_success;
+    }
+
+    void* new_buffer;
+    RETURN_IF_HIP_ERROR(hipHostMalloc(&new_buffer, size));
+
+    if(host_buffer != nullptr)
+    {
+        memcpy(new_buffer, host_buffer, host_buffer_size);
+        RETURN_IF_HIP_ERROR(hipHostFree(host_buffer));
+    }
+
+    host_buffer      = new_buffer;
+    host_buffer_size = size;
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * synchronize with the handle stream
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::synchronize()
+{
+    ++sync_count;
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * copy device memory to host memory
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::copy_to_host(void* dst, const void* src, size_t size)
+{
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst, src, size, hipMemcpyDeviceToHost, stream));
+    return synchronize();
+}
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -202,9 +404,25 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     // Clean up row blocks
     if(info->size > 0)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
-        RETURN_IF_HIP_ERROR(hipFree(info->wg_flags));
-        RETURN_IF_HIP_ERROR(hipFree(info->wg_ids));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->row_blocks, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->wg_flags, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->wg_ids, 0));
+    }
+
+    // Clean up CSC arrays of transposed operations
+    if(info->csc_col_ptr != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->csc_col_ptr, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->csc_row_ind, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->csc_perm, 0));
+    }
+
+    // Clean up merge path tiles
+    if(info->ntiles > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->tile_row, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->tile_nnz, 0));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->tile_carry, 0));
     }
 
     // Destruct
@@ -260,32 +478,32 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
     // Clean up
     if(info->row_map != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_map));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->row_map, 0));
         info->row_map = nullptr;
     }
 
     if(info->trm_diag_ind != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->trm_diag_ind));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->trm_diag_ind, 0));
         info->trm_diag_ind = nullptr;
     }
 
     // Clear trmt arrays
     if(info->trmt_perm != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->trmt_perm));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->trmt_perm, 0));
         info->trmt_perm = nullptr;
     }
 
     if(info->trmt_row_ptr != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->trmt_row_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->trmt_row_ptr, 0));
         info->trmt_row_ptr = nullptr;
     }
 
     if(info->trmt_col_ind != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->trmt_col_ind));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->trmt_col_ind, 0));
         info->trmt_col_ind = nullptr;
     }
 
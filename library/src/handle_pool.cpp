@@ -0,0 +1,85 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle_pool.h"
+
+#include <cstdlib>
+#include <iterator>
+
+rocsparse_handle_pool::rocsparse_handle_pool(size_t capacity)
+    : capacity_(capacity)
+{
+    handles_.reserve(capacity);
+}
+
+rocsparse_handle_pool& rocsparse_handle_pool::instance()
+{
+    // The pool is never destroyed, pooled handles are released by process
+    // termination. Freeing them from a static destructor might happen after the
+    // HIP runtime has been torn down.
+    static rocsparse_handle_pool* pool = []() {
+        // Maximum number of pooled handles
+        char*  str_pool_size = getenv("ROCSPARSE_HANDLE_POOL_SIZE");
+        size_t pool_size     = 16;
+        if(str_pool_size != NULL && atoi(str_pool_size) >= 0)
+        {
+            pool_size = atoi(str_pool_size);
+        }
+
+        return new rocsparse_handle_pool(pool_size);
+    }();
+
+    return *pool;
+}
+
+rocsparse_handle rocsparse_handle_pool::acquire(int device)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Most recently released handles first
+    for(auto it = handles_.rbegin(); it != handles_.rend(); ++it)
+    {
+        if((*it)->device == device)
+        {
+            rocsparse_handle handle = *it;
+            handles_.erase(std::next(it).base());
+            return handle;
+        }
+    }
+
+    return nullptr;
+}
+
+bool rocsparse_handle_pool::release(rocsparse_handle handle)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if(handles_.size() >= capacity_)
+    {
+        return false;
+    }
+
+    handles_.push_back(handle);
+    return true;
+}
@@ -0,0 +1,236 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ANALYSIS_CACHE_H
+#define ANALYSIS_CACHE_H
+
+#include "fingerprint.h"
+#include "handle.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+/*! \brief Kind of the analysis meta data held by a cache entry. */
+enum class rocsparse_analysis_kind : int
+{
+    csrmv,
+    trm
+};
+
+/********************************************************************************
+ * \brief rocsparse_analysis_key identifies the analysis of a sparsity pattern.
+ * Analysis meta data only depends on the sparsity pattern and the matrix
+ * descriptor, never on the matrix values.
+ *******************************************************************************/
+struct rocsparse_analysis_key
+{
+    rocsparse_analysis_kind kind;
+    rocsparse_operation     trans;
+
+    // index type sizes
+    int index_size;
+    int offset_size;
+
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+
+    // descriptor fields
+    rocsparse_matrix_type type;
+    rocsparse_fill_mode   fill_mode;
+    rocsparse_diag_type   diag_type;
+    rocsparse_index_base  base;
+
+    // hash of row pointers and column indices
+    uint64_t fingerprint;
+    // independent second hash of the pattern, such that a collision of the
+    // fingerprint alone does not restore the meta data of a different matrix
+    uint64_t check;
+
+    bool operator==(const rocsparse_analysis_key& x) const
+    {
+        return kind == x.kind && trans == x.trans && index_size == x.index_size
+               && offset_size == x.offset_size && m == x.m && n == x.n && nnz == x.nnz
+               && type == x.type && fill_mode == x.fill_mode && diag_type == x.diag_type
+               && base == x.base && fingerprint == x.fingerprint && check == x.check;
+    }
+};
+
+struct rocsparse_analysis_key_hash
+{
+    size_t operator()(const rocsparse_analysis_key& x) const
+    {
+        return static_cast<size_t>(x.fingerprint ^ (static_cast<uint64_t>(x.kind) << 1)
+                                   ^ (static_cast<uint64_t>(x.trans) << 3));
+    }
+};
+
+/*! \brief Device array that is stored in, or restored from, a cache entry. */
+struct rocsparse_analysis_array
+{
+    const void* data;
+    size_t      bytes;
+};
+
+/**
+ * @brief Handle-level cache of analysis meta data.
+ *
+ * @details
+ * rocsparse_analysis_cache keeps device copies of the meta data gathered by the
+ * analysis routines, keyed by rocsparse_analysis_key. An analysis of a new
+ * rocsparse_mat_info with an identical sparsity pattern then copies the cached
+ * meta data instead of recomputing it. The cache owns its device memory, which
+ * each entry allocates and releases with the device allocator of the handle at
+ * the time of its insertion; the least recently used entries are released once
+ * the total size exceeds the capacity.
+ */
+class rocsparse_analysis_cache
+{
+public:
+    explicit rocsparse_analysis_cache(size_t capacity);
+    ~rocsparse_analysis_cache();
+
+    rocsparse_analysis_cache(const rocsparse_analysis_cache&) = delete;
+    rocsparse_analysis_cache& operator=(const rocsparse_analysis_cache&) = delete;
+
+    /// Look up key. On a hit, found is set, scalar is restored and each array is
+    /// allocated with allocator and copied into the corresponding pointer (nullptr
+    /// for empty arrays).
+    rocsparse_status fetch(const rocsparse_analysis_key&     key,
+                           int64_t*                          scalar,
+                           std::initializer_list<void**>     arrays,
+                           const rocsparse_device_allocator& allocator,
+                           hipStream_t                       stream,
+                           bool*                             found);
+
+    /// Store a copy of scalar and the device arrays under key, allocated with
+    /// allocator.
+    rocsparse_status insert(const rocsparse_analysis_key&                   key,
+                            int64_t                                         scalar,
+                            std::initializer_list<rocsparse_analysis_array> arrays,
+                            const rocsparse_device_allocator&               allocator,
+                            hipStream_t                                     stream);
+
+    /// Change the capacity, evicting entries if required.
+    rocsparse_status resize(size_t capacity, hipStream_t stream);
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    int64_t hits() const
+    {
+        return hits_;
+    }
+
+    int64_t misses() const
+    {
+        return misses_;
+    }
+
+private:
+    struct entry
+    {
+        rocsparse_analysis_key     key;
+        int64_t                    scalar;
+        std::vector<void*>         data;
+        std::vector<size_t>        bytes;
+        size_t                     size;
+        rocsparse_device_allocator allocator;
+    };
+
+    // Release the least recently used entries until size_ + required fits
+    rocsparse_status evict(size_t required, hipStream_t stream);
+    // Release the device memory of an entry
+    static rocsparse_status release(entry& e, hipStream_t stream);
+
+    size_t  capacity_;
+    size_t  size_   = 0;
+    int64_t hits_   = 0;
+    int64_t misses_ = 0;
+
+    // Most recently used entries first
+    std::list<entry> entries_;
+    std::unordered_map<rocsparse_analysis_key,
+                       std::list<entry>::iterator,
+                       rocsparse_analysis_key_hash>
+        index_;
+};
+
+/********************************************************************************
+ * \brief rocsparse_analysis_cache_key fills the key of a pattern, including its
+ * fingerprint. Returns success without touching the device if caching is
+ * disabled.
+ *******************************************************************************/
+template <typename I, typename J>
+rocsparse_status rocsparse_analysis_cache_key(rocsparse_handle          handle,
+                                              rocsparse_analysis_kind   kind,
+                                              rocsparse_operation       trans,
+                                              J                         m,
+                                              J                         n,
+                                              I                         nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              rocsparse_analysis_key*   key)
+{
+    if(handle->analysis_cache == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    key->kind        = kind;
+    key->trans       = trans;
+    key->index_size  = sizeof(J);
+    key->offset_size = sizeof(I);
+    key->m           = m;
+    key->n           = n;
+    key->nnz         = nnz;
+    key->type        = descr->type;
+    key->fill_mode   = descr->fill_mode;
+    key->diag_type   = descr->diag_type;
+    key->base        = descr->base;
+
+    return rocsparse_csr_fingerprint(handle,
+                                     m,
+                                     n,
+                                     nnz,
+                                     descr->base,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     &key->fingerprint,
+                                     &key->check);
+}
+
+#endif // ANALYSIS_CACHE_H
@@ -0,0 +1,218 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "fingerprint.h"
+#include "handle.h"
+
+#include <complex>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Capture of sparse operands for offline replay.
+ *
+ * @details
+ * rocsparse_capture writes one line per captured call to capture.log in the
+ * directory given by ROCSPARSE_LOG_CAPTURE_PATH (or the working directory). Each
+ * distinct sparse operand is stored once, in a binary file that is named by the
+ * hash of its sparsity pattern and the hash of its values. The capture can be
+ * replayed with rocsparse-replay.
+ *
+ * A CSR operand file consists of the int64_t header m, n, nnz, index base and
+ * precision character, followed by m + 1 int64_t row pointers, nnz int64_t column
+ * indices and nnz values.
+ */
+class rocsparse_capture
+{
+public:
+    rocsparse_capture();
+
+    rocsparse_capture(const rocsparse_capture&) = delete;
+    rocsparse_capture& operator=(const rocsparse_capture&) = delete;
+
+    /// Store a CSR operand unless it has been stored before, returns the file name.
+    /// The file is named by the fingerprint of the sparsity pattern and a hash of
+    /// the values.
+    std::string store_csr(int64_t              m,
+                          int64_t              n,
+                          int64_t              nnz,
+                          rocsparse_index_base base,
+                          char                 precision,
+                          uint64_t             pattern,
+                          const int64_t*       csr_row_ptr,
+                          const int64_t*       csr_col_ind,
+                          const void*          csr_val,
+                          size_t               val_size);
+
+    /// Append a line to the capture log.
+    void record(const std::string& line);
+
+private:
+    std::string path;
+
+    // Operands that have already been stored
+    std::set<std::string> stored;
+    std::mutex            mutex;
+};
+
+/// Precision character of the capture, matching rocsparse-bench.
+inline char rocsparse_capture_precision(const float*)
+{
+    return 's';
+}
+
+inline char rocsparse_capture_precision(const double*)
+{
+    return 'd';
+}
+
+inline char rocsparse_capture_precision(const rocsparse_float_complex*)
+{
+    return 'c';
+}
+
+inline char rocsparse_capture_precision(const rocsparse_double_complex*)
+{
+    return 'z';
+}
+
+/**
+ * @brief Capture a csrmv call.
+ *
+ * @details
+ * Copies the CSR operand to the host and records the call together with its
+ * scalars. The dense vectors are not captured, they are initialized on replay.
+ */
+template <typename I, typename J, typename T>
+void rocsparse_capture_csrmv(rocsparse_handle          handle,
+                             rocsparse_operation       trans,
+                             J                         m,
+                             J                         n,
+                             I                         nnz,
+                             const T*                  alpha_device_host,
+                             const rocsparse_mat_descr descr,
+                             const T*                  csr_val,
+                             const I*                  csr_row_ptr,
+                             const J*                  csr_col_ind,
+                             const T*                  beta_device_host,
+                             bool                      adaptive)
+{
+    T alpha;
+    T beta;
+
+    std::vector<I> hptr(m + 1);
+    std::vector<J> hind(nnz);
+    std::vector<T> hval(nnz);
+
+    hipStream_t stream = handle->stream;
+
+    // Fingerprint of the sparsity pattern, as used by the analysis cache and the
+    // serialization of the meta data
+    uint64_t pattern;
+    if(rocsparse_csr_fingerprint(
+           handle, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, &pattern)
+       != rocsparse_status_success)
+    {
+        return;
+    }
+
+    // Operands might still be written by previous work on the stream. No further copies
+    // are enqueued after a failed one, the capture is aborted.
+    hipError_t status = hipMemcpyAsync(
+        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream);
+
+    if(status == hipSuccess)
+    {
+        status = hipMemcpyAsync(
+            hind.data(), csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToHost, stream);
+    }
+
+    if(status == hipSuccess)
+    {
+        status
+            = hipMemcpyAsync(hval.data(), csr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost, stream);
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(status == hipSuccess)
+        {
+            status = hipMemcpyAsync(
+                &alpha, alpha_device_host, sizeof(T), hipMemcpyDeviceToHost, stream);
+        }
+
+        if(status == hipSuccess)
+        {
+            status
+                = hipMemcpyAsync(&beta, beta_device_host, sizeof(T), hipMemcpyDeviceToHost, stream);
+        }
+    }
+    else
+    {
+        alpha = *alpha_device_host;
+        beta  = *beta_device_host;
+    }
+
+    // Copies that have been enqueued write into the host buffers and are always waited for
+    if(hipStreamSynchronize(stream) != hipSuccess || status != hipSuccess)
+    {
+        return;
+    }
+
+    std::vector<int64_t> row_ptr(hptr.begin(), hptr.end());
+    std::vector<int64_t> col_ind(hind.begin(), hind.end());
+
+    char precision = rocsparse_capture_precision(csr_val);
+
+    std::string file = handle->capture->store_csr(m,
+                                                  n,
+                                                  nnz,
+                                                  descr->base,
+                                                  precision,
+                                                  pattern,
+                                                  row_ptr.data(),
+                                                  col_ind.data(),
+                                                  hval.data(),
+                                                  sizeof(T) * nnz);
+
+    std::ostringstream line;
+    line.precision(17);
+    line << "csrmv " << precision << " " << trans << " " << descr->type << " " << descr->fill_mode
+         << " " << m << " " << n << " " << nnz << " " << std::real(alpha) << " "
+         << std::imag(alpha) << " " << std::real(beta) << " " << std::imag(beta) << " "
+         << (adaptive ? "adaptive" : "stream") << " " << file;
+
+    handle->capture->record(line.str());
+}
+
+#endif // CAPTURE_H
@@ -82,10 +82,17 @@ __device__ __forceinline__ double rocsparse_real(const double& x) { return x; }
 __device__ __forceinline__ float rocsparse_real(const rocsparse_float_complex& x) { return std::real(x); }
 __device__ __forceinline__ double rocsparse_real(const rocsparse_double_complex& x) { return std::real(x); }
 
+// Convert stored values into the compute precision, complex values convert componentwise
+template <typename T> __device__ __forceinline__ T rocsparse_convert(float x) { return static_cast<T>(x); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(double x) { return static_cast<T>(x); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(const rocsparse_float_complex& x) { return T(std::real(x), std::imag(x)); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(const rocsparse_double_complex& x) { return T(std::real(x), std::imag(x)); }
+
 __device__ __forceinline__ float rocsparse_nontemporal_load(const float* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ double rocsparse_nontemporal_load(const double* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_nontemporal_load(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__builtin_nontemporal_load((const float*)ptr), __builtin_nontemporal_load((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_nontemporal_load(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__builtin_nontemporal_load((const double*)ptr), __builtin_nontemporal_load((const double*)ptr + 1)); }
+__device__ __forceinline__ uint16_t rocsparse_nontemporal_load(const uint16_t* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ int32_t rocsparse_nontemporal_load(const int32_t* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ int64_t rocsparse_nontemporal_load(const int64_t* ptr) { return __builtin_nontemporal_load(ptr); }
 
@@ -66,6 +66,15 @@
         }                                                                    \
     }
 
+#define THROW_IF_ROCSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                   \
+        rocsparse_status TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != rocsparse_status_success)            \
+        {                                                               \
+            throw TMP_STATUS_FOR_CHECK;                                 \
+        }                                                               \
+    }
+
 #define PRINT_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                \
     {                                                             \
         hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
@@ -79,6 +88,19 @@
         }                                                         \
     }
 
+#define PRINT_IF_ROCSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                   \
+        rocsparse_status TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != rocsparse_status_success)            \
+        {                                                               \
+            fprintf(stderr,                                             \
+                    "rocsparse error code: %d at %s:%d\n",              \
+                    TMP_STATUS_FOR_CHECK,                               \
+                    __FILE__,                                           \
+                    __LINE__);                                          \
+        }                                                               \
+    }
+
 #define RETURN_IF_INVALID_HANDLE(HANDLE)            \
     {                                               \
         if(HANDLE == nullptr)                       \
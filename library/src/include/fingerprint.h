@@ -0,0 +1,72 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef FINGERPRINT_H
+#define FINGERPRINT_H
+
+#include "definitions.h"
+#include "handle.h"
+
+#include <cstdint>
+
+// Initial value of the FNV-1a hash
+static constexpr uint64_t rocsparse_hash_fnv1a_init = 14695981039346656037ULL;
+
+// FNV-1a hash of size bytes of data, continuing from hash
+static inline uint64_t rocsparse_hash_fnv1a(uint64_t hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr_fingerprint computes a hash of the sparsity pattern of a
+ * CSR matrix, given by its dimensions, index base, row pointers and column
+ * indices. The pattern is hashed on the device using the stream of the handle,
+ * only a single 64 bit value is transferred to the host. The hash is the sum of a
+ * mix of position and value of each entry and is thus independent of the order of
+ * accumulation. If check is not nullptr, it receives a second hash of the pattern,
+ * computed in the same pass with different seeds and mixing, that is independent
+ * of the fingerprint.
+ *******************************************************************************/
+template <typename I, typename J>
+rocsparse_status rocsparse_csr_fingerprint(rocsparse_handle     handle,
+                                           J                    m,
+                                           J                    n,
+                                           I                    nnz,
+                                           rocsparse_index_base base,
+                                           const I*             csr_row_ptr,
+                                           const J*             csr_col_ind,
+                                           uint64_t*            fingerprint,
+                                           uint64_t*            check = nullptr);
+
+#endif // FINGERPRINT_H
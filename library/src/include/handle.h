@@ -26,6 +26,8 @@
 #ifndef HANDLE_H
 #define HANDLE_H
 
+#include "handle_resources.h"
+#include "memory_pool.h"
 #include "rocsparse.h"
 
 #include <fstream>
@@ -38,6 +40,26 @@ typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
 typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
 typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
 
+class rocsparse_log_queue;
+class rocsparse_profile;
+class rocsparse_capture;
+class rocsparse_analysis_cache;
+
+/*! \brief Bits of rocsparse_create_handle_with_flags() that are supported. */
+#define ROCSPARSE_HANDLE_FLAGS_MASK (rocsparse_handle_flags_lazy | rocsparse_handle_flags_pooled)
+
+/********************************************************************************
+ * \brief rocsparse_hip_runtime performs the device operations of the handle
+ * resources using HIP.
+ *******************************************************************************/
+struct rocsparse_hip_runtime
+{
+    rocsparse_status malloc(void** ptr, size_t size);
+    rocsparse_status free(void* ptr);
+    rocsparse_status upload(void* dst, const void* src, size_t size, hipStream_t stream);
+    rocsparse_status synchronize(hipStream_t stream);
+};
+
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
  * It must be initialized using rocsparse_create_handle()
@@ -47,8 +69,8 @@ typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
  *******************************************************************************/
 struct _rocsparse_handle
 {
-    // constructor
-    _rocsparse_handle();
+    // constructor, see rocsparse_handle_flags
+    explicit _rocsparse_handle(unsigned int flags = rocsparse_handle_flags_none);
     // destructor
     ~_rocsparse_handle();
 
@@ -56,6 +78,43 @@ struct _rocsparse_handle
     rocsparse_status set_stream(hipStream_t user_stream);
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
+    // reset the user settable state, before the handle is reused from the pool
+    void reset();
+
+    // get device buffer of buffer_size bytes, allocated on first use
+    template <typename T>
+    rocsparse_status get_buffer(T** ptr)
+    {
+        void*            buffer = nullptr;
+        rocsparse_status status = resources.get_buffer(&buffer);
+
+        *ptr = reinterpret_cast<T*>(buffer);
+        return status;
+    }
+
+    // allocate size bytes of temporary device memory, to be used on the handle stream
+    rocsparse_status allocate(void** ptr, size_t size);
+    template <typename T>
+    rocsparse_status allocate(T** ptr, size_t size)
+    {
+        void*            p      = nullptr;
+        rocsparse_status status = allocate(&p, size);
+
+        *ptr = reinterpret_cast<T*>(p);
+        return status;
+    }
+    // release temporary device memory after all previous work on the handle stream
+    rocsparse_status deallocate(void* ptr);
+    // set device memory allocator, see rocsparse_set_allocator()
+    rocsparse_status set_allocator(const rocsparse_device_allocator& alloc);
+
+    // grow pinned host staging buffer to at least size bytes, preserving its content
+    rocsparse_status reserve_host_buffer(size_t size);
+
+    // wait for all work on the handle stream, counted in sync_count
+    rocsparse_status synchronize();
+    // copy size bytes of device memory to host memory and wait for the handle stream
+    rocsparse_status copy_to_host(void* dst, const void* src, size_t size);
 
     // device id
     int device;
@@ -71,21 +130,38 @@ struct _rocsparse_handle
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
     // logging mode
     rocsparse_layer_mode layer_mode;
-    // device buffer
+    // creation flags
+    unsigned int flags;
+    // device buffer size, see get_buffer()
     size_t buffer_size;
-    void*  buffer;
-    // device one
-    float*  sone;
-    double* done;
-    // device complex one
-    rocsparse_float_complex*  cone;
-    rocsparse_double_complex* zone;
+    // pinned host staging buffer
+    size_t host_buffer_size = 0;
+    void*  host_buffer      = nullptr;
+    // number of host synchronizations with the stream, see rocsparse_get_sync_count()
+    int64_t sync_count = 0;
+    // device buffer and device constants
+    rocsparse_hip_runtime                             runtime;
+    rocsparse_handle_resources<rocsparse_hip_runtime> resources{runtime};
 
     // logging streams
     std::ofstream log_trace_ofs;
     std::ofstream log_bench_ofs;
     std::ostream* log_trace_os = nullptr;
     std::ostream* log_bench_os = nullptr;
+
+    // asynchronous logging backend, nullptr if logging is synchronous
+    rocsparse_log_queue* log_queue = nullptr;
+    // profile, nullptr if profiling is disabled
+    rocsparse_profile* profile = nullptr;
+    // operand capture, nullptr if capturing is disabled
+    rocsparse_capture* capture = nullptr;
+    // analysis cache, nullptr if caching is disabled
+    rocsparse_analysis_cache* analysis_cache = nullptr;
+
+    // device memory allocator of temporary storage and meta data
+    rocsparse_device_allocator allocator;
+    // memory pool of temporary storage, nullptr if pooling is disabled
+    rocsparse_memory_pool* memory_pool = nullptr;
 };
 
 /********************************************************************************
@@ -135,6 +211,9 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void*          coo_val     = nullptr;
+
+    // allocator of the ELL and COO arrays
+    rocsparse_device_allocator allocator;
 };
 
 /********************************************************************************
@@ -155,6 +234,7 @@ struct _rocsparse_mat_info
     rocsparse_trm_info bsrilu0_info      = nullptr;
 
     rocsparse_csrmv_info   csrmv_info        = nullptr;
+    rocsparse_csrmv_info   csrmv_merge_info  = nullptr;
     rocsparse_trm_info     csric0_info       = nullptr;
     rocsparse_trm_info     csrilu0_info      = nullptr;
     rocsparse_trm_info     csrsv_upper_info  = nullptr;
@@ -169,6 +249,8 @@ struct _rocsparse_mat_info
 
     // zero pivot for csrsv, csrsm, csrilu0, csric0
     rocsparse_int* zero_pivot = nullptr;
+    // allocator of zero_pivot
+    rocsparse_device_allocator allocator;
 
     // numeric boost for ilu0
     int         boost_enable        = 0;
@@ -202,6 +284,19 @@ struct _rocsparse_csrmv_info
     void*         row_blocks = nullptr;
     unsigned int* wg_flags   = nullptr;
     void*         wg_ids     = nullptr;
+    // transposed operations: zero based CSC column pointers and row indices, and the
+    // position of each CSC entry in the CSR arrays, such that no values are copied
+    void* csc_col_ptr = nullptr;
+    void* csc_row_ind = nullptr;
+    void* csc_perm    = nullptr;
+    // merge path: start coordinates of the ntiles + 1 tile boundaries and the
+    // partial sum of the row that is shared with the next tile
+    int64_t ntiles     = 0;
+    void*   tile_row   = nullptr;
+    void*   tile_nnz   = nullptr;
+    void*   tile_carry = nullptr;
+    // allocator of the row blocks, CSC arrays and merge path tiles
+    rocsparse_device_allocator allocator;
 
     // some data to verify correct execution
     rocsparse_operation         trans;
@@ -239,6 +334,8 @@ struct _rocsparse_trm_info
     rocsparse_int* trmt_perm    = nullptr;
     rocsparse_int* trmt_row_ptr = nullptr;
     rocsparse_int* trmt_col_ind = nullptr;
+    // allocator of the device arrays
+    rocsparse_device_allocator allocator;
 
     // some data to verify correct execution
     rocsparse_int               m;
@@ -339,6 +436,26 @@ struct _rocsparse_spmat_descr
     rocsparse_index_base idx_base;
     rocsparse_format     format;
 
+    // SELL-C-sigma slice size and sorting window
+    int64_t slice_size = 0;
+    int64_t sigma      = 0;
+
+    // BSR block direction and dimensions
+    rocsparse_direction block_dir     = rocsparse_direction_row;
+    int64_t             row_block_dim = 0;
+    int64_t             col_block_dim = 0;
+
+    // CSR16 entries that do not fit the 16 bit column offsets, stored in COO format
+    int64_t esc_nnz      = 0;
+    void*   esc_row_data = nullptr;
+    void*   esc_col_data = nullptr;
+    void*   esc_val_data = nullptr;
+
+    // Strided batch of CSR matrices sharing one sparsity pattern, only the values
+    // are strided
+    int     batch_count  = 1;
+    int64_t batch_stride = 0;
+
     rocsparse_mat_descr descr;
     rocsparse_mat_info  info;
 };
@@ -350,6 +467,10 @@ struct _rocsparse_dnvec_descr
     int64_t            size;
     void*              values;
     rocsparse_datatype data_type;
+
+    // Strided batch of dense vectors
+    int     batch_count  = 1;
+    int64_t batch_stride = 0;
 };
 
 struct _rocsparse_dnmat_descr
@@ -364,6 +485,10 @@ struct _rocsparse_dnmat_descr
 
     rocsparse_datatype data_type;
     rocsparse_order    order;
+
+    // Strided batch of dense matrices
+    int     batch_count  = 1;
+    int64_t batch_stride = 0;
 };
 
 #endif // HANDLE_H
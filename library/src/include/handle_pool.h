@@ -0,0 +1,62 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HANDLE_POOL_H
+#define HANDLE_POOL_H
+
+#include "handle.h"
+
+#include <mutex>
+#include <vector>
+
+/********************************************************************************
+ * \brief rocsparse_handle_pool is a process-wide pool of initialized handles.
+ *
+ * \details
+ * Destroyed pooled handles are kept in the pool, such that creating a pooled
+ * handle of the same device only takes a handle from the pool, instead of
+ * querying the device and allocating its resources again.
+ *******************************************************************************/
+class rocsparse_handle_pool
+{
+public:
+    /// The process-wide pool.
+    static rocsparse_handle_pool& instance();
+
+    /// Take a handle of device from the pool, nullptr if there is none.
+    rocsparse_handle acquire(int device);
+
+    /// Put handle into the pool, returns false if the pool is full.
+    bool release(rocsparse_handle handle);
+
+private:
+    explicit rocsparse_handle_pool(size_t capacity);
+
+    std::mutex                    mutex_;
+    size_t                        capacity_;
+    std::vector<rocsparse_handle> handles_;
+};
+
+#endif // HANDLE_POOL_H
@@ -0,0 +1,243 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HANDLE_RESOURCES_H
+#define HANDLE_RESOURCES_H
+
+#include "rocsparse.h"
+
+#include <cassert>
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+
+/*! \brief Allocation state of a device resource of the handle. */
+enum class rocsparse_resource_state : int
+{
+    unallocated,
+    allocated
+};
+
+/********************************************************************************
+ * \brief rocsparse_handle_resources holds the device scratch buffer and the
+ * device constants of a handle.
+ *
+ * \details
+ * Each resource starts unallocated. It is allocated either by initialize(), or
+ * on first use if the handle is lazy. A failed allocation leaves the resource
+ * unallocated, such that the next use retries. The runtime R performs the
+ * actual device operations and is replaced by a mock in the unit tests. It
+ * must provide
+ *
+ *   rocsparse_status malloc(void** ptr, size_t size);
+ *   rocsparse_status free(void* ptr);
+ *   rocsparse_status upload(void* dst, const void* src, size_t size, hipStream_t stream);
+ *   rocsparse_status synchronize(hipStream_t stream);
+ *******************************************************************************/
+template <typename R>
+class rocsparse_handle_resources
+{
+public:
+    explicit rocsparse_handle_resources(R& runtime)
+        : runtime_(runtime)
+    {
+    }
+
+    ~rocsparse_handle_resources()
+    {
+        release();
+    }
+
+    rocsparse_handle_resources(const rocsparse_handle_resources&) = delete;
+    rocsparse_handle_resources& operator=(const rocsparse_handle_resources&) = delete;
+
+    /// Allocate all resources that are not allocated yet.
+    rocsparse_status initialize(hipStream_t stream)
+    {
+        void*  buffer;
+        float* one;
+
+        rocsparse_status status = get_buffer(&buffer);
+        if(status != rocsparse_status_success)
+        {
+            return status;
+        }
+
+        return get_one(&one, stream);
+    }
+
+    /// Free all resources, they are allocated again on next use.
+    rocsparse_status release()
+    {
+        rocsparse_status status = rocsparse_status_success;
+
+        if(buffer_ != nullptr)
+        {
+            status  = runtime_.free(buffer_);
+            buffer_ = nullptr;
+        }
+
+        if(ones_ != nullptr)
+        {
+            rocsparse_status ones_status = runtime_.free(ones_);
+            ones_                        = nullptr;
+
+            status = (status == rocsparse_status_success) ? ones_status : status;
+        }
+
+        return status;
+    }
+
+    /// Set the size of the scratch buffer, before it is allocated.
+    void set_buffer_size(size_t size)
+    {
+        assert(buffer_ == nullptr);
+        buffer_size_ = size;
+    }
+
+    /// Size of the scratch buffer, known before it is allocated.
+    size_t buffer_size() const
+    {
+        return buffer_size_;
+    }
+
+    rocsparse_resource_state buffer_state() const
+    {
+        return (buffer_ != nullptr) ? rocsparse_resource_state::allocated
+                                    : rocsparse_resource_state::unallocated;
+    }
+
+    rocsparse_resource_state ones_state() const
+    {
+        return (ones_ != nullptr) ? rocsparse_resource_state::allocated
+                                  : rocsparse_resource_state::unallocated;
+    }
+
+    /// Scratch buffer of buffer_size() bytes, allocated on first use.
+    rocsparse_status get_buffer(void** buffer)
+    {
+        if(buffer_ == nullptr)
+        {
+            rocsparse_status status = runtime_.malloc(&buffer_, buffer_size_);
+            if(status != rocsparse_status_success)
+            {
+                buffer_ = nullptr;
+                return status;
+            }
+        }
+
+        *buffer = buffer_;
+        return rocsparse_status_success;
+    }
+
+    /// Device one of type T, allocated and uploaded on first use.
+    template <typename T>
+    rocsparse_status get_one(T** one, hipStream_t stream)
+    {
+        if(ones_ == nullptr)
+        {
+            rocsparse_status status = allocate_ones(stream);
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+        }
+
+        *one = reinterpret_cast<T*>(reinterpret_cast<char*>(ones_) + ones_offset(static_cast<T*>(nullptr)));
+        return rocsparse_status_success;
+    }
+
+private:
+    // All constants share a single allocation, one slot of 16 bytes per type
+    struct ones_block
+    {
+        float                    s;
+        char                     s_pad[16 - sizeof(float)];
+        double                   d;
+        char                     d_pad[16 - sizeof(double)];
+        rocsparse_float_complex  c;
+        char                     c_pad[16 - sizeof(rocsparse_float_complex)];
+        rocsparse_double_complex z;
+    };
+
+    static size_t ones_offset(const float*)
+    {
+        return offsetof(ones_block, s);
+    }
+
+    static size_t ones_offset(const double*)
+    {
+        return offsetof(ones_block, d);
+    }
+
+    static size_t ones_offset(const rocsparse_float_complex*)
+    {
+        return offsetof(ones_block, c);
+    }
+
+    static size_t ones_offset(const rocsparse_double_complex*)
+    {
+        return offsetof(ones_block, z);
+    }
+
+    rocsparse_status allocate_ones(hipStream_t stream)
+    {
+        ones_block hones = {};
+
+        hones.s = 1.0f;
+        hones.d = 1.0;
+        hones.c = rocsparse_float_complex(1.0f, 0.0f);
+        hones.z = rocsparse_double_complex(1.0, 0.0);
+
+        void*            ones;
+        rocsparse_status status = runtime_.malloc(&ones, sizeof(ones_block));
+        if(status != rocsparse_status_success)
+        {
+            return status;
+        }
+
+        // Wait for the transfer to finish, the host constants leave scope
+        status = runtime_.upload(ones, &hones, sizeof(ones_block), stream);
+        if(status == rocsparse_status_success)
+        {
+            status = runtime_.synchronize(stream);
+        }
+
+        if(status != rocsparse_status_success)
+        {
+            runtime_.free(ones);
+            return status;
+        }
+
+        ones_ = ones;
+        return rocsparse_status_success;
+    }
+
+    R&     runtime_;
+    size_t buffer_size_ = 0;
+    void*  buffer_ = nullptr;
+    void*  ones_   = nullptr;
+};
+
+#endif // HANDLE_RESOURCES_H
@@ -0,0 +1,344 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef LOG_QUEUE_H
+#define LOG_QUEUE_H
+
+#include "rocsparse.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief Tags of the arguments stored in a binary log record.
+ */
+enum class log_tag : uint8_t
+{
+    int64,
+    uint64,
+    character,
+    float32,
+    float64,
+    complex32,
+    complex64,
+    pointer,
+    string
+};
+
+/**
+ * @brief Kind of an argument without dedicated encoding: signed integer or
+ * enumeration (0), unsigned integer (1), pointer (2) or any other type (3).
+ */
+template <typename T>
+struct log_kind
+    : std::integral_constant<int,
+                             (std::is_enum<T>::value
+                              || (std::is_integral<T>::value && std::is_signed<T>::value))
+                                 ? 0
+                                 : std::is_integral<T>::value ? 1
+                                                              : std::is_pointer<T>::value ? 2 : 3>
+{
+};
+
+/**
+ * @brief Encoder of a binary log record.
+ *
+ * @details
+ * log_encoder appends each argument as its tag followed by the raw value to a
+ * fixed size record. Strings are copied into the record, such that temporaries
+ * can be logged. Arguments of any other type are formatted into a string. If the
+ * record is too small to hold all arguments, the encoder is marked as overflowed.
+ */
+class log_encoder
+{
+public:
+    log_encoder(char* data, size_t capacity)
+        : data_(data)
+        , capacity_(capacity)
+    {
+    }
+
+    /// Number of bytes used.
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /// True if all arguments fit into the record.
+    bool valid() const
+    {
+        return valid_;
+    }
+
+    /// Generic overload for () operator, dispatches on the kind of type.
+    template <typename T>
+    void operator()(const T& x)
+    {
+        encode_generic(x, log_kind<T>{});
+    }
+
+    void operator()(bool x)
+    {
+        put(log_tag::int64, static_cast<int64_t>(x));
+    }
+
+    void operator()(char x)
+    {
+        put(log_tag::character, x);
+    }
+
+    void operator()(signed char x)
+    {
+        put(log_tag::character, static_cast<char>(x));
+    }
+
+    void operator()(unsigned char x)
+    {
+        put(log_tag::character, static_cast<char>(x));
+    }
+
+    void operator()(float x)
+    {
+        put(log_tag::float32, x);
+    }
+
+    void operator()(double x)
+    {
+        put(log_tag::float64, x);
+    }
+
+    void operator()(const rocsparse_float_complex& x)
+    {
+        put(log_tag::complex32, x);
+    }
+
+    void operator()(const rocsparse_double_complex& x)
+    {
+        put(log_tag::complex64, x);
+    }
+
+    void operator()(const char* x)
+    {
+        put_string(x, strlen(x));
+    }
+
+    void operator()(char* x)
+    {
+        put_string(x, strlen(x));
+    }
+
+    void operator()(const std::string& x)
+    {
+        put_string(x.data(), x.size());
+    }
+
+private:
+    template <typename T>
+    void encode_generic(const T& x, std::integral_constant<int, 0>)
+    {
+        put(log_tag::int64, static_cast<int64_t>(x));
+    }
+
+    template <typename T>
+    void encode_generic(const T& x, std::integral_constant<int, 1>)
+    {
+        put(log_tag::uint64, static_cast<uint64_t>(x));
+    }
+
+    template <typename T>
+    void encode_generic(const T& x, std::integral_constant<int, 2>)
+    {
+        put(log_tag::pointer, static_cast<const void*>(x));
+    }
+
+    template <typename T>
+    void encode_generic(const T& x, std::integral_constant<int, 3>)
+    {
+        std::ostringstream os;
+        os << x;
+        (*this)(os.str());
+    }
+
+    template <typename T>
+    void put(log_tag tag, const T& x)
+    {
+        if(size_ + 1 + sizeof(T) > capacity_)
+        {
+            valid_ = false;
+            return;
+        }
+
+        data_[size_] = static_cast<char>(tag);
+        memcpy(data_ + size_ + 1, &x, sizeof(T));
+        size_ += 1 + sizeof(T);
+    }
+
+    void put_string(const char* x, size_t length)
+    {
+        if(size_ + 1 + sizeof(uint32_t) + length > capacity_)
+        {
+            valid_ = false;
+            return;
+        }
+
+        uint32_t n = static_cast<uint32_t>(length);
+        put(log_tag::string, n);
+        memcpy(data_ + size_, x, length);
+        size_ += length;
+    }
+
+    char*  data_;
+    size_t capacity_;
+    size_t size_  = 0;
+    bool   valid_ = true;
+};
+
+/**
+ * @brief Decode a binary log record and write it to os.
+ *
+ * @details
+ * The output is identical to log_arguments: the first argument is preceded by
+ * a new line, all further arguments are preceded by separator.
+ */
+void log_decode(std::ostream& os, char separator, const char* data, size_t size);
+
+/**
+ * @brief Asynchronous logging backend.
+ *
+ * @details
+ * rocsparse_log_queue is a bounded lock-free ring buffer of binary log records.
+ * Calling threads only encode the raw arguments into a free slot, a background
+ * thread formats the records and writes them to their output stream. If the ring
+ * buffer is full, or a record does not fit into a slot, the record is dropped and
+ * counted instead of blocking the calling thread. Remaining records are written
+ * when the queue is destroyed.
+ */
+class rocsparse_log_queue
+{
+public:
+    /// Bytes available for the arguments of a single record.
+    static constexpr size_t record_bytes = 1024;
+
+    explicit rocsparse_log_queue(size_t capacity);
+    ~rocsparse_log_queue();
+
+    rocsparse_log_queue(const rocsparse_log_queue&) = delete;
+    rocsparse_log_queue& operator=(const rocsparse_log_queue&) = delete;
+
+    /// Enqueue a record of head and xs, to be written to os.
+    template <typename H, typename... Ts>
+    void push(std::ostream& os, char separator, H&& head, Ts&&... xs)
+    {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        slot*  s;
+
+        for(;;)
+        {
+            s = &slots_[pos & mask_];
+
+            size_t   seq  = s->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if(diff == 0)
+            {
+                if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                // Ring buffer is full
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        log_encoder encoder(s->data, record_bytes);
+        encoder(head);
+        (void)std::initializer_list<int>{(encoder(xs), 0)...};
+
+        if(encoder.valid())
+        {
+            s->os        = &os;
+            s->separator = separator;
+            s->size      = encoder.size();
+        }
+        else
+        {
+            // The slot is still handed to the consumer, which skips it
+            s->os = nullptr;
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        s->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    /// Number of records that have been dropped.
+    size_t dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct slot
+    {
+        std::atomic<size_t> sequence;
+        std::ostream*       os;
+        char                separator;
+        size_t              size;
+        char                data[record_bytes];
+    };
+
+    // Write the next record, returns false if the queue is empty
+    bool pop(std::ostream** os);
+    // Background thread
+    void worker();
+
+    std::unique_ptr<slot[]> slots_;
+    size_t                  mask_;
+
+    std::atomic<size_t> enqueue_pos_{0};
+    size_t              dequeue_pos_ = 0;
+
+    std::atomic<size_t> dropped_{0};
+    std::atomic<bool>   stop_{false};
+
+    std::thread thread_;
+};
+
+#endif // LOG_QUEUE_H
@@ -0,0 +1,142 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#include "rocsparse.h"
+
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <unordered_map>
+#include <vector>
+
+/********************************************************************************
+ * \brief rocsparse_device_allocator allocates device memory with the functions
+ * set by rocsparse_set_allocator(), or with hipMalloc and hipFree by default.
+ *******************************************************************************/
+struct rocsparse_device_allocator
+{
+    rocsparse_alloc_func alloc     = nullptr;
+    rocsparse_free_func  free      = nullptr;
+    void*                user_data = nullptr;
+
+    rocsparse_status allocate(void** ptr, size_t size, hipStream_t stream) const;
+    rocsparse_status deallocate(void* ptr, hipStream_t stream) const;
+};
+
+/********************************************************************************
+ * \brief rocsparse_memory_pool is a stream ordered caching pool for temporary
+ * device memory.
+ *
+ * \details
+ * Requests are rounded up to size classes, four per power of two, and freed
+ * blocks are kept in a bin per size class. A freed block is reused right away
+ * by requests on the stream it has been freed on, and by requests on any other
+ * stream once the work preceding its release has completed. Cached bytes are
+ * limited by the pool capacity, blocks exceeding it are returned to the
+ * underlying allocator.
+ *******************************************************************************/
+class rocsparse_memory_pool
+{
+public:
+    rocsparse_memory_pool(const rocsparse_device_allocator& allocator, size_t capacity);
+    ~rocsparse_memory_pool();
+
+    rocsparse_memory_pool(const rocsparse_memory_pool&) = delete;
+    rocsparse_memory_pool& operator=(const rocsparse_memory_pool&) = delete;
+
+    /// Allocate size bytes to be used on stream.
+    rocsparse_status allocate(void** ptr, size_t size, hipStream_t stream);
+    /// Release ptr after all previous work on stream.
+    rocsparse_status deallocate(void* ptr, hipStream_t stream);
+
+    /// Return all cached blocks to the underlying allocator.
+    rocsparse_status release();
+    /// Set the capacity, dropping cached blocks if required.
+    rocsparse_status resize(size_t capacity);
+    /// Replace the underlying allocator, cached blocks are released first.
+    rocsparse_status set_allocator(const rocsparse_device_allocator& allocator);
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    size_t bytes_in_use() const
+    {
+        return in_use_;
+    }
+
+    size_t bytes_cached() const
+    {
+        return cached_;
+    }
+
+    /// Peak number of bytes held from the underlying allocator.
+    size_t high_water_mark() const
+    {
+        return high_water_;
+    }
+
+    int64_t hits() const
+    {
+        return hits_;
+    }
+
+    int64_t misses() const
+    {
+        return misses_;
+    }
+
+private:
+    struct block
+    {
+        void*       ptr;
+        size_t      size;
+        int         bin;
+        hipStream_t stream;
+        hipEvent_t  event;
+    };
+
+    // Size class of size bytes, and its bin
+    static size_t size_class(size_t size, int* bin);
+
+    // Return a cached block to the underlying allocator
+    rocsparse_status free_block(block& b);
+
+    rocsparse_device_allocator       allocator_;
+    size_t                           capacity_;
+    std::vector<std::vector<block>>  bins_;
+    std::unordered_map<void*, block> used_;
+
+    size_t  in_use_     = 0;
+    size_t  cached_     = 0;
+    size_t  high_water_ = 0;
+    int64_t hits_       = 0;
+    int64_t misses_     = 0;
+};
+
+#endif // MEMORY_POOL_H
@@ -0,0 +1,162 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "handle.h"
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Aggregated profile of all calls on a handle.
+ *
+ * @details
+ * rocsparse_profile collects the number of calls, the total, minimum and maximum
+ * host-side latency and histograms of the leading integer arguments (typically m,
+ * n and nnz) of each function. Histogram buckets are powers of two. The summary is
+ * written when the profile is destroyed together with its handle, or at exit for
+ * handles that have never been destroyed.
+ */
+class rocsparse_profile
+{
+public:
+    /// Number of leading integer arguments that are recorded.
+    static constexpr int num_dims = 3;
+    /// Number of histogram buckets, bucket 0 holds non-positive values.
+    static constexpr int num_buckets = 64;
+
+    rocsparse_profile();
+    ~rocsparse_profile();
+
+    rocsparse_profile(const rocsparse_profile&) = delete;
+    rocsparse_profile& operator=(const rocsparse_profile&) = delete;
+
+    /// Add a single call of function name to the profile.
+    void record(const std::string& name, const int64_t* dims, int ndims, double usec);
+
+    /// Write the summary as table or as JSON.
+    void write(std::ostream& os, bool json) const;
+
+    /// Write the summary once, to ROCSPARSE_LOG_PROFILE_PATH or stderr.
+    void dump();
+
+private:
+    struct entry
+    {
+        uint64_t calls      = 0;
+        double   total_usec = 0.0;
+        double   min_usec   = 0.0;
+        double   max_usec   = 0.0;
+        uint64_t histogram[num_dims][num_buckets] = {};
+    };
+
+    std::map<std::string, entry> entries;
+    mutable std::mutex           mutex;
+    bool                         dumped = false;
+};
+
+/**
+ * @brief Profiled scope of a public function.
+ *
+ * @details
+ * rocsparse_profile_scope measures the host-side latency from its construction to
+ * its destruction, and adds it to the profile of the handle if profiling is
+ * enabled. Name and arguments of the call are taken from the first log_trace on
+ * the same handle while the scope is the innermost open scope of the thread, such
+ * that nested calls are attributed to their own function.
+ */
+class rocsparse_profile_scope
+{
+public:
+    explicit rocsparse_profile_scope(rocsparse_handle handle);
+    ~rocsparse_profile_scope();
+
+    rocsparse_profile_scope(const rocsparse_profile_scope&) = delete;
+    rocsparse_profile_scope& operator=(const rocsparse_profile_scope&) = delete;
+
+    /// Name the innermost open scope of handle by the arguments of log_trace.
+    template <typename H, typename... Ts>
+    static void describe(rocsparse_handle handle, const H& head, const Ts&... xs)
+    {
+        rocsparse_profile_scope* scope = current();
+        if(scope == nullptr || scope->handle != handle || scope->named)
+        {
+            return;
+        }
+
+        scope->name  = head;
+        scope->named = true;
+        (void)std::initializer_list<int>{(scope->add_dim(xs), 0)...};
+    }
+
+private:
+    // Integer arguments that are neither enumerations nor characters are shape arguments
+    template <typename T>
+    void add_dim(const T& x)
+    {
+        add_dim(x,
+                std::integral_constant<bool,
+                                       std::is_integral<T>::value && !std::is_same<T, bool>::value
+                                           && !std::is_same<T, char>::value>{});
+    }
+
+    template <typename T>
+    void add_dim(const T& x, std::true_type)
+    {
+        if(ndims < rocsparse_profile::num_dims)
+        {
+            dims[ndims++] = static_cast<int64_t>(x);
+        }
+    }
+
+    template <typename T>
+    void add_dim(const T& x, std::false_type)
+    {
+    }
+
+    // Innermost open scope of the calling thread
+    static rocsparse_profile_scope*& current();
+
+    rocsparse_handle         handle;
+    rocsparse_profile*       profile = nullptr;
+    rocsparse_profile_scope* parent  = nullptr;
+
+    std::chrono::steady_clock::time_point start;
+
+    std::string name;
+    bool        named = false;
+    int64_t     dims[rocsparse_profile::num_dims];
+    int         ndims = 0;
+};
+
+#endif // PROFILE_H
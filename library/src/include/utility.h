@@ -27,7 +27,9 @@
 #define UTILITY_H
 
 #include "handle.h"
+#include "log_queue.h"
 #include "logging.h"
+#include "profile.h"
 #include <algorithm>
 #include <exception>
 
@@ -44,42 +46,44 @@ static inline rocsparse_int rocsparse_clz(rocsparse_int n)
 }
 #endif
 
-// Return one on the device
-static inline void rocsparse_one(const rocsparse_handle handle, float** one)
-{
-    *one = handle->sone;
-}
-
-static inline void rocsparse_one(const rocsparse_handle handle, double** one)
-{
-    *one = handle->done;
-}
-
-static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_float_complex** one)
-{
-    *one = handle->cone;
-}
-
-static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_double_complex** one)
+// Return one on the device, allocated on first use
+template <typename T>
+static inline rocsparse_status rocsparse_one(const rocsparse_handle handle, T** one)
 {
-    *one = handle->zone;
+    return handle->resources.get_one(one, handle->stream);
 }
 
 // if trace logging is turned on with
 // (handle->layer_mode & rocsparse_layer_mode_log_trace) == true
 // then
 // log_function will call log_arguments to log function
-// arguments with a comma separator
+// arguments with a comma separator, or enqueue them to the
+// asynchronous logging backend of the handle.
+// if profiling is turned on with
+// (handle->layer_mode & rocsparse_layer_mode_log_profile) == true
+// then
+// function name and arguments are attached to the open profile scope
 template <typename H, typename... Ts>
 void log_trace(rocsparse_handle handle, H head, Ts&&... xs)
 {
     if(nullptr != handle)
     {
-        if(handle->layer_mode & rocsparse_layer_mode_log_trace)
+        if(handle->layer_mode & rocsparse_layer_mode_log_profile)
         {
-            std::string comma_separator = ",";
+            rocsparse_profile_scope::describe(handle, head, xs...);
+        }
 
+        if(handle->layer_mode & rocsparse_layer_mode_log_trace)
+        {
             std::ostream* os = handle->log_trace_os;
+
+            if(handle->log_queue != nullptr)
+            {
+                handle->log_queue->push(*os, ',', head, std::forward<Ts>(xs)...);
+                return;
+            }
+
+            std::string comma_separator = ",";
             log_arguments(*os, comma_separator, head, std::forward<Ts>(xs)...);
         }
     }
@@ -97,9 +101,15 @@ void log_bench(rocsparse_handle handle, H head, std::string precision, Ts&&... x
     {
         if(handle->layer_mode & rocsparse_layer_mode_log_bench)
         {
-            std::string space_separator = " ";
-
             std::ostream* os = handle->log_bench_os;
+
+            if(handle->log_queue != nullptr)
+            {
+                handle->log_queue->push(*os, ' ', head, precision, std::forward<Ts>(xs)...);
+                return;
+            }
+
+            std::string space_separator = " ";
             log_arguments(*os, space_separator, head, precision, std::forward<Ts>(xs)...);
         }
     }
@@ -295,6 +305,21 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_matrix_type value_)
     return true;
 };
 
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_spmat_attribute value_)
+{
+    switch(value_)
+    {
+    case rocsparse_spmat_fill_mode:
+    case rocsparse_spmat_diag_type:
+    case rocsparse_spmat_matrix_type:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
 template <>
 inline bool rocsparse_enum_utils::is_invalid(rocsparse_direction value_)
 {
@@ -350,6 +375,7 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spmv_alg value_)
     case rocsparse_spmv_alg_csr_adaptive:
     case rocsparse_spmv_alg_csr_stream:
     case rocsparse_spmv_alg_ell:
+    case rocsparse_spmv_alg_csr_merge:
     {
         return false;
     }
@@ -397,6 +423,31 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_analysis_policy value_)
     return true;
 };
 
+// For symmetric and hermitian storage, op(A) is applied by reading the stored
+// triangle of A once, directly and mirrored. Determine which of both parts has
+// to be conjugated.
+static inline void rocsparse_symmetric_conj(rocsparse_operation   trans,
+                                            rocsparse_matrix_type type,
+                                            bool*                 conj_stored,
+                                            bool*                 conj_mirror)
+{
+    bool conj_op = (trans == rocsparse_operation_conjugate_transpose);
+    bool herm    = (type == rocsparse_matrix_type_hermitian);
+
+    // Symmetric:  A^T = A,  A^H = conj(A)
+    // Hermitian:  A^H = A,  A^T = conj(A)
+    if(herm)
+    {
+        *conj_stored = (trans == rocsparse_operation_transpose);
+        *conj_mirror = !*conj_stored;
+    }
+    else
+    {
+        *conj_stored = conj_op;
+        *conj_mirror = conj_op;
+    }
+}
+
 template <typename T>
 struct floating_traits
 {
@@ -0,0 +1,69 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef WORKSPACE_PLAN_H
+#define WORKSPACE_PLAN_H
+
+#include "rocsparse.h"
+
+#include <vector>
+
+/********************************************************************************
+ * \brief rocsparse_workspace_plan is a structure holding the temporary buffer
+ * requirements of a sequence of operations. It must be initialized using the
+ * rocsparse_create_workspace_plan() routine. It should be destroyed at the end
+ * using rocsparse_destroy_workspace_plan().
+ *
+ * \details
+ * Each step of the plan requires a buffer of a given size. A step may share the
+ * buffer of an earlier step, e.g. a triangular solve shares the buffer of its
+ * analysis, which extends the lifetime of that buffer up to the sharing step.
+ * pack() assigns offsets into a single workspace, such that buffers with
+ * overlapping lifetimes do not overlap in memory.
+ *******************************************************************************/
+struct _rocsparse_workspace_plan
+{
+    /// Alignment of the buffer offsets within the workspace.
+    static constexpr size_t alignment = 256;
+
+    // required buffer size of each step
+    std::vector<size_t> sizes;
+    // step that owns the buffer of each step
+    std::vector<rocsparse_int> owners;
+    // offset of the buffer of each step
+    std::vector<size_t> offsets;
+    // size of the packed workspace
+    size_t workspace_size = 0;
+    // true if offsets and workspace_size are up to date
+    bool packed = false;
+
+    /// Append a step, shared_step is the step whose buffer is reused or -1.
+    rocsparse_status add_step(size_t buffer_size, rocsparse_int shared_step, rocsparse_int* step);
+
+    /// Assign the offsets and the workspace size.
+    void pack();
+};
+
+#endif // WORKSPACE_PLAN_H
@@ -52,6 +52,9 @@ rocsparse_status rocsparse_axpyi_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xaxpyi"),
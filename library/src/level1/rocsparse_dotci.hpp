@@ -46,6 +46,9 @@ rocsparse_status rocsparse_dotci_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xdotci"),
@@ -99,7 +102,8 @@ rocsparse_status rocsparse_dotci_template(rocsparse_handle     handle,
 
 #define DOTCI_DIM 256
     // Get workspace from handle device buffer
-    T* workspace = reinterpret_cast<T*>(handle->buffer);
+    T* workspace;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&workspace));
 
     hipLaunchKernelGGL((dotci_kernel_part1<DOTCI_DIM>),
                        dim3(DOTCI_DIM),
@@ -133,7 +137,7 @@ rocsparse_status rocsparse_dotci_template(rocsparse_handle     handle,
                            workspace,
                            (T*)nullptr);
 
-        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(result, workspace, sizeof(T)));
     }
 #undef DOTCI_DIM
 
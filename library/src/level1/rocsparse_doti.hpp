@@ -45,6 +45,9 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xdoti"),
@@ -98,7 +101,8 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
 
 #define DOTI_DIM 256
     // Get workspace from handle device buffer
-    T* workspace = reinterpret_cast<T*>(handle->buffer);
+    T* workspace;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&workspace));
 
     hipLaunchKernelGGL((doti_kernel_part1<DOTI_DIM>),
                        dim3(DOTI_DIM),
@@ -127,7 +131,7 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
                            workspace,
                            (T*)nullptr);
 
-        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(result, workspace, sizeof(T)));
     }
 #undef DOTI_DIM
 
@@ -63,6 +63,9 @@ rocsparse_status rocsparse_roti_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging // TODO bench logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xroti"),
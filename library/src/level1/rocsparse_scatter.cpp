@@ -54,6 +54,9 @@ extern "C" rocsparse_status rocsparse_scatter(rocsparse_handle            handle
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_scatter", (const void*&)x, (const void*&)y);
 
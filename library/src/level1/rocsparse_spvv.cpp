@@ -129,6 +129,9 @@ extern "C" rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_spvv",
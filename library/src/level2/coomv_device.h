@@ -384,4 +384,44 @@ static __device__ void coomvn_aos_general_wf_reduce(I                    nnz,
     }
 }
 
+// Symmetric and hermitian storage: y = y + alpha * op(A) * x, where only the
+// stored triangle of A is read. Off-diagonal entries contribute to both rows.
+template <typename I, typename T>
+__device__ void coomv_symm_device(I                    nnz,
+                                  T                    alpha,
+                                  const I*             coo_row_ind,
+                                  const I*             coo_col_ind,
+                                  const T*             coo_val,
+                                  const T*             x,
+                                  T*                   y,
+                                  rocsparse_index_base idx_base,
+                                  rocsparse_fill_mode  fill_mode,
+                                  bool                 conj_stored,
+                                  bool                 conj_mirror)
+{
+    I gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    I row = coo_row_ind[gid] - idx_base;
+    I col = coo_col_ind[gid] - idx_base;
+
+    if((fill_mode == rocsparse_fill_mode_lower) ? (col > row) : (col < row))
+    {
+        return;
+    }
+
+    T val = coo_val[gid];
+
+    atomicAdd(y + row, alpha * (conj_stored ? rocsparse_conj(val) : val) * x[col]);
+
+    if(col != row)
+    {
+        atomicAdd(y + col, alpha * (conj_mirror ? rocsparse_conj(val) : val) * x[row]);
+    }
+}
+
 #endif // COOMV_DEVICE_H
@@ -0,0 +1,87 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR16MV_DEVICE_H
+#define CSR16MV_DEVICE_H
+
+#include "common.h"
+
+// CSR16 SpMV for general, non-transposed matrices. Each wavefront processes one row,
+// column indices are the base column of the row plus the 16 bit column offsets.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename T>
+static __device__ void csr16mvn_general_device(I                    m,
+                                               T                    alpha,
+                                               const I*             csr16_row_ptr,
+                                               const I*             csr16_row_base,
+                                               const uint16_t*      csr16_col_off,
+                                               const T*             csr16_val,
+                                               const T*             x,
+                                               T                    beta,
+                                               T*                   y,
+                                               rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    I nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(I row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        I row_start = csr16_row_ptr[row] - idx_base;
+        I row_end   = csr16_row_ptr[row + 1] - idx_base;
+
+        // Shift x to the base column of the row
+        const T* xb = x + (csr16_row_base[row] - idx_base);
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(rocsparse_nontemporal_load(csr16_val + j),
+                                rocsparse_ldg(xb + rocsparse_nontemporal_load(csr16_col_off + j)),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = alpha * sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+            }
+        }
+    }
+}
+
+#endif // CSR16MV_DEVICE_H
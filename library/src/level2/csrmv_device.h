@@ -27,17 +27,26 @@
 #define CSRMV_DEVICE_H
 
 #include "common.h"
+#include "csrmv_merge_path.h"
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+// y = beta * y + alpha * A * x, each wavefront processes one row of A. Matrix values of
+// type A are converted to the compute type T before they are accumulated.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename T>
 static __device__ void csrmvn_general_device(J                    m,
                                              T                    alpha,
                                              const I*             row_offset,
                                              const J*             csr_col_ind,
-                                             const T*             csr_val,
+                                             const A*             csr_val,
                                              const T*             x,
                                              T                    beta,
                                              T*                   y,
-                                             rocsparse_index_base idx_base)
+                                             rocsparse_index_base idx_base,
+                                             bool                 conj)
 {
     int lid = hipThreadIdx_x & (WF_SIZE - 1);
 
@@ -56,8 +65,8 @@ static __device__ void csrmvn_general_device(J                    m,
         // Loop over non-zero elements
         for(I j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            sum = rocsparse_fma(
-                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+            T val = rocsparse_convert<T>(conj ? rocsparse_conj(csr_val[j]) : csr_val[j]);
+            sum   = rocsparse_fma(alpha * val, rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
         }
 
         // Obtain row sum using parallel reduction
@@ -78,6 +87,226 @@ static __device__ void csrmvn_general_device(J                    m,
     }
 }
 
+// Strided batched y_b = alpha * A_b * x_b + beta * y_b, where all matrices A_b share
+// the sparsity pattern. Each wavefront processes one row for BATCH_CHUNK batches, such
+// that row offsets and column indices are loaded once per chunk of batches.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          unsigned int BATCH_CHUNK,
+          typename I,
+          typename J,
+          typename T>
+static __device__ void csrmvn_strided_batched_device(J                    m,
+                                                     int                  batch_count,
+                                                     T                    alpha,
+                                                     const I*             row_offset,
+                                                     const J*             csr_col_ind,
+                                                     const T*             csr_val,
+                                                     int64_t              val_batch_stride,
+                                                     const T*             x,
+                                                     int64_t              x_batch_stride,
+                                                     T                    beta,
+                                                     T*                   y,
+                                                     int64_t              y_batch_stride,
+                                                     rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // First batch of this chunk
+    int          batch_begin = hipBlockIdx_y * BATCH_CHUNK;
+    unsigned int nbatch
+        = min(BATCH_CHUNK, static_cast<unsigned int>(batch_count - batch_begin));
+
+    // Shift pointers to the first batch of this chunk
+    csr_val += batch_begin * val_batch_stride;
+    x += batch_begin * x_batch_stride;
+    y += batch_begin * y_batch_stride;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T sum[BATCH_CHUNK];
+
+        for(unsigned int b = 0; b < BATCH_CHUNK; ++b)
+        {
+            sum[b] = static_cast<T>(0);
+        }
+
+        // Loop over non-zero elements
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            // Column index is shared by all batches
+            J col = csr_col_ind[j] - idx_base;
+
+            for(unsigned int b = 0; b < BATCH_CHUNK; ++b)
+            {
+                if(b < nbatch)
+                {
+                    sum[b] = rocsparse_fma(alpha * csr_val[b * val_batch_stride + j],
+                                           rocsparse_ldg(x + b * x_batch_stride + col),
+                                           sum[b]);
+                }
+            }
+        }
+
+        for(unsigned int b = 0; b < BATCH_CHUNK; ++b)
+        {
+            if(b < nbatch)
+            {
+                // Obtain row sum using parallel reduction
+                T val = rocsparse_wfreduce_sum<WF_SIZE>(sum[b]);
+
+                // First thread of each wavefront writes result into global memory
+                if(lid == WF_SIZE - 1)
+                {
+                    T* yb = y + b * y_batch_stride;
+
+                    if(beta == static_cast<T>(0))
+                    {
+                        yb[row] = val;
+                    }
+                    else
+                    {
+                        yb[row] = rocsparse_fma(beta, yb[row], val);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// y_out = alpha * A * x + beta * y_in, fused with the partial sums of the dot product
+// <x_dot, y_out> and the squared norm ||y_out||^2 of each block. The dot product is
+// skipped if x_dot is a nullptr. Rows are assigned to wavefronts and reduced in a fixed
+// order, such that the partial sums are reproducible.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+static __device__ void csrmvn_fused_device(J                    m,
+                                           T                    alpha,
+                                           const I*             row_offset,
+                                           const J*             csr_col_ind,
+                                           const T*             csr_val,
+                                           const T*             x,
+                                           const T*             x_dot,
+                                           T                    beta,
+                                           const T*             y_in,
+                                           T*                   y_out,
+                                           T*                   workspace,
+                                           rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    int lid = tid & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    T dot  = static_cast<T>(0);
+    T nrm2 = static_cast<T>(0);
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(
+                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory and keeps
+        // the contributions to the reductions in registers
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta != static_cast<T>(0))
+            {
+                sum = rocsparse_fma(beta, y_in[row], sum);
+            }
+
+            y_out[row] = sum;
+
+            if(x_dot != nullptr)
+            {
+                dot = rocsparse_fma(rocsparse_conj(x_dot[row]), sum, dot);
+            }
+
+            nrm2 = rocsparse_fma(rocsparse_conj(sum), sum, nrm2);
+        }
+    }
+
+    __shared__ T sdot[BLOCKSIZE];
+    __shared__ T snrm2[BLOCKSIZE];
+
+    sdot[tid]  = dot;
+    snrm2[tid] = nrm2;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdot);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snrm2);
+
+    // Partial sums of this block
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x]                = sdot[0];
+        workspace[hipGridDim_x + hipBlockIdx_x] = snrm2[0];
+    }
+}
+
+// Sums up the partial results of each block in a fixed order
+template <unsigned int BLOCKSIZE, typename T>
+static __device__ void csrmvn_fused_reduce_device(int nblocks, const T* workspace, T* dot, T* nrm2)
+{
+    int tid = hipThreadIdx_x;
+
+    __shared__ T sdot[BLOCKSIZE];
+    __shared__ T snrm2[BLOCKSIZE];
+
+    T sum_dot  = static_cast<T>(0);
+    T sum_nrm2 = static_cast<T>(0);
+
+    for(int i = tid; i < nblocks; i += BLOCKSIZE)
+    {
+        sum_dot  = sum_dot + workspace[i];
+        sum_nrm2 = sum_nrm2 + workspace[nblocks + i];
+    }
+
+    sdot[tid]  = sum_dot;
+    snrm2[tid] = sum_nrm2;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdot);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snrm2);
+
+    if(tid == 0)
+    {
+        if(dot != nullptr)
+        {
+            *dot = sdot[0];
+        }
+
+        if(nrm2 != nullptr)
+        {
+            *nrm2 = snrm2[0];
+        }
+    }
+}
+
 template <typename I, typename T>
 static inline __device__ T sum2_reduce(T cur_sum, T* partial, int lid, I max_size, int reduc_size)
 {
@@ -410,4 +639,501 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
     }
 }
 
+// Symmetric and hermitian storage: y = beta * y + alpha * op(A_tri) * x, where
+// A_tri is the stored triangle of A including its diagonal. Entries of the other
+// triangle are ignored.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+static __device__ void csrmvn_symm_device(J                    m,
+                                          T                    alpha,
+                                          const I*             row_offset,
+                                          const J*             csr_col_ind,
+                                          const T*             csr_val,
+                                          const T*             x,
+                                          T                    beta,
+                                          T*                   y,
+                                          rocsparse_index_base idx_base,
+                                          rocsparse_fill_mode  fill_mode,
+                                          bool                 conj)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements of the stored triangle
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            J col = csr_col_ind[j] - idx_base;
+
+            if((fill_mode == rocsparse_fill_mode_lower) ? (col > row) : (col < row))
+            {
+                continue;
+            }
+
+            T val = conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+            sum   = rocsparse_fma(alpha * val, rocsparse_ldg(x + col), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// Symmetric and hermitian storage: y = y + alpha * op(A_tri)^T * x, where A_tri
+// is the stored triangle of A without its diagonal.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+static __device__ void csrmvt_symm_device(J                    m,
+                                          T                    alpha,
+                                          const I*             row_offset,
+                                          const J*             csr_col_ind,
+                                          const T*             csr_val,
+                                          const T*             x,
+                                          T*                   y,
+                                          rocsparse_index_base idx_base,
+                                          rocsparse_fill_mode  fill_mode,
+                                          bool                 conj)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T xr = alpha * rocsparse_ldg(x + row);
+
+        // Scatter the strictly triangular part of the row
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            J col = csr_col_ind[j] - idx_base;
+
+            if((fill_mode == rocsparse_fill_mode_lower) ? (col < row) : (col > row))
+            {
+                T val = conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+                atomicAdd(y + col, val * xr);
+            }
+        }
+    }
+}
+
+// Scale kernel for transposed operations, y has n entries
+template <typename I, typename T>
+static __device__ void csrmvt_scale_device(I size, T beta, T* __restrict__ data)
+{
+    I gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        data[gid] = static_cast<T>(0);
+    }
+    else
+    {
+        data[gid] = data[gid] * beta;
+    }
+}
+
+// y = y + alpha * op(A) * x for transposed operations without analysis data. Each
+// wavefront scatters one row of A.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename T>
+static __device__ void csrmvt_general_device(J                    m,
+                                             T                    alpha,
+                                             const I*             row_offset,
+                                             const J*             csr_col_ind,
+                                             const A*             csr_val,
+                                             const T*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base,
+                                             bool                 conj)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T xr = alpha * rocsparse_ldg(x + row);
+
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T val = rocsparse_convert<T>(conj ? rocsparse_conj(csr_val[j]) : csr_val[j]);
+            atomicAdd(y + csr_col_ind[j] - idx_base, val * xr);
+        }
+    }
+}
+
+// y = beta * y + alpha * op(A) * x for transposed operations using the CSC structure
+// gathered during analysis. Each wavefront processes one column of A, values are
+// read through the permutation from the CSR value array.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+static __device__ void csrmvt_csc_device(J        n,
+                                         T        alpha,
+                                         const I* csc_col_ptr,
+                                         const J* csc_row_ind,
+                                         const I* csc_perm,
+                                         const T* csr_val,
+                                         const T* x,
+                                         T        beta,
+                                         T*       y,
+                                         bool     conj)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over columns
+    for(J col = gid / WF_SIZE; col < n; col += nwf)
+    {
+        I col_start = csc_col_ptr[col];
+        I col_end   = csc_col_ptr[col + 1];
+
+        T sum = static_cast<T>(0);
+
+        for(I j = col_start + lid; j < col_end; j += WF_SIZE)
+        {
+            T val = csr_val[csc_perm[j]];
+            val   = conj ? rocsparse_conj(val) : val;
+            sum   = rocsparse_fma(alpha * val, rocsparse_ldg(x + csc_row_ind[j]), sum);
+        }
+
+        // Obtain column sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[col] = sum;
+            }
+            else
+            {
+                y[col] = rocsparse_fma(beta, y[col], sum);
+            }
+        }
+    }
+}
+
+// Analysis of transposed operations: row index and identity permutation of each entry.
+// Each thread processes one entry and searches its row, such that long rows do not
+// serialize the analysis.
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_analysis_init_kernel(J m,
+                                     I nnz,
+                                     const I* __restrict__ csr_row_ptr,
+                                     rocsparse_index_base idx_base,
+                                     I* __restrict__ perm,
+                                     J* __restrict__ rows)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    // Binary search for the last row starting at or before the entry
+    J left  = 0;
+    J right = m;
+
+    while(right - left > 1)
+    {
+        J mid = left + ((right - left) >> 1);
+
+        if(csr_row_ptr[mid] - idx_base <= gid)
+        {
+            left = mid;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    perm[gid] = gid;
+    rows[gid] = left;
+}
+
+// Analysis of transposed operations: number of entries per column
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_analysis_count_kernel(I nnz,
+                                      const J* __restrict__ csr_col_ind,
+                                      rocsparse_index_base idx_base,
+                                      I* __restrict__ csc_col_ptr)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    atomicAdd(csc_col_ptr + csr_col_ind[gid] - idx_base + 1, static_cast<I>(1));
+}
+
+// Analysis of transposed operations: row indices of the CSC entries
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_analysis_gather_kernel(I nnz,
+                                       const I* __restrict__ csc_perm,
+                                       const J* __restrict__ rows,
+                                       J* __restrict__ csc_row_ind)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csc_row_ind[gid] = rows[csc_perm[gid]];
+}
+
+// Merge path analysis: each thread searches the start coordinates of one of the
+// ntiles + 1 tile boundaries on the merge path of the row ends and non-zero entries
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_analysis_kernel(J       m,
+                                      I       nnz,
+                                      int64_t ntiles,
+                                      const I* __restrict__ csr_row_ptr,
+                                      rocsparse_index_base idx_base,
+                                      J* __restrict__ tile_row,
+                                      I* __restrict__ tile_nnz)
+{
+    int64_t tile = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile > ntiles)
+    {
+        return;
+    }
+
+    int64_t diagonal = min(tile * CSRMV_MERGE_TILE_ITEMS, static_cast<int64_t>(m) + nnz);
+
+    J row = csrmv_merge_path_search(
+        diagonal, csr_row_ptr + 1, m, static_cast<I>(0), nnz, static_cast<I>(idx_base));
+
+    tile_row[tile] = row;
+    tile_nnz[tile] = static_cast<I>(diagonal - row);
+}
+
+// y = beta * y + alpha * A * x, each block processes one tile of the merge path, such
+// that all blocks consume the same number of row ends and non-zero entries, independent
+// of the row lengths. Rows that end within the tile are written, the partial sum of the
+// row that continues in the next tile is stored in tile_carry.
+template <unsigned int BLOCKSIZE, unsigned int ITEMS, typename I, typename J, typename T>
+static __device__ void csrmvn_merge_device(T alpha,
+                                           const J* __restrict__ tile_row,
+                                           const I* __restrict__ tile_nnz,
+                                           T* __restrict__ tile_carry,
+                                           const I* __restrict__ csr_row_ptr,
+                                           const J* __restrict__ csr_col_ind,
+                                           const T* __restrict__ csr_val,
+                                           const T* __restrict__ x,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    int tid  = hipThreadIdx_x;
+    J   tile = hipBlockIdx_x;
+
+    __shared__ I s_row_end[BLOCKSIZE * ITEMS + 1];
+    __shared__ T s_val[BLOCKSIZE * ITEMS];
+    __shared__ J s_carry_row[BLOCKSIZE];
+    __shared__ T s_carry_val[BLOCKSIZE];
+
+    // Start coordinates of this tile and the next one
+    J row_begin = tile_row[tile];
+    I nnz_begin = tile_nnz[tile];
+    J nrows     = tile_row[tile + 1] - row_begin;
+    I nnz       = tile_nnz[tile + 1] - nnz_begin;
+
+    // Row ends relative to the first entry of the tile, the row that continues in the
+    // next tile ends behind the last entry of the tile
+    for(J i = tid; i < nrows; i += BLOCKSIZE)
+    {
+        s_row_end[i] = csr_row_ptr[row_begin + i + 1] - idx_base - nnz_begin;
+    }
+
+    if(tid == 0)
+    {
+        s_row_end[nrows] = nnz;
+    }
+
+    // Products of the entries of the tile
+    for(I j = tid; j < nnz; j += BLOCKSIZE)
+    {
+        I idx = nnz_begin + j;
+
+        s_val[j] = csr_val[idx] * rocsparse_ldg(x + csr_col_ind[idx] - idx_base);
+    }
+
+    __syncthreads();
+
+    // Each thread consumes up to ITEMS items, starting at its diagonal of the tile
+    int64_t nitems   = static_cast<int64_t>(nrows) + nnz;
+    int64_t diag     = min(static_cast<int64_t>(tid) * ITEMS, nitems);
+    int64_t diag_end = min(diag + ITEMS, nitems);
+
+    J row = csrmv_merge_path_search(
+        diag, s_row_end, nrows, static_cast<I>(0), nnz, static_cast<I>(0));
+    I j = static_cast<I>(diag - row);
+
+    // The first row that ends in this thread might have been started by the previous
+    // threads, it is written once their partial sums are known
+    J    head     = row;
+    bool has_head = false;
+    T    head_sum = static_cast<T>(0);
+    T    sum      = static_cast<T>(0);
+
+    for(int64_t d = diag; d < diag_end; ++d)
+    {
+        if(j < s_row_end[row])
+        {
+            sum += s_val[j++];
+        }
+        else
+        {
+            if(has_head)
+            {
+                J r = row_begin + row;
+
+                if(beta == static_cast<T>(0))
+                {
+                    y[r] = alpha * sum;
+                }
+                else
+                {
+                    y[r] = rocsparse_fma(beta, y[r], alpha * sum);
+                }
+            }
+            else
+            {
+                has_head = true;
+                head_sum = sum;
+            }
+
+            sum = static_cast<T>(0);
+            ++row;
+        }
+    }
+
+    // Partial sum of the row this thread ends in
+    s_carry_row[tid] = row;
+    s_carry_val[tid] = sum;
+
+    __syncthreads();
+
+    if(has_head)
+    {
+        for(int k = tid - 1; k >= 0 && s_carry_row[k] == head; --k)
+        {
+            head_sum += s_carry_val[k];
+        }
+
+        J r = row_begin + head;
+
+        if(beta == static_cast<T>(0))
+        {
+            y[r] = alpha * head_sum;
+        }
+        else
+        {
+            y[r] = rocsparse_fma(beta, y[r], alpha * head_sum);
+        }
+    }
+
+    // Partial sum of the row that continues in the next tile
+    if(tid == BLOCKSIZE - 1)
+    {
+        T carry = static_cast<T>(0);
+
+        for(int k = BLOCKSIZE - 1; k >= 0 && s_carry_row[k] == nrows; --k)
+        {
+            carry += s_carry_val[k];
+        }
+
+        tile_carry[tile] = carry;
+    }
+}
+
+// Adds the partial sums of rows that span multiple tiles. The first tile that ends in a
+// row sums the partial sums of all tiles ending in that row, such that no atomics are
+// required and the result is deterministic.
+template <unsigned int BLOCKSIZE, typename J, typename T>
+static __device__ void csrmvn_merge_fixup_device(J       m,
+                                                 int64_t ntiles,
+                                                 T       alpha,
+                                                 const J* __restrict__ tile_row,
+                                                 const T* __restrict__ tile_carry,
+                                                 T* __restrict__ y)
+{
+    int64_t tile = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+    if(tile >= ntiles)
+    {
+        return;
+    }
+
+    J row = tile_row[tile + 1];
+
+    if(row >= m || (tile > 0 && tile_row[tile] == row))
+    {
+        return;
+    }
+
+    T sum = static_cast<T>(0);
+
+    for(int64_t t = tile; t < ntiles && tile_row[t + 1] == row; ++t)
+    {
+        sum += tile_carry[t];
+    }
+
+    y[row] = rocsparse_fma(alpha, sum, y[row]);
+}
+
 #endif // CSRMV_DEVICE_H
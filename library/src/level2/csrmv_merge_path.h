@@ -0,0 +1,113 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMV_MERGE_PATH_H
+#define CSRMV_MERGE_PATH_H
+
+#include "rocsparse-types.h"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+
+// Number of merge items processed by each thread and block. An item is either a
+// non-zero entry or the end of a row, such that each tile covers the same amount of
+// work, independent of the row lengths.
+#define CSRMV_MERGE_DIM 256
+#define CSRMV_MERGE_ITEMS_PER_THREAD 4
+#define CSRMV_MERGE_TILE_ITEMS (CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD)
+
+// Merge path search along a diagonal of the merge of the row ends and the indices of
+// the non-zero entries. The row ends are given by row_end[0, nrows), the indices of
+// the non-zero entries are nnz_begin + [0, nnz). Returns the number of row ends on the
+// path before the diagonal, the number of non-zero entries is diagonal minus the
+// returned value.
+template <typename I, typename J>
+__host__ __device__ static inline J csrmv_merge_path_search(
+    int64_t diagonal, const I* row_end, J nrows, I nnz_begin, I nnz, I idx_base)
+{
+    J x_min = (diagonal > nnz) ? static_cast<J>(diagonal - nnz) : static_cast<J>(0);
+    J x_max = (diagonal < nrows) ? static_cast<J>(diagonal) : nrows;
+
+    while(x_min < x_max)
+    {
+        J pivot = x_min + (x_max - x_min) / 2;
+
+        if(row_end[pivot] - idx_base <= nnz_begin + static_cast<I>(diagonal - pivot - 1))
+        {
+            x_min = pivot + 1;
+        }
+        else
+        {
+            x_max = pivot;
+        }
+    }
+
+    return x_min;
+}
+
+// Number of tiles of the merge path of a m x n matrix with nnz entries
+template <typename I, typename J>
+static inline int64_t csrmv_merge_path_ntiles(J m, I nnz, int64_t tile_items)
+{
+    int64_t nitems = static_cast<int64_t>(m) + nnz;
+
+    return (nitems > 0) ? (nitems - 1) / tile_items + 1 : 0;
+}
+
+// Host side tile builder, computes the start coordinates of all ntiles + 1 tile
+// boundaries on the merge path. Tile t processes the rows [tile_row[t], tile_row[t + 1])
+// and the non-zero entries [tile_nnz[t], tile_nnz[t + 1]), where the row tile_row[t + 1]
+// might be partially processed.
+template <typename I, typename J>
+static void csrmv_merge_path_tiles(J                    m,
+                                   I                    nnz,
+                                   const I*             csr_row_ptr,
+                                   rocsparse_index_base idx_base,
+                                   int64_t              tile_items,
+                                   J*                   tile_row,
+                                   I*                   tile_nnz)
+{
+    int64_t nitems = static_cast<int64_t>(m) + nnz;
+    int64_t ntiles = csrmv_merge_path_ntiles(m, nnz, tile_items);
+
+    for(int64_t t = 0; t <= ntiles; ++t)
+    {
+        int64_t diagonal = std::min(t * tile_items, nitems);
+
+        J row = csrmv_merge_path_search(diagonal,
+                                        csr_row_ptr + 1,
+                                        m,
+                                        static_cast<I>(0),
+                                        nnz,
+                                        static_cast<I>(idx_base));
+
+        tile_row[t] = row;
+        tile_nnz[t] = static_cast<I>(diagonal - row);
+    }
+}
+
+#endif // CSRMV_MERGE_PATH_H
@@ -0,0 +1,750 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMV_ROW_BLOCKS_H
+#define CSRMV_ROW_BLOCKS_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#define BLOCK_SIZE 1024
+#define BLOCK_MULTIPLIER 3
+#define ROWS_FOR_VECTOR 1
+#define WG_SIZE 256
+
+__attribute__((unused)) static unsigned int flp2(unsigned int x)
+{
+    x |= (x >> 1);
+    x |= (x >> 2);
+    x |= (x >> 4);
+    x |= (x >> 8);
+    x |= (x >> 16);
+    return x - (x >> 1);
+}
+
+// Short rows in CSR-Adaptive are batched together into a single row block.
+// If there are a relatively small number of these, then we choose to do
+// a horizontal reduction (groups of threads all reduce the same row).
+// If there are many threads (e.g. more threads than the maximum size
+// of our workgroup) then we choose to have each thread serially reduce
+// the row.
+// This function calculates the number of threads that could team up
+// to reduce these groups of rows. For instance, if you have a
+// workgroup size of 256 and 4 rows, you could have 64 threads
+// working on each row. If you have 5 rows, only 32 threads could
+// reliably work on each row because our reduction assumes power-of-2.
+static unsigned long long numThreadsForReduction(unsigned long long num_rows)
+{
+#if defined(__INTEL_COMPILER)
+    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
+#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
+    || !defined(__clang) && defined(__GNUG__)             \
+           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
+    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+    unsigned long long bit_returned;
+    _BitScanReverse(&bit_returned, (num_rows - 1));
+    return WG_SIZE >> (bit_returned + 1);
+#else
+    return flp2(WG_SIZE / num_rows);
+#endif
+}
+
+template <typename I, typename J>
+static inline void ComputeRowBlocks(I*       rowBlocks,
+                                    J*       wgIds,
+                                    size_t&  rowBlockSize,
+                                    const I* rowDelimiters,
+                                    I        nRows,
+                                    bool     allocate_row_blocks = true)
+{
+    I* rowBlocksBase;
+
+    // Start at one because of rowBlock[0]
+    I total_row_blocks = 1;
+
+    if(allocate_row_blocks)
+    {
+        rowBlocksBase = rowBlocks;
+        *rowBlocks    = 0;
+        *wgIds        = 0;
+        ++rowBlocks;
+        ++wgIds;
+    }
+
+    I sum = 0;
+    I i;
+    I last_i = 0;
+
+    I consecutive_long_rows = 0;
+    for(i = 1; i <= nRows; ++i)
+    {
+        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+        sum += row_length;
+
+        // The following section of code calculates whether you're moving between
+        // a series of "short" rows and a series of "long" rows.
+        // This is because the reduction in CSR-Adaptive likes things to be
+        // roughly the same length. Long rows can be reduced horizontally.
+        // Short rows can be reduced one-thread-per-row. Try not to mix them.
+        if(row_length > 128)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            // If it turns out we WERE in a long-row region, cut if off now.
+            if(row_length < 32) // Now we're in a short-row region
+            {
+                consecutive_long_rows = -1;
+            }
+            else
+            {
+                consecutive_long_rows++;
+            }
+        }
+
+        // If you just entered into a "long" row from a series of short rows,
+        // then we need to make sure we cut off those short rows. Put them in
+        // their own workgroup.
+        if(consecutive_long_rows == 1)
+        {
+            // Assuming there *was* a previous workgroup. If not, nothing to do here.
+            if(i - last_i > 1)
+            {
+                if(allocate_row_blocks)
+                {
+                    *rowBlocks = i - 1;
+
+                    // If this row fits into CSR-Stream, calculate how many rows
+                    // can be used to do a parallel reduction.
+                    // Fill in the low-order bits with the numThreadsForRed
+                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                    {
+                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
+                    }
+
+                    ++rowBlocks;
+                    ++wgIds;
+                }
+
+                ++total_row_blocks;
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        else if(consecutive_long_rows == -1)
+        {
+            // We see the first short row after some long ones that
+            // didn't previously fill up a row block.
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i - 1;
+                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        // Now, what's up with this row? What did it do?
+
+        // exactly one row results in non-zero elements to be greater than blockSize
+        // This is csr-vector case;
+        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            I numWGReq = static_cast<I>(
+                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+
+            // Check to ensure #workgroups can fit in 32 bits, if not
+            // then the last workgroup will do all the remaining work
+            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
+            numWGReq = (numWGReq < static_cast<I>(std::pow(2, 31) - 1))
+                           ? numWGReq
+                           : static_cast<I>(std::pow(2, 31) - 1);
+
+            if(allocate_row_blocks)
+            {
+                for(I w = 1; w < numWGReq; ++w)
+                {
+                    *rowBlocks = (i - 1);
+                    *wgIds |= static_cast<J>(w);
+
+                    ++rowBlocks;
+                    ++wgIds;
+                }
+
+                *rowBlocks = i;
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            total_row_blocks += numWGReq;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // more than one row results in non-zero elements to be greater than blockSize
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
+        {
+            // This row won't fit, so back off one.
+            --i;
+
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i;
+                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if(sum == static_cast<I>(BLOCK_SIZE))
+        {
+            if(allocate_row_blocks)
+            {
+                *rowBlocks = i;
+                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                {
+                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
+                }
+
+                ++rowBlocks;
+                ++wgIds;
+            }
+
+            ++total_row_blocks;
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    // If we didn't fill a row block with the last row, make sure we don't lose it.
+    if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
+    {
+        *rowBlocks = nRows;
+        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            *(wgIds - 1) |= numThreadsForReduction(i - last_i);
+        }
+
+        ++rowBlocks;
+        ++wgIds;
+    }
+
+    ++total_row_blocks;
+
+    if(allocate_row_blocks)
+    {
+        size_t dist = std::distance(rowBlocksBase, rowBlocks);
+
+        assert((dist) <= rowBlockSize);
+        // Update the size of rowBlocks to reflect the actual amount of memory used
+        rowBlockSize = dist;
+    }
+    else
+    {
+        rowBlockSize = total_row_blocks;
+    }
+}
+
+/********************************************************************************
+ * \brief csrmv_row_blocks_state holds the state of ComputeRowBlocks in between
+ * two rows. The number of non-zeros of the current row block is redundant, it
+ * always equals rowDelimiters[i] - rowDelimiters[last_i].
+ *******************************************************************************/
+template <typename I>
+struct csrmv_row_blocks_state
+{
+    // Row at which the current row block starts
+    I last_i;
+    // Number of non-zeros of the current row block
+    I sum;
+    // Length of the current series of long rows
+    I consecutive_long_rows;
+
+    bool operator==(const csrmv_row_blocks_state& x) const
+    {
+        return last_i == x.last_i && sum == x.sum
+               && consecutive_long_rows == x.consecutive_long_rows;
+    }
+};
+
+/********************************************************************************
+ * \brief csrmv_row_blocks_step processes row i - 1 exactly like a single
+ * iteration of ComputeRowBlocks and returns the next iteration. New row blocks
+ * are passed to out.block(), reduction bits of the previous row block are passed
+ * to out.reduce().
+ *******************************************************************************/
+template <typename I, typename J, typename W>
+static inline I csrmv_row_blocks_step(const I*                   rowDelimiters,
+                                      I                          i,
+                                      csrmv_row_blocks_state<I>& s,
+                                      W&                         out)
+{
+    I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+    s.sum += row_length;
+
+    // See ComputeRowBlocks for the transitions between short and long rows
+    if(row_length > 128)
+    {
+        ++s.consecutive_long_rows;
+    }
+    else if(s.consecutive_long_rows > 0)
+    {
+        if(row_length < 32)
+        {
+            s.consecutive_long_rows = -1;
+        }
+        else
+        {
+            s.consecutive_long_rows++;
+        }
+    }
+
+    if(s.consecutive_long_rows == 1)
+    {
+        if(i - s.last_i > 1)
+        {
+            if(((i - 1) - s.last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+            {
+                out.reduce(static_cast<J>(numThreadsForReduction((i - 1) - s.last_i)));
+            }
+
+            out.block(i - 1, 0);
+
+            s.last_i = i - 1;
+            s.sum    = row_length;
+        }
+    }
+    else if(s.consecutive_long_rows == -1)
+    {
+        if(((i - 1) - s.last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            out.reduce(static_cast<J>(numThreadsForReduction((i - 1) - s.last_i)));
+        }
+
+        out.block(i - 1, 0);
+
+        s.last_i                = i - 1;
+        s.sum                   = row_length;
+        s.consecutive_long_rows = 0;
+    }
+
+    if((i - s.last_i == 1) && s.sum > static_cast<I>(BLOCK_SIZE))
+    {
+        // csr-vector case
+        I numWGReq = static_cast<I>(
+            std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+
+        numWGReq = (numWGReq < static_cast<I>(std::pow(2, 31) - 1))
+                       ? numWGReq
+                       : static_cast<I>(std::pow(2, 31) - 1);
+
+        for(I w = 1; w < numWGReq; ++w)
+        {
+            out.block(i - 1, static_cast<J>(w));
+        }
+
+        out.block(i, 0);
+
+        s.last_i                = i;
+        s.sum                   = 0;
+        s.consecutive_long_rows = 0;
+    }
+    else if((i - s.last_i > 1) && s.sum > static_cast<I>(BLOCK_SIZE))
+    {
+        // csr-stream case, this row won't fit, so back off one
+        --i;
+
+        if((i - s.last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            out.reduce(static_cast<J>(numThreadsForReduction(i - s.last_i)));
+        }
+
+        out.block(i, 0);
+
+        s.last_i                = i;
+        s.sum                   = 0;
+        s.consecutive_long_rows = 0;
+    }
+    else if(s.sum == static_cast<I>(BLOCK_SIZE))
+    {
+        // csr-stream case
+        if((i - s.last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            out.reduce(static_cast<J>(numThreadsForReduction(i - s.last_i)));
+        }
+
+        out.block(i, 0);
+
+        s.last_i                = i;
+        s.sum                   = 0;
+        s.consecutive_long_rows = 0;
+    }
+
+    return i + 1;
+}
+
+/********************************************************************************
+ * \brief csrmv_row_blocks_builder computes the same row blocks and workgroup ids
+ * as ComputeRowBlocks, using multiple host threads.
+ *
+ * The rows are split into chunks. In the first pass, each chunk is processed
+ * speculatively, starting as if a row block ended right before the chunk, and
+ * only the number of row blocks, the final state and the first states after a
+ * new row block are kept. The true state at the start of each chunk is then
+ * determined in order: if it differs from the speculative one, the chunk is
+ * processed from its true state until both runs reach an identical state, from
+ * which on the speculative results are exact. An exclusive scan of the chunk
+ * sizes gives the output offsets, and the second pass writes the row blocks of
+ * all chunks in parallel, starting from their true states. The output buffers
+ * are provided by the caller, no memory proportional to the matrix size is
+ * allocated.
+ *******************************************************************************/
+template <typename I, typename J>
+class csrmv_row_blocks_builder
+{
+public:
+    // Number of states recorded per chunk to detect convergence
+    static constexpr int num_records = 64;
+
+    /// First pass, returns the number of row blocks. The rows are split into at most
+    /// nchunks chunks of at least min_chunk_rows rows.
+    size_t plan(const I* rowDelimiters, I nRows, int nchunks, I min_chunk_rows = 65536);
+
+    /// Second pass, fills rowBlocks and wgIds of size returned by plan(). The row
+    /// delimiters must hold the same values as in plan(), but may have been moved.
+    void fill(const I* rowDelimiters, I* rowBlocks, J* wgIds) const;
+
+    /// Number of chunks that have been used.
+    int chunks() const
+    {
+        return static_cast<int>(chunks_.size());
+    }
+
+private:
+    // Counts row blocks
+    struct counter
+    {
+        size_t size = 0;
+
+        void block(I, J)
+        {
+            ++size;
+        }
+
+        void reduce(J) {}
+    };
+
+    // Writes row blocks starting at pos, bits that belong to the row block in
+    // front of pos are collected in carry
+    struct writer
+    {
+        I*     row_blocks;
+        J*     wg_ids;
+        size_t begin;
+        size_t pos;
+        J      carry;
+
+        void block(I row, J bits)
+        {
+            row_blocks[pos] = row;
+            wg_ids[pos]     = bits;
+            ++pos;
+        }
+
+        void reduce(J bits)
+        {
+            if(pos == begin)
+            {
+                carry |= bits;
+            }
+            else
+            {
+                wg_ids[pos - 1] |= bits;
+            }
+        }
+    };
+
+    // State after a new row block, used to detect convergence
+    struct record
+    {
+        I                         next;
+        csrmv_row_blocks_state<I> state;
+        size_t                    size;
+    };
+
+    struct chunk
+    {
+        // Rows begin - 1 to end - 1
+        I begin;
+        I end;
+
+        // Speculative run
+        csrmv_row_blocks_state<I> spec_start;
+        csrmv_row_blocks_state<I> spec_end;
+        size_t                    spec_size;
+        record                    records[num_records];
+        int                       nrecords;
+
+        // True run
+        csrmv_row_blocks_state<I> start;
+        size_t                    size;
+        size_t                    offset;
+        J                         carry;
+    };
+
+    // Run f(c) for each chunk, one thread per chunk
+    template <typename F>
+    static void parallel_for(int n, F f);
+
+    I                  nRows_  = 0;
+    I                  last_i_ = 0;
+    bool               tail_   = false;
+    size_t             size_   = 0;
+    std::vector<chunk> chunks_;
+};
+
+template <typename I, typename J>
+template <typename F>
+void csrmv_row_blocks_builder<I, J>::parallel_for(int n, F f)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(n - 1);
+
+    for(int c = 1; c < n; ++c)
+    {
+        threads.emplace_back(f, c);
+    }
+
+    f(0);
+
+    for(auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+template <typename I, typename J>
+size_t csrmv_row_blocks_builder<I, J>::plan(const I* rowDelimiters,
+                                            I        nRows,
+                                            int      nchunks,
+                                            I        min_chunk_rows)
+{
+    nRows_ = nRows;
+
+    // Do not split small matrices
+    I max_chunks = std::max(nRows / min_chunk_rows, static_cast<I>(1));
+    nchunks      = static_cast<int>(std::min(static_cast<I>(std::max(nchunks, 1)), max_chunks));
+
+    chunks_.resize(nchunks);
+
+    for(int c = 0; c < nchunks; ++c)
+    {
+        chunks_[c].begin = 1 + static_cast<I>((static_cast<int64_t>(nRows) * c) / nchunks);
+        chunks_[c].end   = 1 + static_cast<I>((static_cast<int64_t>(nRows) * (c + 1)) / nchunks);
+    }
+
+    // Speculative run of each chunk
+    parallel_for(nchunks, [&](int c) {
+        chunk& ch = chunks_[c];
+
+        ch.spec_start = {ch.begin - 1, 0, 0};
+        ch.nrecords   = 0;
+
+        csrmv_row_blocks_state<I> s = ch.spec_start;
+        counter                   cnt;
+
+        I i = ch.begin;
+        while(i < ch.end)
+        {
+            size_t size = cnt.size;
+            i           = csrmv_row_blocks_step<I, J>(rowDelimiters, i, s, cnt);
+
+            if(cnt.size != size && ch.nrecords < num_records)
+            {
+                ch.records[ch.nrecords++] = {i, s, cnt.size};
+            }
+        }
+
+        ch.spec_end  = s;
+        ch.spec_size = cnt.size;
+    });
+
+    // Determine the true state at the start of each chunk, in order
+    csrmv_row_blocks_state<I> s = {0, 0, 0};
+
+    // rowBlocks[0] = 0
+    size_t offset = 1;
+
+    for(auto& ch : chunks_)
+    {
+        ch.start  = s;
+        ch.offset = offset;
+
+        if(s == ch.spec_start)
+        {
+            ch.size = ch.spec_size;
+            s       = ch.spec_end;
+        }
+        else
+        {
+            counter cnt;
+            bool    converged = false;
+            int     r         = 0;
+
+            I i = ch.begin;
+            while(i < ch.end)
+            {
+                size_t size = cnt.size;
+                i           = csrmv_row_blocks_step<I, J>(rowDelimiters, i, s, cnt);
+
+                if(cnt.size == size)
+                {
+                    continue;
+                }
+
+                while(r < ch.nrecords && ch.records[r].next < i)
+                {
+                    ++r;
+                }
+
+                for(int q = r; q < ch.nrecords && ch.records[q].next == i; ++q)
+                {
+                    if(ch.records[q].state == s)
+                    {
+                        // Identical from here on
+                        converged = true;
+                        cnt.size += ch.spec_size - ch.records[q].size;
+                        break;
+                    }
+                }
+
+                if(converged || r == ch.nrecords)
+                {
+                    break;
+                }
+            }
+
+            if(converged)
+            {
+                s = ch.spec_end;
+            }
+            else
+            {
+                // No more records to compare to, finish the chunk
+                while(i < ch.end)
+                {
+                    i = csrmv_row_blocks_step<I, J>(rowDelimiters, i, s, cnt);
+                }
+            }
+
+            ch.size = cnt.size;
+        }
+
+        offset += ch.size;
+    }
+
+    // If we didn't fill a row block with the last row, make sure we don't lose it.
+    last_i_ = s.last_i;
+    tail_   = (s.last_i != nRows);
+    size_   = offset + (tail_ ? 1 : 0);
+
+    return size_;
+}
+
+template <typename I, typename J>
+void csrmv_row_blocks_builder<I, J>::fill(const I* rowDelimiters, I* rowBlocks, J* wgIds) const
+{
+    rowBlocks[0] = 0;
+    wgIds[0]     = 0;
+
+    // Bits that belong to the last row block of a previous chunk
+    std::vector<J> carry(chunks_.size(), 0);
+
+    parallel_for(static_cast<int>(chunks_.size()), [&](int c) {
+        const chunk& ch = chunks_[c];
+
+        writer out = {rowBlocks, wgIds, ch.offset, ch.offset, 0};
+
+        csrmv_row_blocks_state<I> s = ch.start;
+
+        I i = ch.begin;
+        while(i < ch.end)
+        {
+            i = csrmv_row_blocks_step<I, J>(rowDelimiters, i, s, out);
+        }
+
+        assert(out.pos == ch.offset + ch.size);
+
+        carry[c] = out.carry;
+    });
+
+    // Apply the carry bits once all chunks have been written
+    for(size_t c = 0; c < chunks_.size(); ++c)
+    {
+        wgIds[chunks_[c].offset - 1] |= carry[c];
+    }
+
+    if(tail_)
+    {
+        rowBlocks[size_ - 1] = nRows_;
+        wgIds[size_ - 1]     = 0;
+
+        // Like ComputeRowBlocks, using the final iteration index nRows + 1
+        if((nRows_ - last_i_) > static_cast<I>(ROWS_FOR_VECTOR))
+        {
+            wgIds[size_ - 2] |= static_cast<J>(numThreadsForReduction(nRows_ + 1 - last_i_));
+        }
+    }
+}
+
+#endif // CSRMV_ROW_BLOCKS_H
@@ -31,14 +31,14 @@
 #include <hip/hip_runtime.h>
 
 // General GEBSRMV that works for any GEBSR block dimensions
-template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
 __device__ void gebsrmvn_general_device(rocsparse_direction dir,
                                         T                   alpha,
-                                        const rocsparse_int* __restrict__ bsr_row_ptr,
-                                        const rocsparse_int* __restrict__ bsr_col_ind,
+                                        const I* __restrict__ bsr_row_ptr,
+                                        const J* __restrict__ bsr_col_ind,
                                         const T* __restrict__ bsr_val,
-                                        rocsparse_int row_bsr_dim,
-                                        rocsparse_int col_bsr_dim,
+                                        J row_bsr_dim,
+                                        J col_bsr_dim,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
@@ -51,11 +51,11 @@ __device__ void gebsrmvn_general_device(rocsparse_direction dir,
     rocsparse_int wid = hipThreadIdx_x / WFSIZE;
 
     // Each thread block processes a BSR row
-    rocsparse_int row = hipBlockIdx_x;
+    J row = hipBlockIdx_x;
 
     // BSR row entry and exit point
-    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
-    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+    I row_begin = bsr_row_ptr[row] - idx_base;
+    I row_end   = bsr_row_ptr[row + 1] - idx_base;
 
     // Each wavefront processes a row of the BSR block.
     // If the number of BSR block rows exceed the number of wavefronts, each wavefront
@@ -65,20 +65,20 @@ __device__ void gebsrmvn_general_device(rocsparse_direction dir,
 
     // Loop over the rows of the BSR block in chunks of WFSIZE, such that each
     // wavefront will process a row
-    for(rocsparse_int bi = wid; bi < row_bsr_dim; bi += BLOCKSIZE / WFSIZE)
+    for(J bi = wid; bi < row_bsr_dim; bi += BLOCKSIZE / WFSIZE)
     {
         // BSR block row accumulator
         T sum = static_cast<T>(0);
 
         // Loop over all BSR blocks in the current row
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        for(I j = row_begin; j < row_end; ++j)
         {
             // BSR column index
-            rocsparse_int col = bsr_col_ind[j] - idx_base;
+            J col = bsr_col_ind[j] - idx_base;
 
             // Loop over the columns of the BSR block in chunks of WFSIZE, such that
             // each lane will process a single value of the BSR block
-            for(rocsparse_int bj = lid; bj < col_bsr_dim; bj += WFSIZE)
+            for(J bj = lid; bj < col_bsr_dim; bj += WFSIZE)
             {
                 // Each lane computes the sum of a specific entry over all BSR blocks in
                 // the current row
@@ -65,7 +65,8 @@ rocsparse_status rocsparse_bsrmv_template_dispatch(rocsparse_handle          han
                                                                     bsr_col_ind,
                                                                     x,
                                                                     beta_device_host,
-                                                                    y));
+                                                                    y,
+                                                                    false));
 
         return rocsparse_status_success;
     }
@@ -248,6 +249,9 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     //
     // Logging
     //
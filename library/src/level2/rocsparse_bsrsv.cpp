@@ -47,6 +47,9 @@ extern "C" rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_bsrsv_zero_pivot", (const void*&)info, (const void*&)position);
 
@@ -85,7 +88,7 @@ extern "C" rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle
             &zero_pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         if(zero_pivot == std::numeric_limits<rocsparse_int>::max())
         {
@@ -105,8 +108,8 @@ extern "C" rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle
     else
     {
         // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(position, info->zero_pivot, sizeof(rocsparse_int)));
 
         // If no zero pivot is found, set -1
         if(*position == std::numeric_limits<rocsparse_int>::max())
@@ -134,6 +137,9 @@ extern "C" rocsparse_status rocsparse_bsrsv_clear(rocsparse_handle handle, rocsp
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_bsrsv_clear", (const void*&)info);
 
@@ -56,6 +56,9 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsrsv_analysis"),
@@ -192,7 +195,7 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             bsr_row_ptr,
             bsr_col_ind,
             (trans == rocsparse_operation_none) ? info->bsrsv_upper_info : info->bsrsvt_upper_info,
-            &info->zero_pivot,
+            info,
             temp_buffer));
     }
     else
@@ -259,7 +262,7 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             bsr_row_ptr,
             bsr_col_ind,
             (trans == rocsparse_operation_none) ? info->bsrsv_lower_info : info->bsrsvt_lower_info,
-            &info->zero_pivot,
+            info,
             temp_buffer));
     }
 
@@ -66,6 +66,36 @@ __launch_bounds__(BLOCKSIZE) __global__ void coomvn_wf(I nnz,
                                                  idx_base);
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void coomv_symm(I nnz,
+                                                        U alpha_device_host,
+                                                        const I* __restrict__ coo_row_ind,
+                                                        const I* __restrict__ coo_col_ind,
+                                                        const T* __restrict__ coo_val,
+                                                        const T* __restrict__ x,
+                                                        T* __restrict__ y,
+                                                        rocsparse_index_base idx_base,
+                                                        rocsparse_fill_mode  fill_mode,
+                                                        bool                 conj_stored,
+                                                        bool                 conj_mirror)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        coomv_symm_device(nnz,
+                          alpha,
+                          coo_row_ind,
+                          coo_col_ind,
+                          coo_val,
+                          x,
+                          y,
+                          idx_base,
+                          fill_mode,
+                          conj_stored,
+                          conj_mirror);
+    }
+}
+
 template <typename I, typename T, typename U>
 rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -84,8 +114,11 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Symmetric and hermitian matrices, only the triangle given by the fill mode is read
+    bool symmetric = (descr->type != rocsparse_matrix_type_general);
+
     // Run different coomv kernels
-    if(trans == rocsparse_operation_none)
+    if(trans == rocsparse_operation_none || symmetric)
     {
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -121,6 +154,32 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
             }
         }
 
+        if(symmetric)
+        {
+            bool conj_stored;
+            bool conj_mirror;
+            rocsparse_symmetric_conj(trans, descr->type, &conj_stored, &conj_mirror);
+
+            hipLaunchKernelGGL((coomv_symm<256>),
+                               dim3((nnz - 1) / 256 + 1),
+                               dim3(256),
+                               0,
+                               stream,
+                               nnz,
+                               alpha_device_host,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base,
+                               descr->fill_mode,
+                               conj_stored,
+                               conj_mirror);
+
+            return rocsparse_status_success;
+        }
+
 #define COOMVN_DIM 128
         int maxthreads = handle->properties.maxThreadsPerBlock;
         int nprocs     = handle->properties.multiProcessorCount;
@@ -135,7 +194,8 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
         dim3 coomvn_threads(COOMVN_DIM);
 
         // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        char* ptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&ptr));
         ptr += 256;
 
         // row block reduction buffer
@@ -232,6 +292,9 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcoomv"),
@@ -263,7 +326,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
     }
 
     // Check matrix type
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -275,6 +338,12 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and hermitian matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0)
     {
@@ -90,7 +90,8 @@ rocsparse_status rocsparse_coomv_aos_dispatch(rocsparse_handle          handle,
         dim3 coomvn_threads(COOMVN_DIM);
 
         // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        char* ptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&ptr));
         ptr += 256;
 
         // row block reduction buffer
@@ -184,6 +185,9 @@ rocsparse_status rocsparse_coomv_aos_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcoomv_aos"),
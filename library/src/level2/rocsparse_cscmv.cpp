@@ -0,0 +1,404 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_cscmv.hpp"
+#include "definitions.h"
+#include "rocsparse_csrmv.hpp"
+#include "utility.h"
+
+// A matrix in CSC format is the transpose of the same arrays in CSR format, i.e. the
+// column pointers and row indices of A are the row pointers and column indices of A^T,
+// which is a n x m matrix. Thus, cscmv runs csrmv on A^T with the operation flipped.
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status rocsparse_cscmv_dispatch(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 J                         m,
+                                                 J                         n,
+                                                 I                         nnz,
+                                                 U                         alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csc_val,
+                                                 const I*                  csc_col_ptr,
+                                                 const J*                  csc_row_ind,
+                                                 rocsparse_csrmv_info      info,
+                                                 const T*                  x,
+                                                 U                         beta_device_host,
+                                                 T*                        y)
+{
+    switch(trans)
+    {
+    case rocsparse_operation_none:
+    {
+        // If the transposed analysis of A^T is available, the columns of A^T are gathered
+        // without atomics. Otherwise, they are scattered atomically into y.
+        if(info != nullptr && info->trans == rocsparse_operation_transpose)
+        {
+            return rocsparse_csrmv_adaptive_template_dispatch(handle,
+                                                              rocsparse_operation_transpose,
+                                                              n,
+                                                              m,
+                                                              nnz,
+                                                              alpha_device_host,
+                                                              descr,
+                                                              csc_val,
+                                                              csc_col_ptr,
+                                                              csc_row_ind,
+                                                              info,
+                                                              x,
+                                                              beta_device_host,
+                                                              y);
+        }
+
+        return rocsparse_csrmv_template_dispatch(handle,
+                                                 rocsparse_operation_transpose,
+                                                 n,
+                                                 m,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 x,
+                                                 beta_device_host,
+                                                 y,
+                                                 false);
+    }
+
+    case rocsparse_operation_transpose:
+    {
+        // A^T is a regular CSR matrix, use row blocks if available
+        if(info != nullptr && info->trans == rocsparse_operation_none)
+        {
+            return rocsparse_csrmv_adaptive_template_dispatch(handle,
+                                                              rocsparse_operation_none,
+                                                              n,
+                                                              m,
+                                                              nnz,
+                                                              alpha_device_host,
+                                                              descr,
+                                                              csc_val,
+                                                              csc_col_ptr,
+                                                              csc_row_ind,
+                                                              info,
+                                                              x,
+                                                              beta_device_host,
+                                                              y);
+        }
+
+        return rocsparse_csrmv_template_dispatch(handle,
+                                                 rocsparse_operation_none,
+                                                 n,
+                                                 m,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 x,
+                                                 beta_device_host,
+                                                 y,
+                                                 false);
+    }
+
+    case rocsparse_operation_conjugate_transpose:
+    {
+        // A^H is A^T with conjugated entries
+        return rocsparse_csrmv_template_dispatch(handle,
+                                                 rocsparse_operation_none,
+                                                 n,
+                                                 m,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 x,
+                                                 beta_device_host,
+                                                 y,
+                                                 true);
+    }
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_cscmv_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csc_val,
+                                                   const I*                  csc_col_ptr,
+                                                   const J*                  csc_row_ind,
+                                                   rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    switch(trans)
+    {
+    case rocsparse_operation_none:
+    {
+        // Gathering the columns of A^T requires its CSC structure, i.e. the CSR
+        // structure of A
+        return rocsparse_csrmv_analysis_template(handle,
+                                                 rocsparse_operation_transpose,
+                                                 n,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 info);
+    }
+
+    case rocsparse_operation_transpose:
+    {
+        // Row blocks of A^T
+        return rocsparse_csrmv_analysis_template(handle,
+                                                 rocsparse_operation_none,
+                                                 n,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 info);
+    }
+
+    case rocsparse_operation_conjugate_transpose:
+    {
+        // The conjugated product does not make use of any meta data
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+        info->csrmv_info = nullptr;
+
+        return rocsparse_status_success;
+    }
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_cscmv_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          J                         m,
+                                          J                         n,
+                                          I                         nnz,
+                                          const T*                  alpha_device_host,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csc_val,
+                                          const I*                  csc_col_ptr,
+                                          const J*                  csc_row_ind,
+                                          rocsparse_mat_info        info,
+                                          const T*                  x,
+                                          const T*                  beta_device_host,
+                                          T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcscmv"),
+              trans,
+              m,
+              n,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csc_val,
+              (const void*&)csc_col_ptr,
+              (const void*&)csc_row_ind,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csc_val == nullptr || csc_col_ptr == nullptr || csc_row_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrmv_info csrmv_info = (info != nullptr) ? info->csrmv_info : nullptr;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_cscmv_dispatch(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csc_val,
+                                        csc_col_ptr,
+                                        csc_row_ind,
+                                        csrmv_info,
+                                        x,
+                                        beta_device_host,
+                                        y);
+    }
+    else
+    {
+        return rocsparse_cscmv_dispatch(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        *alpha_device_host,
+                                        descr,
+                                        csc_val,
+                                        csc_col_ptr,
+                                        csc_row_ind,
+                                        csrmv_info,
+                                        x,
+                                        *beta_device_host,
+                                        y);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
+    template rocsparse_status rocsparse_cscmv_analysis_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                             \
+        rocsparse_operation       trans,                                              \
+        JTYPE                     m,                                                  \
+        JTYPE                     n,                                                  \
+        ITYPE                     nnz,                                                \
+        const rocsparse_mat_descr descr,                                              \
+        const TTYPE*              csc_val,                                            \
+        const ITYPE*              csc_col_ptr,                                        \
+        const JTYPE*              csc_row_ind,                                        \
+        rocsparse_mat_info        info);                                              \
+    template rocsparse_status rocsparse_cscmv_template<ITYPE, JTYPE, TTYPE>(          \
+        rocsparse_handle          handle,                                             \
+        rocsparse_operation       trans,                                              \
+        JTYPE                     m,                                                  \
+        JTYPE                     n,                                                  \
+        ITYPE                     nnz,                                                \
+        const TTYPE*              alpha_device_host,                                  \
+        const rocsparse_mat_descr descr,                                              \
+        const TTYPE*              csc_val,                                            \
+        const ITYPE*              csc_col_ptr,                                        \
+        const JTYPE*              csc_row_ind,                                        \
+        rocsparse_mat_info        info,                                               \
+        const TTYPE*              x,                                                  \
+        const TTYPE*              beta_device_host,                                   \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
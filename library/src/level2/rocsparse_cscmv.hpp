@@ -0,0 +1,59 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSCMV_HPP
+#define ROCSPARSE_CSCMV_HPP
+
+#include "handle.h"
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_cscmv_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csc_val,
+                                                   const I*                  csc_col_ptr,
+                                                   const J*                  csc_row_ind,
+                                                   rocsparse_mat_info        info);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_cscmv_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          J                         m,
+                                          J                         n,
+                                          I                         nnz,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csc_val,
+                                          const I*                  csc_col_ptr,
+                                          const J*                  csc_row_ind,
+                                          rocsparse_mat_info        info,
+                                          const T*                  x,
+                                          const T*                  beta,
+                                          T*                        y);
+
+#endif // ROCSPARSE_CSCMV_HPP
@@ -0,0 +1,352 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csr16mv.hpp"
+
+#include "csr16mv_device.h"
+#include "definitions.h"
+#include "rocsparse_coomv.hpp"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr16mvn_general_kernel(I m,
+                                 U alpha_device_host,
+                                 const I* __restrict__ csr16_row_ptr,
+                                 const I* __restrict__ csr16_row_base,
+                                 const uint16_t* __restrict__ csr16_col_off,
+                                 const T* __restrict__ csr16_val,
+                                 const T* __restrict__ x,
+                                 U beta_device_host,
+                                 T* __restrict__ y,
+                                 rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csr16mvn_general_device<BLOCKSIZE, WF_SIZE>(m,
+                                                    alpha,
+                                                    csr16_row_ptr,
+                                                    csr16_row_base,
+                                                    csr16_col_off,
+                                                    csr16_val,
+                                                    x,
+                                                    beta,
+                                                    y,
+                                                    idx_base);
+    }
+}
+
+#define LAUNCH_CSR16MVN_KERNEL(BLOCKSIZE, WF_SIZE)                   \
+    hipLaunchKernelGGL((csr16mvn_general_kernel<BLOCKSIZE, WF_SIZE>), \
+                       dim3((m - 1) / BLOCKSIZE + 1),                 \
+                       dim3(BLOCKSIZE),                               \
+                       0,                                             \
+                       stream,                                        \
+                       m,                                             \
+                       alpha_device_host,                             \
+                       csr16_row_ptr,                                 \
+                       csr16_row_base,                                \
+                       csr16_col_off,                                 \
+                       csr16_val,                                     \
+                       x,                                             \
+                       beta_device_host,                              \
+                       y,                                             \
+                       descr->base)
+
+template <typename I, typename T, typename U>
+rocsparse_status rocsparse_csr16mv_dispatch(rocsparse_handle          handle,
+                                            I                         m,
+                                            I                         nnz,
+                                            U                         alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr16_val,
+                                            const I*                  csr16_row_ptr,
+                                            const I*                  csr16_row_base,
+                                            const uint16_t*           csr16_col_off,
+                                            const T*                  x,
+                                            U                         beta_device_host,
+                                            T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR16MVN_DIM 512
+    I nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 32);
+    }
+    else
+    {
+        LAUNCH_CSR16MVN_KERNEL(CSR16MVN_DIM, 64);
+    }
+#undef CSR16MVN_DIM
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSR16MVN_KERNEL
+
+template <typename I, typename T>
+rocsparse_status rocsparse_csr16mv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            I                         m,
+                                            I                         n,
+                                            I                         nnz,
+                                            const T*                  alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr16_val,
+                                            const I*                  csr16_row_ptr,
+                                            const I*                  csr16_row_base,
+                                            const uint16_t*           csr16_col_off,
+                                            I                         esc_nnz,
+                                            const T*                  csr16_esc_val,
+                                            const I*                  csr16_esc_row_ind,
+                                            const I*                  csr16_esc_col_ind,
+                                            const T*                  x,
+                                            const T*                  beta_device_host,
+                                            T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr16mv"),
+              trans,
+              m,
+              n,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csr16_val,
+              (const void*&)csr16_row_ptr,
+              (const void*&)csr16_row_base,
+              (const void*&)csr16_col_off,
+              esc_nnz,
+              (const void*&)csr16_esc_val,
+              (const void*&)csr16_esc_row_ind,
+              (const void*&)csr16_esc_col_ind,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || esc_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(csr16_row_ptr == nullptr || csr16_row_base == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value and offset arrays can only be nullptr if nnz is zero
+    if(nnz != 0 && (csr16_val == nullptr || csr16_col_off == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // escaped entries can only be nullptr if esc_nnz is zero
+    if(esc_nnz != 0
+       && (csr16_esc_val == nullptr || csr16_esc_row_ind == nullptr
+           || csr16_esc_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // CSR16 part, applies beta to all rows
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr16mv_dispatch(handle,
+                                                             m,
+                                                             nnz,
+                                                             alpha_device_host,
+                                                             descr,
+                                                             csr16_val,
+                                                             csr16_row_ptr,
+                                                             csr16_row_base,
+                                                             csr16_col_off,
+                                                             x,
+                                                             beta_device_host,
+                                                             y));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr16mv_dispatch(handle,
+                                                             m,
+                                                             nnz,
+                                                             *alpha_device_host,
+                                                             descr,
+                                                             csr16_val,
+                                                             csr16_row_ptr,
+                                                             csr16_row_base,
+                                                             csr16_col_off,
+                                                             x,
+                                                             *beta_device_host,
+                                                             y));
+    }
+
+    // Escaped entries are accumulated on top
+    if(esc_nnz > 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            T* esc_beta = nullptr;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_one(handle, &esc_beta));
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               esc_nnz,
+                                                               alpha_device_host,
+                                                               descr,
+                                                               csr16_esc_val,
+                                                               csr16_esc_row_ind,
+                                                               csr16_esc_col_ind,
+                                                               x,
+                                                               (const T*)esc_beta,
+                                                               y));
+        }
+        else
+        {
+            T esc_beta = static_cast<T>(1);
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               esc_nnz,
+                                                               alpha_device_host,
+                                                               descr,
+                                                               csr16_esc_val,
+                                                               csr16_esc_row_ind,
+                                                               csr16_esc_col_ind,
+                                                               x,
+                                                               &esc_beta,
+                                                               y));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                       \
+    template rocsparse_status rocsparse_csr16mv_template<ITYPE, TTYPE>( \
+        rocsparse_handle          handle,                               \
+        rocsparse_operation       trans,                                \
+        ITYPE                     m,                                    \
+        ITYPE                     n,                                    \
+        ITYPE                     nnz,                                  \
+        const TTYPE*              alpha,                                \
+        const rocsparse_mat_descr descr,                                \
+        const TTYPE*              csr16_val,                            \
+        const ITYPE*              csr16_row_ptr,                        \
+        const ITYPE*              csr16_row_base,                       \
+        const uint16_t*           csr16_col_off,                        \
+        ITYPE                     esc_nnz,                              \
+        const TTYPE*              csr16_esc_val,                        \
+        const ITYPE*              csr16_esc_row_ind,                    \
+        const ITYPE*              csr16_esc_col_ind,                    \
+        const TTYPE*              x,                                    \
+        const TTYPE*              beta,                                 \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, float)
+INSTANTIATE(int32_t, double)
+INSTANTIATE(int32_t, rocsparse_float_complex)
+INSTANTIATE(int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, float)
+INSTANTIATE(int64_t, double)
+INSTANTIATE(int64_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, rocsparse_double_complex)
+#undef INSTANTIATE
@@ -23,269 +23,131 @@
  * ************************************************************************ */
 
 #include "rocsparse_csrmv.hpp"
+#include "analysis_cache.h"
+#include "capture.h"
 #include "definitions.h"
 #include "utility.h"
 
 #include "csrmv_device.h"
+#include "csrmv_row_blocks.h"
 
-#define BLOCK_SIZE 1024
-#define BLOCK_MULTIPLIER 3
-#define ROWS_FOR_VECTOR 1
-#define WG_SIZE 256
-
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
-{
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
-}
-
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
-}
+#include <rocprim/rocprim.hpp>
 
+// Gather the CSC structure of the matrix for transposed operations. Only indices are
+// stored, values are read from the CSR matrix through the permutation.
 template <typename I, typename J>
-static inline void ComputeRowBlocks(I*       rowBlocks,
-                                    J*       wgIds,
-                                    size_t&  rowBlockSize,
-                                    const I* rowDelimiters,
-                                    I        nRows,
-                                    bool     allocate_row_blocks = true)
+static rocsparse_status rocsparse_csrmv_analysis_transpose(rocsparse_handle     handle,
+                                                           J                    m,
+                                                           J                    n,
+                                                           I                    nnz,
+                                                           const I*             csr_row_ptr,
+                                                           const J*             csr_col_ind,
+                                                           rocsparse_index_base idx_base,
+                                                           rocsparse_csrmv_info info)
 {
-    I* rowBlocksBase;
+    // Stream
+    hipStream_t stream = handle->stream;
 
-    // Start at one because of rowBlock[0]
-    I total_row_blocks = 1;
+    const rocsparse_device_allocator& allocator = info->allocator;
+
+    RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(&info->csc_col_ptr, sizeof(I) * (n + 1), stream));
+    RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(&info->csc_row_ind, sizeof(J) * nnz, stream));
+    RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(&info->csc_perm, sizeof(I) * nnz, stream));
+
+    I* csc_col_ptr = reinterpret_cast<I*>(info->csc_col_ptr);
+    J* csc_row_ind = reinterpret_cast<J*>(info->csc_row_ind);
+    I* csc_perm    = reinterpret_cast<I*>(info->csc_perm);
+
+    // Temporary storage, rocprim does not sort in-place
+    J* keys1;
+    J* keys2;
+    I* perm;
+    J* rows;
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&keys1, sizeof(J) * nnz));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&keys2, sizeof(J) * nnz));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&perm, sizeof(I) * nnz));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&rows, sizeof(J) * nnz));
+
+#define CSRMVT_DIM 256
+    // Row index and identity permutation of each entry
+    hipLaunchKernelGGL((csrmvt_analysis_init_kernel<CSRMVT_DIM>),
+                       dim3((nnz - 1) / CSRMVT_DIM + 1),
+                       dim3(CSRMVT_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       idx_base,
+                       perm,
+                       rows);
+
+    // Stable sort of the entries by column
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        keys1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    if(allocate_row_blocks)
+    unsigned int endbit = 0;
+    while(endbit < sizeof(J) * 8 && ((static_cast<int64_t>(n) + idx_base) >> endbit) != 0)
     {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        *wgIds        = 0;
-        ++rowBlocks;
-        ++wgIds;
+        ++endbit;
     }
 
-    I sum = 0;
-    I i;
-    I last_i = 0;
-
-    I consecutive_long_rows = 0;
-    for(i = 1; i <= nRows; ++i)
-    {
-        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
-
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
-        {
-            ++consecutive_long_rows;
-        }
-        else if(consecutive_long_rows > 0)
-        {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
-        }
+    rocprim::double_buffer<J> keys(keys1, keys2);
+    rocprim::double_buffer<I> vals(perm, csc_perm);
 
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i - 1;
-
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
-        }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i - 1;
-                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
+    size_t size = 0;
+    void*  temp_storage;
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, 0, endbit, stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage, size));
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(temp_storage, size, keys, vals, nnz, 0, endbit, stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage));
 
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
-
-        // Now, what's up with this row? What did it do?
-
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case;
-        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            I numWGReq = static_cast<I>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
-
-            // Check to ensure #workgroups can fit in 32 bits, if not
-            // then the last workgroup will do all the remaining work
-            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
-            numWGReq = (numWGReq < static_cast<I>(std::pow(2, 31) - 1))
-                           ? numWGReq
-                           : static_cast<I>(std::pow(2, 31) - 1);
-
-            if(allocate_row_blocks)
-            {
-                for(I w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = (i - 1);
-                    *wgIds |= static_cast<J>(w);
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                *rowBlocks = i;
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
-
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if(sum == static_cast<I>(BLOCK_SIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-    }
-
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
+    if(vals.current() != csc_perm)
     {
-        *rowBlocks = nRows;
-        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-        {
-            *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-        }
-
-        ++rowBlocks;
-        ++wgIds;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csc_perm, vals.current(), sizeof(I) * nnz, hipMemcpyDeviceToDevice, stream));
     }
 
-    ++total_row_blocks;
-
-    if(allocate_row_blocks)
-    {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
+    // Row indices of the CSC entries
+    hipLaunchKernelGGL((csrmvt_analysis_gather_kernel<CSRMVT_DIM>),
+                       dim3((nnz - 1) / CSRMVT_DIM + 1),
+                       dim3(CSRMVT_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       csc_perm,
+                       rows,
+                       csc_row_ind);
+
+    // Column pointers, count entries per column and scan
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csc_col_ptr, 0, sizeof(I) * (n + 1), stream));
+    hipLaunchKernelGGL((csrmvt_analysis_count_kernel<CSRMVT_DIM>),
+                       dim3((nnz - 1) / CSRMVT_DIM + 1),
+                       dim3(CSRMVT_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       csr_col_ind,
+                       idx_base,
+                       csc_col_ptr);
+#undef CSRMVT_DIM
+
+    size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<I>(), stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage, size));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        temp_storage, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<I>(), stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(keys1));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(keys2));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(perm));
+    RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(rows));
 
-        assert((dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        rowBlockSize = dist;
-    }
-    else
-    {
-        rowBlockSize = total_row_blocks;
-    }
+    return rocsparse_status_success;
 }
 
 template <typename I, typename J, typename T>
@@ -314,6 +176,9 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_csrmv_analysis",
@@ -332,8 +197,8 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_value;
     }
 
-    // Check index base
-    if(descr->type != rocsparse_matrix_type_general)
+    // Check matrix type
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -345,6 +210,12 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and hermitian matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -359,6 +230,13 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
 
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+    info->csrmv_info = nullptr;
+
+    // Symmetric and hermitian matrices do not require row blocks
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
 
     // Create csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
@@ -366,67 +244,171 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Store some pointers to verify correct execution
+    info->csrmv_info->trans       = trans;
+    info->csrmv_info->m           = m;
+    info->csrmv_info->n           = n;
+    info->csrmv_info->nnz         = nnz;
+    info->csrmv_info->descr       = descr;
+    info->csrmv_info->csr_row_ptr = csr_row_ptr;
+    info->csrmv_info->csr_col_ind = csr_col_ind;
+
+    // Meta data is allocated with the allocator of the handle
+    info->csrmv_info->allocator = handle->allocator;
+
+    // Transposed operations require the CSC structure instead of row blocks
+    bool transposed = (trans != rocsparse_operation_none);
+
+    // Reuse the analysis of an identical sparsity pattern, if available
+    rocsparse_analysis_key key;
+    if(handle->analysis_cache != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_key(handle,
+                                                               rocsparse_analysis_kind::csrmv,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               descr,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               &key));
+
+        int64_t size;
+        bool    cached;
+        if(transposed)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->analysis_cache->fetch(key,
+                                              &size,
+                                              {&info->csrmv_info->csc_col_ptr,
+                                               &info->csrmv_info->csc_row_ind,
+                                               &info->csrmv_info->csc_perm},
+                                              info->csrmv_info->allocator,
+                                              stream,
+                                              &cached));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->analysis_cache->fetch(key,
+                                              &size,
+                                              {&info->csrmv_info->row_blocks,
+                                               (void**)&info->csrmv_info->wg_flags,
+                                               &info->csrmv_info->wg_ids},
+                                              info->csrmv_info->allocator,
+                                              stream,
+                                              &cached));
+        }
+
+        if(cached)
+        {
+            info->csrmv_info->size = transposed ? 0 : size;
+            return rocsparse_status_success;
+        }
+    }
+
+    if(transposed)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_transpose(handle,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     csr_row_ptr,
+                                                                     csr_col_ind,
+                                                                     descr->base,
+                                                                     info->csrmv_info));
+
+        // Keep a copy for matrices of identical sparsity pattern
+        if(handle->analysis_cache != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->insert(
+                key,
+                0,
+                {{info->csrmv_info->csc_col_ptr, sizeof(I) * (n + 1)},
+                 {info->csrmv_info->csc_row_ind, sizeof(J) * nnz},
+                 {info->csrmv_info->csc_perm, sizeof(I) * nnz}},
+                handle->allocator,
+                stream));
+        }
+
+        return rocsparse_status_success;
+    }
+
     // row blocks size
     info->csrmv_info->size = 0;
 
-    // Temporary arrays to hold device data
-    std::vector<I> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
+    // Row pointers are staged in the pinned host buffer of the handle
+    size_t ptr_bytes = ((sizeof(I) * (m + 1) - 1) / 256 + 1) * 256;
+    RETURN_IF_ROCSPARSE_ERROR(handle->reserve_host_buffer(ptr_bytes));
+
+    I* hptr = reinterpret_cast<I*>(handle->host_buffer);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hptr, csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+
+    // Determine row blocks array size, using all host threads for large matrices
+    csrmv_row_blocks_builder<I, J> builder;
+    info->csrmv_info->size
+        = builder.plan(hptr, m, std::max(static_cast<int>(std::thread::hardware_concurrency()), 1));
 
-    // Determine row blocks array size
-    ComputeRowBlocks<I, J>((I*)NULL, (J*)NULL, info->csrmv_info->size, hptr.data(), m, false);
+    // Stage row blocks and workgroup data structures behind the row pointers
+    size_t row_blocks_bytes = ((sizeof(I) * info->csrmv_info->size - 1) / 256 + 1) * 256;
+    RETURN_IF_ROCSPARSE_ERROR(handle->reserve_host_buffer(
+        ptr_bytes + row_blocks_bytes + sizeof(J) * info->csrmv_info->size));
 
-    // Create row blocks, workgroup flag, and workgroup data structures
-    std::vector<I>            row_blocks(info->csrmv_info->size, 0);
-    std::vector<unsigned int> wg_flags(info->csrmv_info->size, 0);
-    std::vector<J>            wg_ids(info->csrmv_info->size, 0);
+    // The pinned buffer might have been reallocated
+    char* staging    = reinterpret_cast<char*>(handle->host_buffer);
+    I*    row_blocks = reinterpret_cast<I*>(staging + ptr_bytes);
+    J*    wg_ids     = reinterpret_cast<J*>(staging + ptr_bytes + row_blocks_bytes);
 
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->size, hptr.data(), m, true);
+    builder.fill(reinterpret_cast<const I*>(staging), row_blocks, wg_ids);
 
     // Allocate memory on device to hold csrmv info, if required
     if(info->csrmv_info->size > 0)
     {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->csrmv_info->row_blocks, sizeof(I) * info->csrmv_info->size));
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->wg_flags,
-                                      sizeof(unsigned int) * info->csrmv_info->size));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size));
+        const rocsparse_device_allocator& allocator = info->csrmv_info->allocator;
+
+        RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(
+            &info->csrmv_info->row_blocks, sizeof(I) * info->csrmv_info->size, stream));
+        RETURN_IF_ROCSPARSE_ERROR(allocator.allocate((void**)&info->csrmv_info->wg_flags,
+                                                     sizeof(unsigned int) * info->csrmv_info->size,
+                                                     stream));
+        RETURN_IF_ROCSPARSE_ERROR(allocator.allocate(
+            &info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size, stream));
 
-        // Copy row blocks information to device
+        // Copy row blocks information to device, workgroup flags are initialized with 0
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
+                                           row_blocks,
                                            sizeof(I) * info->csrmv_info->size,
                                            hipMemcpyHostToDevice,
                                            stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_flags,
-                                           wg_flags.data(),
-                                           sizeof(unsigned int) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            info->csrmv_info->wg_flags, 0, sizeof(unsigned int) * info->csrmv_info->size, stream));
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_ids,
-                                           wg_ids.data(),
+                                           wg_ids,
                                            sizeof(J) * info->csrmv_info->size,
                                            hipMemcpyHostToDevice,
                                            stream));
 
         // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
     }
 
-    // Store some pointers to verify correct execution
-    info->csrmv_info->trans       = trans;
-    info->csrmv_info->m           = m;
-    info->csrmv_info->n           = n;
-    info->csrmv_info->nnz         = nnz;
-    info->csrmv_info->descr       = descr;
-    info->csrmv_info->csr_row_ptr = csr_row_ptr;
-    info->csrmv_info->csr_col_ind = csr_col_ind;
+    // Keep a copy for matrices of identical sparsity pattern
+    if(handle->analysis_cache != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->insert(
+            key,
+            info->csrmv_info->size,
+            {{info->csrmv_info->row_blocks, sizeof(I) * info->csrmv_info->size},
+             {info->csrmv_info->wg_flags, sizeof(unsigned int) * info->csrmv_info->size},
+             {info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size}},
+            handle->allocator,
+            stream));
+    }
 
     return rocsparse_status_success;
 }
@@ -435,6 +417,7 @@ template <unsigned int BLOCKSIZE,
           unsigned int WF_SIZE,
           typename I,
           typename J,
+          typename A,
           typename T,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
@@ -442,18 +425,61 @@ __launch_bounds__(BLOCKSIZE) __global__
                                U alpha_device_host,
                                const I* __restrict__ csr_row_ptr,
                                const J* __restrict__ csr_col_ind,
-                               const T* __restrict__ csr_val,
+                               const A* __restrict__ csr_val,
                                const T* __restrict__ x,
                                U beta_device_host,
                                T* __restrict__ y,
-                               rocsparse_index_base idx_base)
+                               rocsparse_index_base idx_base,
+                               bool                 conj)
 {
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
     if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
     {
         csrmvn_general_device<BLOCKSIZE, WF_SIZE>(
-            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base, conj);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          unsigned int BATCH_CHUNK,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_strided_batched_kernel(J   m,
+                                       int batch_count,
+                                       U   alpha_device_host,
+                                       const I* __restrict__ csr_row_ptr,
+                                       const J* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       int64_t val_batch_stride,
+                                       const T* __restrict__ x,
+                                       int64_t x_batch_stride,
+                                       U       beta_device_host,
+                                       T* __restrict__ y,
+                                       int64_t              y_batch_stride,
+                                       rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_strided_batched_device<BLOCKSIZE, WF_SIZE, BATCH_CHUNK>(m,
+                                                                       batch_count,
+                                                                       alpha,
+                                                                       csr_row_ptr,
+                                                                       csr_col_ind,
+                                                                       csr_val,
+                                                                       val_batch_stride,
+                                                                       x,
+                                                                       x_batch_stride,
+                                                                       beta,
+                                                                       y,
+                                                                       y_batch_stride,
+                                                                       idx_base);
     }
 }
 
@@ -489,7 +515,322 @@ __launch_bounds__(WG_SIZE) __global__
     }
 }
 
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_symm_kernel(J m,
+                            U alpha_device_host,
+                            const I* __restrict__ csr_row_ptr,
+                            const J* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            U beta_device_host,
+                            T* __restrict__ y,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            bool                 conj)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_symm_device<BLOCKSIZE, WF_SIZE>(
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base, fill_mode, conj);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_symm_kernel(J m,
+                            U alpha_device_host,
+                            const I* __restrict__ csr_row_ptr,
+                            const J* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            T* __restrict__ y,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            bool                 conj)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvt_symm_device<BLOCKSIZE, WF_SIZE>(
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base, fill_mode, conj);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_scale_kernel(I size, U beta_device_host, T* __restrict__ data)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != static_cast<T>(1))
+    {
+        csrmvt_scale_device(size, beta, data);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_general_kernel(J m,
+                               U alpha_device_host,
+                               const I* __restrict__ csr_row_ptr,
+                               const J* __restrict__ csr_col_ind,
+                               const A* __restrict__ csr_val,
+                               const T* __restrict__ x,
+                               T* __restrict__ y,
+                               rocsparse_index_base idx_base,
+                               bool                 conj)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvt_general_device<BLOCKSIZE, WF_SIZE>(
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base, conj);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_csc_kernel(J n,
+                           U alpha_device_host,
+                           const I* __restrict__ csc_col_ptr,
+                           const J* __restrict__ csc_row_ind,
+                           const I* __restrict__ csc_perm,
+                           const T* __restrict__ csr_val,
+                           const T* __restrict__ x,
+                           U beta_device_host,
+                           T* __restrict__ y,
+                           bool conj)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvt_csc_device<BLOCKSIZE, WF_SIZE>(
+            n, alpha, csc_col_ptr, csc_row_ind, csc_perm, csr_val, x, beta, y, conj);
+    }
+}
+
+#define LAUNCH_CSRMVT_GENERAL_KERNEL(BLOCKSIZE, WF_SIZE)            \
+    hipLaunchKernelGGL((csrmvt_general_kernel<BLOCKSIZE, WF_SIZE>), \
+                       dim3((m - 1) / BLOCKSIZE + 1),               \
+                       dim3(BLOCKSIZE),                             \
+                       0,                                           \
+                       stream,                                      \
+                       m,                                           \
+                       alpha_device_host,                           \
+                       csr_row_ptr,                                 \
+                       csr_col_ind,                                 \
+                       csr_val,                                     \
+                       x,                                           \
+                       y,                                           \
+                       descr->base,                                 \
+                       conj)
+
+#define LAUNCH_CSRMVT_CSC_KERNEL(BLOCKSIZE, WF_SIZE)             \
+    hipLaunchKernelGGL((csrmvt_csc_kernel<BLOCKSIZE, WF_SIZE>),  \
+                       dim3((n - 1) / BLOCKSIZE + 1),            \
+                       dim3(BLOCKSIZE),                          \
+                       0,                                        \
+                       stream,                                   \
+                       n,                                        \
+                       alpha_device_host,                        \
+                       static_cast<const I*>(info->csc_col_ptr), \
+                       static_cast<const J*>(info->csc_row_ind), \
+                       static_cast<const I*>(info->csc_perm),    \
+                       csr_val,                                  \
+                       x,                                        \
+                       beta_device_host,                         \
+                       y,                                        \
+                       conj)
+
+#define LAUNCH_CSRMV_SYMM_KERNELS(BLOCKSIZE, WF_SIZE)            \
+    hipLaunchKernelGGL((csrmvn_symm_kernel<BLOCKSIZE, WF_SIZE>), \
+                       dim3((m - 1) / BLOCKSIZE + 1),            \
+                       dim3(BLOCKSIZE),                          \
+                       0,                                        \
+                       stream,                                   \
+                       m,                                        \
+                       alpha_device_host,                        \
+                       csr_row_ptr,                              \
+                       csr_col_ind,                              \
+                       csr_val,                                  \
+                       x,                                        \
+                       beta_device_host,                         \
+                       y,                                        \
+                       descr->base,                              \
+                       descr->fill_mode,                         \
+                       conj_stored);                             \
+    hipLaunchKernelGGL((csrmvt_symm_kernel<BLOCKSIZE, WF_SIZE>), \
+                       dim3((m - 1) / BLOCKSIZE + 1),            \
+                       dim3(BLOCKSIZE),                          \
+                       0,                                        \
+                       stream,                                   \
+                       m,                                        \
+                       alpha_device_host,                        \
+                       csr_row_ptr,                              \
+                       csr_col_ind,                              \
+                       csr_val,                                  \
+                       x,                                        \
+                       y,                                        \
+                       descr->base,                              \
+                       descr->fill_mode,                         \
+                       conj_mirror)
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_csrmv_symm_template_dispatch(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        J                         m,
+                                                        I                         nnz,
+                                                        U                         alpha_device_host,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        const T*                  x,
+                                                        U                         beta_device_host,
+                                                        T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The stored triangle is applied row-wise, its mirror image is scattered
+    bool conj_stored;
+    bool conj_mirror;
+    rocsparse_symmetric_conj(trans, descr->type, &conj_stored, &conj_mirror);
+
+#define CSRMV_SYMM_DIM 512
+    // Only one triangle is read, thus half of the entries per row on average
+    J nnz_per_row = nnz / m / 2;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMV_SYMM_KERNELS(CSRMV_SYMM_DIM, 2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMV_SYMM_KERNELS(CSRMV_SYMM_DIM, 4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMV_SYMM_KERNELS(CSRMV_SYMM_DIM, 8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMV_SYMM_KERNELS(CSRMV_SYMM_DIM, 16);
+    }
+    else
+    {
+        LAUNCH_CSRMV_SYMM_KERNELS(CSRMV_SYMM_DIM, 32);
+    }
+#undef CSRMV_SYMM_DIM
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRMV_SYMM_KERNELS
+
+#define LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(BLOCKSIZE, WF_SIZE, BATCH_CHUNK)              \
+    hipLaunchKernelGGL((csrmvn_strided_batched_kernel<BLOCKSIZE, WF_SIZE, BATCH_CHUNK>),   \
+                       dim3((m - 1) / BLOCKSIZE + 1, (batch_count - 1) / BATCH_CHUNK + 1), \
+                       dim3(BLOCKSIZE),                                                    \
+                       0,                                                                  \
+                       stream,                                                             \
+                       m,                                                                  \
+                       batch_count,                                                        \
+                       alpha_device_host,                                                  \
+                       csr_row_ptr,                                                        \
+                       csr_col_ind,                                                        \
+                       csr_val,                                                            \
+                       val_batch_stride,                                                   \
+                       x,                                                                  \
+                       x_batch_stride,                                                     \
+                       beta_device_host,                                                   \
+                       y,                                                                  \
+                       y_batch_stride,                                                     \
+                       descr->base)
+
 template <typename I, typename J, typename T, typename U>
+rocsparse_status
+    rocsparse_csrmv_strided_batched_template_dispatch(rocsparse_handle          handle,
+                                                      J                         m,
+                                                      I                         nnz,
+                                                      int                       batch_count,
+                                                      U                         alpha_device_host,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      int64_t                   val_batch_stride,
+                                                      const I*                  csr_row_ptr,
+                                                      const J*                  csr_col_ind,
+                                                      const T*                  x,
+                                                      int64_t                   x_batch_stride,
+                                                      U                         beta_device_host,
+                                                      T*                        y,
+                                                      int64_t                   y_batch_stride)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_BATCHED_DIM 512
+#define CSRMVN_BATCH_CHUNK 8
+    // Each column index is loaded once and applied to a chunk of batches
+    J nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 2, CSRMVN_BATCH_CHUNK);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 4, CSRMVN_BATCH_CHUNK);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 8, CSRMVN_BATCH_CHUNK);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 16, CSRMVN_BATCH_CHUNK);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 32, CSRMVN_BATCH_CHUNK);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL(CSRMVN_BATCHED_DIM, 64, CSRMVN_BATCH_CHUNK);
+    }
+#undef CSRMVN_BATCH_CHUNK
+#undef CSRMVN_BATCHED_DIM
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRMVN_STRIDED_BATCHED_KERNEL
+
+template <typename I, typename J, typename A, typename T, typename U>
 rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
                                                    J                         m,
@@ -497,12 +838,13 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
                                                    const T*                  x,
                                                    U                         beta_device_host,
-                                                   T*                        y)
+                                                   T*                        y,
+                                                   bool                      conj_A)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -534,7 +876,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 8)
             {
@@ -551,7 +894,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 16)
             {
@@ -568,7 +912,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 32)
             {
@@ -585,7 +930,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else
             {
@@ -602,7 +948,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             // LCOV_EXCL_STOP
         }
@@ -624,7 +971,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 8)
             {
@@ -641,7 +989,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 16)
             {
@@ -658,7 +1007,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 32)
             {
@@ -675,7 +1025,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else if(nnz_per_row < 64)
             {
@@ -692,7 +1043,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
             else
             {
@@ -709,7 +1061,8 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                    x,
                                    beta_device_host,
                                    y,
-                                   descr->base);
+                                   descr->base,
+                                   conj_A);
             }
         }
 
@@ -717,8 +1070,47 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Without analysis data, rows of A are scattered into y
+        bool conj = (trans == rocsparse_operation_conjugate_transpose) != conj_A;
+
+#define CSRMVT_DIM 512
+        // Scale y with beta, y has n entries
+        hipLaunchKernelGGL((csrmvt_scale_kernel<CSRMVT_DIM>),
+                           dim3((n - 1) / CSRMVT_DIM + 1),
+                           dim3(CSRMVT_DIM),
+                           0,
+                           stream,
+                           n,
+                           beta_device_host,
+                           y);
+
+        J nnz_per_row = nnz / m;
+
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 16);
+        }
+        else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 32);
+        }
+        else
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 64);
+        }
+#undef CSRMVT_DIM
     }
     return rocsparse_status_success;
 }
@@ -787,12 +1179,45 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Columns of A are gathered through the CSC structure of the analysis, which
+        // is deterministic and does not require atomics
+        bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+#define CSRMVT_DIM 512
+        I nnz_per_col = nnz / n;
+
+        if(nnz_per_col < 4)
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 2);
+        }
+        else if(nnz_per_col < 8)
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 4);
+        }
+        else if(nnz_per_col < 16)
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 8);
+        }
+        else if(nnz_per_col < 32)
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 16);
+        }
+        else if(nnz_per_col < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 32);
+        }
+        else
+        {
+            LAUNCH_CSRMVT_CSC_KERNEL(CSRMVT_DIM, 64);
+        }
+#undef CSRMVT_DIM
     }
     return rocsparse_status_success;
 }
 
+#undef LAUNCH_CSRMVT_GENERAL_KERNEL
+#undef LAUNCH_CSRMVT_CSC_KERNEL
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -820,6 +1245,9 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrmv"),
@@ -850,7 +1278,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -862,6 +1290,12 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and hermitian matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -892,6 +1326,58 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Capture the operands
+    if(handle->capture != nullptr)
+    {
+        rocsparse_capture_csrmv(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha_device_host,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                beta_device_host,
+                                info != nullptr && info->csrmv_info != nullptr);
+    }
+
+    // Symmetric and hermitian matrices, only the triangle given by the fill mode is read
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmv_symm_template_dispatch(handle,
+                                                          trans,
+                                                          m,
+                                                          nnz,
+                                                          alpha_device_host,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          x,
+                                                          beta_device_host,
+                                                          y);
+        }
+        else
+        {
+            return rocsparse_csrmv_symm_template_dispatch(handle,
+                                                          trans,
+                                                          m,
+                                                          nnz,
+                                                          *alpha_device_host,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          x,
+                                                          *beta_device_host,
+                                                          y);
+        }
+    }
+
     if(info == nullptr || info->csrmv_info == nullptr)
     {
         // If csrmv info is not available, call csrmv general
@@ -910,7 +1396,8 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                                      csr_col_ind,
                                                      x,
                                                      beta_device_host,
-                                                     y);
+                                                     y,
+                                                     false);
         }
         else
         {
@@ -926,7 +1413,8 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                                      csr_col_ind,
                                                      x,
                                                      *beta_device_host,
-                                                     y);
+                                                     y,
+                                                     false);
         }
     }
     else
@@ -971,34 +1459,318 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     }
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
-    template rocsparse_status rocsparse_csrmv_analysis_template<ITYPE, JTYPE, TTYPE>( \
-        rocsparse_handle          handle,                                             \
-        rocsparse_operation       trans,                                              \
-        JTYPE                     m,                                                  \
-        JTYPE                     n,                                                  \
-        ITYPE                     nnz,                                                \
-        const rocsparse_mat_descr descr,                                              \
-        const TTYPE*              csr_val,                                            \
-        const ITYPE*              csr_row_ptr,                                        \
-        const JTYPE*              csr_col_ind,                                        \
+template <typename I, typename J, typename A, typename T>
+rocsparse_status rocsparse_csrmv_mixed_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                const T*                  x,
+                                                const T*                  beta_device_host,
+                                                T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Mixed precision is only available for general matrices through the stream kernels
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Values are read in their storage precision and accumulated in the compute precision
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_template_dispatch(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 beta_device_host,
+                                                 y,
+                                                 false);
+    }
+    else
+    {
+        return rocsparse_csrmv_template_dispatch(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 *alpha_device_host,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 *beta_device_host,
+                                                 y,
+                                                 false);
+    }
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrmv_strided_batched_template(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             J                         m,
+                                             J                         n,
+                                             I                         nnz,
+                                             int                       batch_count,
+                                             const T*                  alpha_device_host,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             int64_t                   val_batch_stride,
+                                             const I*                  csr_row_ptr,
+                                             const J*                  csr_col_ind,
+                                             const T*                  x,
+                                             int64_t                   x_batch_stride,
+                                             const T*                  beta_device_host,
+                                             T*                        y,
+                                             int64_t                   y_batch_stride)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Batches are only available for non-transposed general matrices
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || batch_count < 0 || val_batch_stride < 0 || x_batch_stride < 0
+       || y_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_strided_batched_template_dispatch(handle,
+                                                                 m,
+                                                                 nnz,
+                                                                 batch_count,
+                                                                 alpha_device_host,
+                                                                 descr,
+                                                                 csr_val,
+                                                                 val_batch_stride,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 x,
+                                                                 x_batch_stride,
+                                                                 beta_device_host,
+                                                                 y,
+                                                                 y_batch_stride);
+    }
+    else
+    {
+        return rocsparse_csrmv_strided_batched_template_dispatch(handle,
+                                                                 m,
+                                                                 nnz,
+                                                                 batch_count,
+                                                                 *alpha_device_host,
+                                                                 descr,
+                                                                 csr_val,
+                                                                 val_batch_stride,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 x,
+                                                                 x_batch_stride,
+                                                                 *beta_device_host,
+                                                                 y,
+                                                                 y_batch_stride);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                     \
+    template rocsparse_status rocsparse_csrmv_analysis_template<ITYPE, JTYPE, TTYPE>(        \
+        rocsparse_handle          handle,                                                    \
+        rocsparse_operation       trans,                                                     \
+        JTYPE                     m,                                                         \
+        JTYPE                     n,                                                         \
+        ITYPE                     nnz,                                                       \
+        const rocsparse_mat_descr descr,                                                     \
+        const TTYPE*              csr_val,                                                   \
+        const ITYPE*              csr_row_ptr,                                               \
+        const JTYPE*              csr_col_ind,                                               \
         rocsparse_mat_info        info);                                                     \
-    template rocsparse_status rocsparse_csrmv_template<ITYPE, JTYPE, TTYPE>(          \
-        rocsparse_handle          handle,                                             \
-        rocsparse_operation       trans,                                              \
-        JTYPE                     m,                                                  \
-        JTYPE                     n,                                                  \
-        ITYPE                     nnz,                                                \
-        const TTYPE*              alpha_device_host,                                  \
-        const rocsparse_mat_descr descr,                                              \
-        const TTYPE*              csr_val,                                            \
-        const ITYPE*              csr_row_ptr,                                        \
-        const JTYPE*              csr_col_ind,                                        \
-        rocsparse_mat_info        info,                                               \
-        const TTYPE*              x,                                                  \
-        const TTYPE*              beta_device_host,                                   \
+    template rocsparse_status rocsparse_csrmv_template<ITYPE, JTYPE, TTYPE>(                 \
+        rocsparse_handle          handle,                                                    \
+        rocsparse_operation       trans,                                                     \
+        JTYPE                     m,                                                         \
+        JTYPE                     n,                                                         \
+        ITYPE                     nnz,                                                       \
+        const TTYPE*              alpha_device_host,                                         \
+        const rocsparse_mat_descr descr,                                                     \
+        const TTYPE*              csr_val,                                                   \
+        const ITYPE*              csr_row_ptr,                                               \
+        const JTYPE*              csr_col_ind,                                               \
+        rocsparse_mat_info        info,                                                      \
+        const TTYPE*              x,                                                         \
+        const TTYPE*              beta_device_host,                                          \
+        TTYPE*                    y);                                                        \
+    template rocsparse_status rocsparse_csrmv_strided_batched_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                                    \
+        rocsparse_operation       trans,                                                     \
+        JTYPE                     m,                                                         \
+        JTYPE                     n,                                                         \
+        ITYPE                     nnz,                                                       \
+        int                       batch_count,                                               \
+        const TTYPE*              alpha_device_host,                                         \
+        const rocsparse_mat_descr descr,                                                     \
+        const TTYPE*              csr_val,                                                   \
+        int64_t                   val_batch_stride,                                          \
+        const ITYPE*              csr_row_ptr,                                               \
+        const JTYPE*              csr_col_ind,                                               \
+        const TTYPE*              x,                                                         \
+        int64_t                   x_batch_stride,                                            \
+        const TTYPE*              beta_device_host,                                          \
+        TTYPE*                    y,                                                         \
+        int64_t                   y_batch_stride);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
+
+#define INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, UTYPE)                  \
+    template rocsparse_status rocsparse_csrmv_template_dispatch(          \
+        rocsparse_handle          handle,                                 \
+        rocsparse_operation       trans,                                  \
+        JTYPE                     m,                                      \
+        JTYPE                     n,                                      \
+        ITYPE                     nnz,                                    \
+        UTYPE                     alpha_device_host,                      \
+        const rocsparse_mat_descr descr,                                  \
+        const TTYPE*              csr_val,                                \
+        const ITYPE*              csr_row_ptr,                            \
+        const JTYPE*              csr_col_ind,                            \
+        const TTYPE*              x,                                      \
+        UTYPE                     beta_device_host,                       \
+        TTYPE*                    y,                                      \
+        bool                      conj_A);                                \
+    template rocsparse_status rocsparse_csrmv_adaptive_template_dispatch( \
+        rocsparse_handle          handle,                                 \
+        rocsparse_operation       trans,                                  \
+        JTYPE                     m,                                      \
+        JTYPE                     n,                                      \
+        ITYPE                     nnz,                                    \
+        UTYPE                     alpha_device_host,                      \
+        const rocsparse_mat_descr descr,                                  \
+        const TTYPE*              csr_val,                                \
+        const ITYPE*              csr_row_ptr,                            \
+        const JTYPE*              csr_col_ind,                            \
+        rocsparse_csrmv_info      info,                                   \
+        const TTYPE*              x,                                      \
+        UTYPE                     beta_device_host,                       \
         TTYPE*                    y);
 
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                     \
+    INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, const TTYPE*); \
+    INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, TTYPE)
+
 INSTANTIATE(int32_t, int32_t, float);
 INSTANTIATE(int32_t, int32_t, double);
 INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
@@ -1012,6 +1784,34 @@ INSTANTIATE(int64_t, int64_t, double);
 INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 
+#undef INSTANTIATE
+
+#define INSTANTIATE(ITYPE, JTYPE, ATYPE, TTYPE)                                           \
+    template rocsparse_status rocsparse_csrmv_mixed_template<ITYPE, JTYPE, ATYPE, TTYPE>( \
+        rocsparse_handle          handle,                                                 \
+        rocsparse_operation       trans,                                                  \
+        JTYPE                     m,                                                      \
+        JTYPE                     n,                                                      \
+        ITYPE                     nnz,                                                    \
+        const TTYPE*              alpha_device_host,                                      \
+        const rocsparse_mat_descr descr,                                                  \
+        const ATYPE*              csr_val,                                                \
+        const ITYPE*              csr_row_ptr,                                            \
+        const JTYPE*              csr_col_ind,                                            \
+        const TTYPE*              x,                                                      \
+        const TTYPE*              beta_device_host,                                       \
+        TTYPE*                    y)
+
+INSTANTIATE(int32_t, int32_t, float, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, rocsparse_double_complex);
+
+#undef INSTANTIATE
+#undef INSTANTIATE_DISPATCH
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -1097,6 +1897,9 @@ extern "C" rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsp
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_csrmv_clear", (const void*&)info);
 
@@ -40,7 +40,7 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
                                                    const J*                  csr_col_ind,
                                                    rocsparse_mat_info        info);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename A, typename T, typename U>
 rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
                                                    J                         m,
@@ -48,12 +48,29 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
                                                    const T*                  x,
                                                    U                         beta_device_host,
-                                                   T*                        y);
+                                                   T*                        y,
+                                                   bool                      conj_A);
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle    handle,
+                                                            rocsparse_operation trans,
+                                                            J                   m,
+                                                            J                   n,
+                                                            I                   nnz,
+                                                            U                   alpha_device_host,
+                                                            const rocsparse_mat_descr descr,
+                                                            const T*                  csr_val,
+                                                            const I*                  csr_row_ptr,
+                                                            const J*                  csr_col_ind,
+                                                            rocsparse_csrmv_info      info,
+                                                            const T*                  x,
+                                                            U  beta_device_host,
+                                                            T* y);
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
@@ -71,4 +88,38 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           const T*                  beta,
                                           T*                        y);
 
+template <typename I, typename J, typename A, typename T>
+rocsparse_status rocsparse_csrmv_mixed_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_strided_batched_template(rocsparse_handle    handle,
+                                                          rocsparse_operation trans,
+                                                          J                   m,
+                                                          J                   n,
+                                                          I                   nnz,
+                                                          int                 batch_count,
+                                                          const T*            alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          int64_t  val_batch_stride,
+                                                          const I* csr_row_ptr,
+                                                          const J* csr_col_ind,
+                                                          const T* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          T*       y,
+                                                          int64_t  y_batch_stride);
+
 #endif // ROCSPARSE_CSRMV_HPP
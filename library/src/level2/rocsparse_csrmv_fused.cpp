@@ -0,0 +1,487 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrmv_fused.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrmv_device.h"
+
+#define CSRMVN_FUSED_DIM 256
+#define CSRMVN_FUSED_MAX_BLOCKS 1024
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_fused_kernel(J m,
+                             U alpha_device_host,
+                             const I* __restrict__ csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const T* __restrict__ x,
+                             const T* __restrict__ x_dot,
+                             U                    beta_device_host,
+                             const T*             y_in,
+                             T*                   y_out,
+                             T*                   workspace,
+                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    csrmvn_fused_device<BLOCKSIZE, WF_SIZE>(m,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            x_dot,
+                                            beta,
+                                            y_in,
+                                            y_out,
+                                            workspace,
+                                            idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_fused_reduce_kernel(int nblocks, const T* workspace, T* dot, T* nrm2)
+{
+    csrmvn_fused_reduce_device<BLOCKSIZE>(nblocks, workspace, dot, nrm2);
+}
+
+#define LAUNCH_CSRMVN_FUSED_KERNEL(BLOCKSIZE, WF_SIZE)                     \
+    nblocks = std::min(static_cast<J>(CSRMVN_FUSED_MAX_BLOCKS),            \
+                       (m - 1) / static_cast<J>(BLOCKSIZE / WF_SIZE) + 1); \
+    hipLaunchKernelGGL((csrmvn_fused_kernel<BLOCKSIZE, WF_SIZE>),          \
+                       dim3(nblocks),                                      \
+                       dim3(BLOCKSIZE),                                    \
+                       0,                                                  \
+                       stream,                                             \
+                       m,                                                  \
+                       alpha_device_host,                                  \
+                       csr_row_ptr,                                        \
+                       csr_col_ind,                                        \
+                       csr_val,                                            \
+                       x,                                                  \
+                       (dot != nullptr) ? x : nullptr,                     \
+                       beta_device_host,                                   \
+                       y_in,                                               \
+                       y_out,                                              \
+                       workspace,                                          \
+                       descr->base)
+
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status rocsparse_csrmv_fused_dispatch(rocsparse_handle          handle,
+                                                       J                         m,
+                                                       I                         nnz,
+                                                       U                         alpha_device_host,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       const I*                  csr_row_ptr,
+                                                       const J*                  csr_col_ind,
+                                                       const T*                  x,
+                                                       U                         beta_device_host,
+                                                       const T*                  y_in,
+                                                       T*                        y_out,
+                                                       T*                        dot,
+                                                       T*                        nrm2,
+                                                       void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible, the reductions over an empty vector vanish
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            if(dot != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(dot, 0, sizeof(T), stream));
+            }
+
+            if(nrm2 != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(nrm2, 0, sizeof(T), stream));
+            }
+        }
+        else
+        {
+            if(dot != nullptr)
+            {
+                *dot = static_cast<T>(0);
+            }
+
+            if(nrm2 != nullptr)
+            {
+                *nrm2 = static_cast<T>(0);
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Partial sums of each block, followed by the final results
+    T* workspace = reinterpret_cast<T*>(temp_buffer);
+    T* result    = workspace + 2 * CSRMVN_FUSED_MAX_BLOCKS;
+
+    // The number of blocks only depends on the matrix, such that the partial sums are
+    // always reduced in the same order
+    J nblocks;
+    J nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_FUSED_KERNEL(CSRMVN_FUSED_DIM, 64);
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvn_fused_reduce_kernel<CSRMVN_FUSED_DIM>),
+                           dim3(1),
+                           dim3(CSRMVN_FUSED_DIM),
+                           0,
+                           stream,
+                           static_cast<int>(nblocks),
+                           workspace,
+                           dot,
+                           nrm2);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_fused_reduce_kernel<CSRMVN_FUSED_DIM>),
+                           dim3(1),
+                           dim3(CSRMVN_FUSED_DIM),
+                           0,
+                           stream,
+                           static_cast<int>(nblocks),
+                           workspace,
+                           result,
+                           result + 1);
+
+        if(dot != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(dot, result, sizeof(T)));
+        }
+
+        if(nrm2 != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(nrm2, result + 1, sizeof(T)));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRMVN_FUSED_KERNEL
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_fused_buffer_size_template(rocsparse_handle handle,
+                                                            size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Partial sums of dot product and norm for each block, and both final results
+    *buffer_size = sizeof(T) * (2 * CSRMVN_FUSED_MAX_BLOCKS + 2);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_dot_template(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              J                         m,
+                                              J                         n,
+                                              I                         nnz,
+                                              const T*                  alpha_device_host,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              const T*                  x,
+                                              const T*                  beta_device_host,
+                                              T*                        y,
+                                              T*                        dot,
+                                              T*                        nrm2,
+                                              void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Rows are reduced on the fly, thus only non-transposed general matrices are supported
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The dot product requires x and y to be of the same length
+    if(dot != nullptr && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m > 0
+       && (csr_row_ptr == nullptr || y == nullptr || (dot != nullptr && x == nullptr)
+           || (nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr || x == nullptr))))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // y is read and written by the same thread, thus it can be passed as input and output
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_fused_dispatch(handle,
+                                              m,
+                                              nnz,
+                                              alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              x,
+                                              beta_device_host,
+                                              y,
+                                              y,
+                                              dot,
+                                              nrm2,
+                                              temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrmv_fused_dispatch(handle,
+                                              m,
+                                              nnz,
+                                              *alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              x,
+                                              *beta_device_host,
+                                              y,
+                                              y,
+                                              dot,
+                                              nrm2,
+                                              temp_buffer);
+    }
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_residual_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const T*                  x,
+                                                   const T*                  b,
+                                                   T*                        r,
+                                                   T*                        nrm2,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Rows are reduced on the fly, thus only non-transposed general matrices are supported
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m > 0
+       && (csr_row_ptr == nullptr || b == nullptr || r == nullptr
+           || (nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr || x == nullptr))))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // r = -A * x + b, the scalars are passed by value independent of the pointer mode.
+    // The dot product of the residual is not defined, since x and r differ in general.
+    return rocsparse_csrmv_fused_dispatch(handle,
+                                          m,
+                                          nnz,
+                                          static_cast<T>(-1),
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          x,
+                                          static_cast<T>(1),
+                                          b,
+                                          r,
+                                          (T*)nullptr,
+                                          nrm2,
+                                          temp_buffer);
+}
+
+#undef CSRMVN_FUSED_MAX_BLOCKS
+#undef CSRMVN_FUSED_DIM
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                  \
+    template rocsparse_status rocsparse_csrmv_dot_template<ITYPE, JTYPE, TTYPE>(          \
+        rocsparse_handle          handle,                                                 \
+        rocsparse_operation       trans,                                                  \
+        JTYPE                     m,                                                      \
+        JTYPE                     n,                                                      \
+        ITYPE                     nnz,                                                    \
+        const TTYPE*              alpha_device_host,                                      \
+        const rocsparse_mat_descr descr,                                                  \
+        const TTYPE*              csr_val,                                                \
+        const ITYPE*              csr_row_ptr,                                            \
+        const JTYPE*              csr_col_ind,                                            \
+        const TTYPE*              x,                                                      \
+        const TTYPE*              beta_device_host,                                       \
+        TTYPE*                    y,                                                      \
+        TTYPE*                    dot,                                                    \
+        TTYPE*                    nrm2,                                                   \
+        void*                     temp_buffer);                                           \
+    template rocsparse_status rocsparse_csrmv_residual_template<ITYPE, JTYPE, TTYPE>(     \
+        rocsparse_handle          handle,                                                 \
+        rocsparse_operation       trans,                                                  \
+        JTYPE                     m,                                                      \
+        JTYPE                     n,                                                      \
+        ITYPE                     nnz,                                                    \
+        const rocsparse_mat_descr descr,                                                  \
+        const TTYPE*              csr_val,                                                \
+        const ITYPE*              csr_row_ptr,                                            \
+        const JTYPE*              csr_col_ind,                                            \
+        const TTYPE*              x,                                                      \
+        const TTYPE*              b,                                                      \
+        TTYPE*                    r,                                                      \
+        TTYPE*                    nrm2,                                                   \
+        void*                     temp_buffer)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
+
+#define INSTANTIATE(TTYPE)                                                       \
+    template rocsparse_status rocsparse_csrmv_fused_buffer_size_template<TTYPE>( \
+        rocsparse_handle handle, size_t * buffer_size)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+
+#undef INSTANTIATE
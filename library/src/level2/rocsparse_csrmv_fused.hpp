@@ -0,0 +1,69 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_FUSED_HPP
+#define ROCSPARSE_CSRMV_FUSED_HPP
+
+#include "handle.h"
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_fused_buffer_size_template(rocsparse_handle handle,
+                                                            size_t*          buffer_size);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_dot_template(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              J                         m,
+                                              J                         n,
+                                              I                         nnz,
+                                              const T*                  alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              const T*                  x,
+                                              const T*                  beta,
+                                              T*                        y,
+                                              T*                        dot,
+                                              T*                        nrm2,
+                                              void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_residual_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const T*                  x,
+                                                   const T*                  b,
+                                                   T*                        r,
+                                                   T*                        nrm2,
+                                                   void*                     temp_buffer);
+
+#endif // ROCSPARSE_CSRMV_FUSED_HPP
@@ -0,0 +1,429 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrmv_merge.hpp"
+#include "definitions.h"
+#include "rocsparse_csrmv.hpp"
+#include "utility.h"
+
+#include "csrmv_device.h"
+
+#define CSRMVN_MERGE_ANALYSIS_DIM 256
+#define CSRMVN_MERGE_FIXUP_DIM 256
+
+template <unsigned int BLOCKSIZE,
+          unsigned int ITEMS,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_kernel(U alpha_device_host,
+                             const J* __restrict__ tile_row,
+                             const I* __restrict__ tile_nnz,
+                             T* __restrict__ tile_carry,
+                             const I* __restrict__ csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const T* __restrict__ x,
+                             U beta_device_host,
+                             T* __restrict__ y,
+                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_merge_device<BLOCKSIZE, ITEMS>(alpha,
+                                              tile_row,
+                                              tile_nnz,
+                                              tile_carry,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              x,
+                                              beta,
+                                              y,
+                                              idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_fixup_kernel(J       m,
+                                   int64_t ntiles,
+                                   U       alpha_device_host,
+                                   const J* __restrict__ tile_row,
+                                   const T* __restrict__ tile_carry,
+                                   T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvn_merge_fixup_device<BLOCKSIZE>(m, ntiles, alpha, tile_row, tile_carry, y);
+    }
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_merge_analysis_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans,
+                                                         J                         m,
+                                                         J                         n,
+                                                         I                         nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const I*                  csr_row_ptr,
+                                                         const J*                  csr_col_ind,
+                                                         rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Clear merge path info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_merge_info));
+    info->csrmv_merge_info = nullptr;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Transposed operations and symmetric matrices run the stream kernels and do not
+    // require merge path tiles
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Create csrmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_merge_info));
+
+    rocsparse_csrmv_info merge_info = info->csrmv_merge_info;
+
+    // Store some pointers to verify correct execution
+    merge_info->trans       = trans;
+    merge_info->m           = m;
+    merge_info->n           = n;
+    merge_info->nnz         = nnz;
+    merge_info->descr       = descr;
+    merge_info->csr_row_ptr = csr_row_ptr;
+    merge_info->csr_col_ind = csr_col_ind;
+
+    // Meta data is allocated with the allocator of the handle
+    merge_info->allocator = handle->allocator;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The tiles only depend on the row pointers, such that the analysis is a single
+    // search per tile boundary on the device and does not synchronize with the host
+    merge_info->ntiles = csrmv_merge_path_ntiles(m, nnz, CSRMV_MERGE_TILE_ITEMS);
+
+    const rocsparse_device_allocator& allocator = merge_info->allocator;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        allocator.allocate(&merge_info->tile_row, sizeof(J) * (merge_info->ntiles + 1), stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        allocator.allocate(&merge_info->tile_nnz, sizeof(I) * (merge_info->ntiles + 1), stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        allocator.allocate(&merge_info->tile_carry, sizeof(T) * merge_info->ntiles, stream));
+
+    hipLaunchKernelGGL((csrmvn_merge_analysis_kernel<CSRMVN_MERGE_ANALYSIS_DIM>),
+                       dim3(merge_info->ntiles / CSRMVN_MERGE_ANALYSIS_DIM + 1),
+                       dim3(CSRMVN_MERGE_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       merge_info->ntiles,
+                       csr_row_ptr,
+                       descr->base,
+                       static_cast<J*>(merge_info->tile_row),
+                       static_cast<I*>(merge_info->tile_nnz));
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status rocsparse_csrmv_merge_dispatch(rocsparse_handle          handle,
+                                                       J                         m,
+                                                       J                         n,
+                                                       I                         nnz,
+                                                       U                         alpha_device_host,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       const I*                  csr_row_ptr,
+                                                       const J*                  csr_col_ind,
+                                                       rocsparse_csrmv_info      info,
+                                                       const T*                  x,
+                                                       U                         beta_device_host,
+                                                       T*                        y)
+{
+    // Check if info matches current matrix and options
+    if(info->m != m || info->n != n || info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(info->csr_row_ptr != csr_row_ptr || info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    const J* tile_row   = static_cast<const J*>(info->tile_row);
+    const I* tile_nnz   = static_cast<const I*>(info->tile_nnz);
+    T*       tile_carry = static_cast<T*>(info->tile_carry);
+
+    // One block per tile
+    hipLaunchKernelGGL((csrmvn_merge_kernel<CSRMV_MERGE_DIM, CSRMV_MERGE_ITEMS_PER_THREAD>),
+                       dim3(info->ntiles),
+                       dim3(CSRMV_MERGE_DIM),
+                       0,
+                       stream,
+                       alpha_device_host,
+                       tile_row,
+                       tile_nnz,
+                       tile_carry,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       x,
+                       beta_device_host,
+                       y,
+                       descr->base);
+
+    // Rows that span multiple tiles
+    if(info->ntiles > 1)
+    {
+        hipLaunchKernelGGL((csrmvn_merge_fixup_kernel<CSRMVN_MERGE_FIXUP_DIM>),
+                           dim3((info->ntiles - 1) / CSRMVN_MERGE_FIXUP_DIM + 1),
+                           dim3(CSRMVN_MERGE_FIXUP_DIM),
+                           0,
+                           stream,
+                           m,
+                           info->ntiles,
+                           alpha_device_host,
+                           tile_row,
+                           static_cast<const T*>(tile_carry),
+                           y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  x,
+                                                const T*                  beta_device_host,
+                                                T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Operations without merge path tiles run the stream kernels
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general
+       || info == nullptr || info->csrmv_merge_info == nullptr)
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        nullptr,
+                                        x,
+                                        beta_device_host,
+                                        y);
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_merge_dispatch(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info->csrmv_merge_info,
+                                              x,
+                                              beta_device_host,
+                                              y);
+    }
+    else
+    {
+        return rocsparse_csrmv_merge_dispatch(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              *alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info->csrmv_merge_info,
+                                              x,
+                                              *beta_device_host,
+                                              y);
+    }
+}
+
+#undef CSRMVN_MERGE_FIXUP_DIM
+#undef CSRMVN_MERGE_ANALYSIS_DIM
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                    \
+    template rocsparse_status rocsparse_csrmv_merge_analysis_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                                   \
+        rocsparse_operation       trans,                                                    \
+        JTYPE                     m,                                                        \
+        JTYPE                     n,                                                        \
+        ITYPE                     nnz,                                                      \
+        const rocsparse_mat_descr descr,                                                    \
+        const TTYPE*              csr_val,                                                  \
+        const ITYPE*              csr_row_ptr,                                              \
+        const JTYPE*              csr_col_ind,                                              \
+        rocsparse_mat_info        info);                                                    \
+    template rocsparse_status rocsparse_csrmv_merge_template<ITYPE, JTYPE, TTYPE>(          \
+        rocsparse_handle          handle,                                                   \
+        rocsparse_operation       trans,                                                    \
+        JTYPE                     m,                                                        \
+        JTYPE                     n,                                                        \
+        ITYPE                     nnz,                                                      \
+        const TTYPE*              alpha_device_host,                                        \
+        const rocsparse_mat_descr descr,                                                    \
+        const TTYPE*              csr_val,                                                  \
+        const ITYPE*              csr_row_ptr,                                              \
+        const JTYPE*              csr_col_ind,                                              \
+        rocsparse_mat_info        info,                                                     \
+        const TTYPE*              x,                                                        \
+        const TTYPE*              beta_device_host,                                         \
+        TTYPE*                    y)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
@@ -50,7 +50,7 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const rocsparse_int*      csr_row_ptr,
                                         const rocsparse_int*      csr_col_ind,
                                         rocsparse_trm_info        info,
-                                        rocsparse_int**           zero_pivot,
+                                        rocsparse_mat_info        mat_info,
                                         void*                     temp_buffer);
 
 template <typename T>
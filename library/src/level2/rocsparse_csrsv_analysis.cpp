@@ -24,6 +24,7 @@
 #include "rocsparse_csrsv.hpp"
 
 #include "../level1/rocsparse_gthr.hpp"
+#include "analysis_cache.h"
 #include "csrsv_device.h"
 #include "definitions.h"
 #include "utility.h"
@@ -39,12 +40,67 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const rocsparse_int*      csr_row_ptr,
                                         const rocsparse_int*      csr_col_ind,
                                         rocsparse_trm_info        info,
-                                        rocsparse_int**           zero_pivot,
+                                        rocsparse_mat_info        mat_info,
                                         void*                     temp_buffer)
 {
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Release the zero pivot of a previous analysis
+    RETURN_IF_ROCSPARSE_ERROR(mat_info->allocator.deallocate(mat_info->zero_pivot, stream));
+    mat_info->zero_pivot = nullptr;
+
+    // Meta data is allocated with the allocator of the handle
+    mat_info->allocator = handle->allocator;
+    info->allocator     = handle->allocator;
+
+    // Zero pivot of the matrix info, shared by all of its analyses
+    rocsparse_int** zero_pivot = &mat_info->zero_pivot;
+
+    // Reuse the analysis of an identical sparsity pattern, if available
+    rocsparse_analysis_key key;
+    if(handle->analysis_cache != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_analysis_cache_key(handle,
+                                                               rocsparse_analysis_kind::trm,
+                                                               trans,
+                                                               m,
+                                                               m,
+                                                               nnz,
+                                                               descr,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               &key));
+
+        int64_t max_nnz;
+        bool    cached;
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->fetch(key,
+                                                                &max_nnz,
+                                                                {(void**)&info->row_map,
+                                                                 (void**)&info->trm_diag_ind,
+                                                                 (void**)zero_pivot,
+                                                                 (void**)&info->trmt_perm,
+                                                                 (void**)&info->trmt_row_ptr,
+                                                                 (void**)&info->trmt_col_ind},
+                                                                info->allocator,
+                                                                stream,
+                                                                &cached));
+
+        if(cached)
+        {
+            info->max_nnz     = max_nnz;
+            info->m           = m;
+            info->nnz         = nnz;
+            info->descr       = descr;
+            info->trm_row_ptr
+                = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
+            info->trm_col_ind
+                = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
+
+            return rocsparse_status_success;
+        }
+    }
+
     // If analyzing transposed, allocate some info memory to hold the transposed matrix
     if(trans == rocsparse_operation_transpose)
     {
@@ -75,10 +131,12 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(
             tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmt_perm, sizeof(rocsparse_int) * nnz));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->trmt_row_ptr, sizeof(rocsparse_int) * (m + 1)));
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmt_col_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.allocate(
+            (void**)&info->trmt_perm, sizeof(rocsparse_int) * nnz, stream));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.allocate(
+            (void**)&info->trmt_row_ptr, sizeof(rocsparse_int) * (m + 1), stream));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.allocate(
+            (void**)&info->trmt_col_ind, sizeof(rocsparse_int) * nnz, stream));
 
         // Create identity permutation
         RETURN_IF_ROCSPARSE_ERROR(
@@ -152,13 +210,16 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     void* rocprim_buffer = reinterpret_cast<void*>(ptr);
 
     // Allocate buffer to hold diagonal entry point
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trm_diag_ind, sizeof(rocsparse_int) * m));
+    RETURN_IF_ROCSPARSE_ERROR(
+        info->allocator.allocate((void**)&info->trm_diag_ind, sizeof(rocsparse_int) * m, stream));
 
     // Allocate buffer to hold zero pivot
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)zero_pivot, sizeof(rocsparse_int)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        mat_info->allocator.allocate((void**)zero_pivot, sizeof(rocsparse_int), stream));
 
     // Allocate buffer to hold row map
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->row_map, sizeof(rocsparse_int) * m));
+    RETURN_IF_ROCSPARSE_ERROR(
+        info->allocator.allocate((void**)&info->row_map, sizeof(rocsparse_int) * m, stream));
 
     // Initialize zero pivot
     rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
@@ -166,7 +227,7 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         hipMemcpyAsync(*zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
 
     // Wait for device transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
     // Determine gcnArch and ASIC revision
     int gcnArch = handle->properties.gcnArch;
@@ -434,7 +495,7 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         &info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, workspace));
 
@@ -467,6 +528,25 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     info->trm_row_ptr = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
     info->trm_col_ind = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
 
+    // Keep a copy for matrices of identical sparsity pattern
+    if(handle->analysis_cache != nullptr)
+    {
+        size_t trmt_nnz = (trans == rocsparse_operation_none) ? 0 : nnz;
+        size_t trmt_m   = (trans == rocsparse_operation_none) ? 0 : m + 1;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->analysis_cache->insert(key,
+                                           info->max_nnz,
+                                           {{info->row_map, sizeof(rocsparse_int) * m},
+                                            {info->trm_diag_ind, sizeof(rocsparse_int) * m},
+                                            {*zero_pivot, sizeof(rocsparse_int)},
+                                            {info->trmt_perm, sizeof(rocsparse_int) * trmt_nnz},
+                                            {info->trmt_row_ptr, sizeof(rocsparse_int) * trmt_m},
+                                            {info->trmt_col_ind, sizeof(rocsparse_int) * trmt_nnz}},
+                                           handle->allocator,
+                                           stream));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -498,6 +578,9 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsv_analysis"),
@@ -636,7 +719,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             csr_row_ptr,
             csr_col_ind,
             (trans == rocsparse_operation_none) ? info->csrsv_upper_info : info->csrsvt_upper_info,
-            &info->zero_pivot,
+            info,
             temp_buffer));
     }
     else
@@ -710,7 +793,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             csr_row_ptr,
             csr_col_ind,
             (trans == rocsparse_operation_none) ? info->csrsv_lower_info : info->csrsvt_lower_info,
-            &info->zero_pivot,
+            info,
             temp_buffer));
     }
 
@@ -53,6 +53,9 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsv_buffer_size"),
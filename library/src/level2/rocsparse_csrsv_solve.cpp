@@ -115,7 +115,7 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
             info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
 
         // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
     }
 
     // Pointers to differentiate between transpose mode
@@ -262,6 +262,9 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsv"),
@@ -306,6 +306,9 @@ rocsparse_status rocsparse_gebsrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgebsrmv"),
@@ -448,6 +451,32 @@ rocsparse_status rocsparse_gebsrmv_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                       \
+    template rocsparse_status rocsparse_gebsrmv_template<TTYPE>( \
+        rocsparse_handle          handle,                        \
+        rocsparse_direction       dir,                           \
+        rocsparse_operation       trans,                         \
+        rocsparse_int             mb,                            \
+        rocsparse_int             nb,                            \
+        rocsparse_int             nnzb,                          \
+        const TTYPE*              alpha,                         \
+        const rocsparse_mat_descr descr,                         \
+        const TTYPE*              bsr_val,                       \
+        const rocsparse_int*      bsr_row_ptr,                   \
+        const rocsparse_int*      bsr_col_ind,                   \
+        rocsparse_int             row_block_dim,                 \
+        rocsparse_int             col_block_dim,                 \
+        const TTYPE*              x,                             \
+        const TTYPE*              beta,                          \
+        TTYPE*                    y);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+INSTANTIATE(rocsparse_float_complex)
+INSTANTIATE(rocsparse_double_complex)
+
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
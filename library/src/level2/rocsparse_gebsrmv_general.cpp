@@ -0,0 +1,292 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gebsrmv_general.hpp"
+
+#include "definitions.h"
+#include "gebsrmv_device.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gebsrmvn_general_index_kernel(rocsparse_direction dir,
+                                       U                   alpha_device_host,
+                                       const I* __restrict__ bsr_row_ptr,
+                                       const J* __restrict__ bsr_col_ind,
+                                       const T* __restrict__ bsr_val,
+                                       J row_bsr_dim,
+                                       J col_bsr_dim,
+                                       const T* __restrict__ x,
+                                       U beta_device_host,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    gebsrmvn_general_device<BLOCKSIZE, WFSIZE>(dir,
+                                               alpha,
+                                               bsr_row_ptr,
+                                               bsr_col_ind,
+                                               bsr_val,
+                                               row_bsr_dim,
+                                               col_bsr_dim,
+                                               x,
+                                               beta,
+                                               y,
+                                               idx_base);
+}
+
+#define LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(BLOCKSIZE, WFSIZE)             \
+    hipLaunchKernelGGL((gebsrmvn_general_index_kernel<BLOCKSIZE, WFSIZE>), \
+                       dim3(mb),                                           \
+                       dim3(BLOCKSIZE),                                    \
+                       0,                                                  \
+                       handle->stream,                                     \
+                       dir,                                                \
+                       alpha_device_host,                                  \
+                       bsr_row_ptr,                                        \
+                       bsr_col_ind,                                        \
+                       bsr_val,                                            \
+                       row_block_dim,                                      \
+                       col_block_dim,                                      \
+                       x,                                                  \
+                       beta_device_host,                                   \
+                       y,                                                  \
+                       descr->base)
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_gebsrmv_general_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_operation       trans,
+                                                    J                         mb,
+                                                    U                         alpha_device_host,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const I*                  bsr_row_ptr,
+                                                    const J*                  bsr_col_ind,
+                                                    J                         row_block_dim,
+                                                    J                         col_block_dim,
+                                                    const T*                  x,
+                                                    U                         beta_device_host,
+                                                    T*                        y)
+{
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Each thread block processes a block row, each wavefront a row of the blocks
+    if(col_block_dim <= 2)
+    {
+        LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(2 * 32, 2);
+    }
+    else if(col_block_dim <= 4)
+    {
+        LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(4 * 32, 4);
+    }
+    else if(col_block_dim <= 8)
+    {
+        LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(8 * 32, 8);
+    }
+    else if(col_block_dim <= 16)
+    {
+        LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(16 * 32, 16);
+    }
+    else
+    {
+        LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL(32 * 32, 32);
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_GEBSRMV_GENERAL_INDEX_KERNEL
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_gebsrmv_general_template(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_operation       trans,
+                                                    J                         mb,
+                                                    J                         nb,
+                                                    I                         nnzb,
+                                                    const T*                  alpha_device_host,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const I*                  bsr_row_ptr,
+                                                    const J*                  bsr_col_ind,
+                                                    J                         row_block_dim,
+                                                    J                         col_block_dim,
+                                                    const T*                  x,
+                                                    const T*                  beta_device_host,
+                                                    T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgebsrmv"),
+              dir,
+              trans,
+              mb,
+              nb,
+              nnzb,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              row_block_dim,
+              col_block_dim,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || nnzb < 0 || row_block_dim <= 0 || col_block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr || x == nullptr
+       || y == nullptr || alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_gebsrmv_general_dispatch(handle,
+                                                  dir,
+                                                  trans,
+                                                  mb,
+                                                  alpha_device_host,
+                                                  descr,
+                                                  bsr_val,
+                                                  bsr_row_ptr,
+                                                  bsr_col_ind,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  x,
+                                                  beta_device_host,
+                                                  y);
+    }
+    else
+    {
+        return rocsparse_gebsrmv_general_dispatch(handle,
+                                                  dir,
+                                                  trans,
+                                                  mb,
+                                                  *alpha_device_host,
+                                                  descr,
+                                                  bsr_val,
+                                                  bsr_row_ptr,
+                                                  bsr_col_ind,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  x,
+                                                  *beta_device_host,
+                                                  y);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
+    template rocsparse_status rocsparse_gebsrmv_general_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                              \
+        rocsparse_direction       dir,                                                 \
+        rocsparse_operation       trans,                                               \
+        JTYPE                     mb,                                                  \
+        JTYPE                     nb,                                                  \
+        ITYPE                     nnzb,                                                \
+        const TTYPE*              alpha,                                               \
+        const rocsparse_mat_descr descr,                                               \
+        const TTYPE*              bsr_val,                                             \
+        const ITYPE*              bsr_row_ptr,                                         \
+        const JTYPE*              bsr_col_ind,                                         \
+        JTYPE                     row_block_dim,                                       \
+        JTYPE                     col_block_dim,                                       \
+        const TTYPE*              x,                                                   \
+        const TTYPE*              beta,                                                \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, int32_t, float)
+INSTANTIATE(int32_t, int32_t, double)
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int32_t, float)
+INSTANTIATE(int64_t, int32_t, double)
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int64_t, float)
+INSTANTIATE(int64_t, int64_t, double)
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex)
+
+#undef INSTANTIATE
@@ -173,6 +173,9 @@ rocsparse_status rocsparse_gemvi_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
@@ -49,6 +49,9 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xhybmv"),
@@ -171,7 +174,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle          handle,
                 if(hyb->ell_nnz > 0)
                 {
                     T* coo_beta = nullptr;
-                    rocsparse_one(handle, &coo_beta);
+                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_one(handle, &coo_beta));
 
                     RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
                                                                        trans,
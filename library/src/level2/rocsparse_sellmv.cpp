@@ -0,0 +1,276 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_sellmv.hpp"
+
+#include "definitions.h"
+#include "sellmv_device.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void sellmvn_kernel(I m,
+                                                            I n,
+                                                            I slice_size,
+                                                            U alpha_device_host,
+                                                            const I* __restrict__ sell_slice_ptr,
+                                                            const I* __restrict__ sell_row_perm,
+                                                            const I* __restrict__ sell_col_ind,
+                                                            const T* __restrict__ sell_val,
+                                                            const T* __restrict__ x,
+                                                            U beta_device_host,
+                                                            T* __restrict__ y,
+                                                            rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        sellmvn_device<BLOCKSIZE>(m,
+                                  n,
+                                  slice_size,
+                                  alpha,
+                                  sell_slice_ptr,
+                                  sell_row_perm,
+                                  sell_col_ind,
+                                  sell_val,
+                                  x,
+                                  beta,
+                                  y,
+                                  idx_base);
+    }
+}
+
+template <typename I, typename T, typename U>
+rocsparse_status rocsparse_sellmv_dispatch(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           I                         m,
+                                           I                         n,
+                                           U                         alpha_device_host,
+                                           const rocsparse_mat_descr descr,
+                                           I                         slice_size,
+                                           const T*                  sell_val,
+                                           const I*                  sell_slice_ptr,
+                                           const I*                  sell_row_perm,
+                                           const I*                  sell_col_ind,
+                                           const T*                  x,
+                                           U                         beta_device_host,
+                                           T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different sellmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define SELLMVN_DIM 512
+        dim3 sellmvn_blocks((m - 1) / SELLMVN_DIM + 1);
+        dim3 sellmvn_threads(SELLMVN_DIM);
+
+        hipLaunchKernelGGL((sellmvn_kernel<SELLMVN_DIM>),
+                           sellmvn_blocks,
+                           sellmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           slice_size,
+                           alpha_device_host,
+                           sell_slice_ptr,
+                           sell_row_perm,
+                           sell_col_ind,
+                           sell_val,
+                           x,
+                           beta_device_host,
+                           y,
+                           descr->base);
+
+#undef SELLMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+template <typename I, typename T>
+rocsparse_status rocsparse_sellmv_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           I                         m,
+                                           I                         n,
+                                           I                         nnz,
+                                           const T*                  alpha_device_host,
+                                           const rocsparse_mat_descr descr,
+                                           I                         slice_size,
+                                           const T*                  sell_val,
+                                           const I*                  sell_slice_ptr,
+                                           const I*                  sell_row_perm,
+                                           const I*                  sell_col_ind,
+                                           const T*                  x,
+                                           const T*                  beta_device_host,
+                                           T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsellmv"),
+              trans,
+              m,
+              n,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              slice_size,
+              (const void*&)sell_val,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_row_perm,
+              (const void*&)sell_col_ind,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(sell_slice_ptr == nullptr || sell_row_perm == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value and column arrays can only be nullptr if nnz is zero
+    if(nnz != 0 && (sell_val == nullptr || sell_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_sellmv_dispatch(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         alpha_device_host,
+                                         descr,
+                                         slice_size,
+                                         sell_val,
+                                         sell_slice_ptr,
+                                         sell_row_perm,
+                                         sell_col_ind,
+                                         x,
+                                         beta_device_host,
+                                         y);
+    }
+    else
+    {
+        return rocsparse_sellmv_dispatch(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         *alpha_device_host,
+                                         descr,
+                                         slice_size,
+                                         sell_val,
+                                         sell_slice_ptr,
+                                         sell_row_perm,
+                                         sell_col_ind,
+                                         x,
+                                         *beta_device_host,
+                                         y);
+    }
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                      \
+    template rocsparse_status rocsparse_sellmv_template<ITYPE, TTYPE>( \
+        rocsparse_handle          handle,                              \
+        rocsparse_operation       trans,                               \
+        ITYPE                     m,                                   \
+        ITYPE                     n,                                   \
+        ITYPE                     nnz,                                 \
+        const TTYPE*              alpha,                               \
+        const rocsparse_mat_descr descr,                               \
+        ITYPE                     slice_size,                          \
+        const TTYPE*              sell_val,                            \
+        const ITYPE*              sell_slice_ptr,                      \
+        const ITYPE*              sell_row_perm,                       \
+        const ITYPE*              sell_col_ind,                        \
+        const TTYPE*              x,                                   \
+        const TTYPE*              beta,                                \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, float)
+INSTANTIATE(int32_t, double)
+INSTANTIATE(int32_t, rocsparse_float_complex)
+INSTANTIATE(int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, float)
+INSTANTIATE(int64_t, double)
+INSTANTIATE(int64_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, rocsparse_double_complex)
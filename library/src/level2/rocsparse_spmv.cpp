@@ -28,8 +28,14 @@
 
 #include "rocsparse_coomv.hpp"
 #include "rocsparse_coomv_aos.hpp"
+#include "rocsparse_csr16mv.hpp"
+#include "rocsparse_cscmv.hpp"
 #include "rocsparse_csrmv.hpp"
+#include "rocsparse_csrmv_merge.hpp"
 #include "rocsparse_ellmv.hpp"
+#include "rocsparse_gebsrmv.hpp"
+#include "rocsparse_gebsrmv_general.hpp"
+#include "rocsparse_sellmv.hpp"
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
@@ -49,12 +55,17 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
         // We do not need a buffer
         *buffer_size = 4;
 
-        // Run CSR analysis step when format is CSR
-        if(mat->format == rocsparse_format_csr)
+        // Run CSR analysis step when format is CSR, batches always run the stream kernel
+        if(mat->format == rocsparse_format_csr && mat->batch_count == 1)
         {
+            // Transposed operations require a different analysis
+            bool reanalyse = mat->analysed == false
+                             || (mat->info->csrmv_info != nullptr
+                                 && mat->info->csrmv_info->trans != trans);
+
             // If algorithm 1 or default is selected and analysis step is required
             if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive)
-               && mat->analysed == false)
+               && reanalyse)
             {
                 RETURN_IF_ROCSPARSE_ERROR(
                     (rocsparse_csrmv_analysis_template(handle,
@@ -70,6 +81,51 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
                 mat->analysed = true;
             }
+
+            // The merge path analysis only searches the tile boundaries on the device,
+            // it is cheap enough to run on every buffer size query
+            if(alg == rocsparse_spmv_alg_csr_merge)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrmv_merge_analysis_template(handle,
+                                                             trans,
+                                                             (J)mat->rows,
+                                                             (J)mat->cols,
+                                                             (I)mat->nnz,
+                                                             mat->descr,
+                                                             (const T*)mat->val_data,
+                                                             (const I*)mat->row_data,
+                                                             (const J*)mat->col_data,
+                                                             mat->info)));
+            }
+        }
+
+        // Run CSC analysis step when format is CSC
+        if(mat->format == rocsparse_format_csc)
+        {
+            // The analysis is stored for the flipped operation on the CSR view A^T,
+            // the conjugate transposed operation does not store any analysis data
+            bool reanalyse = mat->analysed == false || mat->info->csrmv_info == nullptr
+                             || mat->info->csrmv_info->trans == trans;
+
+            // If algorithm 1 or default is selected and analysis step is required
+            if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive)
+               && reanalyse)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_cscmv_analysis_template(handle,
+                                                       trans,
+                                                       (J)mat->rows,
+                                                       (J)mat->cols,
+                                                       (I)mat->nnz,
+                                                       mat->descr,
+                                                       (const T*)mat->val_data,
+                                                       (const I*)mat->col_data,
+                                                       (const J*)mat->row_data,
+                                                       mat->info)));
+
+                mat->analysed = true;
+            }
         }
 
         return rocsparse_status_success;
@@ -114,6 +170,48 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
         // CSR
     case rocsparse_format_csr:
     {
+        // Batches share the sparsity pattern, a single vector x is broadcast to all batches
+        if(mat->batch_count > 1)
+        {
+            return rocsparse_csrmv_strided_batched_template(
+                handle,
+                trans,
+                (J)mat->rows,
+                (J)mat->cols,
+                (I)mat->nnz,
+                mat->batch_count,
+                (const T*)alpha,
+                mat->descr,
+                (const T*)mat->val_data,
+                mat->batch_stride,
+                (const I*)mat->row_data,
+                (const J*)mat->col_data,
+                (const T*)x->values,
+                (x->batch_count == 1) ? static_cast<int64_t>(0) : x->batch_stride,
+                (const T*)beta,
+                (T*)y->values,
+                y->batch_stride);
+        }
+
+        // Merge path, operations without tiles fall back to the stream kernels
+        if(alg == rocsparse_spmv_alg_csr_merge)
+        {
+            return rocsparse_csrmv_merge_template(handle,
+                                                  trans,
+                                                  (J)mat->rows,
+                                                  (J)mat->cols,
+                                                  (I)mat->nnz,
+                                                  (const T*)alpha,
+                                                  mat->descr,
+                                                  (const T*)mat->val_data,
+                                                  (const I*)mat->row_data,
+                                                  (const J*)mat->col_data,
+                                                  mat->info,
+                                                  (const T*)x->values,
+                                                  (const T*)beta,
+                                                  (T*)y->values);
+        }
+
         return rocsparse_csrmv_template(handle,
                                         trans,
                                         (J)mat->rows,
@@ -151,9 +249,91 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
         // CSC
     case rocsparse_format_csc:
     {
-        // LCOV_EXCL_START
+        return rocsparse_cscmv_template(handle,
+                                        trans,
+                                        (J)mat->rows,
+                                        (J)mat->cols,
+                                        (I)mat->nnz,
+                                        (const T*)alpha,
+                                        mat->descr,
+                                        (const T*)mat->val_data,
+                                        (const I*)mat->col_data,
+                                        (const J*)mat->row_data,
+                                        (alg == rocsparse_spmv_alg_csr_stream
+                                         || alg == rocsparse_spmv_alg_csr_merge)
+                                            ? nullptr
+                                            : mat->info,
+                                        (const T*)x->values,
+                                        (const T*)beta,
+                                        (T*)y->values);
+    }
+
+        // SELL-C-sigma
+    case rocsparse_format_sell:
+    {
+        return rocsparse_sellmv_template(handle,
+                                         trans,
+                                         (I)mat->rows,
+                                         (I)mat->cols,
+                                         (I)mat->nnz,
+                                         (const T*)alpha,
+                                         mat->descr,
+                                         (I)mat->slice_size,
+                                         (const T*)mat->val_data,
+                                         (const I*)mat->row_data,
+                                         (const I*)mat->ind_data,
+                                         (const I*)mat->col_data,
+                                         (const T*)x->values,
+                                         (const T*)beta,
+                                         (T*)y->values);
+    }
+
+        // BSR
+    case rocsparse_format_bsr:
+    {
+        // 32 bit indices use the block dimension specialized kernels
+        if(std::is_same<I, rocsparse_int>() && std::is_same<J, rocsparse_int>())
+        {
+            return rocsparse_gebsrmv_template(handle,
+                                              mat->block_dir,
+                                              trans,
+                                              (rocsparse_int)mat->rows,
+                                              (rocsparse_int)mat->cols,
+                                              (rocsparse_int)mat->nnz,
+                                              (const T*)alpha,
+                                              mat->descr,
+                                              (const T*)mat->val_data,
+                                              (const rocsparse_int*)mat->row_data,
+                                              (const rocsparse_int*)mat->col_data,
+                                              (rocsparse_int)mat->row_block_dim,
+                                              (rocsparse_int)mat->col_block_dim,
+                                              (const T*)x->values,
+                                              (const T*)beta,
+                                              (T*)y->values);
+        }
+
+        return rocsparse_gebsrmv_general_template(handle,
+                                                  mat->block_dir,
+                                                  trans,
+                                                  (J)mat->rows,
+                                                  (J)mat->cols,
+                                                  (I)mat->nnz,
+                                                  (const T*)alpha,
+                                                  mat->descr,
+                                                  (const T*)mat->val_data,
+                                                  (const I*)mat->row_data,
+                                                  (const J*)mat->col_data,
+                                                  (J)mat->row_block_dim,
+                                                  (J)mat->col_block_dim,
+                                                  (const T*)x->values,
+                                                  (const T*)beta,
+                                                  (T*)y->values);
+    }
+
+        // CSR16 is dispatched on its 16 bit column offsets
+    case rocsparse_format_csr16:
+    {
         return rocsparse_status_not_implemented;
-        // LCOV_EXCL_STOP
     }
     }
 
@@ -162,6 +342,134 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
     // LCOV_EXCL_STOP
 }
 
+template <typename I, typename T>
+rocsparse_status rocsparse_spmv_csr16_template(rocsparse_handle            handle,
+                                               rocsparse_operation         trans,
+                                               const void*                 alpha,
+                                               const rocsparse_spmat_descr mat,
+                                               const rocsparse_dnvec_descr x,
+                                               const void*                 beta,
+                                               const rocsparse_dnvec_descr y,
+                                               rocsparse_spmv_alg          alg,
+                                               size_t*                     buffer_size,
+                                               void*                       temp_buffer)
+{
+    // 16 bit column indices are only supported as CSR16 column offsets
+    if(mat->format != rocsparse_format_csr16)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // If temp_buffer is nullptr, return buffer_size
+    if(temp_buffer == nullptr)
+    {
+        // We do not need a buffer
+        *buffer_size = 4;
+
+        return rocsparse_status_success;
+    }
+
+    return rocsparse_csr16mv_template(handle,
+                                      trans,
+                                      (I)mat->rows,
+                                      (I)mat->cols,
+                                      (I)mat->nnz,
+                                      (const T*)alpha,
+                                      mat->descr,
+                                      (const T*)mat->val_data,
+                                      (const I*)mat->row_data,
+                                      (const I*)mat->ind_data,
+                                      (const uint16_t*)mat->col_data,
+                                      (I)mat->esc_nnz,
+                                      (const T*)mat->esc_val_data,
+                                      (const I*)mat->esc_row_data,
+                                      (const I*)mat->esc_col_data,
+                                      (const T*)x->values,
+                                      (const T*)beta,
+                                      (T*)y->values);
+}
+
+template <typename I, typename J, typename A, typename T>
+rocsparse_status rocsparse_spmv_mixed_template(rocsparse_handle            handle,
+                                               rocsparse_operation         trans,
+                                               const void*                 alpha,
+                                               const rocsparse_spmat_descr mat,
+                                               const rocsparse_dnvec_descr x,
+                                               const void*                 beta,
+                                               const rocsparse_dnvec_descr y,
+                                               rocsparse_spmv_alg          alg,
+                                               size_t*                     buffer_size,
+                                               void*                       temp_buffer)
+{
+    // Mixed precision is only supported for a single CSR matrix
+    if(mat->format != rocsparse_format_csr || mat->batch_count > 1)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // If temp_buffer is nullptr, return buffer_size
+    if(temp_buffer == nullptr)
+    {
+        // We do not need a buffer, mixed precision always runs the stream kernels
+        *buffer_size = 4;
+
+        return rocsparse_status_success;
+    }
+
+    return rocsparse_csrmv_mixed_template(handle,
+                                          trans,
+                                          (J)mat->rows,
+                                          (J)mat->cols,
+                                          (I)mat->nnz,
+                                          (const T*)alpha,
+                                          mat->descr,
+                                          (const A*)mat->val_data,
+                                          (const I*)mat->row_data,
+                                          (const J*)mat->col_data,
+                                          (const T*)x->values,
+                                          (const T*)beta,
+                                          (T*)y->values);
+}
+
+template <typename... Ts>
+rocsparse_status rocsparse_spmv_mixed_dynamic_dispatch(rocsparse_indextype itype,
+                                                       rocsparse_indextype jtype,
+                                                       rocsparse_datatype  atype,
+                                                       rocsparse_datatype  ctype,
+                                                       Ts&&... ts)
+{
+#define MIXED_INDEXTYPE_CASE(ATYPE, TTYPE)                                               \
+    {                                                                                    \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)         \
+        {                                                                                \
+            return rocsparse_spmv_mixed_template<int32_t, int32_t, ATYPE, TTYPE>(ts...); \
+        }                                                                                \
+        else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32)    \
+        {                                                                                \
+            return rocsparse_spmv_mixed_template<int64_t, int32_t, ATYPE, TTYPE>(ts...); \
+        }                                                                                \
+        else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64)    \
+        {                                                                                \
+            return rocsparse_spmv_mixed_template<int64_t, int64_t, ATYPE, TTYPE>(ts...); \
+        }                                                                                \
+        return rocsparse_status_not_implemented;                                         \
+    }
+
+    // Matrix values stored in single precision, accumulation in double precision
+    if(atype == rocsparse_datatype_f32_r && ctype == rocsparse_datatype_f64_r)
+    {
+        MIXED_INDEXTYPE_CASE(float, double);
+    }
+    else if(atype == rocsparse_datatype_f32_c && ctype == rocsparse_datatype_f64_c)
+    {
+        MIXED_INDEXTYPE_CASE(rocsparse_float_complex, rocsparse_double_complex);
+    }
+
+#undef MIXED_INDEXTYPE_CASE
+
+    return rocsparse_status_not_implemented;
+}
+
 template <typename... Ts>
 rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
                                                  rocsparse_indextype jtype,
@@ -185,6 +493,9 @@ rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
             switch(jtype)                                                      \
             {                                                                  \
             case rocsparse_indextype_u16:                                      \
+            {                                                                  \
+                return rocsparse_spmv_csr16_template<int32_t, TYPE>(ts...);    \
+            }                                                                  \
             case rocsparse_indextype_i64:                                      \
             {                                                                  \
                 return rocsparse_status_not_implemented;                       \
@@ -201,7 +512,7 @@ rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
             {                                                                  \
             case rocsparse_indextype_u16:                                      \
             {                                                                  \
-                return rocsparse_status_not_implemented;                       \
+                return rocsparse_spmv_csr16_template<int64_t, TYPE>(ts...);    \
             }                                                                  \
             case rocsparse_indextype_i32:                                      \
             {                                                                  \
@@ -249,6 +560,9 @@ extern "C" rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_spmv",
@@ -302,24 +616,50 @@ extern "C" rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
     }
     // LCOV_EXCL_STOP
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat->data_type || compute_type != x->data_type
-       || compute_type != y->data_type)
+    // Each matrix of a batch writes its own vector y, a single vector x may be shared
+    if(mat->batch_count != y->batch_count
+       || (x->batch_count != 1 && x->batch_count != mat->batch_count))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Vectors have to match the compute type
+    if(compute_type != x->data_type || compute_type != y->data_type)
     {
         return rocsparse_status_not_implemented;
     }
 
-    return rocsparse_spmv_dynamic_dispatch(mat->row_type,
-                                           mat->col_type,
-                                           compute_type,
-                                           handle,
-                                           trans,
-                                           alpha,
-                                           mat,
-                                           x,
-                                           beta,
-                                           y,
-                                           alg,
-                                           buffer_size,
-                                           temp_buffer);
+    // Matrix values stored in a lower precision are accumulated in the compute type
+    if(compute_type != mat->data_type)
+    {
+        return rocsparse_spmv_mixed_dynamic_dispatch(mat->row_type,
+                                                     mat->col_type,
+                                                     mat->data_type,
+                                                     compute_type,
+                                                     handle,
+                                                     trans,
+                                                     alpha,
+                                                     mat,
+                                                     x,
+                                                     beta,
+                                                     y,
+                                                     alg,
+                                                     buffer_size,
+                                                     temp_buffer);
+    }
+
+    return rocsparse_spmv_dynamic_dispatch(
+        (mat->format == rocsparse_format_csc) ? mat->col_type : mat->row_type,
+        (mat->format == rocsparse_format_csc) ? mat->row_type : mat->col_type,
+        compute_type,
+        handle,
+        trans,
+        alpha,
+        mat,
+        x,
+        beta,
+        y,
+        alg,
+        buffer_size,
+        temp_buffer);
 }
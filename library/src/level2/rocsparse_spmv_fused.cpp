@@ -0,0 +1,350 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include "rocsparse_csrmv_fused.hpp"
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_spmv_dot_template(rocsparse_handle            handle,
+                                             rocsparse_operation         trans,
+                                             const void*                 alpha,
+                                             const rocsparse_spmat_descr mat,
+                                             const rocsparse_dnvec_descr x,
+                                             const void*                 beta,
+                                             const rocsparse_dnvec_descr y,
+                                             void*                       dot_result,
+                                             void*                       nrm2_result,
+                                             size_t*                     buffer_size,
+                                             void*                       temp_buffer)
+{
+    // If temp_buffer is nullptr, return buffer_size
+    if(temp_buffer == nullptr)
+    {
+        return rocsparse_csrmv_fused_buffer_size_template<T>(handle, buffer_size);
+    }
+
+    return rocsparse_csrmv_dot_template(handle,
+                                        trans,
+                                        (J)mat->rows,
+                                        (J)mat->cols,
+                                        (I)mat->nnz,
+                                        (const T*)alpha,
+                                        mat->descr,
+                                        (const T*)mat->val_data,
+                                        (const I*)mat->row_data,
+                                        (const J*)mat->col_data,
+                                        (const T*)x->values,
+                                        (const T*)beta,
+                                        (T*)y->values,
+                                        (T*)dot_result,
+                                        (T*)nrm2_result,
+                                        temp_buffer);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_spmv_residual_template(rocsparse_handle            handle,
+                                                  rocsparse_operation         trans,
+                                                  const rocsparse_spmat_descr mat,
+                                                  const rocsparse_dnvec_descr x,
+                                                  const rocsparse_dnvec_descr b,
+                                                  const rocsparse_dnvec_descr r,
+                                                  void*                       nrm2_result,
+                                                  size_t*                     buffer_size,
+                                                  void*                       temp_buffer)
+{
+    // If temp_buffer is nullptr, return buffer_size
+    if(temp_buffer == nullptr)
+    {
+        return rocsparse_csrmv_fused_buffer_size_template<T>(handle, buffer_size);
+    }
+
+    return rocsparse_csrmv_residual_template(handle,
+                                             trans,
+                                             (J)mat->rows,
+                                             (J)mat->cols,
+                                             (I)mat->nnz,
+                                             mat->descr,
+                                             (const T*)mat->val_data,
+                                             (const I*)mat->row_data,
+                                             (const J*)mat->col_data,
+                                             (const T*)x->values,
+                                             (const T*)b->values,
+                                             (T*)r->values,
+                                             (T*)nrm2_result,
+                                             temp_buffer);
+}
+
+#define FUSED_DISPATCH(TEMPLATE)                                      \
+    {                                                                 \
+        switch(ctype)                                                 \
+        {                                                             \
+        case rocsparse_datatype_f32_r:                                \
+        {                                                             \
+            FUSED_INDEXTYPE_CASE(TEMPLATE, float);                    \
+        }                                                             \
+        case rocsparse_datatype_f64_r:                                \
+        {                                                             \
+            FUSED_INDEXTYPE_CASE(TEMPLATE, double);                   \
+        }                                                             \
+        case rocsparse_datatype_f32_c:                                \
+        {                                                             \
+            FUSED_INDEXTYPE_CASE(TEMPLATE, rocsparse_float_complex);  \
+        }                                                             \
+        case rocsparse_datatype_f64_c:                                \
+        {                                                             \
+            FUSED_INDEXTYPE_CASE(TEMPLATE, rocsparse_double_complex); \
+        }                                                             \
+        }                                                             \
+        return rocsparse_status_invalid_value;                        \
+    }
+
+#define FUSED_INDEXTYPE_CASE(TEMPLATE, TTYPE)                                         \
+    {                                                                                 \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)      \
+        {                                                                             \
+            return TEMPLATE<int32_t, int32_t, TTYPE>(ts...);                          \
+        }                                                                             \
+        else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32) \
+        {                                                                             \
+            return TEMPLATE<int64_t, int32_t, TTYPE>(ts...);                          \
+        }                                                                             \
+        else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64) \
+        {                                                                             \
+            return TEMPLATE<int64_t, int64_t, TTYPE>(ts...);                          \
+        }                                                                             \
+        return rocsparse_status_not_implemented;                                      \
+    }
+
+template <typename... Ts>
+rocsparse_status rocsparse_spmv_dot_dynamic_dispatch(rocsparse_indextype itype,
+                                                     rocsparse_indextype jtype,
+                                                     rocsparse_datatype  ctype,
+                                                     Ts&&... ts)
+{
+    FUSED_DISPATCH(rocsparse_spmv_dot_template);
+}
+
+template <typename... Ts>
+rocsparse_status rocsparse_spmv_residual_dynamic_dispatch(rocsparse_indextype itype,
+                                                          rocsparse_indextype jtype,
+                                                          rocsparse_datatype  ctype,
+                                                          Ts&&... ts)
+{
+    FUSED_DISPATCH(rocsparse_spmv_residual_template);
+}
+
+#undef FUSED_INDEXTYPE_CASE
+#undef FUSED_DISPATCH
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spmv_dot(rocsparse_handle            handle,
+                                               rocsparse_operation         trans,
+                                               const void*                 alpha,
+                                               const rocsparse_spmat_descr mat,
+                                               const rocsparse_dnvec_descr x,
+                                               const void*                 beta,
+                                               const rocsparse_dnvec_descr y,
+                                               void*                       dot_result,
+                                               void*                       nrm2_result,
+                                               rocsparse_datatype          compute_type,
+                                               size_t*                     buffer_size,
+                                               void*                       temp_buffer)
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmv_dot",
+              trans,
+              (const void*&)alpha,
+              (const void*&)mat,
+              (const void*&)x,
+              (const void*&)beta,
+              (const void*&)y,
+              (const void*&)dot_result,
+              (const void*&)nrm2_result,
+              compute_type,
+              (const void*&)buffer_size,
+              (const void*&)temp_buffer);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(mat);
+    RETURN_IF_NULLPTR(x);
+    RETURN_IF_NULLPTR(y);
+
+    // Check for valid pointers, dot_result and nrm2_result are optional
+    RETURN_IF_NULLPTR(alpha);
+    RETURN_IF_NULLPTR(beta);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(compute_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid buffer_size pointer only if temp_buffer is nullptr
+    if(temp_buffer == nullptr)
+    {
+        RETURN_IF_NULLPTR(buffer_size);
+    }
+
+    // Check if descriptors are initialized
+    // LCOV_EXCL_START
+    if(mat->init == false || x->init == false || y->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+    // LCOV_EXCL_STOP
+
+    // Only single CSR matrices are supported by the fused kernels
+    if(mat->format != rocsparse_format_csr || mat->batch_count != 1)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Matrix and vectors have to match the compute type
+    if(compute_type != mat->data_type || compute_type != x->data_type
+       || compute_type != y->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_spmv_dot_dynamic_dispatch(mat->row_type,
+                                               mat->col_type,
+                                               compute_type,
+                                               handle,
+                                               trans,
+                                               alpha,
+                                               mat,
+                                               x,
+                                               beta,
+                                               y,
+                                               dot_result,
+                                               nrm2_result,
+                                               buffer_size,
+                                               temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_spmv_residual(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans,
+                                                    const rocsparse_spmat_descr mat,
+                                                    const rocsparse_dnvec_descr x,
+                                                    const rocsparse_dnvec_descr b,
+                                                    const rocsparse_dnvec_descr r,
+                                                    void*                       nrm2_result,
+                                                    rocsparse_datatype          compute_type,
+                                                    size_t*                     buffer_size,
+                                                    void*                       temp_buffer)
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmv_residual",
+              trans,
+              (const void*&)mat,
+              (const void*&)x,
+              (const void*&)b,
+              (const void*&)r,
+              (const void*&)nrm2_result,
+              compute_type,
+              (const void*&)buffer_size,
+              (const void*&)temp_buffer);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(mat);
+    RETURN_IF_NULLPTR(x);
+    RETURN_IF_NULLPTR(b);
+    RETURN_IF_NULLPTR(r);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(compute_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid buffer_size pointer only if temp_buffer is nullptr
+    if(temp_buffer == nullptr)
+    {
+        RETURN_IF_NULLPTR(buffer_size);
+    }
+
+    // Check if descriptors are initialized
+    // LCOV_EXCL_START
+    if(mat->init == false || x->init == false || b->init == false || r->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+    // LCOV_EXCL_STOP
+
+    // Only single CSR matrices are supported by the fused kernels
+    if(mat->format != rocsparse_format_csr || mat->batch_count != 1)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Matrix and vectors have to match the compute type
+    if(compute_type != mat->data_type || compute_type != x->data_type
+       || compute_type != b->data_type || compute_type != r->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_spmv_residual_dynamic_dispatch(mat->row_type,
+                                                    mat->col_type,
+                                                    compute_type,
+                                                    handle,
+                                                    trans,
+                                                    mat,
+                                                    x,
+                                                    b,
+                                                    r,
+                                                    nrm2_result,
+                                                    buffer_size,
+                                                    temp_buffer);
+}
@@ -0,0 +1,89 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SELLMV_DEVICE_H
+#define SELLMV_DEVICE_H
+
+#include "common.h"
+
+// SELL-C-sigma SpMV for general, non-transposed matrices. Each thread computes one
+// row of a slice, such that neighbouring threads access consecutive entries.
+template <unsigned int BLOCKSIZE, typename I, typename T>
+static __device__ void sellmvn_device(I                    m,
+                                      I                    n,
+                                      I                    slice_size,
+                                      T                    alpha,
+                                      const I*             sell_slice_ptr,
+                                      const I*             sell_row_perm,
+                                      const I*             sell_col_ind,
+                                      const T*             sell_val,
+                                      const T*             x,
+                                      T                    beta,
+                                      T*                   y,
+                                      rocsparse_index_base idx_base)
+{
+    I ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    I slice = ai / slice_size;
+    I lane  = ai % slice_size;
+
+    I slice_begin = rocsparse_ldg(sell_slice_ptr + slice) - idx_base;
+    I slice_end   = rocsparse_ldg(sell_slice_ptr + slice + 1) - idx_base;
+
+    T sum = static_cast<T>(0);
+    for(I idx = slice_begin + lane; idx < slice_end; idx += slice_size)
+    {
+        I col = rocsparse_nontemporal_load(sell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            sum = rocsparse_fma(
+                rocsparse_nontemporal_load(sell_val + idx), rocsparse_ldg(x + col), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    I row = rocsparse_nontemporal_load(sell_row_perm + ai) - idx_base;
+
+    if(beta != static_cast<T>(0))
+    {
+        T yv = rocsparse_nontemporal_load(y + row);
+        rocsparse_nontemporal_store(rocsparse_fma(beta, yv, alpha * sum), y + row);
+    }
+    else
+    {
+        rocsparse_nontemporal_store(alpha * sum, y + row);
+    }
+}
+
+#endif // SELLMV_DEVICE_H
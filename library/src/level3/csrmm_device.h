@@ -39,6 +39,7 @@ static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
                                               const I* __restrict__ csr_row_ptr,
                                               const J* __restrict__ csr_col_ind,
                                               const T* __restrict__ csr_val,
+                                              const I* __restrict__ csr_perm,
                                               const T* __restrict__ B,
                                               J ldb,
                                               T beta,
@@ -74,14 +75,17 @@ static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
 
             shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
 
+            // Entries of A are accessed through the permutation, if available
+            I idx = (csr_perm != nullptr && k < row_end) ? csr_perm[k] : k;
+
             if(trans_A == rocsparse_operation_conjugate_transpose)
             {
                 shared_val[wid][lid]
-                    = (k < row_end) ? rocsparse_conj(csr_val[k]) : static_cast<T>(0);
+                    = (k < row_end) ? rocsparse_conj(csr_val[idx]) : static_cast<T>(0);
             }
             else
             {
-                shared_val[wid][lid] = (k < row_end) ? csr_val[k] : static_cast<T>(0);
+                shared_val[wid][lid] = (k < row_end) ? csr_val[idx] : static_cast<T>(0);
             }
 
             __syncthreads();
@@ -141,6 +145,7 @@ static __device__ void csrmmnt_general_device(rocsparse_operation trans_A,
                                               const I* __restrict__ csr_row_ptr,
                                               const J* __restrict__ csr_col_ind,
                                               const T* __restrict__ csr_val,
+                                              const I* __restrict__ csr_perm,
                                               const T* __restrict__ B,
                                               J ldb,
                                               T beta,
@@ -179,14 +184,17 @@ static __device__ void csrmmnt_general_device(rocsparse_operation trans_A,
 
             shared_col[wid][lid] = (k < row_end) ? ldb * (csr_col_ind[k] - idx_base) : 0;
 
+            // Entries of A are accessed through the permutation, if available
+            I idx = (csr_perm != nullptr && k < row_end) ? csr_perm[k] : k;
+
             if(trans_A == rocsparse_operation_conjugate_transpose)
             {
                 shared_val[wid][lid]
-                    = (k < row_end) ? rocsparse_conj(csr_val[k]) : static_cast<T>(0);
+                    = (k < row_end) ? rocsparse_conj(csr_val[idx]) : static_cast<T>(0);
             }
             else
             {
-                shared_val[wid][lid] = (k < row_end) ? csr_val[k] : static_cast<T>(0);
+                shared_val[wid][lid] = (k < row_end) ? csr_val[idx] : static_cast<T>(0);
             }
 
             __syncthreads();
@@ -28,32 +28,36 @@
 
 #include "common.h"
 
-template <rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y, typename T>
+template <rocsparse_int BSR_BLOCK_DIM,
+          rocsparse_int BLK_SIZE_Y,
+          typename I,
+          typename J,
+          typename T>
 static __device__ void
     gebsrmm_general_blockdim_device(rocsparse_direction direction,
                                     rocsparse_operation trans_B,
-                                    rocsparse_int       Mb,
-                                    rocsparse_int       N,
+                                    J                   Mb,
+                                    J                   N,
                                     T                   alpha,
-                                    const rocsparse_int* __restrict__ bsr_row_ptr,
-                                    const rocsparse_int* __restrict__ bsr_col_ind,
+                                    const I* __restrict__ bsr_row_ptr,
+                                    const J* __restrict__ bsr_col_ind,
                                     const T* __restrict__ bsr_val,
-                                    rocsparse_int row_block_dim,
-                                    rocsparse_int col_block_dim,
+                                    J row_block_dim,
+                                    J col_block_dim,
                                     const T* __restrict__ B,
-                                    rocsparse_int ldb,
-                                    T             beta,
+                                    J ldb,
+                                    T beta,
                                     T* __restrict__ C,
-                                    rocsparse_int        ldc,
+                                    J                    ldc,
                                     rocsparse_index_base idx_base)
 {
     rocsparse_int tidx = hipThreadIdx_x;
     rocsparse_int tidy = hipThreadIdx_y;
 
-    rocsparse_int block_row = hipBlockIdx_x;
+    J block_row = hipBlockIdx_x;
 
-    rocsparse_int block_row_start = 0;
-    rocsparse_int block_row_end   = 0;
+    I block_row_start = 0;
+    I block_row_end   = 0;
     if(block_row < Mb)
     {
         block_row_start = bsr_row_ptr[block_row] - idx_base;
@@ -63,22 +67,22 @@ static __device__ void
     __shared__ T shared_B[BSR_BLOCK_DIM * BLK_SIZE_Y];
     __shared__ T shared_A[BSR_BLOCK_DIM * BSR_BLOCK_DIM];
 
-    rocsparse_int global_col = tidy + hipBlockIdx_y * BLK_SIZE_Y;
+    J global_col = tidy + hipBlockIdx_y * BLK_SIZE_Y;
 
-    rocsparse_int colB = global_col * ldb;
-    rocsparse_int colC = global_col * ldc;
+    J colB = global_col * ldb;
+    J colC = global_col * ldc;
 
-    for(rocsparse_int x = 0; x < row_block_dim; x += BSR_BLOCK_DIM)
+    for(J x = 0; x < row_block_dim; x += BSR_BLOCK_DIM)
     {
-        rocsparse_int global_row = tidx + x + hipBlockIdx_x * row_block_dim;
+        J global_row = tidx + x + hipBlockIdx_x * row_block_dim;
 
         T sum = static_cast<T>(0);
 
-        for(rocsparse_int k = block_row_start; k < block_row_end; k++)
+        for(I k = block_row_start; k < block_row_end; k++)
         {
-            rocsparse_int block_col = (bsr_col_ind[k] - idx_base);
+            J block_col = (bsr_col_ind[k] - idx_base);
 
-            for(rocsparse_int y = 0; y < col_block_dim; y += BLK_SIZE_Y)
+            for(J y = 0; y < col_block_dim; y += BLK_SIZE_Y)
             {
 
                 if(trans_B == rocsparse_operation_none)
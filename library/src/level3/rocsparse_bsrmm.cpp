@@ -162,7 +162,9 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                  ldb,
                                                  beta,
                                                  C,
-                                                 ldc);
+                                                 ldc,
+                                                 (const rocsparse_int*)nullptr,
+                                                 false);
     }
 
     if(block_dim == 2)
@@ -264,6 +266,9 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging TODO bench logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsrmm"),
@@ -143,12 +143,12 @@ rocsparse_status rocsparse_coomm_template_segmented(rocsparse_handle          ha
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= required_size)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
+            RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&temp_storage_ptr));
+            temp_alloc = false;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, required_size));
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&temp_storage_ptr, required_size));
             temp_alloc = true;
         }
 
@@ -287,7 +287,7 @@ rocsparse_status rocsparse_coomm_template_segmented(rocsparse_handle          ha
 
         if(temp_alloc)
         {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temp_storage_ptr));
         }
     }
     else
@@ -830,6 +830,9 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging TODO bench logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcoomm"),
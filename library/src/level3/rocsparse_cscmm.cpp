@@ -0,0 +1,362 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_cscmm.hpp"
+#include "definitions.h"
+#include "rocsparse_csrmm.hpp"
+#include "utility.h"
+
+// The column pointers and row indices of a CSC matrix A are the row pointers and column
+// indices of the CSR matrix A^T. Thus, cscmm runs csrmm on A^T with the operation flipped.
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status rocsparse_cscmm_dispatch(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_A,
+                                                 rocsparse_operation       trans_B,
+                                                 rocsparse_order           order,
+                                                 J                         m,
+                                                 J                         n,
+                                                 J                         k,
+                                                 I                         nnz,
+                                                 U                         alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csc_val,
+                                                 const I*                  csc_col_ptr,
+                                                 const J*                  csc_row_ind,
+                                                 rocsparse_csrmv_info      info,
+                                                 const T*                  B,
+                                                 J                         ldb,
+                                                 U                         beta_device_host,
+                                                 T*                        C,
+                                                 J                         ldc)
+{
+    // op(A) = A^T or op(A) = A^H is the CSR matrix A^T, with conjugated entries for A^H
+    if(trans_A != rocsparse_operation_none)
+    {
+        bool conj_A = (trans_A == rocsparse_operation_conjugate_transpose);
+
+        return rocsparse_csrmm_template_dispatch(handle,
+                                                 rocsparse_operation_none,
+                                                 trans_B,
+                                                 order,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 B,
+                                                 ldb,
+                                                 beta_device_host,
+                                                 C,
+                                                 ldc,
+                                                 (const I*)nullptr,
+                                                 conj_A);
+    }
+
+    // Without analysis, the rows of A^T are scattered atomically into C
+    if(info == nullptr || info->trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_csrmm_template_dispatch(handle,
+                                                 rocsparse_operation_transpose,
+                                                 trans_B,
+                                                 order,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 B,
+                                                 ldb,
+                                                 beta_device_host,
+                                                 C,
+                                                 ldc,
+                                                 (const I*)nullptr,
+                                                 false);
+    }
+
+    // Check if info matches current matrix
+    if(info->m != k || info->n != m || info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(info->csr_row_ptr != csc_col_ptr || info->csr_col_ind != csc_row_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The transposed csrmv analysis of A^T holds the zero based CSR structure of A,
+    // where the permutation maps each entry to its position in the CSC values. Thus,
+    // the rows of A can be processed without atomics.
+    _rocsparse_mat_descr csr_descr = *descr;
+    csr_descr.base                 = rocsparse_index_base_zero;
+
+    return rocsparse_csrmm_template_dispatch(handle,
+                                             rocsparse_operation_none,
+                                             trans_B,
+                                             order,
+                                             m,
+                                             n,
+                                             k,
+                                             nnz,
+                                             alpha_device_host,
+                                             &csr_descr,
+                                             csc_val,
+                                             static_cast<const I*>(info->csc_col_ptr),
+                                             static_cast<const J*>(info->csc_row_ind),
+                                             B,
+                                             ldb,
+                                             beta_device_host,
+                                             C,
+                                             ldc,
+                                             static_cast<const I*>(info->csc_perm),
+                                             false);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_cscmm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_order           order_B,
+                                          rocsparse_order           order_C,
+                                          J                         m,
+                                          J                         n,
+                                          J                         k,
+                                          I                         nnz,
+                                          const T*                  alpha_device_host,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csc_val,
+                                          const I*                  csc_col_ptr,
+                                          const J*                  csc_row_ind,
+                                          rocsparse_mat_info        info,
+                                          const T*                  B,
+                                          J                         ldb,
+                                          const T*                  beta_device_host,
+                                          T*                        C,
+                                          J                         ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcscmm"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csc_val,
+              (const void*&)csc_col_ptr,
+              (const void*&)csc_row_ind,
+              (const void*&)B,
+              ldb,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)C,
+              ldc);
+
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    if(order_B != order_C)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || k < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csc_val == nullptr || csc_col_ptr == nullptr || csc_row_ind == nullptr || B == nullptr
+       || C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimension of B
+    J one = 1;
+    if(trans_B == rocsparse_operation_none)
+    {
+        if(ldb < std::max(one, order_B == rocsparse_order_column ? k : n))
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+    else
+    {
+        if(ldb < std::max(one, order_B == rocsparse_order_column ? n : k))
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Check leading dimension of C
+    if(ldc < std::max(one, order_C == rocsparse_order_column ? m : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_csrmv_info csrmv_info = (info != nullptr) ? info->csrmv_info : nullptr;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_cscmm_dispatch(handle,
+                                        trans_A,
+                                        trans_B,
+                                        order_B,
+                                        m,
+                                        n,
+                                        k,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csc_val,
+                                        csc_col_ptr,
+                                        csc_row_ind,
+                                        csrmv_info,
+                                        B,
+                                        ldb,
+                                        beta_device_host,
+                                        C,
+                                        ldc);
+    }
+    else
+    {
+        return rocsparse_cscmm_dispatch(handle,
+                                        trans_A,
+                                        trans_B,
+                                        order_B,
+                                        m,
+                                        n,
+                                        k,
+                                        nnz,
+                                        *alpha_device_host,
+                                        descr,
+                                        csc_val,
+                                        csc_col_ptr,
+                                        csc_row_ind,
+                                        csrmv_info,
+                                        B,
+                                        ldb,
+                                        *beta_device_host,
+                                        C,
+                                        ldc);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                     \
+    template rocsparse_status rocsparse_cscmm_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                    \
+        rocsparse_operation       trans_A,                                   \
+        rocsparse_operation       trans_B,                                   \
+        rocsparse_order           order_B,                                   \
+        rocsparse_order           order_C,                                   \
+        JTYPE                     m,                                         \
+        JTYPE                     n,                                         \
+        JTYPE                     k,                                         \
+        ITYPE                     nnz,                                       \
+        const TTYPE*              alpha_device_host,                         \
+        const rocsparse_mat_descr descr,                                     \
+        const TTYPE*              csc_val,                                   \
+        const ITYPE*              csc_col_ptr,                               \
+        const JTYPE*              csc_row_ind,                               \
+        rocsparse_mat_info        info,                                      \
+        const TTYPE*              B,                                         \
+        JTYPE                     ldb,                                       \
+        const TTYPE*              beta_device_host,                          \
+        TTYPE*                    C,                                         \
+        JTYPE                     ldc);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
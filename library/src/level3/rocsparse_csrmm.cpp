@@ -54,6 +54,7 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrmmnn_kernel(rocsparse_operation
                                                             const I* __restrict__ csr_row_ptr,
                                                             const J* __restrict__ csr_col_ind,
                                                             const T* __restrict__ csr_val,
+                                                            const I* __restrict__ csr_perm,
                                                             const T* __restrict__ B,
                                                             J ldb,
                                                             U beta_device_host,
@@ -80,6 +81,7 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrmmnn_kernel(rocsparse_operation
                                                csr_row_ptr,
                                                csr_col_ind,
                                                csr_val,
+                                               csr_perm,
                                                B,
                                                ldb,
                                                beta,
@@ -107,6 +109,7 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrmmnt_kernel(rocsparse_operation
                                                             const I* __restrict__ csr_row_ptr,
                                                             const J* __restrict__ csr_col_ind,
                                                             const T* __restrict__ csr_val,
+                                                            const I* __restrict__ csr_perm,
                                                             const T* __restrict__ B,
                                                             J ldb,
                                                             U beta_device_host,
@@ -134,6 +137,7 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrmmnt_kernel(rocsparse_operation
                                                csr_row_ptr,
                                                csr_col_ind,
                                                csr_val,
+                                               csr_perm,
                                                B,
                                                ldb,
                                                beta,
@@ -261,13 +265,25 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    J                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
-                                                   J                         ldc)
+                                                   J                         ldc,
+                                                   const I*                  csr_perm,
+                                                   bool                      conj_A)
 {
     // Stream
     hipStream_t stream = handle->stream;
 
+    // The kernels conjugate the entries of A if trans_A is conjugate_transpose,
+    // thus conjugation of A is folded into the operation passed to the kernels
+    bool transposed = (trans_A != rocsparse_operation_none);
+    if(conj_A)
+    {
+        trans_A = (trans_A == rocsparse_operation_conjugate_transpose)
+                      ? rocsparse_operation_transpose
+                      : rocsparse_operation_conjugate_transpose;
+    }
+
     // Run different csrmv kernels
-    if(trans_A == rocsparse_operation_none)
+    if(!transposed)
     {
         if((order == rocsparse_order_column && trans_B == rocsparse_operation_none)
            || (order == rocsparse_order_row && trans_B == rocsparse_operation_transpose)
@@ -293,6 +309,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               csr_perm,
                                B,
                                ldb,
                                beta_device_host,
@@ -347,6 +364,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -381,6 +399,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -415,6 +434,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -449,6 +469,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -485,6 +506,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -512,6 +534,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -539,6 +562,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -566,6 +590,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                        csr_row_ptr,
                                        csr_col_ind,
                                        csr_val,
+                                       csr_perm,
                                        B,
                                        ldb,
                                        beta_device_host,
@@ -718,6 +743,9 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging TODO bench logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrmm"),
@@ -836,7 +864,9 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                                  ldb,
                                                  beta_device_host,
                                                  C,
-                                                 ldc);
+                                                 ldc,
+                                                 (const I*)nullptr,
+                                                 false);
     }
     else
     {
@@ -857,7 +887,9 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                                  ldb,
                                                  *beta_device_host,
                                                  C,
-                                                 ldc);
+                                                 ldc,
+                                                 (const I*)nullptr,
+                                                 false);
     }
 
     return rocsparse_status_success;
@@ -897,6 +929,50 @@ INSTANTIATE(int64_t, int64_t, float);
 INSTANTIATE(int64_t, int64_t, double);
 INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
+
+#define INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, UTYPE)         \
+    template rocsparse_status rocsparse_csrmm_template_dispatch( \
+        rocsparse_handle          handle,                        \
+        rocsparse_operation       trans_A,                       \
+        rocsparse_operation       trans_B,                       \
+        rocsparse_order           order,                         \
+        JTYPE                     m,                             \
+        JTYPE                     n,                             \
+        JTYPE                     k,                             \
+        ITYPE                     nnz,                           \
+        UTYPE                     alpha_device_host,             \
+        const rocsparse_mat_descr descr,                         \
+        const TTYPE*              csr_val,                       \
+        const ITYPE*              csr_row_ptr,                   \
+        const JTYPE*              csr_col_ind,                   \
+        const TTYPE*              B,                             \
+        JTYPE                     ldb,                           \
+        UTYPE                     beta_device_host,              \
+        TTYPE*                    C,                             \
+        JTYPE                     ldc,                           \
+        const ITYPE*              csr_perm,                      \
+        bool                      conj_A);
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                     \
+    INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, const TTYPE*); \
+    INSTANTIATE_DISPATCH(ITYPE, JTYPE, TTYPE, TTYPE)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
+#undef INSTANTIATE_DISPATCH
 
 /*
 * ===========================================================================
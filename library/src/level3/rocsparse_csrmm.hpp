@@ -46,7 +46,9 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    J                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
-                                                   J                         ldc);
+                                                   J                         ldc,
+                                                   const I*                  csr_perm,
+                                                   bool                      conj_A);
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
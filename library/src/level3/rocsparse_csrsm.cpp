@@ -63,6 +63,9 @@ rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsm_buffer_size"),
@@ -258,6 +261,9 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsm_analysis"),
@@ -396,7 +402,7 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                                                          (trans_A == rocsparse_operation_none)
                                                              ? info->csrsm_upper_info
                                                              : info->csrsmt_upper_info,
-                                                         &info->zero_pivot,
+                                                         info,
                                                          temp_buffer));
     }
     else
@@ -472,7 +478,7 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                                                          (trans_A == rocsparse_operation_none)
                                                              ? info->csrsm_lower_info
                                                              : info->csrsmt_lower_info,
-                                                         &info->zero_pivot,
+                                                         info,
                                                          temp_buffer));
     }
 
@@ -590,7 +596,7 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
             info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
 
         // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
     }
 
     // Leading dimension
@@ -950,6 +956,9 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrsm_solve"),
@@ -1071,6 +1080,9 @@ extern "C" rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_csrsm_zero_pivot", (const void*&)info, (const void*&)position);
 
@@ -1109,7 +1121,7 @@ extern "C" rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle
             &zero_pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         if(zero_pivot == std::numeric_limits<rocsparse_int>::max())
         {
@@ -1129,8 +1141,8 @@ extern "C" rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle
     else
     {
         // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(position, info->zero_pivot, sizeof(rocsparse_int)));
 
         // If no zero pivot is found, set -1
         if(*position == std::numeric_limits<rocsparse_int>::max())
@@ -1158,6 +1170,9 @@ extern "C" rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle, rocsp
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_csrsm_clear", (const void*&)info);
 
@@ -0,0 +1,326 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gebsrmm_general.hpp"
+
+#include "definitions.h"
+#include "gebsrmm_device_general.h"
+#include "utility.h"
+
+template <rocsparse_int BSR_BLOCK_DIM,
+          rocsparse_int BLK_SIZE_Y,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
+    void gebsrmm_general_index_kernel(rocsparse_direction direction,
+                                      rocsparse_operation trans_B,
+                                      J                   mb,
+                                      J                   n,
+                                      U                   alpha_device_host,
+                                      const I* __restrict__ bsr_row_ptr,
+                                      const J* __restrict__ bsr_col_ind,
+                                      const T* __restrict__ bsr_val,
+                                      J row_block_dim,
+                                      J col_block_dim,
+                                      const T* __restrict__ B,
+                                      J ldb,
+                                      U beta_device_host,
+                                      T* __restrict__ C,
+                                      J                    ldc,
+                                      rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    gebsrmm_general_blockdim_device<BSR_BLOCK_DIM, BLK_SIZE_Y>(direction,
+                                                               trans_B,
+                                                               mb,
+                                                               n,
+                                                               alpha,
+                                                               bsr_row_ptr,
+                                                               bsr_col_ind,
+                                                               bsr_val,
+                                                               row_block_dim,
+                                                               col_block_dim,
+                                                               B,
+                                                               ldb,
+                                                               beta,
+                                                               C,
+                                                               ldc,
+                                                               idx_base);
+}
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_gebsrmm_general_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_operation       trans_B,
+                                                    J                         mb,
+                                                    J                         n,
+                                                    U                         alpha_device_host,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const I*                  bsr_row_ptr,
+                                                    const J*                  bsr_col_ind,
+                                                    J                         row_block_dim,
+                                                    J                         col_block_dim,
+                                                    const T*                  B,
+                                                    J                         ldb,
+                                                    U                         beta_device_host,
+                                                    T*                        C,
+                                                    J                         ldc)
+{
+    dim3 gebsrmm_blocks(mb, (n - 1) / 32 + 1);
+    dim3 gebsrmm_threads(32, 32, 1);
+    hipLaunchKernelGGL((gebsrmm_general_index_kernel<32, 32>),
+                       gebsrmm_blocks,
+                       gebsrmm_threads,
+                       0,
+                       handle->stream,
+                       dir,
+                       trans_B,
+                       mb,
+                       n,
+                       alpha_device_host,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       row_block_dim,
+                       col_block_dim,
+                       B,
+                       ldb,
+                       beta_device_host,
+                       C,
+                       ldc,
+                       descr->base);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_gebsrmm_general_template(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    J                         mb,
+                                                    J                         n,
+                                                    J                         kb,
+                                                    I                         nnzb,
+                                                    const T*                  alpha_device_host,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const I*                  bsr_row_ptr,
+                                                    const J*                  bsr_col_ind,
+                                                    J                         row_block_dim,
+                                                    J                         col_block_dim,
+                                                    const T*                  B,
+                                                    J                         ldb,
+                                                    const T*                  beta_device_host,
+                                                    T*                        C,
+                                                    J                         ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgebsrmm"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              n,
+              kb,
+              nnzb,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              row_block_dim,
+              col_block_dim,
+              (const void*&)B,
+              ldb,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)C,
+              ldc);
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation
+    if(trans_A != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || n < 0 || kb < 0 || nnzb < 0 || row_block_dim <= 0 || col_block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || n == 0 || kb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr || B == nullptr
+       || C == nullptr || alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimension of B
+    if(ldb < ((trans_B == rocsparse_operation_none) ? kb * col_block_dim : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of C
+    if(ldc < mb * row_block_dim)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_gebsrmm_general_dispatch(handle,
+                                                  dir,
+                                                  trans_B,
+                                                  mb,
+                                                  n,
+                                                  alpha_device_host,
+                                                  descr,
+                                                  bsr_val,
+                                                  bsr_row_ptr,
+                                                  bsr_col_ind,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  B,
+                                                  ldb,
+                                                  beta_device_host,
+                                                  C,
+                                                  ldc);
+    }
+    else
+    {
+        return rocsparse_gebsrmm_general_dispatch(handle,
+                                                  dir,
+                                                  trans_B,
+                                                  mb,
+                                                  n,
+                                                  *alpha_device_host,
+                                                  descr,
+                                                  bsr_val,
+                                                  bsr_row_ptr,
+                                                  bsr_col_ind,
+                                                  row_block_dim,
+                                                  col_block_dim,
+                                                  B,
+                                                  ldb,
+                                                  *beta_device_host,
+                                                  C,
+                                                  ldc);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
+    template rocsparse_status rocsparse_gebsrmm_general_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                              \
+        rocsparse_direction       dir,                                                 \
+        rocsparse_operation       trans_A,                                             \
+        rocsparse_operation       trans_B,                                             \
+        JTYPE                     mb,                                                  \
+        JTYPE                     n,                                                   \
+        JTYPE                     kb,                                                  \
+        ITYPE                     nnzb,                                                \
+        const TTYPE*              alpha,                                               \
+        const rocsparse_mat_descr descr,                                               \
+        const TTYPE*              bsr_val,                                             \
+        const ITYPE*              bsr_row_ptr,                                         \
+        const JTYPE*              bsr_col_ind,                                         \
+        JTYPE                     row_block_dim,                                       \
+        JTYPE                     col_block_dim,                                       \
+        const TTYPE*              B,                                                   \
+        JTYPE                     ldb,                                                 \
+        const TTYPE*              beta,                                                \
+        TTYPE*                    C,                                                   \
+        JTYPE                     ldc);
+
+INSTANTIATE(int32_t, int32_t, float)
+INSTANTIATE(int32_t, int32_t, double)
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int32_t, float)
+INSTANTIATE(int64_t, int32_t, double)
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int64_t, float)
+INSTANTIATE(int64_t, int64_t, double)
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex)
+
+#undef INSTANTIATE
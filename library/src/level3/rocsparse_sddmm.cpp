@@ -76,6 +76,13 @@ rocsparse_status rocsparse_sddmm_buffer_size_dispatch_format(rocsparse_format
     {
         return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
     }
+
+    case rocsparse_format_sell:
+    case rocsparse_format_bsr:
+    case rocsparse_format_csr16:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
     return rocsparse_status_invalid_value;
 }
@@ -165,6 +172,9 @@ extern "C" rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_sddmm_buffer_size",
@@ -286,6 +296,13 @@ rocsparse_status rocsparse_sddmm_preprocess_dispatch_format(rocsparse_format
     {
         return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
     }
+
+    case rocsparse_format_sell:
+    case rocsparse_format_bsr:
+    case rocsparse_format_csr16:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
     return rocsparse_status_invalid_value;
 }
@@ -374,6 +391,9 @@ extern "C" rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_sddmm_preprocess",
@@ -498,6 +518,13 @@ rocsparse_status
     {
         return rocsparse_sddmm_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
     }
+
+    case rocsparse_format_sell:
+    case rocsparse_format_bsr:
+    case rocsparse_format_csr16:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
     return rocsparse_status_invalid_value;
 }
@@ -586,6 +613,9 @@ extern "C" rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_sddmm",
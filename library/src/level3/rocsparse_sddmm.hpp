@@ -215,6 +215,11 @@ struct rocsparse_sddmm_st
                 alg,
                 out_buffer_size);
         }
+
+        default:
+        {
+            break;
+        }
         }
         return rocsparse_status_invalid_value;
     }
@@ -334,6 +339,11 @@ struct rocsparse_sddmm_st
                 alg,
                 buffer);
         }
+
+        default:
+        {
+            break;
+        }
         }
         return rocsparse_status_invalid_value;
     }
@@ -453,6 +463,11 @@ struct rocsparse_sddmm_st
                 alg,
                 buffer);
         }
+
+        default:
+        {
+            break;
+        }
         }
         return rocsparse_status_invalid_value;
     }
@@ -0,0 +1,54 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SELLMM_HPP
+#define ROCSPARSE_SELLMM_HPP
+
+#include "handle.h"
+
+template <typename I, typename T>
+rocsparse_status rocsparse_sellmm_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_order           order_B,
+                                           rocsparse_order           order_C,
+                                           I                         m,
+                                           I                         n,
+                                           I                         k,
+                                           I                         nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           I                         slice_size,
+                                           const T*                  sell_val,
+                                           const I*                  sell_slice_ptr,
+                                           const I*                  sell_row_perm,
+                                           const I*                  sell_col_ind,
+                                           const T*                  B,
+                                           I                         ldb,
+                                           const T*                  beta,
+                                           T*                        C,
+                                           I                         ldc);
+
+#endif // ROCSPARSE_SELLMM_HPP
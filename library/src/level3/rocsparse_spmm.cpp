@@ -27,7 +27,13 @@
 #include "utility.h"
 
 #include "rocsparse_coomm.hpp"
+#include "rocsparse_cscmm.hpp"
 #include "rocsparse_csrmm.hpp"
+#include "rocsparse_gebsrmm.hpp"
+#include "rocsparse_gebsrmm_general.hpp"
+#include "rocsparse_sellmm.hpp"
+
+#include "../level2/rocsparse_cscmv.hpp"
 
 #define RETURN_SPMM(itype, jtype, ctype, ...)                                           \
     {                                                                                   \
@@ -95,7 +101,7 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
         {
             algorithm = rocsparse_spmm_alg_coo_atomic;
         }
-        else if(mat_A->format == rocsparse_format_csr)
+        else if(mat_A->format == rocsparse_format_csr || mat_A->format == rocsparse_format_csc)
         {
             algorithm = rocsparse_spmm_alg_csr;
         }
@@ -107,6 +113,33 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
         // We do not need a buffer
         *buffer_size = 4;
 
+        // Run CSC analysis step when format is CSC and A is not transposed, such that
+        // the rows of A can be computed without atomics
+        if(mat_A->format == rocsparse_format_csc && trans_A == rocsparse_operation_none
+           && algorithm == rocsparse_spmm_alg_csr)
+        {
+            // The analysis is shared with rocsparse_spmv
+            bool reanalyse = mat_A->analysed == false || mat_A->info->csrmv_info == nullptr
+                             || mat_A->info->csrmv_info->trans != rocsparse_operation_transpose;
+
+            if(reanalyse)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_cscmv_analysis_template(handle,
+                                                       trans_A,
+                                                       (J)mat_A->rows,
+                                                       (J)mat_A->cols,
+                                                       (I)mat_A->nnz,
+                                                       mat_A->descr,
+                                                       (const T*)mat_A->val_data,
+                                                       (const I*)mat_A->col_data,
+                                                       (const J*)mat_A->row_data,
+                                                       mat_A->info)));
+
+                mat_A->analysed = true;
+            }
+        }
+
         return rocsparse_status_success;
     }
 
@@ -142,6 +175,40 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
         J n = (J)mat_C->cols;
         J k = trans_A == rocsparse_operation_none ? (J)mat_A->cols : (J)mat_A->rows;
 
+        // Batches share the sparsity pattern, which is already reused across all columns
+        // of B, thus each batch runs its own multiplication. A single matrix B is
+        // broadcast to all batches.
+        if(mat_A->batch_count > 1)
+        {
+            int64_t B_batch_stride = (mat_B->batch_count == 1) ? 0 : mat_B->batch_stride;
+
+            for(int batch = 0; batch < mat_A->batch_count; ++batch)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmm_template(
+                    handle,
+                    trans_A,
+                    trans_B,
+                    mat_B->order,
+                    mat_C->order,
+                    m,
+                    n,
+                    k,
+                    (I)mat_A->nnz,
+                    (const T*)alpha,
+                    mat_A->descr,
+                    (const T*)mat_A->val_data + batch * mat_A->batch_stride,
+                    (const I*)mat_A->row_data,
+                    (const J*)mat_A->col_data,
+                    (const T*)mat_B->values + batch * B_batch_stride,
+                    (J)mat_B->ld,
+                    (const T*)beta,
+                    (T*)mat_C->values + batch * mat_C->batch_stride,
+                    (J)mat_C->ld));
+            }
+
+            return rocsparse_status_success;
+        }
+
         return rocsparse_csrmm_template(handle,
                                         trans_A,
                                         trans_B,
@@ -163,6 +230,118 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
                                         (J)mat_C->ld);
     }
 
+    // CSC
+    if(mat_A->format == rocsparse_format_csc)
+    {
+        J m = (J)mat_C->rows;
+        J n = (J)mat_C->cols;
+        J k = trans_A == rocsparse_operation_none ? (J)mat_A->cols : (J)mat_A->rows;
+
+        return rocsparse_cscmm_template(handle,
+                                        trans_A,
+                                        trans_B,
+                                        mat_B->order,
+                                        mat_C->order,
+                                        m,
+                                        n,
+                                        k,
+                                        (I)mat_A->nnz,
+                                        (const T*)alpha,
+                                        mat_A->descr,
+                                        (const T*)mat_A->val_data,
+                                        (const I*)mat_A->col_data,
+                                        (const J*)mat_A->row_data,
+                                        (algorithm == rocsparse_spmm_alg_csr) ? mat_A->info
+                                                                              : nullptr,
+                                        (const T*)mat_B->values,
+                                        (J)mat_B->ld,
+                                        (const T*)beta,
+                                        (T*)mat_C->values,
+                                        (J)mat_C->ld);
+    }
+
+    // SELL-C-sigma
+    if(mat_A->format == rocsparse_format_sell)
+    {
+        return rocsparse_sellmm_template(handle,
+                                         trans_A,
+                                         trans_B,
+                                         mat_B->order,
+                                         mat_C->order,
+                                         (I)mat_C->rows,
+                                         (I)mat_C->cols,
+                                         (I)mat_A->cols,
+                                         (I)mat_A->nnz,
+                                         (const T*)alpha,
+                                         mat_A->descr,
+                                         (I)mat_A->slice_size,
+                                         (const T*)mat_A->val_data,
+                                         (const I*)mat_A->row_data,
+                                         (const I*)mat_A->ind_data,
+                                         (const I*)mat_A->col_data,
+                                         (const T*)mat_B->values,
+                                         (I)mat_B->ld,
+                                         (const T*)beta,
+                                         (T*)mat_C->values,
+                                         (I)mat_C->ld);
+    }
+
+    // BSR
+    if(mat_A->format == rocsparse_format_bsr)
+    {
+        // Block kernels only support column ordered dense matrices
+        if(mat_B->order != rocsparse_order_column || mat_C->order != rocsparse_order_column)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // 32 bit indices use the block dimension specialized kernels
+        if(std::is_same<I, rocsparse_int>() && std::is_same<J, rocsparse_int>())
+        {
+            return rocsparse_gebsrmm_template(handle,
+                                              mat_A->block_dir,
+                                              trans_A,
+                                              trans_B,
+                                              (rocsparse_int)mat_A->rows,
+                                              (rocsparse_int)mat_C->cols,
+                                              (rocsparse_int)mat_A->cols,
+                                              (rocsparse_int)mat_A->nnz,
+                                              (const T*)alpha,
+                                              mat_A->descr,
+                                              (const T*)mat_A->val_data,
+                                              (const rocsparse_int*)mat_A->row_data,
+                                              (const rocsparse_int*)mat_A->col_data,
+                                              (rocsparse_int)mat_A->row_block_dim,
+                                              (rocsparse_int)mat_A->col_block_dim,
+                                              (const T*)mat_B->values,
+                                              (rocsparse_int)mat_B->ld,
+                                              (const T*)beta,
+                                              (T*)mat_C->values,
+                                              (rocsparse_int)mat_C->ld);
+        }
+
+        return rocsparse_gebsrmm_general_template(handle,
+                                                  mat_A->block_dir,
+                                                  trans_A,
+                                                  trans_B,
+                                                  (J)mat_A->rows,
+                                                  (J)mat_C->cols,
+                                                  (J)mat_A->cols,
+                                                  (I)mat_A->nnz,
+                                                  (const T*)alpha,
+                                                  mat_A->descr,
+                                                  (const T*)mat_A->val_data,
+                                                  (const I*)mat_A->row_data,
+                                                  (const J*)mat_A->col_data,
+                                                  (J)mat_A->row_block_dim,
+                                                  (J)mat_A->col_block_dim,
+                                                  (const T*)mat_B->values,
+                                                  (J)mat_B->ld,
+                                                  (const T*)beta,
+                                                  (T*)mat_C->values,
+                                                  (J)mat_C->ld);
+    }
+
     return rocsparse_status_not_implemented;
 }
 
@@ -188,6 +367,9 @@ extern "C" rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
     // Check for invalid handle
     RETURN_IF_INVALID_HANDLE(handle);
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               "rocsparse_spmm",
@@ -224,6 +406,13 @@ extern "C" rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
         return rocsparse_status_not_initialized;
     }
 
+    // Each matrix of a batch writes its own matrix C, a single matrix B may be shared
+    if(mat_A->batch_count != mat_C->batch_count
+       || (mat_B->batch_count != 1 && mat_B->batch_count != mat_A->batch_count))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Check for matching types while we do not support mixed precision computation
     if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
        || compute_type != mat_C->data_type)
@@ -231,8 +420,9 @@ extern "C" rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
         return rocsparse_status_not_implemented;
     }
 
-    RETURN_SPMM(mat_A->row_type,
-                mat_A->col_type,
+    // CSC matrices hold the pointer array in the column data
+    RETURN_SPMM((mat_A->format == rocsparse_format_csc) ? mat_A->col_type : mat_A->row_type,
+                (mat_A->format == rocsparse_format_csc) ? mat_A->row_type : mat_A->col_type,
                 compute_type,
                 handle,
                 trans_A,
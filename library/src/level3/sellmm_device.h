@@ -0,0 +1,104 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SELLMM_DEVICE_H
+#define SELLMM_DEVICE_H
+
+#include "common.h"
+
+// SELL-C-sigma SpMM for general, non-transposed matrices A. Each thread computes one
+// row of a slice for the columns of C assigned to its block.
+template <unsigned int BLOCKSIZE, typename I, typename T>
+static __device__ void sellmmn_device(rocsparse_operation  trans_B,
+                                      rocsparse_order      order,
+                                      I                    m,
+                                      I                    n,
+                                      I                    k,
+                                      I                    slice_size,
+                                      T                    alpha,
+                                      const I*             sell_slice_ptr,
+                                      const I*             sell_row_perm,
+                                      const I*             sell_col_ind,
+                                      const T*             sell_val,
+                                      const T*             B,
+                                      I                    ldb,
+                                      T                    beta,
+                                      T*                   C,
+                                      I                    ldc,
+                                      rocsparse_index_base idx_base)
+{
+    I ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    I slice = ai / slice_size;
+    I lane  = ai % slice_size;
+
+    I slice_begin = sell_slice_ptr[slice] - idx_base;
+    I slice_end   = sell_slice_ptr[slice + 1] - idx_base;
+
+    I row = sell_row_perm[ai] - idx_base;
+
+    // op(B) is accessed by column if it is stored column wise
+    bool col_B = (trans_B == rocsparse_operation_none && order == rocsparse_order_column)
+                 || (trans_B != rocsparse_operation_none && order == rocsparse_order_row);
+    bool conj_B = (trans_B == rocsparse_operation_conjugate_transpose);
+
+    for(I j = hipBlockIdx_y; j < n; j += hipGridDim_y)
+    {
+        T sum = static_cast<T>(0);
+
+        for(I idx = slice_begin + lane; idx < slice_end; idx += slice_size)
+        {
+            I col = sell_col_ind[idx] - idx_base;
+
+            if(col >= 0 && col < k)
+            {
+                T val_B = B[col_B ? (col + j * ldb) : (j + col * ldb)];
+                sum     = rocsparse_fma(sell_val[idx], conj_B ? rocsparse_conj(val_B) : val_B, sum);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        I idx_C = (order == rocsparse_order_column) ? (row + j * ldc) : (row * ldc + j);
+
+        if(beta != static_cast<T>(0))
+        {
+            C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum);
+        }
+        else
+        {
+            C[idx_C] = alpha * sum;
+        }
+    }
+}
+
+#endif // SELLMM_DEVICE_H
@@ -0,0 +1,217 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "log_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+template <typename T>
+static T log_read(const char* data, size_t& pos)
+{
+    T x;
+    memcpy(&x, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return x;
+}
+
+void log_decode(std::ostream& os, char separator, const char* data, size_t size)
+{
+    size_t pos = 0;
+    while(pos < size)
+    {
+        // First argument is preceded by a new line
+        if(pos == 0)
+        {
+            os << "\n";
+        }
+        else
+        {
+            os << separator;
+        }
+
+        log_tag tag = static_cast<log_tag>(data[pos++]);
+        switch(tag)
+        {
+        case log_tag::int64:
+        {
+            os << log_read<int64_t>(data, pos);
+            break;
+        }
+        case log_tag::uint64:
+        {
+            os << log_read<uint64_t>(data, pos);
+            break;
+        }
+        case log_tag::character:
+        {
+            os << log_read<char>(data, pos);
+            break;
+        }
+        case log_tag::float32:
+        {
+            os << log_read<float>(data, pos);
+            break;
+        }
+        case log_tag::float64:
+        {
+            os << log_read<double>(data, pos);
+            break;
+        }
+        case log_tag::complex32:
+        {
+            rocsparse_float_complex x = log_read<rocsparse_float_complex>(data, pos);
+            os << std::real(x) << separator << std::imag(x);
+            break;
+        }
+        case log_tag::complex64:
+        {
+            rocsparse_double_complex x = log_read<rocsparse_double_complex>(data, pos);
+            os << std::real(x) << separator << std::imag(x);
+            break;
+        }
+        case log_tag::pointer:
+        {
+            os << log_read<const void*>(data, pos);
+            break;
+        }
+        case log_tag::string:
+        {
+            uint32_t length = log_read<uint32_t>(data, pos);
+            os.write(data + pos, length);
+            pos += length;
+            break;
+        }
+        }
+    }
+}
+
+rocsparse_log_queue::rocsparse_log_queue(size_t capacity)
+{
+    // Capacity is rounded up to the next power of two
+    size_t size = 2;
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+
+    slots_.reset(new slot[size]);
+    mask_ = size - 1;
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    thread_ = std::thread(&rocsparse_log_queue::worker, this);
+}
+
+rocsparse_log_queue::~rocsparse_log_queue()
+{
+    // Background thread writes all remaining records before it exits
+    stop_.store(true, std::memory_order_release);
+    thread_.join();
+
+    size_t dropped = this->dropped();
+    if(dropped > 0)
+    {
+        std::cerr << "rocsparse: " << dropped << " log records have been dropped" << std::endl;
+    }
+}
+
+bool rocsparse_log_queue::pop(std::ostream** os)
+{
+    slot*  s   = &slots_[dequeue_pos_ & mask_];
+    size_t seq = s->sequence.load(std::memory_order_acquire);
+
+    if(seq != dequeue_pos_ + 1)
+    {
+        return false;
+    }
+
+    // Records that did not fit into their slot have no stream
+    *os = s->os;
+    if(s->os != nullptr)
+    {
+        log_decode(*s->os, s->separator, s->data, s->size);
+    }
+
+    // Release the slot for the next round of the ring buffer
+    s->sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+
+    return true;
+}
+
+void rocsparse_log_queue::worker()
+{
+    int idle = 0;
+
+    for(;;)
+    {
+        // Check for shutdown before draining, such that records that have been
+        // pushed before the shutdown are always written
+        bool stop = stop_.load(std::memory_order_acquire);
+
+        // Streams that have been written to, trace and bench records can go to
+        // different streams
+        std::ostream* streams[2] = {nullptr, nullptr};
+        std::ostream* os         = nullptr;
+
+        bool written = false;
+        while(pop(&os))
+        {
+            written = true;
+
+            if(os != nullptr && os != streams[0])
+            {
+                streams[1] = streams[0];
+                streams[0] = os;
+            }
+        }
+
+        for(std::ostream* stream : streams)
+        {
+            if(stream != nullptr)
+            {
+                stream->flush();
+            }
+        }
+
+        if(written)
+        {
+            idle = 0;
+            continue;
+        }
+
+        if(stop)
+        {
+            break;
+        }
+
+        // Back off while the queue is empty, up to one millisecond
+        std::this_thread::sleep_for(std::chrono::microseconds(1 << std::min(idle++, 10)));
+    }
+}
@@ -0,0 +1,264 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "memory_pool.h"
+#include "definitions.h"
+
+#include <algorithm>
+#include <iterator>
+
+// Requests of at least 2^max_class_log2 bytes are not cached
+static constexpr int    max_class_log2 = 48;
+static constexpr size_t min_class_size = 256;
+static constexpr int    num_bins       = 1 + (max_class_log2 - 8) * 4;
+
+rocsparse_status
+    rocsparse_device_allocator::allocate(void** ptr, size_t size, hipStream_t stream) const
+{
+    if(size == 0)
+    {
+        *ptr = nullptr;
+        return rocsparse_status_success;
+    }
+
+    if(alloc == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, size));
+        return rocsparse_status_success;
+    }
+
+    return alloc(ptr, size, stream, user_data);
+}
+
+rocsparse_status rocsparse_device_allocator::deallocate(void* ptr, hipStream_t stream) const
+{
+    if(ptr == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(free == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+        return rocsparse_status_success;
+    }
+
+    return free(ptr, stream, user_data);
+}
+
+rocsparse_memory_pool::rocsparse_memory_pool(const rocsparse_device_allocator& allocator,
+                                             size_t                            capacity)
+    : allocator_(allocator)
+    , capacity_(capacity)
+    , bins_(num_bins)
+{
+}
+
+rocsparse_memory_pool::~rocsparse_memory_pool()
+{
+    PRINT_IF_ROCSPARSE_ERROR(release());
+}
+
+size_t rocsparse_memory_pool::size_class(size_t size, int* bin)
+{
+    if(size <= min_class_size)
+    {
+        *bin = 0;
+        return min_class_size;
+    }
+
+    // 2^k < size <= 2^(k + 1), split into four classes of 2^(k - 2) bytes each
+    int k = 63 - __builtin_clzll(size - 1);
+
+    if(k >= max_class_log2)
+    {
+        *bin = -1;
+        return size;
+    }
+
+    size_t step = size_t(1) << (k - 2);
+    size_t n    = (size - 1) / step + 1;
+
+    *bin = 1 + (k - 8) * 4 + static_cast<int>(n - 5);
+
+    return n * step;
+}
+
+rocsparse_status rocsparse_memory_pool::allocate(void** ptr, size_t size, hipStream_t stream)
+{
+    if(size == 0)
+    {
+        *ptr = nullptr;
+        return rocsparse_status_success;
+    }
+
+    int    bin;
+    size_t bytes = size_class(size, &bin);
+
+    if(bin >= 0)
+    {
+        std::vector<block>& cache = bins_[bin];
+
+        // Most recently freed blocks first, they are most likely still resident
+        // in cache and, on a different stream, most likely still in flight. Only
+        // blocks of the same stream, or whose release has completed, are reused.
+        for(auto it = cache.rbegin(); it != cache.rend(); ++it)
+        {
+            if(it->stream == stream || hipEventQuery(it->event) == hipSuccess)
+            {
+                block b = *it;
+                cache.erase(std::next(it).base());
+
+                b.stream = stream;
+                used_.emplace(b.ptr, b);
+
+                cached_ -= bytes;
+                in_use_ += bytes;
+                ++hits_;
+
+                *ptr = b.ptr;
+                return rocsparse_status_success;
+            }
+        }
+    }
+
+    ++misses_;
+
+    rocsparse_status status = allocator_.allocate(ptr, bytes, stream);
+
+    // Drop the cache and try again if the device ran out of memory
+    if(status == rocsparse_status_memory_error && cached_ > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(release());
+        status = allocator_.allocate(ptr, bytes, stream);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    used_.emplace(*ptr, block{*ptr, bytes, bin, stream, nullptr});
+
+    in_use_ += bytes;
+    high_water_ = std::max(high_water_, in_use_ + cached_);
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_memory_pool::deallocate(void* ptr, hipStream_t stream)
+{
+    if(ptr == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    auto it = used_.find(ptr);
+
+    if(it == used_.end())
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    block b = it->second;
+    used_.erase(it);
+
+    in_use_ -= b.size;
+
+    // Blocks that do not fit into the cache are returned right away
+    if(b.bin < 0 || cached_ + b.size > capacity_)
+    {
+        b.stream = stream;
+        return free_block(b);
+    }
+
+    if(b.event == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&b.event, hipEventDisableTiming));
+    }
+
+    // Mark the point on stream after which the block is free
+    RETURN_IF_HIP_ERROR(hipEventRecord(b.event, stream));
+
+    b.stream = stream;
+    bins_[b.bin].push_back(b);
+
+    cached_ += b.size;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_memory_pool::free_block(block& b)
+{
+    if(b.event != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipEventDestroy(b.event));
+        b.event = nullptr;
+    }
+
+    return allocator_.deallocate(b.ptr, b.stream);
+}
+
+rocsparse_status rocsparse_memory_pool::release()
+{
+    rocsparse_status status = rocsparse_status_success;
+
+    for(std::vector<block>& cache : bins_)
+    {
+        for(block& b : cache)
+        {
+            rocsparse_status s = free_block(b);
+
+            // Keep releasing, report the first error
+            if(status == rocsparse_status_success)
+            {
+                status = s;
+            }
+        }
+
+        cache.clear();
+    }
+
+    cached_ = 0;
+
+    return status;
+}
+
+rocsparse_status rocsparse_memory_pool::resize(size_t capacity)
+{
+    capacity_ = capacity;
+
+    if(cached_ > capacity_)
+    {
+        return release();
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_memory_pool::set_allocator(const rocsparse_device_allocator& allocator)
+{
+    RETURN_IF_ROCSPARSE_ERROR(release());
+
+    allocator_ = allocator;
+
+    return rocsparse_status_success;
+}
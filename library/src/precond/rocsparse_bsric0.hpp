@@ -150,6 +150,9 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsric0_analysis"),
@@ -273,7 +276,7 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
                                                      bsr_row_ptr,
                                                      bsr_col_ind,
                                                      info->bsric0_info,
-                                                     &info->zero_pivot,
+                                                     info,
                                                      temp_buffer));
 
     return rocsparse_status_success;
@@ -427,6 +430,9 @@ rocsparse_status rocsparse_bsric0_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsric0"),
@@ -132,6 +132,9 @@ rocsparse_status rocsparse_bsrilu0_numeric_boost_template(rocsparse_handle   han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsrilu0_numeric_boost"),
@@ -195,6 +198,9 @@ rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          h
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsrilu0_analysis"),
@@ -318,7 +324,7 @@ rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          h
                                                      bsr_row_ptr,
                                                      bsr_col_ind,
                                                      info->bsrilu0_info,
-                                                     &info->zero_pivot,
+                                                     info,
                                                      temp_buffer));
 
     return rocsparse_status_success;
@@ -622,6 +628,9 @@ rocsparse_status rocsparse_bsrilu0_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xbsrilu0"),
@@ -230,6 +230,9 @@ extern "C" rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocs
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_csric0_clear", (const void*&)info);
 
@@ -318,6 +321,9 @@ extern "C" rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handl
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle, "rocsparse_csric0_zero_pivot", (const void*&)info, (const void*&)position);
 
@@ -356,7 +362,7 @@ extern "C" rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handl
             &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
 
         if(pivot == std::numeric_limits<rocsparse_int>::max())
         {
@@ -376,8 +382,8 @@ extern "C" rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handl
     else
     {
         // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(position, info->zero_pivot, sizeof(rocsparse_int)));
 
         // If no zero pivot is found, set -1
         if(*position == std::numeric_limits<rocsparse_int>::max())
@@ -58,6 +58,9 @@ rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          ha
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsric0_analysis"),
@@ -194,7 +197,7 @@ rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          ha
                                                      csr_row_ptr,
                                                      csr_col_ind,
                                                      info->csric0_info,
-                                                     &info->zero_pivot,
+                                                     info,
                                                      temp_buffer));
 
     return rocsparse_status_success;
@@ -226,6 +229,9 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsric0"),
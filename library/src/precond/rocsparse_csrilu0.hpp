@@ -48,6 +48,9 @@ rocsparse_status rocsparse_csrilu0_numeric_boost_template(rocsparse_handle   han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrilu0_numeric_boost"),
@@ -109,6 +112,9 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrilu0_analysis"),
@@ -245,7 +251,7 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
                                                      csr_row_ptr,
                                                      csr_col_ind,
                                                      info->csrilu0_info,
-                                                     &info->zero_pivot,
+                                                     info,
                                                      temp_buffer));
 
     return rocsparse_status_success;
@@ -672,6 +678,9 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrilu0"),
@@ -43,6 +43,9 @@ rocsparse_status rocsparse_gtsv_buffer_size_template(rocsparse_handle handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgtsv_buffer_size"),
@@ -141,6 +144,9 @@ rocsparse_status rocsparse_gtsv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgtsv"),
@@ -167,6 +167,9 @@ rocsparse_status rocsparse_gtsv_no_pivot_buffer_size_template(rocsparse_handle h
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgtsv_no_pivot_buffer_size"),
@@ -424,6 +427,9 @@ rocsparse_status rocsparse_gtsv_no_pivot_template(rocsparse_handle handle,
         return rocsparse_status_invalid_handle;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xgtsv_no_pivot"),
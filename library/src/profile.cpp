@@ -0,0 +1,306 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profile.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <vector>
+
+/*******************************************************************************
+ * Profiles that have not been written yet, written at exit
+ ******************************************************************************/
+struct rocsparse_profile_registry
+{
+    std::mutex                   mutex;
+    std::set<rocsparse_profile*> profiles;
+};
+
+static rocsparse_profile_registry& rocsparse_get_profile_registry()
+{
+    // The registry is never destroyed, such that handles that are destroyed during
+    // static destruction can still unregister
+    static rocsparse_profile_registry* registry = [] {
+        std::atexit([] {
+            rocsparse_profile_registry& r = rocsparse_get_profile_registry();
+
+            std::set<rocsparse_profile*> profiles;
+            {
+                std::lock_guard<std::mutex> lock(r.mutex);
+                profiles = r.profiles;
+            }
+
+            for(rocsparse_profile* profile : profiles)
+            {
+                profile->dump();
+            }
+        });
+
+        return new rocsparse_profile_registry;
+    }();
+
+    return *registry;
+}
+
+/*******************************************************************************
+ * rocsparse_profile
+ ******************************************************************************/
+rocsparse_profile::rocsparse_profile()
+{
+    rocsparse_profile_registry& registry = rocsparse_get_profile_registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.profiles.insert(this);
+}
+
+rocsparse_profile::~rocsparse_profile()
+{
+    dump();
+
+    rocsparse_profile_registry& registry = rocsparse_get_profile_registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.profiles.erase(this);
+}
+
+void rocsparse_profile::record(const std::string& name, const int64_t* dims, int ndims, double usec)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    entry& e = entries[name];
+
+    e.min_usec = (e.calls == 0) ? usec : std::min(e.min_usec, usec);
+    e.max_usec = (e.calls == 0) ? usec : std::max(e.max_usec, usec);
+    e.total_usec += usec;
+    ++e.calls;
+
+    for(int i = 0; i < ndims; ++i)
+    {
+        // Bucket b > 0 holds values in [2^(b-1), 2^b)
+        int bucket = 0;
+        for(int64_t v = dims[i]; v > 0 && bucket < num_buckets - 1; v >>= 1)
+        {
+            ++bucket;
+        }
+
+        ++e.histogram[i][bucket];
+    }
+}
+
+static int64_t rocsparse_profile_bucket_min(int bucket)
+{
+    return (bucket == 0) ? 0 : int64_t(1) << (bucket - 1);
+}
+
+static int64_t rocsparse_profile_bucket_max(int bucket)
+{
+    return (bucket == 0) ? 0 : (int64_t(1) << (bucket - 1)) * 2 - 1;
+}
+
+void rocsparse_profile::write(std::ostream& out, bool json) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Format into a local stream, such that the format flags of out are left untouched
+    std::ostringstream os;
+
+    // Functions with the largest total time first
+    std::vector<const std::pair<const std::string, entry>*> sorted;
+    for(const std::pair<const std::string, entry>& e : entries)
+    {
+        sorted.push_back(&e);
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+        return a->second.total_usec > b->second.total_usec;
+    });
+
+    if(json)
+    {
+        os << "{\"functions\": [";
+        for(size_t i = 0; i < sorted.size(); ++i)
+        {
+            const entry& e = sorted[i]->second;
+
+            os << (i ? "," : "") << "\n  {\"name\": \"" << sorted[i]->first
+               << "\", \"calls\": " << e.calls << ", \"total_usec\": " << e.total_usec
+               << ", \"min_usec\": " << e.min_usec << ", \"max_usec\": " << e.max_usec
+               << ", \"histograms\": [";
+
+            for(int d = 0; d < num_dims; ++d)
+            {
+                os << (d ? ", " : "") << "[";
+
+                bool first = true;
+                for(int b = 0; b < num_buckets; ++b)
+                {
+                    if(e.histogram[d][b] > 0)
+                    {
+                        os << (first ? "" : ", ") << "{\"min\": " << rocsparse_profile_bucket_min(b)
+                           << ", \"max\": " << rocsparse_profile_bucket_max(b)
+                           << ", \"count\": " << e.histogram[d][b] << "}";
+                        first = false;
+                    }
+                }
+
+                os << "]";
+            }
+
+            os << "]}";
+        }
+        os << "\n]}" << std::endl;
+
+        out << os.str() << std::flush;
+        return;
+    }
+
+    size_t width = 12;
+    for(const auto* e : sorted)
+    {
+        width = std::max(width, e->first.size() + 2);
+    }
+
+    os << "rocSPARSE profile" << std::endl;
+    os << std::left << std::setw(width) << "function" << std::right << std::setw(12) << "calls"
+       << std::setw(14) << "total(ms)" << std::setw(14) << "mean(us)" << std::setw(14)
+       << "min(us)" << std::setw(14) << "max(us)" << std::endl;
+
+    for(const auto* e : sorted)
+    {
+        const entry& s = e->second;
+
+        os << std::left << std::setw(width) << e->first << std::right << std::setw(12) << s.calls
+           << std::fixed << std::setprecision(3) << std::setw(14) << s.total_usec / 1e3
+           << std::setprecision(2) << std::setw(14) << s.total_usec / s.calls << std::setw(14)
+           << s.min_usec << std::setw(14) << s.max_usec << std::endl;
+    }
+
+    // Histograms of the leading integer arguments, e.g. m, n and nnz
+    os << std::endl;
+    for(const auto* e : sorted)
+    {
+        const entry& s = e->second;
+
+        for(int d = 0; d < num_dims; ++d)
+        {
+            bool empty = true;
+            for(int b = 0; b < num_buckets; ++b)
+            {
+                if(s.histogram[d][b] > 0)
+                {
+                    if(empty)
+                    {
+                        os << std::left << std::setw(width) << e->first << "arg " << d << ":";
+                        empty = false;
+                    }
+
+                    os << " [" << rocsparse_profile_bucket_min(b) << ","
+                       << rocsparse_profile_bucket_max(b) << "]=" << s.histogram[d][b];
+                }
+            }
+
+            if(!empty)
+            {
+                os << std::endl;
+            }
+        }
+    }
+
+    out << os.str() << std::flush;
+}
+
+void rocsparse_profile::dump()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(dumped)
+        {
+            return;
+        }
+        dumped = true;
+    }
+
+    char const* format = getenv("ROCSPARSE_LOG_PROFILE_FORMAT");
+    bool        json   = (format != NULL && std::string(format) == "json");
+
+    // Summaries of several handles are appended to the same file
+    char const* path = getenv("ROCSPARSE_LOG_PROFILE_PATH");
+    if(path != NULL)
+    {
+        std::ofstream ofs(path, std::ios::app);
+        if(ofs.is_open())
+        {
+            write(ofs, json);
+            return;
+        }
+    }
+
+    write(std::cerr, json);
+}
+
+/*******************************************************************************
+ * rocsparse_profile_scope
+ ******************************************************************************/
+rocsparse_profile_scope*& rocsparse_profile_scope::current()
+{
+    static thread_local rocsparse_profile_scope* scope = nullptr;
+    return scope;
+}
+
+rocsparse_profile_scope::rocsparse_profile_scope(rocsparse_handle handle)
+    : handle(handle)
+{
+    if(handle == nullptr || handle->profile == nullptr)
+    {
+        return;
+    }
+
+    profile   = handle->profile;
+    parent    = current();
+    current() = this;
+    start     = std::chrono::steady_clock::now();
+}
+
+rocsparse_profile_scope::~rocsparse_profile_scope()
+{
+    if(profile == nullptr)
+    {
+        return;
+    }
+
+    if(named)
+    {
+        double usec = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                 - start)
+                          .count();
+        profile->record(name, dims, ndims, usec);
+    }
+
+    current() = parent;
+}
@@ -24,6 +24,8 @@
 #pragma once
 #include "common.h"
 
+#include <hip/hip_cooperative_groups.h>
+
 template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrcolor_kernel_count_colors(J size,
@@ -117,6 +119,12 @@ __launch_bounds__(BLOCKSIZE) __global__
     }
 }
 
+template <typename J>
+__global__ void csrcolor_kernel_ncolors(const J* __restrict__ max_color, J* __restrict__ ncolors)
+{
+    *ncolors = *max_color + 1;
+}
+
 static __forceinline__ __device__ uint32_t murmur3_32(uint32_t h)
 {
     h ^= h >> 16;
@@ -128,28 +136,14 @@ static __forceinline__ __device__ uint32_t murmur3_32(uint32_t h)
     return h;
 }
 
-template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
-__launch_bounds__(BLOCKSIZE) __global__ void csrcolor_kernel_jpl(J m,
-                                                                 J color,
-                                                                 const I* __restrict__ csr_row_ptr,
-                                                                 const J* __restrict__ csr_col_ind,
-                                                                 rocsparse_index_base csr_base,
-                                                                 J* __restrict__ colors)
+template <typename I, typename J>
+static __forceinline__ __device__ void csrcolor_jpl_device(J row,
+                                                          J color,
+                                                          const I* __restrict__ csr_row_ptr,
+                                                          const J* __restrict__ csr_col_ind,
+                                                          rocsparse_index_base csr_base,
+                                                          J* __restrict__ colors)
 {
-
-    //
-    // Each thread processes a vertex
-    //
-    J row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-
-    //
-    // Do not run out of bounds
-    //
-    if(row >= m)
-    {
-        return;
-    }
-
     //
     // Assume current vertex is maximum and minimum
     //
@@ -237,3 +231,100 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrcolor_kernel_jpl(J m,
         colors[row] = color + 1;
     }
 }
+
+template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) __global__ void csrcolor_kernel_jpl(J m,
+                                                                 J color,
+                                                                 const I* __restrict__ csr_row_ptr,
+                                                                 const J* __restrict__ csr_col_ind,
+                                                                 rocsparse_index_base csr_base,
+                                                                 J* __restrict__ colors)
+{
+    //
+    // Each thread processes a vertex
+    //
+    J row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    //
+    // Do not run out of bounds
+    //
+    if(row >= m)
+    {
+        return;
+    }
+
+    csrcolor_jpl_device(row, color, csr_row_ptr, csr_col_ind, csr_base, colors);
+}
+
+//
+// Persistent Jones-Plassmann Luby kernel, which has to be launched cooperatively.
+// The rounds are separated by grid wide barriers, such that the colors are the same
+// as with one launch of csrcolor_kernel_jpl per round. The number of uncolored
+// vertices of each round is accumulated in one of the two zero initialized counters,
+// alternating between rounds, such that the loop exits on the device.
+//
+template <unsigned int BLOCKSIZE,
+          typename I = rocsparse_int,
+          typename J = rocsparse_int,
+          typename F = float>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_jpl_persistent(J m,
+                                        const I* __restrict__ csr_row_ptr,
+                                        const J* __restrict__ csr_col_ind,
+                                        rocsparse_index_base csr_base,
+                                        const F* __restrict__ fraction_to_color,
+                                        J* __restrict__ colors,
+                                        J* __restrict__ num_uncolored)
+{
+    cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+    const J gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const J inc = hipGridDim_x * hipBlockDim_x;
+
+    const J max_num_uncolored = m - m * fraction_to_color[0];
+
+    __shared__ J sdata[BLOCKSIZE];
+
+    J uncolored = m;
+    for(J round = 0; uncolored > max_num_uncolored; ++round)
+    {
+        J* count = num_uncolored + (round & 1);
+
+        for(J row = gid; row < m; row += inc)
+        {
+            csrcolor_jpl_device(row, 2 * round, csr_row_ptr, csr_col_ind, csr_base, colors);
+        }
+
+        grid.sync();
+
+        //
+        // The counter of the next round was last read before the barrier
+        //
+        if(gid == 0)
+        {
+            num_uncolored[(round + 1) & 1] = 0;
+        }
+
+        J sum = 0;
+        for(J row = gid; row < m; row += inc)
+        {
+            if(colors[row] == -1)
+            {
+                ++sum;
+            }
+        }
+
+        sdata[hipThreadIdx_x] = sum;
+
+        __syncthreads();
+        rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+        if(hipThreadIdx_x == 0)
+        {
+            atomicAdd(count, sdata[0]);
+        }
+
+        grid.sync();
+
+        uncolored = __atomic_load_n(count, __ATOMIC_RELAXED);
+    }
+}
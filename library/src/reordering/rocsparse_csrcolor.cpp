@@ -107,8 +107,12 @@ __launch_bounds__(BLOCKSIZE) static __global__
 
 template <rocsparse_int NUMCOLUMNS_PER_BLOCK, rocsparse_int WF_SIZE, typename J>
 __launch_bounds__(WF_SIZE* NUMCOLUMNS_PER_BLOCK) static __global__
-    void csrcolor_assign_uncolored_kernel(
-        J size, J m, J n, J shift_color, J* __restrict__ colors, J* __restrict__ index_sequence)
+    void csrcolor_assign_uncolored_kernel(J size,
+                                          J m,
+                                          J n,
+                                          const J* __restrict__ max_color,
+                                          J* __restrict__ colors,
+                                          J* __restrict__ index_sequence)
 {
     static constexpr J  s_uncolored_value = static_cast<J>(-1);
     const rocsparse_int wavefront_index   = hipThreadIdx_x / WF_SIZE;
@@ -118,7 +122,7 @@ __launch_bounds__(WF_SIZE* NUMCOLUMNS_PER_BLOCK) static __global__
 
     if(column_index < n)
     {
-        J shift = shift_color + index_sequence[column_index];
+        J shift = *max_color + 1 + index_sequence[column_index];
         //
         // The warp handles the entire column.
         //
@@ -173,11 +177,26 @@ __launch_bounds__(WF_SIZE* NUMCOLUMNS_PER_BLOCK) static __global__
     }
 }
 
+//
+// Round up a temporary storage size to the alignment of the buffers carved from the
+// handle buffer.
+//
+static size_t rocsparse_csrcolor_align(size_t size)
+{
+    return ((size - 1) / 256 + 1) * 256;
+}
+
+//
+// The temporary storage is carved from buffer, which holds buffer_size bytes, and
+// allocated only if it does not fit.
+//
 template <typename J>
 static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle handle,
-                                                            J                num_colored,
+                                                            const J*         max_color,
                                                             J                colors_length,
-                                                            J*               colors)
+                                                            J*               colors,
+                                                            char*            buffer,
+                                                            size_t           buffer_size)
 {
     hipStream_t stream = handle->stream;
     J           m, n;
@@ -191,7 +210,19 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
     //
     // Allocation.
     //
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&seq_ptr, sizeof(J) * (n + 1)));
+    const size_t seq_ptr_size  = rocsparse_csrcolor_align(sizeof(J) * (n + 1));
+    const bool   seq_ptr_alloc = (seq_ptr_size > buffer_size);
+
+    if(seq_ptr_alloc)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&seq_ptr, sizeof(J) * (n + 1)));
+    }
+    else
+    {
+        seq_ptr = reinterpret_cast<J*>(buffer);
+        buffer += seq_ptr_size;
+        buffer_size -= seq_ptr_size;
+    }
 
     //
     // Set to 0.
@@ -237,14 +268,14 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
     //
     // Device buffer should be sufficient for rocprim in most cases
     //
-    if(handle->buffer_size >= temp_storage_bytes)
+    if(buffer_size >= temp_storage_bytes)
     {
-        d_temp_storage = handle->buffer;
+        d_temp_storage = buffer;
         d_temp_alloc   = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&d_temp_storage, temp_storage_bytes));
         d_temp_alloc = true;
     }
 
@@ -263,7 +294,7 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
     //
     if(d_temp_alloc == true)
     {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(d_temp_storage));
     }
 
     //
@@ -285,7 +316,7 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
                            colors_length,
                            m,
                            n,
-                           num_colored,
+                           max_color,
                            colors,
                            seq_ptr);
     }
@@ -305,10 +336,19 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
                            colors_length,
                            m,
                            n,
-                           num_colored,
+                           max_color,
                            colors,
                            seq_ptr);
     }
+
+    //
+    // Free sequence pointers, if allocated.
+    //
+    if(seq_ptr_alloc == true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(seq_ptr));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -335,15 +375,21 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
     J max_num_uncolored = m - m * fraction_to_color[0];
 
     //
-    // Create workspace.
+    // The workspace is taken from the handle buffer, such that no device memory is
+    // allocated or freed (which may synchronize the device) unless a reordering is
+    // requested.
     //
-    J* workspace;
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(J) * blocksize));
+    const size_t workspace_size = rocsparse_csrcolor_align(sizeof(J) * blocksize);
+
+    char* buffer;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&buffer));
+
+    J* workspace = reinterpret_cast<J*>(buffer);
 
     //
     // Initialize colors
     //
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(colors, -1, sizeof(J) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(colors, -1, sizeof(J) * m, stream));
 
     //
     // Iterate until the desired fraction of colored vertices is reached
@@ -392,7 +438,7 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
         //
         // Copy colored max vertices for current iteration to host
         //
-        RETURN_IF_HIP_ERROR(hipMemcpy(&num_uncolored, workspace, sizeof(J), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(&num_uncolored, workspace, sizeof(J)));
     }
 
     //
@@ -400,34 +446,34 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
     // This is something I'll need to figure out.
     // *ncolors += 2 is not the right number of colors, sometimes yes, sometimes no.
     //
-    {
-        hipLaunchKernelGGL((csrcolor_kernel_count_colors<blocksize, J>),
-                           dim3(blocksize),
-                           dim3(blocksize),
-                           0,
-                           stream,
-                           m,
-                           colors,
-                           workspace);
-
-        hipLaunchKernelGGL((csrcolor_kernel_count_colors_finalize<blocksize, J>),
-                           dim3(1),
-                           dim3(blocksize),
-                           0,
-                           stream,
-                           workspace);
-
-        RETURN_IF_HIP_ERROR(hipMemcpy(ncolors, workspace, sizeof(J), hipMemcpyDeviceToHost));
-        *ncolors += 1;
-    }
-    //
-    // Free workspace.
-    //
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors<blocksize, J>),
+                       dim3(blocksize),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       m,
+                       colors,
+                       workspace);
+
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors_finalize<blocksize, J>),
+                       dim3(1),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       workspace);
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->copy_to_host(ncolors, workspace, sizeof(J)));
+    *ncolors += 1;
 
     if(num_uncolored > 0)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrcolor_assign_uncolored(handle, *ncolors, m, colors));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrcolor_assign_uncolored(handle,
+                                                workspace,
+                                                m,
+                                                colors,
+                                                buffer + workspace_size,
+                                                handle->buffer_size - workspace_size));
         *ncolors += num_uncolored;
     }
 
@@ -441,7 +487,7 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
         //
         // Create identity.
         //
-        RETURN_IF_HIP_ERROR(hipMalloc(&reordering_identity, m * sizeof(J)));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&reordering_identity, m * sizeof(J)));
 
         //
         //
@@ -457,7 +503,7 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
         //
         // Alloc output sorted colors.
         //
-        RETURN_IF_HIP_ERROR(hipMalloc(&sorted_colors, m * sizeof(J)));
+        RETURN_IF_ROCSPARSE_ERROR(handle->allocate(&sorted_colors, m * sizeof(J)));
 
         {
             rocsparse_int* keys_input    = colors;
@@ -471,41 +517,42 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
             //
             // Get required size of the temporary storage
             //
-            rocprim::radix_sort_pairs(temporary_storage_ptr,
-                                      temporary_storage_size_bytes,
-                                      keys_input,
-                                      keys_output,
-                                      values_input,
-                                      values_output,
-                                      m,
-                                      0,
-                                      8 * sizeof(rocsparse_int),
-                                      stream);
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(temporary_storage_ptr,
+                                                          temporary_storage_size_bytes,
+                                                          keys_input,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_output,
+                                                          m,
+                                                          0,
+                                                          8 * sizeof(rocsparse_int),
+                                                          stream));
 
             //
             // allocate temporary storage
             //
-            hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->allocate(&temporary_storage_ptr, temporary_storage_size_bytes));
 
             //
             // perform sort
             //
-            rocprim::radix_sort_pairs(temporary_storage_ptr,
-                                      temporary_storage_size_bytes,
-                                      keys_input,
-                                      keys_output,
-                                      values_input,
-                                      values_output,
-                                      m,
-                                      0,
-                                      8 * sizeof(rocsparse_int),
-                                      stream);
-
-            RETURN_IF_HIP_ERROR(hipFree(temporary_storage_ptr));
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(temporary_storage_ptr,
+                                                          temporary_storage_size_bytes,
+                                                          keys_input,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_output,
+                                                          m,
+                                                          0,
+                                                          8 * sizeof(rocsparse_int),
+                                                          stream));
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(temporary_storage_ptr));
         }
 
-        RETURN_IF_HIP_ERROR(hipFree(reordering_identity));
-        RETURN_IF_HIP_ERROR(hipFree(sorted_colors));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(reordering_identity));
+        RETURN_IF_ROCSPARSE_ERROR(handle->deallocate(sorted_colors));
     }
 
     return rocsparse_status_success;
@@ -537,6 +584,9 @@ rocsparse_status rocsparse_csrcolor_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
     // Logging
     log_trace(handle,
               replaceX<T>("rocsparse_Xcsrcolor"),
@@ -593,6 +643,257 @@ rocsparse_status rocsparse_csrcolor_template(rocsparse_handle          handle,
                                        info);
 }
 
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csrcolor_async_dispatch(rocsparse_handle          handle,
+                                                   J                         m,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const floating_data_t<T>* fraction_to_color,
+                                                   J*                        ncolors,
+                                                   J*                        colors,
+                                                   rocsparse_mat_info        info)
+{
+    static constexpr rocsparse_int blocksize = 256;
+
+    hipStream_t stream = handle->stream;
+
+    //
+    // The workspace is taken from the handle buffer. The two counters of uncolored
+    // vertices of the persistent kernel are stored past the reduction buffer.
+    //
+    const size_t workspace_size = rocsparse_csrcolor_align(sizeof(J) * (blocksize + 2));
+
+    char* buffer;
+    RETURN_IF_ROCSPARSE_ERROR(handle->get_buffer(&buffer));
+
+    J* workspace     = reinterpret_cast<J*>(buffer);
+    J* num_uncolored = workspace + blocksize;
+
+    //
+    // Initialize colors
+    //
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(colors, -1, sizeof(J) * m, stream));
+
+    if(handle->properties.cooperativeLaunch)
+    {
+        //
+        // All rounds run in a single kernel, that is limited to the number of blocks
+        // that can be resident at the same time.
+        //
+        int active_blocks;
+        RETURN_IF_HIP_ERROR(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+            &active_blocks,
+            csrcolor_kernel_jpl_persistent<blocksize, I, J, floating_data_t<T>>,
+            blocksize,
+            0));
+
+        const J nblocks = std::min(static_cast<int64_t>((m - 1) / blocksize + 1),
+                                   static_cast<int64_t>(active_blocks)
+                                       * handle->properties.multiProcessorCount);
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(num_uncolored, 0, sizeof(J) * 2, stream));
+
+        rocsparse_index_base base = descr->base;
+
+        void* args[] = {&m,
+                        &csr_row_ptr,
+                        &csr_col_ind,
+                        &base,
+                        &fraction_to_color,
+                        &colors,
+                        &num_uncolored};
+
+        RETURN_IF_HIP_ERROR(hipLaunchCooperativeKernel(
+            csrcolor_kernel_jpl_persistent<blocksize, I, J, floating_data_t<T>>,
+            dim3(nblocks),
+            dim3(blocksize),
+            args,
+            0,
+            stream));
+    }
+    else
+    {
+        //
+        // Without cooperative launches, the rounds are driven by the host, which has to
+        // be synchronized in every round.
+        //
+        floating_data_t<T> fraction;
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->copy_to_host(&fraction, fraction_to_color, sizeof(floating_data_t<T>)));
+
+        J num_uncolored_host = m;
+        J max_num_uncolored  = m - m * fraction;
+
+        for(J color = 0; num_uncolored_host > max_num_uncolored; color += 2)
+        {
+            hipLaunchKernelGGL((csrcolor_kernel_jpl<blocksize, I, J>),
+                               dim3((m - 1) / blocksize + 1),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               m,
+                               color,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base,
+                               colors);
+
+            hipLaunchKernelGGL((csrcolor_kernel_count_uncolored<blocksize, J>),
+                               dim3(blocksize),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               m,
+                               colors,
+                               workspace);
+
+            hipLaunchKernelGGL((csrcolor_kernel_count_uncolored_finalize<blocksize, J>),
+                               dim3(1),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               workspace);
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->copy_to_host(&num_uncolored_host, workspace, sizeof(J)));
+        }
+    }
+
+    //
+    // Compute the maximum color.
+    //
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors<blocksize, J>),
+                       dim3(blocksize),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       m,
+                       colors,
+                       workspace);
+
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors_finalize<blocksize, J>),
+                       dim3(1),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       workspace);
+
+    //
+    // The remaining uncolored vertices, if any, receive distinct new colors.
+    //
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrcolor_assign_uncolored(handle,
+                                            workspace,
+                                            m,
+                                            colors,
+                                            buffer + workspace_size,
+                                            handle->buffer_size - workspace_size));
+
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors<blocksize, J>),
+                       dim3(blocksize),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       m,
+                       colors,
+                       workspace);
+
+    hipLaunchKernelGGL((csrcolor_kernel_count_colors_finalize<blocksize, J>),
+                       dim3(1),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       workspace);
+
+    hipLaunchKernelGGL(
+        (csrcolor_kernel_ncolors<J>), dim3(1), dim3(1), 0, stream, workspace, ncolors);
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_csrcolor_async_template(rocsparse_handle          handle,
+                                                   J                         m,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const floating_data_t<T>* fraction_to_color,
+                                                   J*                        ncolors,
+                                                   J*                        coloring,
+                                                   rocsparse_mat_info        info)
+{
+
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile_scope(handle);
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcolor_async"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)fraction_to_color,
+              (const void*&)ncolors,
+              (const void*&)coloring,
+              (const void*&)info);
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr
+       || fraction_to_color == nullptr || ncolors == nullptr || coloring == nullptr
+       || info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_csrcolor_async_dispatch(handle,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             fraction_to_color,
+                                             ncolors,
+                                             coloring,
+                                             info);
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -632,3 +933,36 @@ C_IMPL(rocsparse_ccsrcolor, rocsparse_float_complex, float);
 C_IMPL(rocsparse_zcsrcolor, rocsparse_double_complex, double);
 
 #undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, TYPE2)                                                 \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,            \
+                                     rocsparse_int             m,                 \
+                                     rocsparse_int             nnz,               \
+                                     const rocsparse_mat_descr descr,             \
+                                     const TYPE*               csr_val,           \
+                                     const rocsparse_int*      csr_row_ptr,       \
+                                     const rocsparse_int*      csr_col_ind,       \
+                                     const TYPE2*              fraction_to_color, \
+                                     rocsparse_int*            ncolors,           \
+                                     rocsparse_int*            coloring,          \
+                                     rocsparse_mat_info        info)              \
+    {                                                                             \
+        return rocsparse_csrcolor_async_template(handle,                          \
+                                                 m,                               \
+                                                 nnz,                             \
+                                                 descr,                           \
+                                                 csr_val,                         \
+                                                 csr_row_ptr,                     \
+                                                 csr_col_ind,                     \
+                                                 fraction_to_color,               \
+                                                 ncolors,                         \
+                                                 coloring,                        \
+                                                 info);                           \
+    }
+
+C_IMPL(rocsparse_scsrcolor_async, float, float);
+C_IMPL(rocsparse_dcsrcolor_async, double, double);
+C_IMPL(rocsparse_ccsrcolor_async, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrcolor_async, rocsparse_double_complex, double);
+
+#undef C_IMPL
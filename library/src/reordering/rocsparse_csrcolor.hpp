@@ -55,4 +55,17 @@ rocsparse_status rocsparse_csrcolor_template(rocsparse_handle          handle,
                                              J*                        reordering,
                                              rocsparse_color_info      info);
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+rocsparse_status rocsparse_csrcolor_async_template(rocsparse_handle          handle,
+                                                   J                         m,
+                                                   I                         nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const floating_data_t<T>* fraction_to_color,
+                                                   J*                        ncolors,
+                                                   J*                        coloring,
+                                                   rocsparse_mat_info        info);
+
 #endif // ROCSPARSE_CSRCOLOR_HPP
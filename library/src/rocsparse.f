@@ -42,6 +42,16 @@ module rocsparse
             type(c_ptr) :: handle
         end function rocsparse_create_handle
 
+        function rocsparse_create_handle_with_flags(handle, flags) &
+                bind(c, name = 'rocsparse_create_handle_with_flags')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_create_handle_with_flags
+            type(c_ptr) :: handle
+            integer(c_int), value :: flags
+        end function rocsparse_create_handle_with_flags
+
         function rocsparse_destroy_handle(handle) &
                 bind(c, name = 'rocsparse_destroy_handle')
             use rocsparse_enums
@@ -261,6 +271,202 @@ module rocsparse
             type(c_ptr), value :: info
         end function rocsparse_destroy_mat_info
 
+        function rocsparse_mat_info_serialize(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, buffer_size, buffer) &
+                bind(c, name = 'rocsparse_mat_info_serialize')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_mat_info_serialize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: info
+            type(c_ptr), value :: buffer_size
+            type(c_ptr), value :: buffer
+        end function rocsparse_mat_info_serialize
+
+        function rocsparse_mat_info_deserialize(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, buffer_size, buffer) &
+                bind(c, name = 'rocsparse_mat_info_deserialize')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_mat_info_deserialize
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_size_t), value :: buffer_size
+            type(c_ptr), intent(in), value :: buffer
+        end function rocsparse_mat_info_deserialize
+
+        function rocsparse_mat_info_save(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, filename) &
+                bind(c, name = 'rocsparse_mat_info_save')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_mat_info_save
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: info
+            character(c_char), intent(in) :: filename(*)
+        end function rocsparse_mat_info_save
+
+        function rocsparse_mat_info_load(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, info, filename) &
+                bind(c, name = 'rocsparse_mat_info_load')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_mat_info_load
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            character(c_char), intent(in) :: filename(*)
+        end function rocsparse_mat_info_load
+
+        function rocsparse_set_analysis_cache_size(handle, size) &
+                bind(c, name = 'rocsparse_set_analysis_cache_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_analysis_cache_size
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: size
+        end function rocsparse_set_analysis_cache_size
+
+        function rocsparse_get_analysis_cache_info(handle, size, used, hits, misses) &
+                bind(c, name = 'rocsparse_get_analysis_cache_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_analysis_cache_info
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: size
+            type(c_ptr), value :: used
+            type(c_ptr), value :: hits
+            type(c_ptr), value :: misses
+        end function rocsparse_get_analysis_cache_info
+
+        function rocsparse_set_allocator(handle, alloc, free, user_data) &
+                bind(c, name = 'rocsparse_set_allocator')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_allocator
+            type(c_ptr), value :: handle
+            type(c_funptr), value :: alloc
+            type(c_funptr), value :: free
+            type(c_ptr), value :: user_data
+        end function rocsparse_set_allocator
+
+        function rocsparse_set_memory_pool_size(handle, size) &
+                bind(c, name = 'rocsparse_set_memory_pool_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_memory_pool_size
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: size
+        end function rocsparse_set_memory_pool_size
+
+        function rocsparse_get_memory_pool_info(handle, used, cached, high_water, &
+                hits, misses) &
+                bind(c, name = 'rocsparse_get_memory_pool_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_memory_pool_info
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: used
+            type(c_ptr), value :: cached
+            type(c_ptr), value :: high_water
+            type(c_ptr), value :: hits
+            type(c_ptr), value :: misses
+        end function rocsparse_get_memory_pool_info
+
+        function rocsparse_get_sync_count(handle, count) &
+                bind(c, name = 'rocsparse_get_sync_count')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_sync_count
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: count
+        end function rocsparse_get_sync_count
+
+        function rocsparse_create_workspace_plan(plan) &
+                bind(c, name = 'rocsparse_create_workspace_plan')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_create_workspace_plan
+            type(c_ptr) :: plan
+        end function rocsparse_create_workspace_plan
+
+        function rocsparse_destroy_workspace_plan(plan) &
+                bind(c, name = 'rocsparse_destroy_workspace_plan')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_destroy_workspace_plan
+            type(c_ptr), value :: plan
+        end function rocsparse_destroy_workspace_plan
+
+        function rocsparse_workspace_plan_add_step(plan, buffer_size, shared_step, &
+                step) &
+                bind(c, name = 'rocsparse_workspace_plan_add_step')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_workspace_plan_add_step
+            type(c_ptr), value :: plan
+            integer(c_size_t), value :: buffer_size
+            integer(c_int), value :: shared_step
+            type(c_ptr), value :: step
+        end function rocsparse_workspace_plan_add_step
+
+        function rocsparse_workspace_plan_get_size(plan, workspace_size) &
+                bind(c, name = 'rocsparse_workspace_plan_get_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_workspace_plan_get_size
+            type(c_ptr), value :: plan
+            type(c_ptr), value :: workspace_size
+        end function rocsparse_workspace_plan_get_size
+
+        function rocsparse_workspace_plan_get_offset(plan, step, offset) &
+                bind(c, name = 'rocsparse_workspace_plan_get_offset')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_workspace_plan_get_offset
+            type(c_ptr), value :: plan
+            integer(c_int), value :: step
+            type(c_ptr), value :: offset
+        end function rocsparse_workspace_plan_get_offset
+
 ! ===========================================================================
 !   level 1 SPARSE
 ! ===========================================================================
@@ -5462,6 +5668,143 @@ module rocsparse
             integer(c_int), value :: partition_type
         end function rocsparse_zcsr2hyb
 
+!       rocsparse_csr2hyb_bounded_buffer_size
+        function rocsparse_csr2hyb_bounded_buffer_size(handle, m, n, nnz, &
+                user_ell_width, partition_type, ell_width_bound, coo_nnz_bound, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_csr2hyb_bounded_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2hyb_bounded_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width_bound
+            type(c_ptr), value :: coo_nnz_bound
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csr2hyb_bounded_buffer_size
+
+!       rocsparse_csr2hyb_bounded
+        function rocsparse_scsr2hyb_bounded(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, user_ell_width, partition_type, &
+                ell_width, ell_val, ell_col_ind, coo_nnz, coo_val, coo_row_ind, &
+                coo_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_scsr2hyb_bounded')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2hyb_bounded
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: coo_nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsr2hyb_bounded
+
+        function rocsparse_dcsr2hyb_bounded(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, user_ell_width, partition_type, &
+                ell_width, ell_val, ell_col_ind, coo_nnz, coo_val, coo_row_ind, &
+                coo_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsr2hyb_bounded')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2hyb_bounded
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: coo_nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsr2hyb_bounded
+
+        function rocsparse_ccsr2hyb_bounded(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, user_ell_width, partition_type, &
+                ell_width, ell_val, ell_col_ind, coo_nnz, coo_val, coo_row_ind, &
+                coo_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsr2hyb_bounded')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2hyb_bounded
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: coo_nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsr2hyb_bounded
+
+        function rocsparse_zcsr2hyb_bounded(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, user_ell_width, partition_type, &
+                ell_width, ell_val, ell_col_ind, coo_nnz, coo_val, coo_row_ind, &
+                coo_col_ind, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsr2hyb_bounded')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2hyb_bounded
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: coo_nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsr2hyb_bounded
+
 !       rocsparse_csr2bsr_nnz
         function rocsparse_csr2bsr_nnz(handle, dir, m, n, csr_descr, csr_row_ptr, &
                 csr_col_ind, block_dim, bsr_descr, bsr_row_ptr, bsr_nnz) &
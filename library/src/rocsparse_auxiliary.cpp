@@ -21,10 +21,13 @@
  *
  * ************************************************************************ */
 
+#include "analysis_cache.h"
 #include "definitions.h"
 #include "handle.h"
+#include "handle_pool.h"
 #include "rocsparse.h"
 #include "utility.h"
+#include "workspace_plan.h"
 
 #include <hip/hip_runtime_api.h>
 
@@ -66,6 +69,66 @@ rocsparse_status rocsparse_create_handle(rocsparse_handle* handle)
     }
 }
 
+/********************************************************************************
+ * \brief create handle with flags, see rocsparse_handle_flags
+ *******************************************************************************/
+rocsparse_status rocsparse_create_handle_with_flags(rocsparse_handle* handle, unsigned int flags)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    *handle = nullptr;
+
+    // Check for unknown flags
+    if((flags & ~ROCSPARSE_HANDLE_FLAGS_MASK) != 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    try
+    {
+        // Reuse a handle of the active device from the pool
+        if(flags & rocsparse_handle_flags_pooled)
+        {
+            int device;
+            RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+            *handle = rocsparse_handle_pool::instance().acquire(device);
+        }
+
+        if(*handle != nullptr)
+        {
+            (*handle)->flags = flags;
+
+            // A lazy handle from the pool might not hold all resources yet
+            if(!(flags & rocsparse_handle_flags_lazy))
+            {
+                rocsparse_status status = (*handle)->resources.initialize((*handle)->stream);
+                if(status != rocsparse_status_success)
+                {
+                    delete *handle;
+                    *handle = nullptr;
+                    return status;
+                }
+            }
+        }
+        else
+        {
+            *handle = new _rocsparse_handle(flags);
+        }
+
+        log_trace(*handle, "rocsparse_create_handle_with_flags", flags);
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief destroy handle
  *******************************************************************************/
@@ -75,6 +138,23 @@ rocsparse_status rocsparse_destroy_handle(rocsparse_handle handle)
     // Destruct
     try
     {
+        // Pooled handles are kept for reuse, unless the pool is full. The pool is never
+        // destroyed, handles with asynchronous logging or profiling are destroyed, such
+        // that the log worker is joined, the log files are closed and the profile summary
+        // is written.
+        if(handle != nullptr && (handle->flags & rocsparse_handle_flags_pooled)
+           && handle->log_queue == nullptr && handle->profile == nullptr)
+        {
+            // The next owner must not share the device buffer with pending work
+            RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+            handle->reset();
+
+            if(rocsparse_handle_pool::instance().release(handle))
+            {
+                return rocsparse_status_success;
+            }
+        }
+
         delete handle;
     }
     catch(const rocsparse_status& status)
@@ -115,6 +195,215 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Set the capacity of the analysis cache in bytes, 0 disables caching.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t size)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_set_analysis_cache_size", size);
+
+    try
+    {
+        if(size == 0)
+        {
+            // Release all cached meta data
+            delete handle->analysis_cache;
+            handle->analysis_cache = nullptr;
+        }
+        else if(handle->analysis_cache == nullptr)
+        {
+            handle->analysis_cache = new rocsparse_analysis_cache(size);
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->resize(size, handle->stream));
+        }
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get capacity, size and statistics of the analysis cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_analysis_cache_info(
+    rocsparse_handle handle, size_t* size, size_t* used, int64_t* hits, int64_t* misses)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle,
+              "rocsparse_get_analysis_cache_info",
+              (const void*&)size,
+              (const void*&)used,
+              (const void*&)hits,
+              (const void*&)misses);
+
+    if(size == nullptr || used == nullptr || hits == nullptr || misses == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    const rocsparse_analysis_cache* cache = handle->analysis_cache;
+
+    *size   = (cache != nullptr) ? cache->capacity() : 0;
+    *used   = (cache != nullptr) ? cache->size() : 0;
+    *hits   = (cache != nullptr) ? cache->hits() : 0;
+    *misses = (cache != nullptr) ? cache->misses() : 0;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set the device memory allocator, nullptr restores hipMalloc and hipFree.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_allocator(rocsparse_handle     handle,
+                                         rocsparse_alloc_func alloc,
+                                         rocsparse_free_func  free,
+                                         void*                user_data)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle,
+              "rocsparse_set_allocator",
+              (const void*&)alloc,
+              (const void*&)free,
+              (const void*&)user_data);
+
+    // Either both or none of the functions have to be set
+    if((alloc == nullptr) != (free == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_device_allocator allocator;
+
+    allocator.alloc     = alloc;
+    allocator.free      = free;
+    allocator.user_data = (alloc != nullptr) ? user_data : nullptr;
+
+    return handle->set_allocator(allocator);
+}
+
+/********************************************************************************
+ * \brief Set the capacity of the memory pool in bytes, 0 disables pooling.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_memory_pool_size(rocsparse_handle handle, size_t size)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_set_memory_pool_size", size);
+
+    try
+    {
+        if(size == 0)
+        {
+            // Release all cached blocks
+            delete handle->memory_pool;
+            handle->memory_pool = nullptr;
+        }
+        else if(handle->memory_pool == nullptr)
+        {
+            handle->memory_pool = new rocsparse_memory_pool(handle->allocator, size);
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->memory_pool->resize(size));
+        }
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get usage and statistics of the memory pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_memory_pool_info(rocsparse_handle handle,
+                                                size_t*          used,
+                                                size_t*          cached,
+                                                size_t*          high_water,
+                                                int64_t*         hits,
+                                                int64_t*         misses)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle,
+              "rocsparse_get_memory_pool_info",
+              (const void*&)used,
+              (const void*&)cached,
+              (const void*&)high_water,
+              (const void*&)hits,
+              (const void*&)misses);
+
+    if(used == nullptr || cached == nullptr || high_water == nullptr || hits == nullptr
+       || misses == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    const rocsparse_memory_pool* pool = handle->memory_pool;
+
+    *used       = (pool != nullptr) ? pool->bytes_in_use() : 0;
+    *cached     = (pool != nullptr) ? pool->bytes_cached() : 0;
+    *high_water = (pool != nullptr) ? pool->high_water_mark() : 0;
+    *hits       = (pool != nullptr) ? pool->hits() : 0;
+    *misses     = (pool != nullptr) ? pool->misses() : 0;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get the number of host synchronizations with the stream of the handle.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_sync_count(rocsparse_handle handle, int64_t* count)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_get_sync_count", (const void*&)count);
+
+    if(count == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *count = handle->sync_count;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -417,28 +706,13 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     try
     {
         // Clean up ELL part
-        if(hyb->ell_col_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-        }
-        if(hyb->ell_val != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-        }
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->ell_col_ind, 0));
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->ell_val, 0));
 
         // Clean up COO part
-        if(hyb->coo_row_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-        }
-        if(hyb->coo_col_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-        }
-        if(hyb->coo_val != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
-        }
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_row_ind, 0));
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_col_ind, 0));
+        RETURN_IF_ROCSPARSE_ERROR(hyb->allocator.deallocate(hyb->coo_val, 0));
 
         delete hyb;
     }
@@ -543,6 +817,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
     }
 
+    // Clear csrmv merge path info struct
+    if(info->csrmv_merge_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_merge_info));
+    }
+
     // Clear bsrsvt upper info struct
     if(info->bsrsvt_upper_info != nullptr)
     {
@@ -648,7 +928,7 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->zero_pivot));
+        RETURN_IF_ROCSPARSE_ERROR(info->allocator.deallocate(info->zero_pivot, 0));
         info->zero_pivot = nullptr;
     }
 
@@ -715,102 +995,230 @@ rocsparse_status rocsparse_destroy_color_info(rocsparse_color_info info)
 }
 
 /********************************************************************************
- * \brief rocsparse_create_spvec_descr creates a descriptor holding the sparse
- * vector data, sizes and properties. It must be called prior to all subsequent
- * library function calls that involve sparse vectors. It should be destroyed at
- * the end using rocsparse_destroy_spvec_descr(). All data pointers remain valid.
+ * \brief rocsparse_create_workspace_plan creates an empty workspace plan, that
+ * packs the temporary buffers of a sequence of operations into a single
+ * workspace. It should be destroyed at the end using
+ * rocsparse_destroy_workspace_plan().
  *******************************************************************************/
-rocsparse_status rocsparse_create_spvec_descr(rocsparse_spvec_descr* descr,
-                                              int64_t                size,
-                                              int64_t                nnz,
-                                              void*                  indices,
-                                              void*                  values,
-                                              rocsparse_indextype    idx_type,
-                                              rocsparse_index_base   idx_base,
-                                              rocsparse_datatype     data_type)
+rocsparse_status rocsparse_create_workspace_plan(rocsparse_workspace_plan* plan)
 {
-    // Check for valid descriptor
-    if(descr == nullptr)
+    if(plan == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
-
-    // Check for valid sizes
-    if(size < 0 || nnz < 0 || size < nnz)
+    else
     {
-        return rocsparse_status_invalid_size;
+        *plan = nullptr;
+        // Allocate
+        try
+        {
+            *plan = new _rocsparse_workspace_plan;
+        }
+        catch(...)
+        {
+            return exception_to_rocsparse_status();
+        }
+        return rocsparse_status_success;
     }
+}
 
-    // Check for valid pointers
-    if(nnz > 0 && (indices == nullptr || values == nullptr))
+/********************************************************************************
+ * \brief Destroy workspace plan.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_workspace_plan(rocsparse_workspace_plan plan)
+{
+    if(plan == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    *descr = nullptr;
-    // Allocate
-    try
-    {
-        *descr = new _rocsparse_spvec_descr;
-
-        (*descr)->init = true;
-
-        (*descr)->size = size;
-        (*descr)->nnz  = nnz;
+    delete plan;
 
-        (*descr)->idx_data = indices;
-        (*descr)->val_data = values;
+    return rocsparse_status_success;
+}
 
-        (*descr)->idx_type  = idx_type;
-        (*descr)->data_type = data_type;
+/********************************************************************************
+ * \brief Append a step with its temporary buffer size to the workspace plan.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_plan_add_step(rocsparse_workspace_plan plan,
+                                                   size_t                   buffer_size,
+                                                   rocsparse_int            shared_step,
+                                                   rocsparse_int*           step)
+{
+    if(plan == nullptr || step == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
 
-        (*descr)->idx_base = idx_base;
+    try
+    {
+        return plan->add_step(buffer_size, shared_step, step);
     }
-    catch(const rocsparse_status& status)
+    catch(...)
     {
-        return status;
+        return exception_to_rocsparse_status();
     }
-
-    return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_destroy_spvec_descr destroys a sparse vector descriptor.
+ * \brief Get the size of the packed workspace of the workspace plan.
  *******************************************************************************/
-rocsparse_status rocsparse_destroy_spvec_descr(rocsparse_spvec_descr descr)
+rocsparse_status rocsparse_workspace_plan_get_size(rocsparse_workspace_plan plan,
+                                                   size_t*                  workspace_size)
 {
-    // Check for valid handle
-    if(descr == nullptr)
+    if(plan == nullptr || workspace_size == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    // Check if descriptor has been initialized
-    if(descr->init == false)
-    {
-        // Do nothing
-        return rocsparse_status_success;
-    }
-
-    // Destruct
     try
     {
-        delete descr;
+        if(!plan->packed)
+        {
+            plan->pack();
+        }
     }
-    catch(const rocsparse_status& status)
+    catch(...)
     {
-        return status;
+        return exception_to_rocsparse_status();
     }
 
+    *workspace_size = plan->workspace_size;
+
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_spvec_get returns the sparse vector matrix data, sizes and
- * properties.
+ * \brief Get the offset of the buffer of a step within the packed workspace.
  *******************************************************************************/
-rocsparse_status rocsparse_spvec_get(const rocsparse_spvec_descr descr,
-                                     int64_t*                    size,
+rocsparse_status rocsparse_workspace_plan_get_offset(rocsparse_workspace_plan plan,
+                                                     rocsparse_int            step,
+                                                     size_t*                  offset)
+{
+    if(plan == nullptr || offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(step < 0 || step >= static_cast<rocsparse_int>(plan->sizes.size()))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    try
+    {
+        if(!plan->packed)
+        {
+            plan->pack();
+        }
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+
+    *offset = plan->offsets[step];
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_spvec_descr creates a descriptor holding the sparse
+ * vector data, sizes and properties. It must be called prior to all subsequent
+ * library function calls that involve sparse vectors. It should be destroyed at
+ * the end using rocsparse_destroy_spvec_descr(). All data pointers remain valid.
+ *******************************************************************************/
+rocsparse_status rocsparse_create_spvec_descr(rocsparse_spvec_descr* descr,
+                                              int64_t                size,
+                                              int64_t                nnz,
+                                              void*                  indices,
+                                              void*                  values,
+                                              rocsparse_indextype    idx_type,
+                                              rocsparse_index_base   idx_base,
+                                              rocsparse_datatype     data_type)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid sizes
+    if(size < 0 || nnz < 0 || size < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid pointers
+    if(nnz > 0 && (indices == nullptr || values == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *descr = nullptr;
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spvec_descr;
+
+        (*descr)->init = true;
+
+        (*descr)->size = size;
+        (*descr)->nnz  = nnz;
+
+        (*descr)->idx_data = indices;
+        (*descr)->val_data = values;
+
+        (*descr)->idx_type  = idx_type;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_destroy_spvec_descr destroys a sparse vector descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_spvec_descr(rocsparse_spvec_descr descr)
+{
+    // Check for valid handle
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        // Do nothing
+        return rocsparse_status_success;
+    }
+
+    // Destruct
+    try
+    {
+        delete descr;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_spvec_get returns the sparse vector matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_spvec_get(const rocsparse_spvec_descr descr,
+                                     int64_t*                    size,
                                      int64_t*                    nnz,
                                      void**                      indices,
                                      void**                      values,
@@ -1299,30 +1707,81 @@ rocsparse_status rocsparse_create_ell_descr(rocsparse_spmat_descr* descr,
 }
 
 /********************************************************************************
- * \brief rocsparse_destroy_spmat_descr destroys a sparse matrix descriptor.
+ * \brief rocsparse_create_sell_descr creates a descriptor holding the SELL-C-sigma
+ * matrix data, sizes and properties. It must be called prior to all subsequent
+ * library function calls that involve sparse matrices. It should be destroyed
+ * at the end using rocsparse_destroy_spmat_descr(). All data pointers remain
+ * valid.
  *******************************************************************************/
-rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr)
+rocsparse_status rocsparse_create_sell_descr(rocsparse_spmat_descr* descr,
+                                             int64_t                rows,
+                                             int64_t                cols,
+                                             int64_t                nnz,
+                                             int64_t                slice_size,
+                                             int64_t                sigma,
+                                             void*                  sell_slice_ptr,
+                                             void*                  sell_row_perm,
+                                             void*                  sell_col_ind,
+                                             void*                  sell_val,
+                                             rocsparse_indextype    idx_type,
+                                             rocsparse_index_base   idx_base,
+                                             rocsparse_datatype     data_type)
 {
-    // Check for valid handle
+    // Check for valid descriptor
     if(descr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    // Check if descriptor has been initialized
-    if(descr->init == false)
+    // Check for valid sizes
+    if(rows < 0 || cols < 0 || nnz < 0 || slice_size <= 0 || sigma <= 0)
     {
-        // Do nothing
-        return rocsparse_status_success;
+        return rocsparse_status_invalid_size;
     }
 
-    // Destruct
+    // Check for valid pointers
+    if(rows > 0 && cols > 0 && (sell_slice_ptr == nullptr || sell_row_perm == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz > 0 && (sell_col_ind == nullptr || sell_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *descr = nullptr;
+    // Allocate
     try
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr->descr));
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(descr->info));
+        *descr = new _rocsparse_spmat_descr;
 
-        delete descr;
+        (*descr)->init = true;
+
+        (*descr)->rows = rows;
+        (*descr)->cols = cols;
+        (*descr)->nnz  = nnz;
+
+        (*descr)->slice_size = slice_size;
+        (*descr)->sigma      = sigma;
+
+        (*descr)->row_data = sell_slice_ptr;
+        (*descr)->col_data = sell_col_ind;
+        (*descr)->ind_data = sell_row_perm;
+        (*descr)->val_data = sell_val;
+
+        (*descr)->row_type  = idx_type;
+        (*descr)->col_type  = idx_type;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+        (*descr)->format   = rocsparse_format_sell;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&(*descr)->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&(*descr)->info));
+
+        // Initialize descriptor
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_mat_index_base((*descr)->descr, idx_base));
     }
     catch(const rocsparse_status& status)
     {
@@ -1333,87 +1792,312 @@ rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr)
 }
 
 /********************************************************************************
- * \brief rocsparse_coo_get returns the sparse COO matrix data, sizes and
- * properties.
+ * \brief rocsparse_create_bsr_descr creates a descriptor holding the BSR matrix
+ * data, sizes and properties. Sizes are given in number of blocks, blocks are
+ * of dimension row_block_dim x col_block_dim. It must be called prior to all
+ * subsequent library function calls that involve sparse matrices. It should be
+ * destroyed at the end using rocsparse_destroy_spmat_descr(). All data pointers
+ * remain valid.
  *******************************************************************************/
-rocsparse_status rocsparse_coo_get(const rocsparse_spmat_descr descr,
-                                   int64_t*                    rows,
-                                   int64_t*                    cols,
-                                   int64_t*                    nnz,
-                                   void**                      coo_row_ind,
-                                   void**                      coo_col_ind,
-                                   void**                      coo_val,
-                                   rocsparse_indextype*        idx_type,
-                                   rocsparse_index_base*       idx_base,
-                                   rocsparse_datatype*         data_type)
+rocsparse_status rocsparse_create_bsr_descr(rocsparse_spmat_descr* descr,
+                                            int64_t                mb,
+                                            int64_t                nb,
+                                            int64_t                nnzb,
+                                            rocsparse_direction    block_dir,
+                                            int64_t                row_block_dim,
+                                            int64_t                col_block_dim,
+                                            void*                  bsr_row_ptr,
+                                            void*                  bsr_col_ind,
+                                            void*                  bsr_val,
+                                            rocsparse_indextype    row_ptr_type,
+                                            rocsparse_indextype    col_ind_type,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type)
 {
-    // Check for valid pointers
+    // Check for valid descriptor
     if(descr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    // Check for invalid size pointers
-    if(rows == nullptr || cols == nullptr || nnz == nullptr)
+    // Check for valid block direction
+    if(rocsparse_enum_utils::is_invalid(block_dir))
     {
-        return rocsparse_status_invalid_pointer;
+        return rocsparse_status_invalid_value;
     }
 
-    // Check for invalid data pointers
-    if(coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr)
+    // Check for valid sizes
+    if(mb < 0 || nb < 0 || nnzb < 0 || nnzb > mb * nb || row_block_dim <= 0
+       || col_block_dim <= 0)
     {
-        return rocsparse_status_invalid_pointer;
+        return rocsparse_status_invalid_size;
     }
 
-    // Check for invalid property pointers
-    if(idx_type == nullptr || idx_base == nullptr || data_type == nullptr)
+    // Check for valid pointers
+    if(mb > 0 && bsr_row_ptr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    // Check if descriptor has been initialized
-    if(descr->init == false)
+    if(nnzb > 0 && (bsr_col_ind == nullptr || bsr_val == nullptr))
     {
-        return rocsparse_status_not_initialized;
+        return rocsparse_status_invalid_pointer;
     }
 
-    *rows = descr->rows;
-    *cols = descr->cols;
-    *nnz  = descr->nnz;
+    *descr = nullptr;
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spmat_descr;
 
-    *coo_row_ind = descr->row_data;
-    *coo_col_ind = descr->col_data;
-    *coo_val     = descr->val_data;
+        (*descr)->init = true;
 
-    *idx_type  = descr->row_type;
-    *idx_base  = descr->idx_base;
-    *data_type = descr->data_type;
+        (*descr)->rows = mb;
+        (*descr)->cols = nb;
+        (*descr)->nnz  = nnzb;
+
+        (*descr)->block_dir     = block_dir;
+        (*descr)->row_block_dim = row_block_dim;
+        (*descr)->col_block_dim = col_block_dim;
+
+        (*descr)->row_data = bsr_row_ptr;
+        (*descr)->col_data = bsr_col_ind;
+        (*descr)->val_data = bsr_val;
+
+        (*descr)->row_type  = row_ptr_type;
+        (*descr)->col_type  = col_ind_type;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+        (*descr)->format   = rocsparse_format_bsr;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&(*descr)->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&(*descr)->info));
+
+        // Initialize descriptor
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_mat_index_base((*descr)->descr, idx_base));
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
 
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_coo_aos_get returns the sparse COO (AoS) matrix data, sizes and
- * properties.
+ * \brief rocsparse_create_csr16_descr creates a descriptor holding the CSR16
+ * matrix data, sizes and properties. Column indices are stored as 16 bit offsets
+ * to a per row base column, entries that cannot be reached from the base column
+ * are stored separately in COO format. It must be called prior to all subsequent
+ * library function calls that involve sparse matrices. It should be destroyed at
+ * the end using rocsparse_destroy_spmat_descr(). All data pointers remain valid.
  *******************************************************************************/
-rocsparse_status rocsparse_coo_aos_get(const rocsparse_spmat_descr descr,
-                                       int64_t*                    rows,
-                                       int64_t*                    cols,
-                                       int64_t*                    nnz,
-                                       void**                      coo_ind,
-                                       void**                      coo_val,
-                                       rocsparse_indextype*        idx_type,
-                                       rocsparse_index_base*       idx_base,
-                                       rocsparse_datatype*         data_type)
+rocsparse_status rocsparse_create_csr16_descr(rocsparse_spmat_descr* descr,
+                                              int64_t                rows,
+                                              int64_t                cols,
+                                              int64_t                nnz,
+                                              int64_t                esc_nnz,
+                                              void*                  csr16_row_ptr,
+                                              void*                  csr16_row_base,
+                                              void*                  csr16_col_off,
+                                              void*                  csr16_val,
+                                              void*                  csr16_esc_row_ind,
+                                              void*                  csr16_esc_col_ind,
+                                              void*                  csr16_esc_val,
+                                              rocsparse_indextype    idx_type,
+                                              rocsparse_index_base   idx_base,
+                                              rocsparse_datatype     data_type)
 {
-    // Check for valid pointers
+    // Check for valid descriptor
     if(descr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    // Check for invalid size pointers
-    if(rows == nullptr || cols == nullptr || nnz == nullptr)
+    // Check for valid sizes
+    if(rows < 0 || cols < 0 || nnz < 0 || esc_nnz < 0 || nnz + esc_nnz > rows * cols)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid pointers
+    if(rows > 0 && (csr16_row_ptr == nullptr || csr16_row_base == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz > 0 && (csr16_col_off == nullptr || csr16_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(esc_nnz > 0
+       && (csr16_esc_row_ind == nullptr || csr16_esc_col_ind == nullptr
+           || csr16_esc_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *descr = nullptr;
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spmat_descr;
+
+        (*descr)->init = true;
+
+        (*descr)->rows = rows;
+        (*descr)->cols = cols;
+        (*descr)->nnz  = nnz;
+
+        (*descr)->row_data = csr16_row_ptr;
+        (*descr)->col_data = csr16_col_off;
+        (*descr)->ind_data = csr16_row_base;
+        (*descr)->val_data = csr16_val;
+
+        (*descr)->esc_nnz      = esc_nnz;
+        (*descr)->esc_row_data = csr16_esc_row_ind;
+        (*descr)->esc_col_data = csr16_esc_col_ind;
+        (*descr)->esc_val_data = csr16_esc_val;
+
+        (*descr)->row_type  = idx_type;
+        (*descr)->col_type  = rocsparse_indextype_u16;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+        (*descr)->format   = rocsparse_format_csr16;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&(*descr)->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&(*descr)->info));
+
+        // Initialize descriptor
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_mat_index_base((*descr)->descr, idx_base));
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_destroy_spmat_descr destroys a sparse matrix descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr)
+{
+    // Check for valid handle
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        // Do nothing
+        return rocsparse_status_success;
+    }
+
+    // Destruct
+    try
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(descr->info));
+
+        delete descr;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_coo_get returns the sparse COO matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_coo_get(const rocsparse_spmat_descr descr,
+                                   int64_t*                    rows,
+                                   int64_t*                    cols,
+                                   int64_t*                    nnz,
+                                   void**                      coo_row_ind,
+                                   void**                      coo_col_ind,
+                                   void**                      coo_val,
+                                   rocsparse_indextype*        idx_type,
+                                   rocsparse_index_base*       idx_base,
+                                   rocsparse_datatype*         data_type)
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid size pointers
+    if(rows == nullptr || cols == nullptr || nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid data pointers
+    if(coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid property pointers
+    if(idx_type == nullptr || idx_base == nullptr || data_type == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *rows = descr->rows;
+    *cols = descr->cols;
+    *nnz  = descr->nnz;
+
+    *coo_row_ind = descr->row_data;
+    *coo_col_ind = descr->col_data;
+    *coo_val     = descr->val_data;
+
+    *idx_type  = descr->row_type;
+    *idx_base  = descr->idx_base;
+    *data_type = descr->data_type;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_coo_aos_get returns the sparse COO (AoS) matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_coo_aos_get(const rocsparse_spmat_descr descr,
+                                       int64_t*                    rows,
+                                       int64_t*                    cols,
+                                       int64_t*                    nnz,
+                                       void**                      coo_ind,
+                                       void**                      coo_val,
+                                       rocsparse_indextype*        idx_type,
+                                       rocsparse_index_base*       idx_base,
+                                       rocsparse_datatype*         data_type)
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid size pointers
+    if(rows == nullptr || cols == nullptr || nnz == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1572,12 +2256,356 @@ rocsparse_status rocsparse_ell_get(const rocsparse_spmat_descr descr,
 }
 
 /********************************************************************************
- * \brief rocsparse_coo_set_pointers sets the sparse COO matrix data pointers.
+ * \brief rocsparse_sell_get returns the sparse SELL-C-sigma matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_sell_get(const rocsparse_spmat_descr descr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    nnz,
+                                    int64_t*                    slice_size,
+                                    int64_t*                    sigma,
+                                    void**                      sell_slice_ptr,
+                                    void**                      sell_row_perm,
+                                    void**                      sell_col_ind,
+                                    void**                      sell_val,
+                                    rocsparse_indextype*        idx_type,
+                                    rocsparse_index_base*       idx_base,
+                                    rocsparse_datatype*         data_type)
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid size pointers
+    if(rows == nullptr || cols == nullptr || nnz == nullptr || slice_size == nullptr
+       || sigma == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid data pointers
+    if(sell_slice_ptr == nullptr || sell_row_perm == nullptr || sell_col_ind == nullptr
+       || sell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid property pointers
+    if(idx_type == nullptr || idx_base == nullptr || data_type == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *rows       = descr->rows;
+    *cols       = descr->cols;
+    *nnz        = descr->nnz;
+    *slice_size = descr->slice_size;
+    *sigma      = descr->sigma;
+
+    *sell_slice_ptr = descr->row_data;
+    *sell_row_perm  = descr->ind_data;
+    *sell_col_ind   = descr->col_data;
+    *sell_val       = descr->val_data;
+
+    *idx_type  = descr->row_type;
+    *idx_base  = descr->idx_base;
+    *data_type = descr->data_type;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_bsr_get returns the sparse BSR matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_bsr_get(const rocsparse_spmat_descr descr,
+                                   int64_t*                    mb,
+                                   int64_t*                    nb,
+                                   int64_t*                    nnzb,
+                                   rocsparse_direction*        block_dir,
+                                   int64_t*                    row_block_dim,
+                                   int64_t*                    col_block_dim,
+                                   void**                      bsr_row_ptr,
+                                   void**                      bsr_col_ind,
+                                   void**                      bsr_val,
+                                   rocsparse_indextype*        row_ptr_type,
+                                   rocsparse_indextype*        col_ind_type,
+                                   rocsparse_index_base*       idx_base,
+                                   rocsparse_datatype*         data_type)
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid size pointers
+    if(mb == nullptr || nb == nullptr || nnzb == nullptr || row_block_dim == nullptr
+       || col_block_dim == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid data pointers
+    if(bsr_row_ptr == nullptr || bsr_col_ind == nullptr || bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid property pointers
+    if(block_dir == nullptr || row_ptr_type == nullptr || col_ind_type == nullptr
+       || idx_base == nullptr || data_type == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *mb   = descr->rows;
+    *nb   = descr->cols;
+    *nnzb = descr->nnz;
+
+    *block_dir     = descr->block_dir;
+    *row_block_dim = descr->row_block_dim;
+    *col_block_dim = descr->col_block_dim;
+
+    *bsr_row_ptr = descr->row_data;
+    *bsr_col_ind = descr->col_data;
+    *bsr_val     = descr->val_data;
+
+    *row_ptr_type = descr->row_type;
+    *col_ind_type = descr->col_type;
+    *idx_base     = descr->idx_base;
+    *data_type    = descr->data_type;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr16_get returns the sparse CSR16 matrix data, sizes and
+ * properties.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr16_get(const rocsparse_spmat_descr descr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     int64_t*                    esc_nnz,
+                                     void**                      csr16_row_ptr,
+                                     void**                      csr16_row_base,
+                                     void**                      csr16_col_off,
+                                     void**                      csr16_val,
+                                     void**                      csr16_esc_row_ind,
+                                     void**                      csr16_esc_col_ind,
+                                     void**                      csr16_esc_val,
+                                     rocsparse_indextype*        idx_type,
+                                     rocsparse_index_base*       idx_base,
+                                     rocsparse_datatype*         data_type)
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid size pointers
+    if(rows == nullptr || cols == nullptr || nnz == nullptr || esc_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid data pointers
+    if(csr16_row_ptr == nullptr || csr16_row_base == nullptr || csr16_col_off == nullptr
+       || csr16_val == nullptr || csr16_esc_row_ind == nullptr || csr16_esc_col_ind == nullptr
+       || csr16_esc_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for invalid property pointers
+    if(idx_type == nullptr || idx_base == nullptr || data_type == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *rows    = descr->rows;
+    *cols    = descr->cols;
+    *nnz     = descr->nnz;
+    *esc_nnz = descr->esc_nnz;
+
+    *csr16_row_ptr     = descr->row_data;
+    *csr16_row_base    = descr->ind_data;
+    *csr16_col_off     = descr->col_data;
+    *csr16_val         = descr->val_data;
+    *csr16_esc_row_ind = descr->esc_row_data;
+    *csr16_esc_col_ind = descr->esc_col_data;
+    *csr16_esc_val     = descr->esc_val_data;
+
+    *idx_type  = descr->row_type;
+    *idx_base  = descr->idx_base;
+    *data_type = descr->data_type;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_coo_set_pointers sets the sparse COO matrix data pointers.
+ *******************************************************************************/
+rocsparse_status rocsparse_coo_set_pointers(rocsparse_spmat_descr descr,
+                                            void*                 coo_row_ind,
+                                            void*                 coo_col_ind,
+                                            void*                 coo_val)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid pointers
+    if(coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    descr->row_data = coo_row_ind;
+    descr->col_data = coo_col_ind;
+    descr->val_data = coo_val;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_coo_aos_set_pointers sets the sparse COO (AoS) matrix data pointers.
+ *******************************************************************************/
+rocsparse_status
+    rocsparse_coo_aos_set_pointers(rocsparse_spmat_descr descr, void* coo_ind, void* coo_val)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid pointers
+    if(coo_ind == nullptr || coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    descr->ind_data = coo_ind;
+    descr->val_data = coo_val;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr_set_pointers sets the sparse CSR matrix data pointers.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_set_pointers(rocsparse_spmat_descr descr,
+                                            void*                 csr_row_ptr,
+                                            void*                 csr_col_ind,
+                                            void*                 csr_val)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid pointers
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Sparsity structure might have changed, analysis is required before calling SpMV
+    descr->analysed = false;
+
+    descr->row_data = csr_row_ptr;
+    descr->col_data = csr_col_ind;
+    descr->val_data = csr_val;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csc_set_pointers sets the sparse CSR matrix data pointers.
+ *******************************************************************************/
+rocsparse_status rocsparse_csc_set_pointers(rocsparse_spmat_descr descr,
+                                            void*                 csc_col_ptr,
+                                            void*                 csc_row_ind,
+                                            void*                 csc_val)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid pointers
+    if(csc_col_ptr == nullptr || csc_row_ind == nullptr || csc_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Sparsity structure might have changed, analysis is required before calling SpMV
+    descr->analysed = false;
+
+    descr->row_data = csc_row_ind;
+    descr->col_data = csc_col_ptr;
+    descr->val_data = csc_val;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_ell_set_pointers sets the sparse ELL matrix data pointers.
  *******************************************************************************/
-rocsparse_status rocsparse_coo_set_pointers(rocsparse_spmat_descr descr,
-                                            void*                 coo_row_ind,
-                                            void*                 coo_col_ind,
-                                            void*                 coo_val)
+rocsparse_status
+    rocsparse_ell_set_pointers(rocsparse_spmat_descr descr, void* ell_col_ind, void* ell_val)
 {
     // Check for valid descriptor
     if(descr == nullptr)
@@ -1586,7 +2614,7 @@ rocsparse_status rocsparse_coo_set_pointers(rocsparse_spmat_descr descr,
     }
 
     // Check for valid pointers
-    if(coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr)
+    if(ell_col_ind == nullptr || ell_val == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1597,18 +2625,21 @@ rocsparse_status rocsparse_coo_set_pointers(rocsparse_spmat_descr descr,
         return rocsparse_status_not_initialized;
     }
 
-    descr->row_data = coo_row_ind;
-    descr->col_data = coo_col_ind;
-    descr->val_data = coo_val;
+    descr->col_data = ell_col_ind;
+    descr->val_data = ell_val;
 
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_coo_aos_set_pointers sets the sparse COO (AoS) matrix data pointers.
+ * \brief rocsparse_sell_set_pointers sets the sparse SELL-C-sigma matrix data
+ * pointers.
  *******************************************************************************/
-rocsparse_status
-    rocsparse_coo_aos_set_pointers(rocsparse_spmat_descr descr, void* coo_ind, void* coo_val)
+rocsparse_status rocsparse_sell_set_pointers(rocsparse_spmat_descr descr,
+                                             void*                 sell_slice_ptr,
+                                             void*                 sell_row_perm,
+                                             void*                 sell_col_ind,
+                                             void*                 sell_val)
 {
     // Check for valid descriptor
     if(descr == nullptr)
@@ -1617,7 +2648,8 @@ rocsparse_status
     }
 
     // Check for valid pointers
-    if(coo_ind == nullptr || coo_val == nullptr)
+    if(sell_slice_ptr == nullptr || sell_row_perm == nullptr || sell_col_ind == nullptr
+       || sell_val == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1628,19 +2660,21 @@ rocsparse_status
         return rocsparse_status_not_initialized;
     }
 
-    descr->ind_data = coo_ind;
-    descr->val_data = coo_val;
+    descr->row_data = sell_slice_ptr;
+    descr->ind_data = sell_row_perm;
+    descr->col_data = sell_col_ind;
+    descr->val_data = sell_val;
 
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_csr_set_pointers sets the sparse CSR matrix data pointers.
+ * \brief rocsparse_bsr_set_pointers sets the sparse BSR matrix data pointers.
  *******************************************************************************/
-rocsparse_status rocsparse_csr_set_pointers(rocsparse_spmat_descr descr,
-                                            void*                 csr_row_ptr,
-                                            void*                 csr_col_ind,
-                                            void*                 csr_val)
+rocsparse_status rocsparse_bsr_set_pointers(rocsparse_spmat_descr descr,
+                                            void*                 bsr_row_ptr,
+                                            void*                 bsr_col_ind,
+                                            void*                 bsr_val)
 {
     // Check for valid descriptor
     if(descr == nullptr)
@@ -1649,7 +2683,7 @@ rocsparse_status rocsparse_csr_set_pointers(rocsparse_spmat_descr descr,
     }
 
     // Check for valid pointers
-    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr)
+    if(bsr_row_ptr == nullptr || bsr_col_ind == nullptr || bsr_val == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1660,23 +2694,24 @@ rocsparse_status rocsparse_csr_set_pointers(rocsparse_spmat_descr descr,
         return rocsparse_status_not_initialized;
     }
 
-    // Sparsity structure might have changed, analysis is required before calling SpMV
-    descr->analysed = false;
-
-    descr->row_data = csr_row_ptr;
-    descr->col_data = csr_col_ind;
-    descr->val_data = csr_val;
+    descr->row_data = bsr_row_ptr;
+    descr->col_data = bsr_col_ind;
+    descr->val_data = bsr_val;
 
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_csc_set_pointers sets the sparse CSR matrix data pointers.
+ * \brief rocsparse_csr16_set_pointers sets the sparse CSR16 matrix data pointers.
  *******************************************************************************/
-rocsparse_status rocsparse_csc_set_pointers(rocsparse_spmat_descr descr,
-                                            void*                 csc_col_ptr,
-                                            void*                 csc_row_ind,
-                                            void*                 csc_val)
+rocsparse_status rocsparse_csr16_set_pointers(rocsparse_spmat_descr descr,
+                                              void*                 csr16_row_ptr,
+                                              void*                 csr16_row_base,
+                                              void*                 csr16_col_off,
+                                              void*                 csr16_val,
+                                              void*                 csr16_esc_row_ind,
+                                              void*                 csr16_esc_col_ind,
+                                              void*                 csr16_esc_val)
 {
     // Check for valid descriptor
     if(descr == nullptr)
@@ -1685,7 +2720,8 @@ rocsparse_status rocsparse_csc_set_pointers(rocsparse_spmat_descr descr,
     }
 
     // Check for valid pointers
-    if(csc_col_ptr == nullptr || csc_row_ind == nullptr || csc_val == nullptr)
+    if(csr16_row_ptr == nullptr || csr16_row_base == nullptr || csr16_col_off == nullptr
+       || csr16_val == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1696,21 +2732,32 @@ rocsparse_status rocsparse_csc_set_pointers(rocsparse_spmat_descr descr,
         return rocsparse_status_not_initialized;
     }
 
-    // Sparsity structure might have changed, analysis is required before calling SpMV
-    descr->analysed = false;
+    // Escaped entries might be empty
+    if(descr->esc_nnz > 0
+       && (csr16_esc_row_ind == nullptr || csr16_esc_col_ind == nullptr
+           || csr16_esc_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
 
-    descr->row_data = csc_row_ind;
-    descr->col_data = csc_col_ptr;
-    descr->val_data = csc_val;
+    descr->row_data     = csr16_row_ptr;
+    descr->ind_data     = csr16_row_base;
+    descr->col_data     = csr16_col_off;
+    descr->val_data     = csr16_val;
+    descr->esc_row_data = csr16_esc_row_ind;
+    descr->esc_col_data = csr16_esc_col_ind;
+    descr->esc_val_data = csr16_esc_val;
 
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_ell_set_pointers sets the sparse ELL matrix data pointers.
+ * \brief rocsparse_csr_set_strided_batch sets the batch count and the stride
+ * between the values of consecutive CSR matrices sharing one sparsity pattern.
  *******************************************************************************/
-rocsparse_status
-    rocsparse_ell_set_pointers(rocsparse_spmat_descr descr, void* ell_col_ind, void* ell_val)
+rocsparse_status rocsparse_csr_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               values_batch_stride)
 {
     // Check for valid descriptor
     if(descr == nullptr)
@@ -1718,8 +2765,46 @@ rocsparse_status
         return rocsparse_status_invalid_pointer;
     }
 
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Batches share the row offsets and column indices of a CSR matrix
+    if(descr->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid sizes
+    if(batch_count <= 0 || values_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Values of different batches must not overlap
+    if(batch_count > 1 && values_batch_stride < descr->nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = values_batch_stride;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr_get_strided_batch returns the batch count and the stride
+ * between the values of consecutive CSR matrices.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_get_strided_batch(const rocsparse_spmat_descr descr,
+                                                 int*                        batch_count,
+                                                 int64_t*                    values_batch_stride)
+{
     // Check for valid pointers
-    if(ell_col_ind == nullptr || ell_val == nullptr)
+    if(descr == nullptr || batch_count == nullptr || values_batch_stride == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1730,8 +2815,8 @@ rocsparse_status
         return rocsparse_status_not_initialized;
     }
 
-    descr->col_data = ell_col_ind;
-    descr->val_data = ell_val;
+    *batch_count         = descr->batch_count;
+    *values_batch_stride = descr->batch_stride;
 
     return rocsparse_status_success;
 }
@@ -1859,6 +2944,135 @@ rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_spmat_get_attribute returns an attribute of the sparse matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_get_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               void*                     data,
+                                               size_t                    data_size)
+{
+    // Check for valid pointers
+    if(descr == nullptr || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check attribute
+    if(rocsparse_enum_utils::is_invalid(attribute))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    switch(attribute)
+    {
+    case rocsparse_spmat_fill_mode:
+    {
+        if(data_size != sizeof(rocsparse_fill_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_fill_mode*>(data) = rocsparse_get_mat_fill_mode(descr->descr);
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_diag_type:
+    {
+        if(data_size != sizeof(rocsparse_diag_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_diag_type*>(data) = rocsparse_get_mat_diag_type(descr->descr);
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_matrix_type:
+    {
+        if(data_size != sizeof(rocsparse_matrix_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_matrix_type*>(data) = rocsparse_get_mat_type(descr->descr);
+        return rocsparse_status_success;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+/********************************************************************************
+ * \brief rocsparse_spmat_set_attribute sets an attribute of the sparse matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_set_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               const void*               data,
+                                               size_t                    data_size)
+{
+    // Check for valid pointers
+    if(descr == nullptr || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check attribute
+    if(rocsparse_enum_utils::is_invalid(attribute))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    switch(attribute)
+    {
+    case rocsparse_spmat_fill_mode:
+    {
+        if(data_size != sizeof(rocsparse_fill_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_set_mat_fill_mode(descr->descr,
+                                           *reinterpret_cast<const rocsparse_fill_mode*>(data));
+    }
+    case rocsparse_spmat_diag_type:
+    {
+        if(data_size != sizeof(rocsparse_diag_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_set_mat_diag_type(descr->descr,
+                                           *reinterpret_cast<const rocsparse_diag_type*>(data));
+    }
+    case rocsparse_spmat_matrix_type:
+    {
+        if(data_size != sizeof(rocsparse_matrix_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        // Analysis data of a different matrix type cannot be reused
+        descr->analysed = false;
+
+        return rocsparse_set_mat_type(descr->descr,
+                                      *reinterpret_cast<const rocsparse_matrix_type*>(data));
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnvec_descr creates a descriptor holding the dense
  * vector data, size and properties. It must be called prior to all subsequent
@@ -2003,6 +3217,70 @@ rocsparse_status rocsparse_dnvec_set_values(rocsparse_dnvec_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnvec_set_strided_batch sets the batch count and the stride
+ * between consecutive dense vectors.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check for valid sizes
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Vectors of different batches must not overlap
+    if(batch_count > 1 && batch_stride < descr->size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnvec_get_strided_batch returns the batch count and the stride
+ * between consecutive dense vectors.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_get_strided_batch(const rocsparse_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = descr->batch_count;
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnmat_descr creates a descriptor holding the dense
  * matrix data, size and properties. It must be called prior to all subsequent
@@ -2160,6 +3438,72 @@ rocsparse_status rocsparse_dnmat_set_values(rocsparse_dnmat_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnmat_set_strided_batch sets the batch count and the stride
+ * between consecutive dense matrices.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnmat_set_strided_batch(rocsparse_dnmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check for valid sizes
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Matrices of different batches must not overlap
+    int64_t size
+        = descr->ld * ((descr->order == rocsparse_order_column) ? descr->cols : descr->rows);
+    if(batch_count > 1 && batch_stride < size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnmat_get_strided_batch returns the batch count and the stride
+ * between consecutive dense matrices.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnmat_get_strided_batch(const rocsparse_dnmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = descr->batch_count;
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+
 #ifdef __cplusplus
 }
 #endif
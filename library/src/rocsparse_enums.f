@@ -102,6 +102,15 @@ module rocsparse_enums
         enumerator :: rocsparse_layer_mode_none = 0
         enumerator :: rocsparse_layer_mode_log_trace = 1
         enumerator :: rocsparse_layer_mode_log_bench = 2
+        enumerator :: rocsparse_layer_mode_log_profile = 4
+        enumerator :: rocsparse_layer_mode_log_capture = 8
+    end enum
+
+!   rocsparse_handle_flags
+    enum, bind(c)
+        enumerator :: rocsparse_handle_flags_none = 0
+        enumerator :: rocsparse_handle_flags_lazy = 1
+        enumerator :: rocsparse_handle_flags_pooled = 2
     end enum
 
 !   rocsparse_status
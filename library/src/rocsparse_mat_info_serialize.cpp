@@ -0,0 +1,728 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "fingerprint.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+
+// Serialized meta data starts with the magic and the version of its layout. Version 2
+// stores the device fingerprint of the sparsity pattern, version 3 the CSC structure of
+// transposed csrmv meta data.
+static const char         rocsparse_mat_info_magic[8] = {'r', 'o', 'c', 's', 'p', 'a', 'r', 'i'};
+static constexpr uint32_t rocsparse_mat_info_version  = 3;
+
+// Number of trm info structures held by the matrix info
+#define ROCSPARSE_MAT_INFO_TRM_SLOTS 16
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_trm_slots returns the addresses of all trm info
+ * structures of a matrix info, in the order they are serialized.
+ *******************************************************************************/
+static void rocsparse_mat_info_trm_slots(rocsparse_mat_info   info,
+                                         rocsparse_trm_info** slots[ROCSPARSE_MAT_INFO_TRM_SLOTS])
+{
+    slots[0]  = &info->bsrsv_upper_info;
+    slots[1]  = &info->bsrsv_lower_info;
+    slots[2]  = &info->bsrsvt_upper_info;
+    slots[3]  = &info->bsrsvt_lower_info;
+    slots[4]  = &info->bsric0_info;
+    slots[5]  = &info->bsrilu0_info;
+    slots[6]  = &info->csric0_info;
+    slots[7]  = &info->csrilu0_info;
+    slots[8]  = &info->csrsv_upper_info;
+    slots[9]  = &info->csrsv_lower_info;
+    slots[10] = &info->csrsvt_upper_info;
+    slots[11] = &info->csrsvt_lower_info;
+    slots[12] = &info->csrsm_upper_info;
+    slots[13] = &info->csrsm_lower_info;
+    slots[14] = &info->csrsmt_upper_info;
+    slots[15] = &info->csrsmt_lower_info;
+}
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_writer appends host values and device arrays to a
+ * host buffer. If the buffer is nullptr, only the size is accumulated.
+ *******************************************************************************/
+class rocsparse_mat_info_writer
+{
+public:
+    rocsparse_mat_info_writer(char* buffer, hipStream_t stream)
+        : buffer(buffer)
+        , stream(stream)
+    {
+    }
+
+    template <typename T>
+    void value(const T& x)
+    {
+        if(this->buffer != nullptr)
+        {
+            memcpy(this->buffer + this->size, &x, sizeof(T));
+        }
+
+        this->size += sizeof(T);
+    }
+
+    template <typename T>
+    hipError_t device(const T* x, size_t count)
+    {
+        hipError_t status = hipSuccess;
+
+        if(this->buffer != nullptr && count > 0)
+        {
+            status = hipMemcpyAsync(
+                this->buffer + this->size, x, sizeof(T) * count, hipMemcpyDeviceToHost, stream);
+        }
+
+        this->size += sizeof(T) * count;
+
+        return status;
+    }
+
+    size_t size = 0;
+
+private:
+    char*       buffer;
+    hipStream_t stream;
+};
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_reader reads host values and device arrays from a
+ * host buffer, checking that the buffer is not exceeded.
+ *******************************************************************************/
+class rocsparse_mat_info_reader
+{
+public:
+    rocsparse_mat_info_reader(const char*                       buffer,
+                              size_t                            buffer_size,
+                              const rocsparse_device_allocator& allocator,
+                              hipStream_t                       stream)
+        : buffer(buffer)
+        , buffer_size(buffer_size)
+        , allocator(allocator)
+        , stream(stream)
+    {
+    }
+
+    template <typename T>
+    rocsparse_status value(T& x)
+    {
+        if(this->pos + sizeof(T) > this->buffer_size)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        memcpy(&x, this->buffer + this->pos, sizeof(T));
+        this->pos += sizeof(T);
+
+        return rocsparse_status_success;
+    }
+
+    template <typename T>
+    rocsparse_status device(T** x, size_t count)
+    {
+        if(this->pos + sizeof(T) * count > this->buffer_size)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        if(count > 0)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(allocator.allocate((void**)x, sizeof(T) * count, stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                *x, this->buffer + this->pos, sizeof(T) * count, hipMemcpyHostToDevice, stream));
+        }
+
+        this->pos += sizeof(T) * count;
+
+        return rocsparse_status_success;
+    }
+
+private:
+    const char*                buffer;
+    size_t                     buffer_size;
+    size_t                     pos = 0;
+    rocsparse_device_allocator allocator;
+    hipStream_t                stream;
+};
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_write writes the meta data of info, see
+ * rocsparse_mat_info_serialize() for the arguments.
+ *******************************************************************************/
+static rocsparse_status rocsparse_mat_info_write(rocsparse_handle           handle,
+                                                 rocsparse_int              m,
+                                                 rocsparse_int              n,
+                                                 rocsparse_int              nnz,
+                                                 rocsparse_index_base       base,
+                                                 uint64_t                   fingerprint,
+                                                 const rocsparse_mat_info   info,
+                                                 rocsparse_mat_info_writer& writer)
+{
+    // Header
+    for(char c : rocsparse_mat_info_magic)
+    {
+        writer.value(c);
+    }
+
+    writer.value(rocsparse_mat_info_version);
+    writer.value(static_cast<uint32_t>(sizeof(rocsparse_int)));
+    writer.value(fingerprint);
+    writer.value(static_cast<int64_t>(m));
+    writer.value(static_cast<int64_t>(n));
+    writer.value(static_cast<int64_t>(nnz));
+    writer.value(static_cast<int32_t>(base));
+
+    // Zero pivot
+    writer.value(static_cast<int32_t>(info->zero_pivot != nullptr));
+    if(info->zero_pivot != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(writer.device(info->zero_pivot, 1));
+    }
+
+    // csrmv meta data
+    const rocsparse_csrmv_info csrmv = info->csrmv_info;
+
+    writer.value(static_cast<int32_t>(csrmv != nullptr));
+    if(csrmv != nullptr)
+    {
+        writer.value(static_cast<int32_t>(csrmv->trans));
+        writer.value(static_cast<uint64_t>(csrmv->size));
+        RETURN_IF_HIP_ERROR(
+            writer.device(static_cast<rocsparse_int*>(csrmv->row_blocks), csrmv->size));
+        RETURN_IF_HIP_ERROR(writer.device(csrmv->wg_flags, csrmv->size));
+        RETURN_IF_HIP_ERROR(writer.device(static_cast<rocsparse_int*>(csrmv->wg_ids), csrmv->size));
+
+        // Transposed operations use the CSC structure instead of row blocks
+        if(csrmv->trans != rocsparse_operation_none)
+        {
+            RETURN_IF_HIP_ERROR(
+                writer.device(static_cast<rocsparse_int*>(csrmv->csc_col_ptr), n + 1));
+            RETURN_IF_HIP_ERROR(
+                writer.device(static_cast<rocsparse_int*>(csrmv->csc_row_ind), nnz));
+            RETURN_IF_HIP_ERROR(writer.device(static_cast<rocsparse_int*>(csrmv->csc_perm), nnz));
+        }
+    }
+
+    // trm meta data, shared structures are written once
+    rocsparse_trm_info* slots[ROCSPARSE_MAT_INFO_TRM_SLOTS];
+    rocsparse_mat_info_trm_slots(info, slots);
+
+    std::vector<rocsparse_trm_info> trms;
+    int32_t                         ids[ROCSPARSE_MAT_INFO_TRM_SLOTS];
+
+    for(int i = 0; i < ROCSPARSE_MAT_INFO_TRM_SLOTS; ++i)
+    {
+        rocsparse_trm_info trm = *slots[i];
+
+        ids[i] = -1;
+
+        if(trm == nullptr)
+        {
+            continue;
+        }
+
+        ids[i] = std::find(trms.begin(), trms.end(), trm) - trms.begin();
+
+        if(ids[i] == static_cast<int32_t>(trms.size()))
+        {
+            trms.push_back(trm);
+        }
+    }
+
+    writer.value(static_cast<int32_t>(trms.size()));
+    for(rocsparse_trm_info trm : trms)
+    {
+        bool transposed = (trm->trmt_perm != nullptr);
+
+        writer.value(trm->max_nnz);
+        writer.value(trm->m);
+        writer.value(trm->nnz);
+        writer.value(static_cast<int32_t>(transposed));
+
+        RETURN_IF_HIP_ERROR(writer.device(trm->row_map, trm->m));
+        RETURN_IF_HIP_ERROR(writer.device(trm->trm_diag_ind, trm->m));
+
+        if(transposed)
+        {
+            RETURN_IF_HIP_ERROR(writer.device(trm->trmt_perm, trm->nnz));
+            RETURN_IF_HIP_ERROR(writer.device(trm->trmt_row_ptr, trm->m + 1));
+            RETURN_IF_HIP_ERROR(writer.device(trm->trmt_col_ind, trm->nnz));
+        }
+    }
+
+    for(int i = 0; i < ROCSPARSE_MAT_INFO_TRM_SLOTS; ++i)
+    {
+        writer.value(ids[i]);
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_read reads meta data into csrmv and trms, see
+ * rocsparse_mat_info_deserialize() for the arguments. The structures are owned by
+ * the caller, also on failure.
+ *******************************************************************************/
+static rocsparse_status rocsparse_mat_info_read(rocsparse_handle                 handle,
+                                                rocsparse_int                    m,
+                                                rocsparse_int                    n,
+                                                rocsparse_int                    nnz,
+                                                const rocsparse_mat_descr        descr,
+                                                const rocsparse_int*             csr_row_ptr,
+                                                const rocsparse_int*             csr_col_ind,
+                                                rocsparse_mat_info_reader&       reader,
+                                                rocsparse_int**                  zero_pivot,
+                                                rocsparse_csrmv_info*            csrmv,
+                                                std::vector<rocsparse_trm_info>& trms,
+                                                int32_t*                         ids)
+{
+    // Header
+    char     magic[sizeof(rocsparse_mat_info_magic)];
+    uint32_t version;
+    uint32_t index_size;
+
+    for(char& c : magic)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(c));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(version));
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(index_size));
+
+    if(memcmp(magic, rocsparse_mat_info_magic, sizeof(magic)) != 0
+       || version != rocsparse_mat_info_version || index_size != sizeof(rocsparse_int))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    uint64_t fingerprint;
+    int64_t  info_m;
+    int64_t  info_n;
+    int64_t  info_nnz;
+    int32_t  info_base;
+
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(fingerprint));
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(info_m));
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(info_n));
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(info_nnz));
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(info_base));
+
+    // Validate the meta data against the matrix
+    if(info_m != m || info_n != n || info_nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(info_base != descr->base)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    uint64_t matrix_fingerprint;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_fingerprint(
+        handle, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, &matrix_fingerprint));
+
+    if(matrix_fingerprint != fingerprint)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Zero pivot
+    int32_t has_zero_pivot;
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(has_zero_pivot));
+    if(has_zero_pivot)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(reader.device(zero_pivot, 1));
+    }
+
+    // csrmv meta data
+    int32_t has_csrmv;
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(has_csrmv));
+    if(has_csrmv)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(csrmv));
+        (*csrmv)->allocator = handle->allocator;
+
+        int32_t  trans;
+        uint64_t size;
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(trans));
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(size));
+
+        (*csrmv)->size = size;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            reader.device(reinterpret_cast<rocsparse_int**>(&(*csrmv)->row_blocks), size));
+        RETURN_IF_ROCSPARSE_ERROR(reader.device(&(*csrmv)->wg_flags, size));
+        RETURN_IF_ROCSPARSE_ERROR(
+            reader.device(reinterpret_cast<rocsparse_int**>(&(*csrmv)->wg_ids), size));
+
+        if(trans != rocsparse_operation_none)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                reader.device(reinterpret_cast<rocsparse_int**>(&(*csrmv)->csc_col_ptr), n + 1));
+            RETURN_IF_ROCSPARSE_ERROR(
+                reader.device(reinterpret_cast<rocsparse_int**>(&(*csrmv)->csc_row_ind), nnz));
+            RETURN_IF_ROCSPARSE_ERROR(
+                reader.device(reinterpret_cast<rocsparse_int**>(&(*csrmv)->csc_perm), nnz));
+        }
+
+        // Bind the meta data to the given matrix
+        (*csrmv)->trans       = static_cast<rocsparse_operation>(trans);
+        (*csrmv)->m           = m;
+        (*csrmv)->n           = n;
+        (*csrmv)->nnz         = nnz;
+        (*csrmv)->descr       = descr;
+        (*csrmv)->csr_row_ptr = csr_row_ptr;
+        (*csrmv)->csr_col_ind = csr_col_ind;
+    }
+
+    // trm meta data
+    int32_t ntrms;
+    RETURN_IF_ROCSPARSE_ERROR(reader.value(ntrms));
+    for(int32_t i = 0; i < ntrms; ++i)
+    {
+        rocsparse_trm_info trm;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&trm));
+        trm->allocator = handle->allocator;
+        trms.push_back(trm);
+
+        int32_t transposed;
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(trm->max_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(trm->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(trm->nnz));
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(transposed));
+
+        if(trm->m != m || trm->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.device(&trm->row_map, trm->m));
+        RETURN_IF_ROCSPARSE_ERROR(reader.device(&trm->trm_diag_ind, trm->m));
+
+        if(transposed)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.device(&trm->trmt_perm, trm->nnz));
+            RETURN_IF_ROCSPARSE_ERROR(reader.device(&trm->trmt_row_ptr, trm->m + 1));
+            RETURN_IF_ROCSPARSE_ERROR(reader.device(&trm->trmt_col_ind, trm->nnz));
+        }
+
+        // Bind the meta data to the given matrix
+        trm->descr       = descr;
+        trm->trm_row_ptr = transposed ? trm->trmt_row_ptr : csr_row_ptr;
+        trm->trm_col_ind = transposed ? trm->trmt_col_ind : csr_col_ind;
+    }
+
+    for(int i = 0; i < ROCSPARSE_MAT_INFO_TRM_SLOTS; ++i)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(reader.value(ids[i]));
+
+        if(ids[i] < -1 || ids[i] >= ntrms)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    // Wait for device transfer to finish
+    RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         const rocsparse_mat_info  info,
+                                                         size_t*                   buffer_size,
+                                                         void*                     buffer)
+{
+    try
+    {
+        // Check for valid handle
+        if(handle == nullptr)
+        {
+            return rocsparse_status_invalid_handle;
+        }
+
+        // Check sizes
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        // Check pointer arguments
+        if(descr == nullptr || info == nullptr || buffer_size == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        if((m > 0 && csr_row_ptr == nullptr) || (nnz > 0 && csr_col_ind == nullptr))
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        // Query the buffer size
+        rocsparse_mat_info_writer counter(nullptr, handle->stream);
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_mat_info_write(handle, m, n, nnz, descr->base, 0, info, counter));
+
+        if(buffer == nullptr)
+        {
+            *buffer_size = counter.size;
+            return rocsparse_status_success;
+        }
+
+        if(*buffer_size < counter.size)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        uint64_t fingerprint;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_fingerprint(
+            handle, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, &fingerprint));
+
+        rocsparse_mat_info_writer writer(static_cast<char*>(buffer), handle->stream);
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_mat_info_write(handle, m, n, nnz, descr->base, fingerprint, info, writer));
+
+        // Wait for device transfer to finish
+        RETURN_IF_ROCSPARSE_ERROR(handle->synchronize());
+
+        *buffer_size = writer.size;
+
+        return rocsparse_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             n,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           size_t                    buffer_size,
+                                                           const void*               buffer)
+{
+    try
+    {
+        // Check for valid handle
+        if(handle == nullptr)
+        {
+            return rocsparse_status_invalid_handle;
+        }
+
+        // Check sizes
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        // Check pointer arguments
+        if(descr == nullptr || info == nullptr || buffer == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        if((m > 0 && csr_row_ptr == nullptr) || (nnz > 0 && csr_col_ind == nullptr))
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        // Meta data can only be restored into an empty info structure
+        rocsparse_trm_info* slots[ROCSPARSE_MAT_INFO_TRM_SLOTS];
+        rocsparse_mat_info_trm_slots(info, slots);
+
+        if(info->csrmv_info != nullptr || info->zero_pivot != nullptr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        for(int i = 0; i < ROCSPARSE_MAT_INFO_TRM_SLOTS; ++i)
+        {
+            if(*slots[i] != nullptr)
+            {
+                return rocsparse_status_invalid_value;
+            }
+        }
+
+        rocsparse_mat_info_reader reader(
+            static_cast<const char*>(buffer), buffer_size, handle->allocator, handle->stream);
+
+        rocsparse_int*                  zero_pivot = nullptr;
+        rocsparse_csrmv_info            csrmv      = nullptr;
+        std::vector<rocsparse_trm_info> trms;
+        int32_t                         ids[ROCSPARSE_MAT_INFO_TRM_SLOTS];
+
+        rocsparse_status status = rocsparse_mat_info_read(handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          descr,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          reader,
+                                                          &zero_pivot,
+                                                          &csrmv,
+                                                          trms,
+                                                          ids);
+
+        if(status != rocsparse_status_success)
+        {
+            // Clean up partially restored meta data
+            RETURN_IF_ROCSPARSE_ERROR(handle->allocator.deallocate(zero_pivot, handle->stream));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(csrmv));
+
+            for(rocsparse_trm_info trm : trms)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(trm));
+            }
+
+            return status;
+        }
+
+        info->zero_pivot = zero_pivot;
+        info->allocator  = handle->allocator;
+        info->csrmv_info = csrmv;
+
+        for(int i = 0; i < ROCSPARSE_MAT_INFO_TRM_SLOTS; ++i)
+        {
+            *slots[i] = (ids[i] >= 0) ? trms[ids[i]] : nullptr;
+        }
+
+        return rocsparse_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_save(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const rocsparse_mat_info  info,
+                                                    const char*               filename)
+{
+    try
+    {
+        if(filename == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        size_t buffer_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(
+            handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, &buffer_size, nullptr));
+
+        std::vector<char> buffer(buffer_size);
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(
+            handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, &buffer_size, buffer.data()));
+
+        std::ofstream ofs(filename, std::ios::binary);
+        ofs.write(buffer.data(), buffer_size);
+        ofs.close();
+
+        if(!ofs.good())
+        {
+            return rocsparse_status_internal_error;
+        }
+
+        return rocsparse_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_load(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const char*               filename)
+{
+    try
+    {
+        if(filename == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+        if(!ifs.good())
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        std::vector<char> buffer(ifs.tellg());
+        ifs.seekg(0);
+
+        if(!ifs.read(buffer.data(), buffer.size()))
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        return rocsparse_mat_info_deserialize(
+            handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info, buffer.size(), buffer.data());
+    }
+    catch(...)
+    {
+        return exception_to_rocsparse_status();
+    }
+}
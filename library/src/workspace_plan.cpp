@@ -0,0 +1,151 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "workspace_plan.h"
+
+#include <algorithm>
+#include <limits>
+
+rocsparse_status _rocsparse_workspace_plan::add_step(size_t         buffer_size,
+                                                     rocsparse_int  shared_step,
+                                                     rocsparse_int* step)
+{
+    rocsparse_int count = static_cast<rocsparse_int>(this->sizes.size());
+
+    if(shared_step < -1 || shared_step >= count)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(buffer_size > std::numeric_limits<size_t>::max() - alignment
+       || count == std::numeric_limits<rocsparse_int>::max())
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    this->sizes.push_back(buffer_size);
+    this->owners.push_back(shared_step == -1 ? count : this->owners[shared_step]);
+    this->packed = false;
+
+    *step = count;
+
+    return rocsparse_status_success;
+}
+
+void _rocsparse_workspace_plan::pack()
+{
+    // A buffer, owned by its first step and live up to its last sharing step
+    struct buffer
+    {
+        size_t        size;
+        rocsparse_int first;
+        rocsparse_int last;
+        size_t        offset;
+    };
+
+    rocsparse_int count = static_cast<rocsparse_int>(this->sizes.size());
+
+    // Index of the buffer of each owning step
+    std::vector<rocsparse_int> index(count, -1);
+    std::vector<buffer>        buffers;
+
+    for(rocsparse_int i = 0; i < count; ++i)
+    {
+        rocsparse_int owner = this->owners[i];
+        size_t        size  = (this->sizes[i] + alignment - 1) / alignment * alignment;
+
+        if(owner == i)
+        {
+            index[i] = static_cast<rocsparse_int>(buffers.size());
+            buffers.push_back({size, i, i, 0});
+        }
+        else
+        {
+            buffer& b = buffers[index[owner]];
+            b.size    = std::max(b.size, size);
+            b.last    = i;
+        }
+    }
+
+    // Place the largest buffers first, each at the lowest offset where it does not
+    // overlap any placed buffer that is live at the same time
+    std::vector<rocsparse_int> order(buffers.size());
+    for(size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = static_cast<rocsparse_int>(i);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return buffers[a].size > buffers[b].size;
+    });
+
+    std::vector<const buffer*> placed;
+    std::vector<const buffer*> live;
+
+    this->workspace_size = 0;
+
+    for(rocsparse_int i : order)
+    {
+        buffer& b = buffers[i];
+
+        if(b.size == 0)
+        {
+            continue;
+        }
+
+        live.clear();
+        for(const buffer* p : placed)
+        {
+            if(p->first <= b.last && b.first <= p->last)
+            {
+                live.push_back(p);
+            }
+        }
+
+        std::sort(live.begin(), live.end(), [](const buffer* x, const buffer* y) {
+            return x->offset < y->offset;
+        });
+
+        for(const buffer* p : live)
+        {
+            if(b.offset + b.size <= p->offset)
+            {
+                break;
+            }
+
+            b.offset = std::max(b.offset, p->offset + p->size);
+        }
+
+        placed.push_back(&b);
+        this->workspace_size = std::max(this->workspace_size, b.offset + b.size);
+    }
+
+    this->offsets.resize(count);
+    for(rocsparse_int i = 0; i < count; ++i)
+    {
+        this->offsets[i] = buffers[index[this->owners[i]]].offset;
+    }
+
+    this->packed = true;
+}
@@ -0,0 +1,9 @@
+# rocsparse-bench machine profile template for host runs
+#
+# Fill in the peak memory bandwidth and floating point throughput of the host. The
+# roofline report is computed from the flop and byte counters of flops.hpp and
+# gbyte.hpp only, thus it applies to host reference timings the same way.
+name       = host
+bandwidth  = 100
+gflops_f32 = 2000
+gflops_f64 = 1000
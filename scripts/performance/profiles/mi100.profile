@@ -0,0 +1,8 @@
+# rocsparse-bench machine profile, see rocsparse-bench --help (--machine-profile)
+#
+# Peak values are taken from the vendor specification. Measured values (e.g. from a
+# stream benchmark) usually give a more realistic roofline.
+name       = MI100
+bandwidth  = 1228.8
+gflops_f32 = 23100
+gflops_f64 = 11500